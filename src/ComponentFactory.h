@@ -7,6 +7,7 @@
 #include "interfaces/IDryer.h"
 #include "interfaces/IDisplay.h"
 #include "interfaces/IFanControl.h"
+#include "interfaces/IWeightSensor.h"
 #include "sensors/SensorManager.h"
 #include "sensors/HeaterTempSensor.h"
 #include "sensors/BoxTempHumiditySensor.h"
@@ -14,6 +15,7 @@
 #include "control/FanControl.h"
 #include "Dryer.h"
 #include "Config.h"
+#include "memory/StaticSlot.h"
 
 #ifdef UNIT_TEST
 #include "test/mocks/MockSensorManager.h"
@@ -26,6 +28,12 @@
 
 /**
  * Factory interfaces for creating production or mock components
+ *
+ * Production factories own a StaticSlot for their product: create()
+ * builds it in static storage on the first call and returns the same
+ * instance afterwards, so nothing is heap-allocated and the factory is
+ * the owner. Mock factories (test builds only) still return new objects
+ * owned by the caller.
  */
 
 // ==================== Heater Temp Sensor Factory ====================
@@ -37,9 +45,12 @@ public:
 };
 
 class ProductionHeaterTempSensorFactory : public IHeaterTempSensorFactory {
+private:
+    StaticSlot<HeaterTempSensor> slot;
+
 public:
     IHeaterTempSensor* create() override {
-        return new HeaterTempSensor(HEATER_TEMP_PIN);
+        return slot.construct(HEATER_TEMP_PIN);
     }
 };
 
@@ -61,9 +72,12 @@ public:
 };
 
 class ProductionBoxTempHumiditySensorFactory : public IBoxTempHumiditySensorFactory {
+private:
+    StaticSlot<BoxTempHumiditySensor> slot;
+
 public:
     IBoxTempHumiditySensor* create() override {
-        return new BoxTempHumiditySensor();
+        return slot.construct();
     }
 };
 
@@ -86,23 +100,15 @@ public:
 
 class ProductionSensorManagerFactory : public ISensorManagerFactory {
 private:
-    IHeaterTempSensor* heaterSensor;
-    IBoxTempHumiditySensor* boxSensor;
+    // The factory owns the sensors; SensorManager only borrows them
+    StaticSlot<HeaterTempSensor> heaterSensorSlot;
+    StaticSlot<BoxTempHumiditySensor> boxSensorSlot;
+    StaticSlot<SensorManager> slot;
 
 public:
-    ProductionSensorManagerFactory() {
-        // Create sensor instances
-        heaterSensor = new HeaterTempSensor(HEATER_TEMP_PIN);
-        boxSensor = new BoxTempHumiditySensor();
-    }
-
-    ~ProductionSensorManagerFactory() {
-        // Note: SensorManager will NOT delete these, so factory manages lifecycle
-        // In production code, consider smart pointers or different ownership model
-    }
-
     ISensorManager* create() override {
-        return new SensorManager(heaterSensor, boxSensor);
+        return slot.construct(heaterSensorSlot.construct(HEATER_TEMP_PIN),
+                              boxSensorSlot.construct());
     }
 };
 
@@ -125,9 +131,12 @@ public:
 };
 
 class ProductionDisplayFactory : public IDisplayFactory {
+private:
+    StaticSlot<OLEDDisplay> slot;
+
 public:
     IDisplay* create() override {
-        return new OLEDDisplay(128, 32, 0x3C);
+        return slot.construct(DISPLAY_WIDTH, DISPLAY_HEIGHT, 0x3C);
     }
 };
 
@@ -149,9 +158,12 @@ public:
 };
 
 class ProductionFanControlFactory : public IFanControlFactory {
+private:
+    StaticSlot<FanControl> slot;
+
 public:
     IFanControl* create() override {
-        return new FanControl(FAN_PIN);
+        return slot.construct(FAN_PIN);
     }
 };
 
@@ -175,12 +187,16 @@ public:
         ISafetyMonitor* safety,
         ISettingsStorage* storage,
         ISoundController* sound = nullptr,
-        IFanControl* fan = nullptr
+        IFanControl* fan = nullptr,
+        IWeightSensor* weight = nullptr
     ) = 0;
     virtual ~IDryerFactory() = default;
 };
 
 class ProductionDryerFactory : public IDryerFactory {
+private:
+    StaticSlot<Dryer> slot;
+
 public:
     IDryer* create(
         ISensorManager* sensors,
@@ -189,9 +205,10 @@ public:
         ISafetyMonitor* safety,
         ISettingsStorage* storage,
         ISoundController* sound = nullptr,
-        IFanControl* fan = nullptr
+        IFanControl* fan = nullptr,
+        IWeightSensor* weight = nullptr
     ) override {
-        return new Dryer(sensors, heater, pid, safety, storage, sound, fan);
+        return slot.construct(sensors, heater, pid, safety, storage, sound, fan, weight);
     }
 };
 
@@ -205,7 +222,8 @@ public:
         ISafetyMonitor* safety,
         ISettingsStorage* storage,
         ISoundController* sound = nullptr,
-        IFanControl* fan = nullptr
+        IFanControl* fan = nullptr,
+        IWeightSensor* weight = nullptr
     ) override {
         // Ignore all dependencies and return mock
         (void)sensors;
@@ -215,6 +233,7 @@ public:
         (void)storage;
         (void)sound;
         (void)fan;
+        (void)weight;
         return new MockDryer();
     }
 };
@@ -224,6 +243,9 @@ public:
 
 /**
  * Create appropriate factories based on build configuration
+ *
+ * Production factories are function-local statics (one per type, never
+ * freed); mock factories are heap objects owned by the test.
  */
 class ComponentFactoryProvider {
 public:
@@ -231,7 +253,8 @@ public:
 #ifdef UNIT_TEST
         return new MockHeaterTempSensorFactory();
 #else
-        return new ProductionHeaterTempSensorFactory();
+        static ProductionHeaterTempSensorFactory factory;
+        return &factory;
 #endif
     }
 
@@ -239,7 +262,8 @@ public:
 #ifdef UNIT_TEST
         return new MockBoxTempHumiditySensorFactory();
 #else
-        return new ProductionBoxTempHumiditySensorFactory();
+        static ProductionBoxTempHumiditySensorFactory factory;
+        return &factory;
 #endif
     }
 
@@ -247,7 +271,8 @@ public:
 #ifdef UNIT_TEST
         return new MockSensorManagerFactory();
 #else
-        return new ProductionSensorManagerFactory();
+        static ProductionSensorManagerFactory factory;
+        return &factory;
 #endif
     }
 
@@ -255,7 +280,8 @@ public:
 #ifdef UNIT_TEST
         return new MockDryerFactory();
 #else
-        return new ProductionDryerFactory();
+        static ProductionDryerFactory factory;
+        return &factory;
 #endif
     }
 
@@ -263,7 +289,8 @@ public:
 #ifdef UNIT_TEST
         return new MockDisplayFactory();
 #else
-        return new ProductionDisplayFactory();
+        static ProductionDisplayFactory factory;
+        return &factory;
 #endif
     }
 
@@ -271,7 +298,8 @@ public:
 #ifdef UNIT_TEST
         return new MockFanControlFactory();
 #else
-        return new ProductionFanControlFactory();
+        static ProductionFanControlFactory factory;
+        return &factory;
 #endif
     }
 };
@@ -61,6 +61,10 @@ constexpr uint8_t BOOT_BUTTON_PIN = 9;
 // Fan pin
 constexpr uint8_t FAN_PIN = 2;
 
+// HX711 load cell amplifier (spool scale) - bit-banged, any GPIO works
+constexpr uint8_t HX711_DOUT_PIN = 0;      // A0
+constexpr uint8_t HX711_SCK_PIN = 1;       // A1
+
 #endif // ESP32_C3_BOARD
 
 // ============================================================================
@@ -99,8 +103,20 @@ constexpr uint8_t BOOT_BUTTON_PIN = 0;     // Strapping pin
 // Fan pin
 constexpr uint8_t FAN_PIN = 2;
 
+// HX711 load cell amplifier (spool scale)
+constexpr uint8_t HX711_DOUT_PIN = 10;
+constexpr uint8_t HX711_SCK_PIN = 11;
+
+// Optional dual-core split: sensors/PID/heater/safety in a pinned task on
+// CONTROL_CORE, UI/menu/serial stay in the Arduino loop on the other core
+// #define DUAL_CORE_MODE
+
 #endif // ESP32_S3_BOARD
 
+#if defined(DUAL_CORE_MODE) && !defined(ESP32_S3_BOARD)
+    #error "DUAL_CORE_MODE needs a dual-core board (ESP32-S3)"
+#endif
+
 // ============================================================================
 // COMMON CONFIGURATION (Both boards)
 // ============================================================================
@@ -112,10 +128,148 @@ constexpr uint8_t FAN_PIN = 2;
 constexpr uint32_t HEATER_TEMP_INTERVAL = 1000;
 constexpr uint32_t BOX_DATA_INTERVAL = 2000;
 constexpr uint32_t PID_UPDATE_INTERVAL = 500;
-constexpr uint32_t STATE_SAVE_INTERVAL = 60000; // Save every 60 seconds
+constexpr uint32_t STATE_SAVE_INTERVAL = 60000; // Save every 60 seconds (one NVS runtime record; resets recover from RTC memory)
 constexpr uint32_t DISPLAY_UPDATE_INTERVAL = 200;
 constexpr uint32_t SENSOR_TIMEOUT = 5000;
 
+// ==================== Main Loop Scheduler ====================
+
+constexpr uint8_t MAX_SCHEDULER_TASKS = 8;
+constexpr uint32_t SCHEDULER_MAX_SLEEP_MS = 100;     // Longest single sleep between passes
+constexpr uint8_t SCHEDULER_HISTOGRAM_BUCKETS = 12;  // log2 ms buckets per task (0 .. 1024+)
+
+// Task periods and deadlines (release -> finished), milliseconds
+constexpr uint32_t CONTROL_TASK_PERIOD_MS = 50;      // Dryer: sensors, safety, PID, state
+constexpr uint32_t CONTROL_TASK_DEADLINE_MS = 50;
+constexpr uint32_t HEATER_TASK_PERIOD_MS = 20;       // Software PWM edge resolution
+constexpr uint32_t HEATER_TASK_DEADLINE_MS = 20;
+constexpr uint32_t UI_TASK_PERIOD_MS = 20;           // Button polling + dirty display render
+constexpr uint32_t UI_TASK_DEADLINE_MS = 60;         // Full SSD1306 frame is ~25ms over I2C
+constexpr uint32_t SERIAL_TASK_PERIOD_MS = 50;
+constexpr uint32_t SERIAL_TASK_DEADLINE_MS = 100;
+constexpr uint32_t STORAGE_TASK_PERIOD_MS = 50;      // Storage worker slice: one queued write per pass
+constexpr uint32_t STORAGE_TASK_DEADLINE_MS = 100;   // A LittleFS erase + program can take tens of ms
+
+// ==================== Dual-Core Split ====================
+
+// Only used with DUAL_CORE_MODE
+constexpr uint8_t CONTROL_CORE = 0;                // Arduino loop (UI side) runs on core 1
+constexpr uint8_t CONTROL_TASK_PRIORITY = 5;       // Above the loop task (1)
+constexpr uint32_t CONTROL_TASK_STACK = 8192;      // Bytes
+constexpr size_t DRYER_COMMAND_QUEUE_SIZE = 16;    // UI -> control, power of two
+constexpr size_t DRYER_EVENT_QUEUE_SIZE = 8;       // Control -> UI state changes, power of two
+constexpr uint32_t DRYER_PROXY_TASK_PERIOD_MS = 20;  // UI side: drain events, fire stats callbacks
+constexpr uint32_t DRYER_PROXY_TASK_DEADLINE_MS = 20;
+constexpr uint32_t DIAGNOSTICS_REPLY_TIMEOUT_MS = 250;  // Serial diagnostics wait for the control core's copy
+constexpr size_t SETTINGS_JSON_MAX_BYTES = 256;    // `settings` / `settings import` document, with terminator
+constexpr uint8_t STORAGE_TASK_PRIORITY = 1;       // Storage worker on the UI core, same as the loop task
+constexpr uint32_t STORAGE_TASK_STACK = 4096;      // Bytes
+constexpr uint32_t STORAGE_TASK_IDLE_MS = 1000;    // Wakes on a notification; this is just a backstop
+
+// ==================== Loop Profiling ====================
+
+// Cycle-counter timers around the hot paths, dumped by the `perf` serial
+// command. Off by default - PERF_SCOPE() then compiles to nothing.
+// #define PERF_PROFILING
+
+constexpr uint8_t PERF_HISTOGRAM_BUCKETS = 16;     // log2 µs buckets per zone (0 .. 32ms+)
+
+// Wire the firmware Dryer through its interfaces (as the tests do) instead
+// of the concrete classes - only for comparing code size and `perf` cycles
+// #define VIRTUAL_DRYER_WIRING
+
+// ==================== Logging ====================
+
+// Compile-time ceiling per module (0 none, 1 error, 2 warn, 3 info,
+// 4 debug). LOG_* statements above it compile to nothing, arguments
+// included; `log <module> <level>` lowers an enabled module at runtime.
+constexpr uint8_t LOG_LEVEL_PID = 2;          // 4 = per-compute PID summary line
+constexpr uint8_t LOG_LEVEL_HEATER = 2;       // 4 = every PWM edge
+constexpr uint8_t LOG_LEVEL_STORAGE = 3;
+constexpr uint8_t LOG_LEVEL_UI = 3;
+constexpr uint8_t LOG_RUNTIME_DEFAULT_LEVEL = 3;   // Runtime filter at boot (info)
+constexpr size_t LOG_LINE_BYTES = 160;             // Formatted line, stack buffer
+
+// ==================== Binary Trace ====================
+
+// TRACE() sites (src/diagnostics/TraceSites.h) store raw arguments in a
+// RAM ring; the "trace" task sends them as binary frames for
+// tools/trace_decode.py. Off at boot, `trace on` starts a session.
+constexpr size_t TRACE_RING_RECORDS = 64;          // Power of two, 24 B each
+constexpr uint8_t TRACE_MAX_ARGS = 4;
+constexpr uint32_t TRACE_TASK_PERIOD_MS = 20;
+constexpr uint32_t TRACE_TASK_DEADLINE_MS = 10;
+constexpr size_t TRACE_DRAIN_MAX_BYTES = 128;      // Per pass (115200 baud moves ~230 B per 20 ms)
+
+// ==================== Health Monitor ====================
+
+// Heap/stack sampling by the "health" scheduler task (`health` command,
+// SYSTEM_INFO menu). Sampling is a few allocator/RTOS queries.
+constexpr uint32_t HEALTH_TASK_PERIOD_MS = 5000;
+constexpr uint32_t HEALTH_TASK_DEADLINE_MS = 20;
+constexpr uint8_t MAX_HEALTH_TASKS = 3;              // Task stacks watched (loop, control core, storage)
+constexpr uint8_t HEALTH_TREND_SLOTS = 12;           // Per-slot minima, oldest dropped
+constexpr uint32_t HEALTH_TREND_SLOT_MS = 3600000;   // 1 h per slot -> 12 h trend
+
+// Warn over serial (once per episode) when...
+constexpr uint32_t HEALTH_WARN_FREE_HEAP_BYTES = 24576;     // ...free heap < 24 KB
+constexpr uint32_t HEALTH_WARN_LARGEST_BLOCK_BYTES = 8192;  // ...no free block of 8 KB left
+constexpr uint32_t HEALTH_WARN_STACK_BYTES = 512;           // ...a task never had 512 B to spare
+
+// ==================== Event Bus ====================
+
+// Callback slots are fixed at compile time (no heap after setup)
+constexpr size_t DELEGATE_STORAGE_BYTES = 4 * sizeof(void*);  // Inline capture space per callback
+constexpr uint8_t MAX_SENSOR_SUBSCRIBERS = 4;      // Per sensor event (heater, box, error, channel)
+constexpr uint8_t MAX_EMERGENCY_SUBSCRIBERS = 4;
+constexpr uint8_t MAX_STATE_SUBSCRIBERS = 4;       // Dryer state changes
+constexpr uint8_t MAX_STATS_SUBSCRIBERS = 4;       // Dryer stats (UI, history, cross-core bridge)
+constexpr uint8_t MAX_MENU_SUBSCRIBERS = 2;
+constexpr uint8_t MAX_HEALTH_SUBSCRIBERS = 2;
+
+// ==================== Sensor Registry ====================
+
+constexpr uint8_t MAX_SENSOR_CHANNELS = 12;        // Registered sensor channels (heater + box built in)
+constexpr uint8_t MAX_SENSOR_CHANNEL_VALUES = 2;   // Values per channel sample (e.g. temp + humidity)
+constexpr uint16_t SENSOR_WHEEL_SLOTS = 64;        // Timer wheel buckets
+constexpr uint32_t SENSOR_WHEEL_TICK_MS = 50;      // Timer wheel bucket width (64 x 50ms = 3.2s revolution)
+constexpr uint8_t SENSOR_HISTOGRAM_BUCKETS = 16;   // log2 buckets per acquisition histogram (0 .. 32767+)
+
+// ==================== History Buffer ====================
+
+// Tiered in-RAM ring: 1s x 10min, 10s x 2h, 60s x 12h (footprint fixed at compile time)
+constexpr uint32_t HISTORY_SAMPLE_INTERVAL_MS = 1000;
+constexpr uint16_t HISTORY_TIER0_SAMPLES = 600;    // 1s resolution, 10 minutes
+constexpr uint8_t HISTORY_TIER1_FACTOR = 10;       // Tier 0 samples per tier 1 entry
+constexpr uint16_t HISTORY_TIER1_SAMPLES = 720;    // 10s resolution, 2 hours
+constexpr uint8_t HISTORY_TIER2_FACTOR = 6;        // Tier 1 entries per tier 2 entry
+constexpr uint16_t HISTORY_TIER2_SAMPLES = 720;    // 60s resolution, 12 hours
+constexpr size_t HISTORY_MAX_BYTES = 40 * 1024;    // Upper bound checked by static_assert
+
+// ==================== Drying Estimation ====================
+
+constexpr float CHAMBER_VOLUME_M3 = 0.030;         // Free air volume of the drying box (30 L)
+constexpr float FAN_EXHAUST_FLOW_M3H = 0.6;        // Air exchanged through the vent while the fan runs
+constexpr float HEATER_RATED_POWER_W = 100.0;      // Heater draw at 100% PWM (cycle energy estimate only)
+constexpr uint32_t CYCLE_SAMPLE_INTERVAL_MS = 1000; // Cycle statistics (min/max/mean, energy) sample period
+
+// ==================== Spool Scale ====================
+
+constexpr uint32_t WEIGHT_SENSOR_INTERVAL = 1000;     // HX711 sample period (converts at 10 SPS)
+constexpr uint32_t SCALE_READY_TIMEOUT_MS = 500;      // DOUT stuck HIGH this long = not responding
+constexpr uint8_t SCALE_AVERAGE_SAMPLES = 8;          // Raw readings averaged for tare/calibration
+constexpr int SCALE_DEFAULT_CAL_MASS_G = 500;         // Menu default for the reference mass
+constexpr int SCALE_MIN_CAL_MASS_G = 50;
+constexpr int SCALE_MAX_CAL_MASS_G = 5000;
+constexpr int SCALE_CAL_MASS_STEP_G = 50;
+
+// Dryness end condition: stop once the fitted mass-loss rate flattens out
+constexpr uint32_t WEIGHT_TREND_INTERVAL_MS = 60000;  // One trend point per minute (mean of samples)
+constexpr uint8_t WEIGHT_TREND_POINTS = 30;           // Regression window (30 min)
+constexpr float DRY_END_LOSS_RATE_G_PER_H = 0.5;      // Finish below this loss rate
+constexpr uint32_t DRY_END_MIN_ELAPSED_S = 3600;      // Never finish on weight during the first hour
+constexpr float DRY_END_MIN_SPOOL_WEIGHT_G = 100.0;   // Ignore an empty holder
+
 // ==================== Temperature Limits ====================
 
 // Operational limits
@@ -235,13 +389,88 @@ constexpr float MAX_BASELINE_BOOST = 10.0;         // % - Maximum additional boo
 
 // ==================== Storage Configuration ====================
 
-#define SETTINGS_FILE "/settings.json"
-#define RUNTIME_FILE "/runtime.json"
+#define SETTINGS_FILE "/settings.bin"          // Binary SettingsRecord (SettingsRecord.h)
+#define LEGACY_SETTINGS_FILE "/settings.json"  // Pre-binary format, imported once at boot
+#define LEGACY_RUNTIME_FILE "/runtime.json"    // Pre-journal format, removed at boot
+#define LEGACY_RUNTIME_JOURNAL_FILE "/runtime.bin" // LittleFS journal before NVS, removed at boot
+#define EMERGENCY_FILE "/emergency.txt"         // Reason for the last emergency stop
+#define CYCLE_HISTORY_FILE "/cycles.bin"         // Finished-cycle ring (CycleHistoryFile.h)
+#define TELEMETRY_SEGMENT_PREFIX "/telemetry"      // Telemetry ring segments /telemetry<n>.bin (TelemetryLogFile.h)
+#define LEGACY_TELEMETRY_FILE "/telemetry.bin"    // Single-file ring, written in place; removed on the first scan
+
+// Runtime journal (RuntimeJournal.h) lives in NVS, not LittleFS: a
+// 32-byte record appends three NVS entries instead of copying a 4 KB
+// LittleFS block, so 42 saves cost one page erase.
+#define RUNTIME_NVS_NAMESPACE "dryer"
+#define RUNTIME_NVS_KEY "runtime"
+
+// Setting changes are written once they have been quiet this long, so
+// scrolling a value in the menu costs one slot write, not one per step.
+// State transitions and emergencies write at once.
+constexpr uint32_t SETTINGS_WRITE_DEBOUNCE_MS = 2000;
+
+// Write-behind worker (StorageWorker.h). Queues are power-of-two rings.
+constexpr size_t STORAGE_QUEUE_DEPTH = 8;             // Settings + runtime requests
+constexpr size_t STORAGE_EMERGENCY_QUEUE_DEPTH = 2;   // Served first
+constexpr size_t STORAGE_EMERGENCY_REASON_LENGTH = 48;
+constexpr uint32_t STORAGE_BARRIER_TIMEOUT_MS = 500;  // Longest a barrier() waits for the worker task
+
+// Cycle history: 64-byte records, so 32 cycles + the index header are 2 KB
+constexpr uint16_t CYCLE_HISTORY_RECORDS = 32;
+constexpr uint8_t CYCLE_HISTORY_SCREEN_ENTRIES = 4;   // Newest cycles on the History screen
+
+// Telemetry: every control tick, delta-encoded into self-contained
+// 256-byte pages (one flash program page per write). A 10 h cycle at
+// 1 Hz takes about 610 pages / 155 KB (test_telemetry benchmark), so the
+// ring holds the last two long cycles in full; older ones rotate out.
+constexpr uint16_t TELEMETRY_PAGE_BYTES = 256;
+constexpr uint16_t TELEMETRY_LOG_PAGES = 1280;          // 320 KB of LittleFS
+constexpr uint16_t TELEMETRY_SEGMENT_PAGES = 16;        // One 4 KB block per segment file; rotation unit
+constexpr uint32_t TELEMETRY_TIME_UNIT_MS = 100;        // Sample timestamp resolution
+
+// `telemetry <n>` streams its CSV from the serial task, a slice per pass,
+// so a 10 h recording never holds the loop (or the watchdog) for minutes
+constexpr uint16_t TELEMETRY_CSV_LINES_PER_PASS = 32;    // ~640 lines/s at SERIAL_TASK_PERIOD_MS
+constexpr uint16_t TELEMETRY_CSV_HEADERS_PER_PASS = 32;  // Page headers scanned per pass
+constexpr int TELEMETRY_CSV_LINE_BYTES = 72;             // Longest CSV line; waits for this much TX room
+
+// Flash wear accounting (FlashWear.h). LittleFS never rewrites a block in
+// place, and each block of a file points back at the ones before it: a
+// write session copies every block from the first one it writes to the
+// end of the file to freshly erased ones. Wear is counted in those
+// blocks, not bytes, so files are appended to, never written before EOF
+// once they span blocks. NVS appends entries instead and erases a page
+// once it has taken a page's worth of them.
+constexpr size_t FLASH_PAGE_BYTES = 256;                 // Program unit
+constexpr size_t FLASH_ERASE_BLOCK_BYTES = 4096;         // Erase unit (LittleFS block)
+constexpr uint32_t FLASH_ERASE_CYCLES = 100000;          // Rated erases per block
+constexpr uint8_t FLASH_COMMITS_PER_METADATA_ERASE = 16; // Commits a metadata block takes before compaction
+constexpr size_t NVS_ENTRY_BYTES = 32;                   // NVS write unit
+constexpr uint8_t NVS_ENTRIES_PER_PAGE = 126;            // Entries per 4 KB NVS page (one erase)
+constexpr uint8_t FLASH_LATENCY_BUCKETS = 20;            // log2 µs, last bucket from ~0.5 s
 
 // ==================== Safety Configuration ====================
 
 constexpr uint32_t WATCHDOG_TIMEOUT = 10000;  // 10 seconds
 
+// ==================== Power Management ====================
+
+// READY/FINISHED with no button or serial input for...
+constexpr uint32_t IDLE_DIM_AFTER_MS = 60000;       // ...1 min: dim OLED, slow sensors
+constexpr uint32_t IDLE_SLEEP_AFTER_MS = 300000;    // ...5 min: OLED off, light sleep between ticks
+constexpr uint32_t IDLE_SENSOR_INTERVAL_MS = 4000;  // Sensor interval floor while idle (< SENSOR_TIMEOUT)
+constexpr uint32_t IDLE_MIN_LIGHT_SLEEP_MS = 5;     // Shorter gaps just delay (sleep entry/exit ~1ms)
+constexpr uint32_t POWER_TASK_PERIOD_MS = 100;
+constexpr uint32_t POWER_TASK_DEADLINE_MS = 100;
+
+// ==================== Boot ====================
+
+// setup() only brings up what the first control tick needs; the display
+// is started by the first UI pass and the splash never blocks
+constexpr uint32_t BOOT_BUDGET_MS = 500;             // Reset -> first control tick (warned over serial)
+constexpr uint32_t SPLASH_DURATION_MS = 3000;        // Any button dismisses it early
+constexpr uint32_t STORAGE_ERROR_SPLASH_MS = 5000;
+
 // ==================== Display Configuration ====================
 
 constexpr uint8_t DISPLAY_WIDTH = 128;
@@ -9,26 +9,49 @@
 #include "interfaces/ISettingsStorage.h"
 #include "interfaces/ISoundController.h"
 #include "interfaces/IFanControl.h"
+#include "interfaces/IWeightSensor.h"
+#include "interfaces/IRecoveryMemory.h"
+#include "sensors/Psychrometrics.h"
+#include "sensors/WeightTrend.h"
+#include "history/CycleRecorder.h"
+#include "history/TelemetryRecorder.h"
 #include "Types.h"
 #include "Config.h"
-#include <vector>
+#include "events/EventBus.h"
+#include "events/Events.h"
+#include "diagnostics/PerfCounters.h"
+#include "diagnostics/Trace.h"
 
 /**
  * Dryer - Main System Orchestrator
  *
  * Owns all major components and coordinates their operation through
  * a state machine. Sets constraints but delegates enforcement.
+ *
+ * The control-path dependencies are template parameters. `Dryer` (the
+ * defaults) talks to them through their interfaces, which is what the
+ * tests and mocks use. The firmware instantiates BasicDryer with the
+ * concrete (final) classes instead, so sensor, safety, PID, heater and
+ * storage calls are resolved at compile time and can inline - see
+ * StaticDryer in main.cpp.
  */
-class Dryer : public IDryer {
+template <typename SensorsT = ISensorManager,
+          typename HeaterT = IHeaterControl,
+          typename PidT = IPIDController,
+          typename SafetyT = ISafetyMonitor,
+          typename StorageT = ISettingsStorage>
+class BasicDryer : public IDryer {
 private:
     // Component dependencies (injected)
-    ISensorManager* sensorManager;
-    IHeaterControl* heaterControl;
-    IPIDController* pidController;
-    ISafetyMonitor* safetyMonitor;
-    ISettingsStorage* storage;
+    SensorsT* sensorManager;
+    HeaterT* heaterControl;
+    PidT* pidController;
+    SafetyT* safetyMonitor;
+    StorageT* storage;
     ISoundController* soundController;
     IFanControl* fanControl;
+    IWeightSensor* weightSensor;
+    IRecoveryMemory* recoveryMemory;
 
     // State
     DryerState currentState;
@@ -54,30 +77,65 @@ private:
     float currentBoxHumidity;
     float currentPWM;
 
+    // Derived humidity and water-removed estimate
+    float currentAbsoluteHumidity;
+    float currentDewPoint;
+    float intakeAbsoluteHumidity;   // Box AH at cycle start, taken as the air drawn in
+    float lastChamberHumidity;      // AH at the previous box sample
+    float waterRemovedGrams;
+    uint32_t lastBoxSampleTime;
+    bool waterBaselineValid;
+
+    // Spool weight and dryness trend
+    uint8_t weightChannel;          // Registry channel carrying the scale, if any
+    float currentSpoolWeight;
+    WeightTrend weightTrend;
+
+    // Statistics of the cycle in progress, stored when it ends
+    CycleRecorder cycleRecorder;
+    bool finishedDry;               // FINISHED was reached on weight, not time
+
+    // Every PID step of the heated stretches, to the telemetry log
+    TelemetryRecorder telemetryRecorder;
+
     // Timing
     uint32_t lastStateSaveTime;
     uint32_t currentTime;  // Updated every update() call
 
     // Callbacks
-    std::vector<StateChangeCallback> stateChangeCallbacks;
-    std::vector<StatsUpdateCallback> statsUpdateCallbacks;
+    EventBus<StateChangeEvent> stateChangeBus;
+    EventBus<StatsUpdateEvent> statsUpdateBus;
 
     // State transition
     void transitionToState(DryerState newState, uint32_t currentMillis) {
         if (currentState == newState) return;
 
+        // Elapsed time is still that of the ending state here
+        bool endsCycle = newState == DryerState::FINISHED || newState == DryerState::FAILED ||
+                         newState == DryerState::READY;
+        uint32_t endElapsed = getElapsedTime(currentMillis);
+
         previousState = currentState;
         currentState = newState;
+        TRACE(DRYER_STATE, previousState, currentState);
 
         // Notify callbacks
-        for (auto& callback : stateChangeCallbacks) {
-            if (callback) {
-                callback(previousState, currentState);
-            }
-        }
+        stateChangeBus.publish(previousState, currentState);
 
         // Handle state entry actions
         onStateEnter(newState, previousState, currentMillis);
+
+        // Only with the heater already off: queueing may meet a full queue
+        if (endsCycle) {
+            recordCycle(newState, endElapsed);
+        }
+
+        // Settings changed before a transition hit flash with it, not after
+        // the debounce window
+        storage->flush();
+
+        // A reset right after the transition must not resume the old state
+        mirrorRecoveryState(currentMillis);
     }
 
     void onStateEnter(DryerState newState, DryerState prevState, uint32_t currentMillis) {
@@ -95,12 +153,32 @@ private:
                     // Fresh start
                     startTime = currentMillis;
                     totalPausedDuration = 0;
+                    waterRemovedGrams = 0;
+                    waterBaselineValid = false;
+                    finishedDry = false;
+                    cycleRecorder.begin(currentMillis, activePreset, pidProfile,
+                                        targetTemp, targetTimeSeconds, false);
+                    telemetryRecorder.begin(currentMillis);
                 } else if (prevState == DryerState::PAUSED || prevState == DryerState::POWER_RECOVERED) {
                     // Resuming from pause or power recovery
                     // In both cases, timing is already set up to preserve elapsed time
                     totalPausedDuration += (currentMillis - pausedTime);
+                    if (cycleRecorder.isActive()) {
+                        cycleRecorder.resume(currentMillis);
+                    } else {
+                        // Statistics from before the power loss are gone
+                        finishedDry = false;
+                        cycleRecorder.begin(currentMillis, activePreset, pidProfile,
+                                            targetTemp, targetTimeSeconds, true);
+                    }
+                    if (!telemetryRecorder.isRecording()) {
+                        telemetryRecorder.begin(currentMillis);
+                    }
                 }
 
+                // Weight settles differently after a pause or power loss - refit from scratch
+                weightTrend.clear();
+
                 // Save runtime state when entering RUNNING
                 saveRuntimeStateNow(currentMillis);
                 break;
@@ -108,6 +186,7 @@ private:
             case DryerState::PAUSED:
                 heaterControl->stop(currentMillis);
                 pausedTime = currentMillis;
+                telemetryRecorder.pause();
                 // Keep fan running when paused
                 if (fanControl && !fanControl->isRunning()) {
                     fanControl->start();
@@ -144,6 +223,30 @@ private:
         }
     }
 
+    // Close the cycle in progress (if any) and queue it for the history
+    void recordCycle(DryerState endState, uint32_t elapsedSeconds) {
+        telemetryRecorder.finish();
+
+        CycleEndReason reason;
+        switch (endState) {
+            case DryerState::FAILED:
+                reason = CycleEndReason::FAILED;
+                break;
+            case DryerState::FINISHED:
+                reason = finishedDry ? CycleEndReason::DRY : CycleEndReason::FINISHED;
+                break;
+            default:
+                reason = CycleEndReason::STOPPED;
+                break;
+        }
+
+        CycleRecord record;
+        if (cycleRecorder.finish(reason, elapsedSeconds, targetTimeSeconds,
+                                 waterRemovedGrams, record)) {
+            storage->saveCycleRecord(record);
+        }
+    }
+
     void saveRuntimeStateNow(uint32_t currentMillis) {
         uint32_t elapsed = getElapsedTime(currentMillis);
         storage->saveRuntimeState(
@@ -170,6 +273,14 @@ private:
             }
         );
 
+        sensorManager->registerChannelCallback(
+            [this](uint8_t channel, const SensorReading* values, uint8_t valueCount) {
+                if (channel == weightChannel && valueCount > 0) {
+                    onWeightUpdate(values[0]);
+                }
+            }
+        );
+
         sensorManager->registerSensorErrorCallback(
             [this](SensorType type, const String& error) {
                 onSensorError(type, error);
@@ -193,20 +304,83 @@ private:
             float output = pidController->compute(targetTemp, currentBoxTemp, currentHeaterTemp, timestamp);
             currentPWM = output;
             heaterControl->setPWM((uint8_t)output);
+            telemetryRecorder.record(timestamp, currentHeaterTemp, currentBoxTemp, currentBoxHumidity,
+                                     output, pidController->getLastTerms());
         }
     }
 
     void onBoxDataUpdate(float temp, float humidity, uint32_t timestamp) {
         currentBoxTemp = temp;
         currentBoxHumidity = humidity;
+
+        currentAbsoluteHumidity = Psychrometrics::absoluteHumidity(temp, humidity);
+        currentDewPoint = Psychrometrics::dewPoint(temp, humidity);
+
+        if (currentState == DryerState::RUNNING) {
+            integrateWaterRemoved(timestamp);
+        }
+        lastBoxSampleTime = timestamp;
+    }
+
+    /**
+     * Water leaving the filament = vapour carried out by the exhaust
+     * (flow x excess AH over intake air) + vapour building up in the chamber
+     */
+    void integrateWaterRemoved(uint32_t timestamp) {
+        if (!waterBaselineValid) {
+            // First sample of the cycle: box air is still at ambient humidity
+            intakeAbsoluteHumidity = currentAbsoluteHumidity;
+            lastChamberHumidity = currentAbsoluteHumidity;
+            waterBaselineValid = true;
+            return;
+        }
+
+        if (fanControl && fanControl->isRunning()) {
+            float seconds = (timestamp - lastBoxSampleTime) / 1000.0f;
+            float exhaustFlow = FAN_EXHAUST_FLOW_M3H / 3600.0f;
+            waterRemovedGrams += exhaustFlow * (currentAbsoluteHumidity - intakeAbsoluteHumidity) * seconds;
+        }
+
+        waterRemovedGrams += CHAMBER_VOLUME_M3 * (currentAbsoluteHumidity - lastChamberHumidity);
+        lastChamberHumidity = currentAbsoluteHumidity;
+    }
+
+    void onWeightUpdate(const SensorReading& reading) {
+        if (!reading.isValid || !weightSensor || !weightSensor->isCalibrated()) {
+            return;
+        }
+
+        currentSpoolWeight = reading.value;
+        if (currentState == DryerState::RUNNING) {
+            weightTrend.addSample(reading.value, reading.timestamp);
+        }
+    }
+
+    /**
+     * Dry once the fitted mass-loss rate has flattened out, rather than
+     * waiting for the preset time. Needs a calibrated scale with a spool
+     * on it, the first hour behind us (the spool is still warming up) and
+     * a full regression window.
+     */
+    bool isDryByWeight(uint32_t elapsedSeconds) const {
+        if (!weightSensor || !weightSensor->isCalibrated() || !weightSensor->isValid()) {
+            return false;
+        }
+        if (elapsedSeconds < DRY_END_MIN_ELAPSED_S || currentSpoolWeight < DRY_END_MIN_SPOOL_WEIGHT_G) {
+            return false;
+        }
+        return weightTrend.isReady() && weightTrend.getLossRate() < DRY_END_LOSS_RATE_G_PER_H;
     }
 
     void onSensorError(SensorType type, const String& error) {
         // Sensor errors are handled by SafetyMonitor
-        // This is just for logging/display purposes
+        // Here they are only counted against the cycle
+        cycleRecorder.noteFault();
     }
 
     void onEmergencyStop(const String& reason) {
+        cycleRecorder.noteFault(reason.c_str());
+
         // Emergency uses currentTime since it's triggered during update loop
         transitionToState(DryerState::FAILED, currentTime);
         storage->saveEmergencyState(reason);
@@ -259,13 +433,41 @@ private:
         }
     }
 
+    /**
+     * Every tick: what recovery would need, into reset-surviving memory.
+     * Not while POWER_RECOVERED - the recovered snapshot stays on offer
+     * until the user resumes or stops.
+     */
+    void mirrorRecoveryState(uint32_t currentMillis) {
+        if (!recoveryMemory || currentState == DryerState::POWER_RECOVERED) return;
+
+        RecoverySnapshot snapshot;
+        snapshot.state = currentState;
+        snapshot.preset = activePreset;
+        snapshot.elapsed = getElapsedTime(currentMillis);
+        snapshot.targetTemp = targetTemp;
+        snapshot.targetTime = targetTimeSeconds;
+        snapshot.pid = pidController->getRecoveryState();
+        recoveryMemory->store(snapshot);
+    }
+
+    // The runtime journal's snapshot (no PID state: flash never had it)
+    bool loadFlashSnapshot(RecoverySnapshot& out) {
+        if (!storage->hasValidRuntimeState()) {
+            return false;
+        }
+        out.state = storage->getRuntimeState();
+        out.preset = storage->getRuntimePreset();
+        out.elapsed = storage->getRuntimeElapsed();
+        out.targetTemp = storage->getRuntimeTargetTemp();
+        out.targetTime = storage->getRuntimeTargetTime();
+        out.pid = PIDRecoveryState();
+        return true;
+    }
+
     void notifyStatsUpdate(uint32_t currentMillis) {
         CurrentStats stats = getCurrentStats(currentMillis);
-        for (auto& callback : statsUpdateCallbacks) {
-            if (callback) {
-                callback(stats);
-            }
-        }
+        statsUpdateBus.publish(stats);
     }
 
     /**
@@ -302,17 +504,28 @@ private:
         stats.pidProfile = pidProfile;
         stats.maxOvershoot = maxAllowedTemp - targetTemp;
         stats.targetTime = targetTimeSeconds;
+        stats.absoluteHumidity = currentAbsoluteHumidity;
+        stats.dewPoint = currentDewPoint;
+        stats.waterRemoved = waterRemovedGrams > 0 ? waterRemovedGrams : 0;
+        stats.spoolWeight = currentSpoolWeight;
+        stats.massLossRate = weightTrend.isReady() ? weightTrend.getLossRate() : 0;
+        stats.heaterTempValid = sensorManager->isHeaterTempValid();
+        stats.boxDataValid = sensorManager->isBoxDataValid();
+        stats.scaleCalibrated = weightSensor && weightSensor->isCalibrated();
+        stats.scaleValid = weightSensor && weightSensor->isValid();
         return stats;
     }
 
 public:
-    Dryer(ISensorManager* sensors,
-          IHeaterControl* heater,
-          IPIDController* pid,
-          ISafetyMonitor* safety,
-          ISettingsStorage* store,
-          ISoundController* sound = nullptr,
-          IFanControl* fan = nullptr)
+    BasicDryer(SensorsT* sensors,
+               HeaterT* heater,
+               PidT* pid,
+               SafetyT* safety,
+               StorageT* store,
+               ISoundController* sound = nullptr,
+               IFanControl* fan = nullptr,
+               IWeightSensor* weight = nullptr,
+               IRecoveryMemory* recovery = nullptr)
         : sensorManager(sensors),
           heaterControl(heater),
           pidController(pid),
@@ -320,6 +533,8 @@ public:
           storage(store),
           soundController(sound),
           fanControl(fan),
+          weightSensor(weight),
+          recoveryMemory(recovery),
           currentState(DryerState::READY),
           previousState(DryerState::READY),
           activePreset(PresetType::PLA),
@@ -335,6 +550,17 @@ public:
           currentBoxTemp(0),
           currentBoxHumidity(0),
           currentPWM(0),
+          currentAbsoluteHumidity(0),
+          currentDewPoint(0),
+          intakeAbsoluteHumidity(0),
+          lastChamberHumidity(0),
+          waterRemovedGrams(0),
+          lastBoxSampleTime(0),
+          waterBaselineValid(false),
+          weightChannel(INVALID_SENSOR_CHANNEL),
+          currentSpoolWeight(0),
+          finishedDry(false),
+          telemetryRecorder(store),
           lastStateSaveTime(0),
           currentTime(0) {
 
@@ -356,16 +582,22 @@ public:
             soundController->begin();
         }
 
-        // Setup callbacks
+        // Setup callbacks (the scale channel is registered before begin())
+        weightChannel = sensorManager->findChannel(SensorType::SPOOL_WEIGHT);
         setupCallbacks();
 
-        // Try to recover from power loss
-        if (storage->hasValidRuntimeState()) {
-            // Load runtime state from storage
-            DryerState savedState = storage->getRuntimeState();
+        if (weightSensor) {
+            weightSensor->setCalibration(storage->loadScaleCalibration());
+        }
 
+        // Try to recover from a reset or power loss. Recovery memory
+        // (written every tick, survives resets but not a power cut) wins
+        // when intact; otherwise the flash journal (every STATE_SAVE_INTERVAL)
+        RecoverySnapshot saved;
+        bool fromMemory = recoveryMemory && recoveryMemory->load(saved);
+        if (fromMemory || loadFlashSnapshot(saved)) {
             // Business logic: only recover from RUNNING or PAUSED states
-            if (isRecoverableState(savedState)) {
+            if (isRecoverableState(saved.state)) {
                 // Load custom preset FIRST (for CUSTOM preset values)
                 customPreset = storage->loadCustomPreset();
 
@@ -379,10 +611,10 @@ public:
                 }
 
                 // Restore runtime values
-                PresetType savedPreset = storage->getRuntimePreset();
-                uint32_t savedElapsed = storage->getRuntimeElapsed();
-                float savedTargetTemp = storage->getRuntimeTargetTemp();
-                uint32_t savedTargetTime = storage->getRuntimeTargetTime();
+                PresetType savedPreset = saved.preset;
+                uint32_t savedElapsed = saved.elapsed;
+                float savedTargetTemp = saved.targetTemp;
+                uint32_t savedTargetTime = saved.targetTime;
 
                 // Set active preset
                 activePreset = savedPreset;
@@ -415,10 +647,25 @@ public:
                 pausedTime = savedElapsed * 1000;  // Convert seconds to millis
                 totalPausedDuration = 0;
 
+                if (fromMemory) {
+                    // Resume with the integrator and learned output, not from zero
+                    pidController->restoreRecoveryState(saved.pid);
+
+                    // Flash catches up, so a power cut before resuming recovers the same point
+                    storage->saveRuntimeState(saved.state, savedElapsed, savedTargetTemp,
+                                              savedTargetTime, savedPreset, currentMillis);
+                }
+
                 // Transition to POWER_RECOVERED (ensures heater and fan are OFF)
                 transitionToState(DryerState::POWER_RECOVERED, currentMillis);
             } else {
                 // State wasn't RUNNING or PAUSED, do normal startup
+                if (fromMemory && storage->hasValidRuntimeState() &&
+                    isRecoverableState(storage->getRuntimeState())) {
+                    // The cycle ended before the reset, but its tombstone
+                    // never reached flash: don't let a later power cut revive it
+                    storage->clearRuntimeState();
+                }
                 loadSavedSettings();
             }
         } else {
@@ -449,6 +696,8 @@ public:
     }
 
     void update(uint32_t currentMillis) override {
+        PERF_SCOPE(PerfZone::DRYER_UPDATE);
+
         // Store current time for use in user-triggered actions
         currentTime = currentMillis;
 
@@ -458,9 +707,13 @@ public:
 
         // State-specific updates
         if (currentState == DryerState::RUNNING) {
+            cycleRecorder.sample(currentMillis, currentBoxTemp, currentHeaterTemp,
+                                 currentBoxHumidity, currentPWM);
+
             // Check if target time reached
             uint32_t elapsed = getElapsedTime(currentMillis);
-            if (elapsed >= targetTimeSeconds) {
+            if (elapsed >= targetTimeSeconds || isDryByWeight(elapsed)) {
+                finishedDry = elapsed < targetTimeSeconds;
                 transitionToState(DryerState::FINISHED, currentMillis);
             }
 
@@ -468,6 +721,11 @@ public:
             persistState(currentMillis);
         }
 
+        // Coalesced settings writes
+        storage->update(currentMillis);
+
+        mirrorRecoveryState(currentMillis);
+
         // Notify stats update (for display)
         notifyStatsUpdate(currentMillis);
     }
@@ -613,6 +871,29 @@ public:
         return soundEnabled;
     }
 
+    bool tareScale() override {
+        // Taring mid-cycle would step the weight trend
+        if (!weightSensor || currentState == DryerState::RUNNING) {
+            return false;
+        }
+        if (!weightSensor->tare()) {
+            return false;
+        }
+        storage->saveScaleCalibration(weightSensor->getCalibration());
+        return true;
+    }
+
+    bool calibrateScale(float knownMassGrams) override {
+        if (!weightSensor || currentState == DryerState::RUNNING) {
+            return false;
+        }
+        if (!weightSensor->calibrate(knownMassGrams)) {
+            return false;
+        }
+        storage->saveScaleCalibration(weightSensor->getCalibration());
+        return true;
+    }
+
     DryerState getState() const override {
         return currentState;
     }
@@ -642,12 +923,15 @@ public:
     }
 
     void registerStateChangeCallback(StateChangeCallback callback) override {
-        stateChangeCallbacks.push_back(callback);
+        stateChangeBus.subscribe(callback);
     }
 
     void registerStatsUpdateCallback(StatsUpdateCallback callback) override {
-        statsUpdateCallbacks.push_back(callback);
+        statsUpdateBus.subscribe(callback);
     }
 };
 
+// Interface-wired Dryer (tests, mocks, factories)
+using Dryer = BasicDryer<>;
+
 #endif
\ No newline at end of file
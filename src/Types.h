@@ -1,13 +1,13 @@
 #ifndef TYPES_H
 #define TYPES_H
 
-#include <functional>
 #ifndef UNIT_TEST
     #include <Arduino.h>
 #else
     // Mock Arduino functions for native testing
     #include "../test/mocks/arduino_mock.h"
 #endif
+#include "events/Delegate.h"
 
 // ==================== Enums ====================
 
@@ -35,7 +35,8 @@ enum class PIDProfile {
 enum class SensorType {
     HEATER_TEMP,
     BOX_TEMP,
-    BOX_HUMIDITY
+    BOX_HUMIDITY,
+    SPOOL_WEIGHT
 };
 
 enum class MenuAction {
@@ -68,6 +69,10 @@ enum class MenuPath {
     SOUND,
     SOUND_ON,
     SOUND_OFF,
+    SCALE,
+    SCALE_TARE,
+    SCALE_CALIBRATE,
+    HISTORY,
     SYSTEM_INFO,
     ADJUST_TIMER,
     BACK
@@ -91,6 +96,18 @@ enum class ButtonEvent {
     LONG_PRESS
 };
 
+enum class DisplayPowerMode {
+    NORMAL,
+    DIMMED,     // Lowest contrast
+    OFF         // Panel off, RAM kept
+};
+
+enum class PowerMode {
+    ACTIVE,     // Full rate
+    DIMMED,     // Idle: OLED dimmed, sensors slowed
+    SLEEPING    // Idle: OLED off, light sleep between ticks
+};
+
 // ==================== Structs ====================
 
 struct DryingPreset {
@@ -113,6 +130,45 @@ struct SensorReading {
         : value(v), timestamp(t), isValid(valid) {}
 };
 
+struct ScaleCalibration {
+    int32_t tareOffset;    // Raw counts with an empty holder
+    float countsPerGram;   // 0 = not calibrated
+
+    ScaleCalibration() : tareOffset(0), countsPerGram(0) {}
+    ScaleCalibration(int32_t offset, float scale)
+        : tareOffset(offset), countsPerGram(scale) {}
+};
+
+// Last PID output split into its terms (telemetry / post-mortems)
+struct PIDTerms {
+    float proportional;
+    float integral;
+    float derivative;
+
+    PIDTerms() : proportional(0), integral(0), derivative(0) {}
+};
+
+// What the PID has built up over a cycle and a reset() would throw away
+struct PIDRecoveryState {
+    float integral;
+    float steadyStateOutput;    // Learned output that holds the target (0 = none)
+
+    PIDRecoveryState() : integral(0), steadyStateOutput(0) {}
+};
+
+// Everything Dryer needs to resume a cycle after a reset
+struct RecoverySnapshot {
+    DryerState state;
+    PresetType preset;
+    uint32_t elapsed;           // Seconds
+    float targetTemp;
+    uint32_t targetTime;        // Seconds
+    PIDRecoveryState pid;
+
+    RecoverySnapshot()
+        : state(DryerState::READY), preset(PresetType::PLA), elapsed(0), targetTemp(0), targetTime(0) {}
+};
+
 struct SensorReadings {
     SensorReading heaterTemp;
     SensorReading boxTemp;
@@ -135,12 +191,24 @@ struct CurrentStats {
     PIDProfile pidProfile;
     float maxOvershoot;
     uint32_t targetTime;
+    float absoluteHumidity;  // g/m³
+    float dewPoint;          // °C
+    float waterRemoved;      // g, estimated for the current cycle
+    float spoolWeight;       // g, 0 without a calibrated scale
+    float massLossRate;      // g/h, 0 until the trend window is full
+    bool heaterTempValid;    // Sensor validity, so readers on the UI core
+    bool boxDataValid;       // never touch the sensors themselves
+    bool scaleCalibrated;
+    bool scaleValid;
 
     CurrentStats() : state(DryerState::READY), currentTemp(0), targetTemp(0),
                      boxTemp(0), boxHumidity(0), elapsedTime(0),
                      remainingTime(0), pwmOutput(0), activePreset(PresetType::PLA),
                      fanRunning(false), pidProfile(PIDProfile::NORMAL),
-                     maxOvershoot(0), targetTime(0) {}
+                     maxOvershoot(0), targetTime(0), absoluteHumidity(0),
+                     dewPoint(0), waterRemoved(0), spoolWeight(0),
+                     massLossRate(0), heaterTempValid(false), boxDataValid(false),
+                     scaleCalibrated(false), scaleValid(false) {}
 };
 
 struct MenuItem {
@@ -165,22 +233,25 @@ struct MenuItem {
 
 // ==================== Callback Types ====================
 
+// Heap-free delegates (see events/Delegate.h); subscriber lists are EventBus<...Event>
+
 // Sensor callbacks
-using HeaterTempCallback = std::function<void(float temp, uint32_t timestamp)>;
-using BoxDataCallback = std::function<void(float temp, float humidity, uint32_t timestamp)>;
-using SensorErrorCallback = std::function<void(SensorType type, const String& error)>;
+using HeaterTempCallback = Delegate<void(float temp, uint32_t timestamp)>;
+using BoxDataCallback = Delegate<void(float temp, float humidity, uint32_t timestamp)>;
+using SensorErrorCallback = Delegate<void(SensorType type, const String& error)>;
+using SensorChannelCallback = Delegate<void(uint8_t channel, const SensorReading* values, uint8_t valueCount)>;
 
 // Safety callbacks
-using EmergencyStopCallback = std::function<void(const String& reason)>;
+using EmergencyStopCallback = Delegate<void(const String& reason)>;
 
 // State callbacks
-using StateChangeCallback = std::function<void(DryerState oldState, DryerState newState)>;
-using StatsUpdateCallback = std::function<void(const CurrentStats& stats)>;
+using StateChangeCallback = Delegate<void(DryerState oldState, DryerState newState)>;
+using StatsUpdateCallback = Delegate<void(const CurrentStats& stats)>;
 
 // Menu callbacks
-using MenuSelectionCallback = std::function<void(MenuPath path, int value)>;
+using MenuSelectionCallback = Delegate<void(MenuPath path, int value)>;
 
 // Button callbacks
-using ButtonCallback = std::function<void(ButtonEvent event)>;
+using ButtonCallback = Delegate<void(ButtonEvent event)>;
 
 #endif
\ No newline at end of file
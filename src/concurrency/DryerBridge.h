@@ -0,0 +1,162 @@
+#ifndef DRYER_BRIDGE_H
+#define DRYER_BRIDGE_H
+
+#include "../interfaces/IDryer.h"
+#include "../interfaces/ISensorManager.h"
+#include "../interfaces/ISettingsStorage.h"
+#include "DryerLink.h"
+
+/**
+ * DryerBridge - Control-core end of the dual-core split
+ *
+ * Owns the only calls into the real Dryer once the split is running.
+ * Each update() applies the commands queued by the UI core, runs the
+ * Dryer (sensors, safety, PID, state machine) and publishes a fresh
+ * snapshot. State changes are forwarded as events so the UI core sees
+ * every transition, not just the latest state.
+ *
+ * Sensor diagnostics and the `settings` JSON commands are answered here
+ * too, since the sensor manager's counters and the settings storage
+ * (fed by the Dryer's tick) belong to the control core.
+ *
+ * Does NOT:
+ * - Block on the UI core (a full event queue drops and counts)
+ * - Touch UI components
+ */
+class DryerBridge {
+private:
+    IDryer* dryer;
+    DryerLink* link;
+    ISensorManager* sensorManager;
+    ISettingsStorage* settingsStorage;
+
+    uint32_t statsSerial;
+    uint32_t sensorStatsSerial;
+    uint32_t settingsReplySerial;
+    uint32_t droppedEvents;
+
+    void execute(const DryerCommand& command) {
+        switch (command.type) {
+            case DryerCommandType::START:                 dryer->start(); break;
+            case DryerCommandType::PAUSE:                 dryer->pause(); break;
+            case DryerCommandType::RESUME:                dryer->resume(); break;
+            case DryerCommandType::RESET:                 dryer->reset(); break;
+            case DryerCommandType::STOP:                  dryer->stop(); break;
+            case DryerCommandType::SELECT_PRESET:         dryer->selectPreset(static_cast<PresetType>(command.intValue)); break;
+            case DryerCommandType::SET_CUSTOM_TEMP:       dryer->setCustomPresetTemp(command.floatValue); break;
+            case DryerCommandType::SET_CUSTOM_TIME:       dryer->setCustomPresetTime(static_cast<uint32_t>(command.intValue)); break;
+            case DryerCommandType::SET_CUSTOM_OVERSHOOT:  dryer->setCustomPresetOvershoot(command.floatValue); break;
+            case DryerCommandType::SAVE_CUSTOM_PRESET:    dryer->saveCustomPreset(); break;
+            case DryerCommandType::ADJUST_REMAINING_TIME: dryer->adjustRemainingTime(command.intValue); break;
+            case DryerCommandType::SET_PID_PROFILE:       dryer->setPIDProfile(static_cast<PIDProfile>(command.intValue)); break;
+            case DryerCommandType::SET_SOUND_ENABLED:     dryer->setSoundEnabled(command.intValue != 0); break;
+            case DryerCommandType::TARE_SCALE:            dryer->tareScale(); break;
+            case DryerCommandType::CALIBRATE_SCALE:       dryer->calibrateScale(command.floatValue); break;
+            case DryerCommandType::REQUEST_SENSOR_STATS:  replySensorStats(static_cast<uint8_t>(command.intValue)); break;
+            case DryerCommandType::RESET_SENSOR_STATS:    if (sensorManager) sensorManager->resetChannelStats(); break;
+            case DryerCommandType::EXPORT_SETTINGS:       exportSettings(static_cast<uint32_t>(command.intValue)); break;
+            case DryerCommandType::IMPORT_SETTINGS:       importSettings(static_cast<uint32_t>(command.intValue)); break;
+        }
+    }
+
+    void replySensorStats(uint8_t channel) {
+        SensorStatsReply reply;
+        reply.serial = ++sensorStatsSerial;
+        reply.channel = channel;
+        const SensorChannelStats* stats = sensorManager ? sensorManager->getChannelStats(channel) : nullptr;
+        if (stats) {
+            reply.found = true;
+            reply.stats = *stats;
+        }
+        link->sensorStats.write(reply);
+    }
+
+    void exportSettings(uint32_t request) {
+        SettingsJsonReply reply;
+        reply.serial = ++settingsReplySerial;
+        reply.request = request;
+        if (settingsStorage) {
+            String json = settingsStorage->exportJson();
+            if (json.length() < sizeof(reply.json)) {
+                memcpy(reply.json, json.c_str(), json.length() + 1);
+                reply.ok = true;
+            }
+        }
+        link->settingsReply.write(reply);
+    }
+
+    // A document the UI core replaced after queueing the command is not applied
+    void importSettings(uint32_t request) {
+        SettingsJsonReply reply;
+        reply.serial = ++settingsReplySerial;
+        reply.request = request;
+        SettingsJsonRequest document = link->settingsRequest.read();
+        if (settingsStorage && document.serial == request) {
+            document.json[sizeof(document.json) - 1] = '\0';
+            reply.ok = settingsStorage->importJson(String(document.json));
+        }
+        link->settingsReply.write(reply);
+    }
+
+public:
+    DryerBridge(IDryer* dryerInstance, DryerLink* sharedLink, ISensorManager* sensors = nullptr,
+                ISettingsStorage* settings = nullptr)
+        : dryer(dryerInstance),
+          link(sharedLink),
+          sensorManager(sensors),
+          settingsStorage(settings),
+          statsSerial(0),
+          sensorStatsSerial(0),
+          settingsReplySerial(0),
+          droppedEvents(0) {
+    }
+
+    /**
+     * Call after dryer->begin(), before the UI core starts reading
+     */
+    void begin() {
+        dryer->registerStateChangeCallback([this](DryerState oldState, DryerState newState) {
+            if (!link->events.push(DryerEvent(oldState, newState))) {
+                droppedEvents++;
+            }
+        });
+
+        dryer->registerStatsUpdateCallback([this](const CurrentStats& stats) {
+            statsSerial++;
+        });
+
+        publish();
+    }
+
+    void update(uint32_t currentMillis) {
+        processCommands();
+        dryer->update(currentMillis);
+        publish();
+    }
+
+    void processCommands() {
+        DryerCommand command;
+        while (link->commands.pop(command)) {
+            execute(command);
+        }
+    }
+
+    void publish() {
+        DryerSnapshot snapshot;
+        snapshot.stats = dryer->getCurrentStats();
+        snapshot.customPreset = dryer->getCustomPreset();
+        snapshot.soundEnabled = dryer->isSoundEnabled();
+        snapshot.minTemp = dryer->getMinTemp();
+        snapshot.maxTemp = dryer->getMaxTemp();
+        snapshot.maxTime = dryer->getMaxTime();
+        snapshot.maxOvershoot = dryer->getMaxOvershoot();
+        snapshot.statsSerial = statsSerial;
+        link->snapshot.write(snapshot);
+    }
+
+    uint32_t getDroppedEvents() const {
+        return droppedEvents;
+    }
+};
+
+#endif
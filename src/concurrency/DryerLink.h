@@ -0,0 +1,131 @@
+#ifndef DRYER_LINK_H
+#define DRYER_LINK_H
+
+#include "../Config.h"
+#include "../Types.h"
+#include "SpscQueue.h"
+#include "SeqLock.h"
+#include "../diagnostics/SensorChannelStats.h"
+
+// ==================== Commands (UI core -> control core) ====================
+
+enum class DryerCommandType : uint8_t {
+    START,
+    PAUSE,
+    RESUME,
+    RESET,
+    STOP,
+    SELECT_PRESET,
+    SET_CUSTOM_TEMP,
+    SET_CUSTOM_TIME,
+    SET_CUSTOM_OVERSHOOT,
+    SAVE_CUSTOM_PRESET,
+    ADJUST_REMAINING_TIME,
+    SET_PID_PROFILE,
+    SET_SOUND_ENABLED,
+    TARE_SCALE,
+    CALIBRATE_SCALE,
+    REQUEST_SENSOR_STATS,   // intValue: channel, answered in DryerLink::sensorStats
+    RESET_SENSOR_STATS,
+    EXPORT_SETTINGS,        // intValue: request serial, answered in DryerLink::settingsReply
+    IMPORT_SETTINGS         // intValue: serial of the document in DryerLink::settingsRequest
+};
+
+struct DryerCommand {
+    DryerCommandType type;
+    int32_t intValue;
+    float floatValue;
+
+    DryerCommand() : type(DryerCommandType::STOP), intValue(0), floatValue(0) {}
+    DryerCommand(DryerCommandType t, int32_t i = 0, float f = 0)
+        : type(t), intValue(i), floatValue(f) {}
+};
+
+// ==================== Events (control core -> UI core) ====================
+
+struct DryerEvent {
+    DryerState oldState;
+    DryerState newState;
+
+    DryerEvent() : oldState(DryerState::READY), newState(DryerState::READY) {}
+    DryerEvent(DryerState from, DryerState to) : oldState(from), newState(to) {}
+};
+
+// ==================== Snapshot (control core -> UI core) ====================
+
+/**
+ * Everything the UI side may ask the dryer for, published as one unit
+ */
+struct DryerSnapshot {
+    CurrentStats stats;
+    DryingPreset customPreset;
+    bool soundEnabled;
+    float minTemp;
+    float maxTemp;
+    uint32_t maxTime;
+    float maxOvershoot;
+    uint32_t statsSerial;   // Bumped each time the dryer fired its stats callbacks
+
+    DryerSnapshot() : soundEnabled(true), minTemp(0), maxTemp(0), maxTime(0),
+                      maxOvershoot(0), statsSerial(0) {}
+};
+
+// ==================== Diagnostics reply (control core -> UI core) ====================
+
+/**
+ * One channel's acquisition counters, copied on the control core on
+ * request: too large to publish every tick with the snapshot
+ */
+struct SensorStatsReply {
+    uint32_t serial;        // Bumped per reply, so the UI can tell a fresh one
+    uint8_t channel;
+    bool found;             // false: no such channel
+    SensorChannelStats stats;
+
+    SensorStatsReply() : serial(0), channel(0), found(false) {}
+};
+
+// ==================== Settings JSON (serial debug path) ====================
+
+/**
+ * A `settings import` document, written by the UI core before it queues
+ * IMPORT_SETTINGS. Settings storage belongs to the control core, so the
+ * document is applied there.
+ */
+struct SettingsJsonRequest {
+    uint32_t serial;
+    char json[SETTINGS_JSON_MAX_BYTES];
+
+    SettingsJsonRequest() : serial(0), json{} {}
+};
+
+/**
+ * Answer to EXPORT_SETTINGS (the settings as JSON) or IMPORT_SETTINGS
+ * (accepted or not)
+ */
+struct SettingsJsonReply {
+    uint32_t serial;        // Bumped per reply, so the UI can tell a fresh one
+    uint32_t request;       // Serial of the command answered
+    bool ok;                // false: rejected, too long, or no storage
+    char json[SETTINGS_JSON_MAX_BYTES];
+
+    SettingsJsonReply() : serial(0), request(0), ok(false), json{} {}
+};
+
+/**
+ * DryerLink - Shared state between DryerBridge (control core) and
+ * DryerProxy (UI core)
+ *
+ * Two SPSC queues, a seqlock'd snapshot and seqlock'd request/reply
+ * mailboxes; each has exactly one writer, so nothing here takes a lock.
+ */
+struct DryerLink {
+    SpscQueue<DryerCommand, DRYER_COMMAND_QUEUE_SIZE> commands;
+    SpscQueue<DryerEvent, DRYER_EVENT_QUEUE_SIZE> events;
+    SeqLock<DryerSnapshot> snapshot;
+    SeqLock<SensorStatsReply> sensorStats;
+    SeqLock<SettingsJsonRequest> settingsRequest;   // Written by the UI core
+    SeqLock<SettingsJsonReply> settingsReply;       // Written by the control core
+};
+
+#endif
@@ -0,0 +1,253 @@
+#ifndef DRYER_PROXY_H
+#define DRYER_PROXY_H
+
+#include "../interfaces/IDryer.h"
+#include "../events/EventBus.h"
+#include "../events/Events.h"
+#include "DryerLink.h"
+
+/**
+ * DryerProxy - UI-core stand-in for the Dryer in the dual-core split
+ *
+ * Implements IDryer so UIController, MenuController and the serial
+ * handler don't know which core the real Dryer runs on:
+ * - Commands are queued to DryerBridge and applied on its next tick
+ * - Getters read the latest seqlock'd snapshot (never block the writer)
+ * - Callbacks fire from update(), on the UI core
+ *
+ * Because commands are asynchronous, getters reflect a command only
+ * after the control core's next tick, and tareScale()/calibrateScale()
+ * report whether the request was accepted, not the measurement result.
+ */
+class DryerProxy : public IDryer {
+private:
+    DryerLink* link;
+
+    uint32_t lastStatsSerial;
+    uint32_t droppedCommands;
+    uint32_t settingsRequestSerial;
+
+    EventBus<StateChangeEvent> stateChangeBus;
+    EventBus<StatsUpdateEvent> statsUpdateBus;
+
+    bool send(const DryerCommand& command) {
+        if (!link->commands.push(command)) {
+            droppedCommands++;
+            return false;
+        }
+        return true;
+    }
+
+    DryerSnapshot snapshot() const {
+        return link->snapshot.read();
+    }
+
+public:
+    DryerProxy(DryerLink* sharedLink)
+        : link(sharedLink),
+          lastStatsSerial(0),
+          droppedCommands(0),
+          settingsRequestSerial(0) {
+    }
+
+    // ==================== Lifecycle ====================
+
+    // The real Dryer is begun on the control side
+    void begin(uint32_t currentMillis) override {
+        lastStatsSerial = snapshot().statsSerial;
+    }
+
+    /**
+     * Deliver state changes and stats updates published since the last call
+     */
+    void update(uint32_t currentMillis) override {
+        DryerEvent event;
+        while (link->events.pop(event)) {
+            stateChangeBus.publish(event.oldState, event.newState);
+        }
+
+        DryerSnapshot current = snapshot();
+        if (current.statsSerial != lastStatsSerial) {
+            lastStatsSerial = current.statsSerial;
+            statsUpdateBus.publish(current.stats);
+        }
+    }
+
+    // ==================== State Control ====================
+
+    void start() override { send(DryerCommand(DryerCommandType::START)); }
+    void pause() override { send(DryerCommand(DryerCommandType::PAUSE)); }
+    void resume() override { send(DryerCommand(DryerCommandType::RESUME)); }
+    void reset() override { send(DryerCommand(DryerCommandType::RESET)); }
+    void stop() override { send(DryerCommand(DryerCommandType::STOP)); }
+
+    // ==================== Presets ====================
+
+    void selectPreset(PresetType preset) override {
+        send(DryerCommand(DryerCommandType::SELECT_PRESET, static_cast<int32_t>(preset)));
+    }
+
+    void setCustomPresetTemp(float temp) override {
+        send(DryerCommand(DryerCommandType::SET_CUSTOM_TEMP, 0, temp));
+    }
+
+    void setCustomPresetTime(uint32_t seconds) override {
+        send(DryerCommand(DryerCommandType::SET_CUSTOM_TIME, static_cast<int32_t>(seconds)));
+    }
+
+    void setCustomPresetOvershoot(float overshoot) override {
+        send(DryerCommand(DryerCommandType::SET_CUSTOM_OVERSHOOT, 0, overshoot));
+    }
+
+    void saveCustomPreset() override {
+        send(DryerCommand(DryerCommandType::SAVE_CUSTOM_PRESET));
+    }
+
+    DryingPreset getCustomPreset() const override {
+        return snapshot().customPreset;
+    }
+
+    void adjustRemainingTime(int32_t deltaSeconds) override {
+        send(DryerCommand(DryerCommandType::ADJUST_REMAINING_TIME, deltaSeconds));
+    }
+
+    // ==================== Settings ====================
+
+    void setPIDProfile(PIDProfile profile) override {
+        send(DryerCommand(DryerCommandType::SET_PID_PROFILE, static_cast<int32_t>(profile)));
+    }
+
+    PIDProfile getPIDProfile() const override {
+        return snapshot().stats.pidProfile;
+    }
+
+    void setSoundEnabled(bool enabled) override {
+        send(DryerCommand(DryerCommandType::SET_SOUND_ENABLED, enabled ? 1 : 0));
+    }
+
+    bool isSoundEnabled() const override {
+        return snapshot().soundEnabled;
+    }
+
+    // ==================== Scale ====================
+
+    // Same precondition as Dryer; the result of the measurement itself is not reported back
+    bool tareScale() override {
+        if (getState() == DryerState::RUNNING) {
+            return false;
+        }
+        return send(DryerCommand(DryerCommandType::TARE_SCALE));
+    }
+
+    bool calibrateScale(float knownMassGrams) override {
+        if (getState() == DryerState::RUNNING) {
+            return false;
+        }
+        return send(DryerCommand(DryerCommandType::CALIBRATE_SCALE, 0, knownMassGrams));
+    }
+
+    // ==================== Getters ====================
+
+    DryerState getState() const override {
+        return snapshot().stats.state;
+    }
+
+    CurrentStats getCurrentStats() const override {
+        return snapshot().stats;
+    }
+
+    PresetType getActivePreset() const override {
+        return snapshot().stats.activePreset;
+    }
+
+    float getMinTemp() const override { return snapshot().minTemp; }
+    float getMaxTemp() const override { return snapshot().maxTemp; }
+    uint32_t getMaxTime() const override { return snapshot().maxTime; }
+    float getMaxOvershoot() const override { return snapshot().maxOvershoot; }
+
+    // ==================== Callbacks ====================
+
+    void registerStateChangeCallback(StateChangeCallback callback) override {
+        stateChangeBus.subscribe(callback);
+    }
+
+    void registerStatsUpdateCallback(StatsUpdateCallback callback) override {
+        statsUpdateBus.subscribe(callback);
+    }
+
+    // ==================== Sensor Diagnostics ====================
+
+    /**
+     * Ask the control core for one channel's counters. The reply is the
+     * first sensorStats serial above getSensorStatsSerial() taken before
+     * the request.
+     */
+    bool requestSensorStats(uint8_t channel) {
+        return send(DryerCommand(DryerCommandType::REQUEST_SENSOR_STATS, channel));
+    }
+
+    uint32_t getSensorStatsSerial() const {
+        return link->sensorStats.read().serial;
+    }
+
+    // @return false until a reply newer than previousSerial has arrived
+    bool readSensorStats(uint32_t previousSerial, SensorStatsReply& reply) const {
+        reply = link->sensorStats.read();
+        return reply.serial != previousSerial;
+    }
+
+    bool resetSensorStats() {
+        return send(DryerCommand(DryerCommandType::RESET_SENSOR_STATS));
+    }
+
+    // ==================== Settings JSON ====================
+
+    /**
+     * Ask the control core for the settings as JSON. Like the sensor
+     * stats, the reply is the first settingsReply serial above
+     * getSettingsReplySerial() taken before the request.
+     */
+    bool requestSettingsJson() {
+        return send(DryerCommand(DryerCommandType::EXPORT_SETTINGS,
+                                 static_cast<int32_t>(++settingsRequestSerial)));
+    }
+
+    /**
+     * Hand a (partial) JSON document to the control core, which applies it
+     * on its next tick
+     * @return false if it is too long or the command queue is full
+     */
+    bool importSettingsJson(const char* json) {
+        SettingsJsonRequest document;
+        size_t length = strlen(json);
+        if (length >= sizeof(document.json)) {
+            return false;
+        }
+        document.serial = ++settingsRequestSerial;
+        memcpy(document.json, json, length + 1);
+        link->settingsRequest.write(document);
+        return send(DryerCommand(DryerCommandType::IMPORT_SETTINGS,
+                                 static_cast<int32_t>(document.serial)));
+    }
+
+    // Serial of the last settings command, echoed in SettingsJsonReply::request
+    uint32_t getSettingsRequestSerial() const {
+        return settingsRequestSerial;
+    }
+
+    uint32_t getSettingsReplySerial() const {
+        return link->settingsReply.read().serial;
+    }
+
+    // @return false until a reply newer than previousSerial has arrived
+    bool readSettingsReply(uint32_t previousSerial, SettingsJsonReply& reply) const {
+        reply = link->settingsReply.read();
+        return reply.serial != previousSerial;
+    }
+
+    uint32_t getDroppedCommands() const {
+        return droppedCommands;
+    }
+};
+
+#endif
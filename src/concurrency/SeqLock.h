@@ -0,0 +1,96 @@
+#ifndef SEQ_LOCK_H
+#define SEQ_LOCK_H
+
+#include <atomic>
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+
+/**
+ * SeqLock - Single-writer snapshot that readers never block
+ *
+ * The writer bumps the sequence to odd, copies the value in, and bumps
+ * it back to even. A reader copies the value out between two sequence
+ * loads and retries if they differ or are odd, so it always returns a
+ * value from exactly one write - never half of one and half of the
+ * next. The writer never waits for readers, which is the point: the
+ * control task publishes every tick regardless of what the UI is doing.
+ *
+ * The payload is stored as relaxed atomic words rather than a plain T,
+ * so the concurrent copy is a well-defined race that the sequence check
+ * resolves, not undefined behaviour. T must be trivially copyable.
+ *
+ * Exactly one writer task; any number of reader tasks.
+ */
+template <typename T>
+class SeqLock {
+public:
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock payload must be trivially copyable");
+
+private:
+    static constexpr size_t WORDS = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    std::atomic<uint32_t> sequence;
+    std::atomic<uint32_t> words[WORDS];
+
+    void storeWords(const T& value) {
+        uint32_t buffer[WORDS] = {};
+        memcpy(buffer, &value, sizeof(T));
+        for (size_t i = 0; i < WORDS; i++) {
+            words[i].store(buffer[i], std::memory_order_relaxed);
+        }
+    }
+
+    void loadWords(T& value) const {
+        uint32_t buffer[WORDS];
+        for (size_t i = 0; i < WORDS; i++) {
+            buffer[i] = words[i].load(std::memory_order_relaxed);
+        }
+        memcpy(&value, buffer, sizeof(T));
+    }
+
+public:
+    SeqLock() : sequence(0) {
+        storeWords(T());
+    }
+
+    /**
+     * Writer side - publish a new value
+     */
+    void write(const T& value) {
+        uint32_t current = sequence.load(std::memory_order_relaxed);
+        sequence.store(current + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        storeWords(value);
+
+        sequence.store(current + 2, std::memory_order_release);
+    }
+
+    /**
+     * Reader side - copy out a consistent value (spins only while a
+     * write is in flight, which is a ~100 byte copy)
+     */
+    T read() const {
+        T value;
+        uint32_t before;
+        uint32_t after;
+        do {
+            before = sequence.load(std::memory_order_acquire);
+            loadWords(value);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = sequence.load(std::memory_order_relaxed);
+        } while ((before & 1) != 0 || before != after);
+        return value;
+    }
+
+    /**
+     * Number of completed writes (even sequence / 2) - lets a reader
+     * tell whether anything changed since it last looked
+     */
+    uint32_t getVersion() const {
+        return sequence.load(std::memory_order_acquire) / 2;
+    }
+};
+
+#endif
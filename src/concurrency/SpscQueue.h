@@ -0,0 +1,76 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <stddef.h>
+
+/**
+ * SpscQueue - Lock-free single-producer / single-consumer ring
+ *
+ * One task pushes, one other task pops; no mutex and no critical
+ * section, so neither side can be blocked by the other. The producer
+ * owns `head`, the consumer owns `tail`; each publishes its index with
+ * release ordering and reads the other's with acquire ordering, which
+ * is what makes the slot contents visible across cores.
+ *
+ * CAPACITY must be a power of two. Indices run freely and are masked on
+ * access, so all CAPACITY slots are usable. T must be copyable; storage
+ * is fixed at compile time.
+ */
+template <typename T, size_t CAPACITY>
+class SpscQueue {
+public:
+    static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+private:
+    T slots[CAPACITY];
+    std::atomic<size_t> head;   // Next slot to write (producer)
+    std::atomic<size_t> tail;   // Next slot to read (consumer)
+
+public:
+    SpscQueue() : head(0), tail(0) {
+    }
+
+    /**
+     * Producer side
+     * @return false if the queue is full (item not queued)
+     */
+    bool push(const T& item) {
+        size_t currentHead = head.load(std::memory_order_relaxed);
+        if (currentHead - tail.load(std::memory_order_acquire) >= CAPACITY) {
+            return false;
+        }
+        slots[currentHead & (CAPACITY - 1)] = item;
+        head.store(currentHead + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Consumer side
+     * @return false if the queue is empty
+     */
+    bool pop(T& item) {
+        size_t currentTail = tail.load(std::memory_order_relaxed);
+        if (currentTail == head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = slots[currentTail & (CAPACITY - 1)];
+        tail.store(currentTail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate when called from the side that doesn't own the change
+    size_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    bool isEmpty() const {
+        return size() == 0;
+    }
+
+    static constexpr size_t capacity() {
+        return CAPACITY;
+    }
+};
+
+#endif
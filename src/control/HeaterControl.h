@@ -3,6 +3,7 @@
 
 #include "../interfaces/IHeaterControl.h"
 #include "../Config.h"
+#include "../diagnostics/Log.h"
 
 /**
  * HeaterControl - Software PWM for SSR control with long period
@@ -10,7 +11,7 @@
  * Uses software timing instead of LEDC to achieve slow PWM (5s period)
  * suitable for SSR relay longevity.
  */
-class HeaterControl : public IHeaterControl {
+class HeaterControl final : public IHeaterControl {
 private:
     uint8_t pwmPin;
     bool running;
@@ -106,18 +107,9 @@ public:
             digitalWrite(pwmPin, pinState ? HIGH : LOW);
 #endif
 
-            // Debug output for state changes
-            #ifdef DEBUG_PWM
-            Serial.print("PWM: ");
-            Serial.print(pinState ? "ON" : "OFF");
-            Serial.print(" | Duty: ");
-            Serial.print(currentPWM);
-            Serial.print("/255 | Elapsed: ");
-            Serial.print(elapsed);
-            Serial.print("ms / ");
-            Serial.print(PWM_PERIOD_MS);
-            Serial.println("ms");
-            #endif
+            LOG_DEBUG(HEATER, "PWM: %s | Duty: %u/255 | Elapsed: %lums / %lums",
+                      pinState ? "ON" : "OFF", (unsigned)currentPWM,
+                      (unsigned long)elapsed, (unsigned long)PWM_PERIOD_MS);
         }
 
         lastUpdateTime = currentMillis;
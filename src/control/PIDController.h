@@ -1,8 +1,11 @@
 #ifndef PID_CONTROLLER_H
 #define PID_CONTROLLER_H
-#define DEBUG_PID
+
 #include "../interfaces/IPIDController.h"
 #include "../Config.h"
+#include "../diagnostics/PerfCounters.h"
+#include "../diagnostics/Log.h"
+#include "../diagnostics/Trace.h"
 
 /**
  * PIDController - PID algorithm with box temperature control and heater limiting
@@ -22,7 +25,7 @@
  *            maxAllowedTemp is the maximum heater temperature (e.g., targetBox + overshoot)
  *            Example: For 50°C box target with 10°C overshoot → maxAllowedTemp = 60°C
  */
-class PIDController : public IPIDController {
+class PIDController final : public IPIDController {
 private:
     // Tuning parameters
     float kp, ki, kd;
@@ -40,6 +43,7 @@ private:
     float coolingRate;  // Track cooling rate separately
     uint32_t lastTime;
     bool firstRun;
+    PIDTerms lastTerms;
 
     // Steady-state tracking
     float steadyStateOutput;        // Learned output that maintains target temperature
@@ -122,6 +126,8 @@ public:
     }
 
     float compute(float setpoint, float boxTemp, float heaterTemp, uint32_t currentMillis) override {
+        PERF_SCOPE(PerfZone::PID_COMPUTE);
+
         // First run initialization
         if (firstRun) {
             lastInput = boxTemp;
@@ -171,16 +177,7 @@ public:
                 error = error + (predictedError - error) * PREDICTIVE_GAIN;
                 coolingPredictionActive = true;
 
-                #ifdef DEBUG_PID
-                Serial.print("COOLING PREDICTION: BoxRate=");
-                Serial.print(coolingRate, 3);
-                Serial.print(" HeaterRate=");
-                Serial.print(heaterRate, 3);
-                Serial.print(" °C/s | Predicted=");
-                Serial.print(predictedTemp, 1);
-                Serial.print("°C | Enhanced error=");
-                Serial.println(error, 2);
-                #endif
+                TRACE(PID_COOLING, coolingRate, heaterRate, predictedTemp, error);
             }
         }
 
@@ -240,22 +237,12 @@ public:
             float minHeaterLimit = setpoint + MAX_BOX_TEMP_OVERSHOOT;
             dynamicHeaterLimit = minHeaterLimit + (maxAllowedTemp - minHeaterLimit) * approachRatio;
 
-            #ifdef DEBUG_PID
-            Serial.print("CONSERVATIVE MODE: BoxError=");
-            Serial.print(boxError, 2);
-            Serial.print("°C | ApproachRatio=");
-            Serial.print(approachRatio, 2);
-            Serial.print(" | HeaterLimit=");
-            Serial.println(dynamicHeaterLimit, 1);
-            #endif
+            TRACE(PID_CONSERVATIVE, boxError, approachRatio, dynamicHeaterLimit);
         } else if (boxError <= 0) {
             // Box is at or above target - minimum heater limit
             dynamicHeaterLimit = setpoint + MAX_BOX_TEMP_OVERSHOOT;
 
-            #ifdef DEBUG_PID
-            Serial.print("BOX AT TARGET: HeaterLimit=");
-            Serial.println(dynamicHeaterLimit, 1);
-            #endif
+            TRACE(PID_BOX_AT_TARGET, dynamicHeaterLimit);
         }
 
         // ==================== Coordinated Heater Limiting ====================
@@ -267,12 +254,7 @@ public:
             output = 0.0;
             integral *= 0.5; // Smooth decay instead of hard zero
 
-            #ifdef DEBUG_PID
-            Serial.print("HEATER LIMIT REACHED: Heater=");
-            Serial.print(heaterTemp, 1);
-            Serial.print("°C | Limit=");
-            Serial.println(dynamicHeaterLimit, 1);
-            #endif
+            TRACE(PID_HEATER_LIMIT, heaterTemp, dynamicHeaterLimit);
         } else if (heaterMargin < TEMP_SLOWDOWN_MARGIN && heaterMargin > 0) {
             // Approaching heater limit: scale output proportionally
             float scaleFactor = heaterMargin / TEMP_SLOWDOWN_MARGIN; // 0-1 range
@@ -288,14 +270,7 @@ public:
             // Smooth integral decay proportional to scaling
             integral *= (scaleFactor * 0.5 + 0.5);  // Decay less aggressively
 
-            #ifdef DEBUG_PID
-            Serial.print("HEATER SLOWDOWN: Margin=");
-            Serial.print(heaterMargin, 2);
-            Serial.print("°C | Scale=");
-            Serial.print(scaleFactor, 2);
-            Serial.print(" | Output reduced to ");
-            Serial.println(output, 1);
-            #endif
+            TRACE(PID_HEATER_SLOWDOWN, heaterMargin, scaleFactor, output);
         }
 
         // ==================== Minimum Heater Temperature Control ====================
@@ -315,14 +290,7 @@ public:
                 if (output < minOutput) {
                     output = constrain(minOutput, output, outMax);
 
-                    #ifdef DEBUG_PID
-                    Serial.print("MIN HEATER CONTROL: Heater=");
-                    Serial.print(heaterTemp, 1);
-                    Serial.print("°C | MinLimit=");
-                    Serial.print(minHeaterTemp, 1);
-                    Serial.print(" | Output boosted to ");
-                    Serial.println(output, 1);
-                    #endif
+                    TRACE(PID_MIN_HEATER, heaterTemp, minHeaterTemp, output);
                 }
             }
         }
@@ -340,13 +308,7 @@ public:
             output += momentumCompensation;
             output = constrain(output, outMin, outMax);
 
-            #ifdef DEBUG_PID
-            Serial.print("HEATER MOMENTUM COMP: HeaterRate=");
-            Serial.print(heaterRate, 3);
-            Serial.print("°C/s | Boost=+");
-            Serial.print(momentumCompensation, 1);
-            Serial.println("%");
-            #endif
+            TRACE(PID_MOMENTUM, heaterRate, momentumCompensation);
         }
 
         // ==================== Minimum Output Near Target ====================
@@ -361,13 +323,7 @@ public:
             output = MIN_OUTPUT_NEAR_TARGET;
             wasBaselineEnforced = true;
 
-            #ifdef DEBUG_PID
-            Serial.print("MIN OUTPUT ENFORCED: Was=");
-            Serial.print(originalOutput, 1);
-            Serial.print("% | Now=");
-            Serial.print(output, 1);
-            Serial.println("%");
-            #endif
+            TRACE(PID_MIN_OUTPUT, originalOutput, output);
         }
 
         // ==================== Baseline Insufficiency Compensation ====================
@@ -395,16 +351,7 @@ public:
                     output += baselineBoost;
                     output = constrain(output, outMin, outMax);
 
-                    #ifdef DEBUG_PID
-                    Serial.print("BASELINE INSUFFICIENT: BoxRate=");
-                    Serial.print(coolingRate, 3);
-                    Serial.print("°C/s | Duration=");
-                    Serial.print(baselineEnforcementDuration / 1000.0, 1);
-                    Serial.print("s | Boost=+");
-                    Serial.print(baselineBoost, 1);
-                    Serial.print("% | Output=");
-                    Serial.println(output, 1);
-                    #endif
+                    TRACE(PID_BASELINE_BOOST, coolingRate, baselineEnforcementDuration, baselineBoost, output);
                 }
             }
         } else {
@@ -441,15 +388,9 @@ public:
                                           + (1.0 - STEADY_STATE_OUTPUT_FILTER) * output;
                     }
 
-                    #ifdef DEBUG_PID
                     if (timeInSteadyState % 10000 < dt) {  // Log every ~10 seconds
-                        Serial.print("STEADY-STATE LEARNING: Output=");
-                        Serial.print(output, 1);
-                        Serial.print("% | Learned=");
-                        Serial.print(steadyStateOutput, 1);
-                        Serial.println("%");
+                        TRACE(PID_STEADY_LEARNING, output, steadyStateOutput);
                     }
-                    #endif
                 }
             }
 
@@ -467,12 +408,7 @@ public:
 
                     output = output * (1.0 - biasFactor) + steadyStateOutput * biasFactor;
 
-                    #ifdef DEBUG_PID
-                    Serial.print("STEADY-STATE BIAS: Factor=");
-                    Serial.print(biasFactor, 2);
-                    Serial.print(" | Output adjusted to ");
-                    Serial.println(output, 1);
-                    #endif
+                    TRACE(PID_STEADY_BIAS, biasFactor, output);
                 }
             }
         } else {
@@ -481,33 +417,15 @@ public:
         }
 
         // Update state (store temps for rate calculation)
+        lastTerms.proportional = pTerm;
+        lastTerms.integral = integral;
+        lastTerms.derivative = dTerm;
         lastInput = boxTemp;
         lastHeaterTemp = heaterTemp;
         lastTime = currentMillis;
 
-        #ifdef DEBUG_PID
-        Serial.print("PID: BoxSP=");
-        Serial.print(setpoint, 1);
-        Serial.print(" | BoxTemp=");
-        Serial.print(boxTemp, 1);
-        Serial.print(" | HeaterTemp=");
-        Serial.print(heaterTemp, 1);
-        Serial.print(" | ERR=");
-        Serial.print(error, 2);
-        Serial.print(" | P=");
-        Serial.print(pTerm, 1);
-        Serial.print(" | I=");
-        Serial.print(integral, 1);
-        Serial.print(" | D=");
-        Serial.print(dTerm, 1);
-        Serial.print(" | OUT=");
-        Serial.print(output, 1);
-        if (steadyStateOutput > 0.0) {
-            Serial.print(" | SS=");
-            Serial.print(steadyStateOutput, 1);
-        }
-        Serial.println();
-        #endif
+        LOG_DEBUG(PID, "PID: BoxSP=%.1f | BoxTemp=%.1f | HeaterTemp=%.1f | ERR=%.2f | P=%.1f | I=%.1f | D=%.1f | OUT=%.1f | SS=%.1f",
+                  setpoint, boxTemp, heaterTemp, error, pTerm, integral, dTerm, output, steadyStateOutput);
 
         return output;
     }
@@ -518,6 +436,7 @@ public:
         coolingRate = 0.0;
         lastInput = 0.0;
         firstRun = true;
+        lastTerms = PIDTerms();
         steadyStateOutput = STEADY_STATE_MIN_OUTPUT;  // Initialize to baseline (~20%)
         steadyStateStartTime = 0;
         inSteadyState = false;
@@ -527,6 +446,25 @@ public:
         baselineEnforcementStartTime = 0;
     }
 
+    PIDTerms getLastTerms() const override {
+        return lastTerms;
+    }
+
+    PIDRecoveryState getRecoveryState() const override {
+        PIDRecoveryState state;
+        state.integral = integral;
+        state.steadyStateOutput = steadyStateOutput;
+        return state;
+    }
+
+    // Timing state (rates, steady-state timer) starts over: millis() did too
+    void restoreRecoveryState(const PIDRecoveryState& state) override {
+        integral = constrain(state.integral, outMin, outMax);
+        if (state.steadyStateOutput > 0.0) {
+            steadyStateOutput = constrain(state.steadyStateOutput, outMin, outMax);
+        }
+    }
+
     // Debug getter
     float getCoolingRate() const {
         return coolingRate;
@@ -0,0 +1,141 @@
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include "../interfaces/IPowerManager.h"
+#include "../interfaces/ISleepControl.h"
+#include "../interfaces/IDryer.h"
+#include "../interfaces/ISensorManager.h"
+#include "../interfaces/IDisplay.h"
+#include "../Config.h"
+
+static_assert(IDLE_SENSOR_INTERVAL_MS + 1000 <= SENSOR_TIMEOUT,
+              "Idle sensor interval would trip the SafetyMonitor sensor timeout");
+static_assert(IDLE_DIM_AFTER_MS <= IDLE_SLEEP_AFTER_MS, "Idle stages out of order");
+
+/**
+ * PowerManager - Idle policy for READY/FINISHED
+ *
+ * While the dryer is READY or FINISHED and nobody has touched a button
+ * or sent a serial command:
+ *   after IDLE_DIM_AFTER_MS   -> DIMMED:   OLED dimmed, sensors stretched
+ *                                          to IDLE_SENSOR_INTERVAL_MS
+ *   after IDLE_SLEEP_AFTER_MS -> SLEEPING: OLED off, idle() light-sleeps
+ *                                          with the button GPIOs as wake,
+ *                                          unless a serial host is attached
+ *
+ * Any activity (button, serial command), a button wake from light sleep,
+ * or a dryer state change returns to ACTIVE at once: full sensor rate
+ * (every channel resampled on the next tick) and a normal display.
+ * Every other dryer state stays ACTIVE.
+ *
+ * Sleeping itself goes through ISleepControl so the policy is testable
+ * natively. The sensor manager is optional: without it only the display
+ * and sleep stages apply.
+ */
+class PowerManager : public IPowerManager {
+private:
+    IDryer* dryer;
+    ISensorManager* sensorManager;
+    IDisplay* display;
+    ISleepControl* sleepControl;
+
+    PowerMode mode;
+    uint32_t lastActivityTime;
+    uint32_t currentTime;
+
+    static bool isIdleState(DryerState state) {
+        return state == DryerState::READY || state == DryerState::FINISHED;
+    }
+
+    void enterMode(PowerMode newMode) {
+        if (newMode == mode) {
+            return;
+        }
+        mode = newMode;
+
+        switch (mode) {
+            case PowerMode::ACTIVE:
+                if (sensorManager) sensorManager->setMinInterval(0);
+                display->setPowerMode(DisplayPowerMode::NORMAL);
+                break;
+            case PowerMode::DIMMED:
+                if (sensorManager) sensorManager->setMinInterval(IDLE_SENSOR_INTERVAL_MS);
+                display->setPowerMode(DisplayPowerMode::DIMMED);
+                break;
+            case PowerMode::SLEEPING:
+                if (sensorManager) sensorManager->setMinInterval(IDLE_SENSOR_INTERVAL_MS);
+                display->setPowerMode(DisplayPowerMode::OFF);
+                break;
+        }
+    }
+
+public:
+    PowerManager(IDryer* dryerPtr,
+                 ISensorManager* sensors,
+                 IDisplay* displayPtr,
+                 ISleepControl* sleep)
+        : dryer(dryerPtr),
+          sensorManager(sensors),
+          display(displayPtr),
+          sleepControl(sleep),
+          mode(PowerMode::ACTIVE),
+          lastActivityTime(0),
+          currentTime(0) {
+    }
+
+    void begin(uint32_t currentMillis) override {
+        currentTime = currentMillis;
+        lastActivityTime = currentMillis;
+
+        // Start/stop/finish all count as activity
+        dryer->registerStateChangeCallback([this](DryerState oldState, DryerState newState) {
+            notifyActivity(currentTime);
+        });
+    }
+
+    void update(uint32_t currentMillis) override {
+        currentTime = currentMillis;
+
+        if (!isIdleState(dryer->getState())) {
+            // Idle timers start when the dryer comes back to READY/FINISHED
+            lastActivityTime = currentMillis;
+            enterMode(PowerMode::ACTIVE);
+            return;
+        }
+
+        uint32_t inactive = currentMillis - lastActivityTime;
+        if (inactive >= IDLE_SLEEP_AFTER_MS) {
+            enterMode(PowerMode::SLEEPING);
+        } else if (inactive >= IDLE_DIM_AFTER_MS) {
+            enterMode(PowerMode::DIMMED);
+        } else {
+            enterMode(PowerMode::ACTIVE);
+        }
+    }
+
+    void notifyActivity(uint32_t currentMillis) override {
+        currentTime = currentMillis;
+        lastActivityTime = currentMillis;
+        enterMode(PowerMode::ACTIVE);
+    }
+
+    void idle(uint32_t ms, uint32_t currentMillis) override {
+        // Light sleep would leave serial unread: with a host attached a
+        // SLEEPING dryer only waits, so a command is handled on the next pass
+        if (mode != PowerMode::SLEEPING || ms < IDLE_MIN_LIGHT_SLEEP_MS ||
+            sleepControl->serialHostConnected()) {
+            sleepControl->wait(ms);
+            return;
+        }
+
+        if (sleepControl->lightSleep(ms)) {
+            notifyActivity(currentMillis);
+        }
+    }
+
+    PowerMode getMode() const override {
+        return mode;
+    }
+};
+
+#endif
@@ -3,7 +3,8 @@
 
 #include "../interfaces/ISafetyMonitor.h"
 #include "../Config.h"
-#include <vector>
+#include "../events/EventBus.h"
+#include "../events/Events.h"
 
 /**
  * SafetyMonitor - Passive guardian monitoring temperature limits
@@ -11,7 +12,7 @@
  * Monitors sensor readings and triggers emergency stop on violations.
  * Does NOT control heater directly - just notifies via callbacks.
  */
-class SafetyMonitor : public ISafetyMonitor {
+class SafetyMonitor final : public ISafetyMonitor {
 private:
     float maxHeaterTemp;
     float maxBoxTemp;
@@ -25,7 +26,7 @@ private:
     uint32_t lastBoxTimestamp;
     bool boxValid;
 
-    std::vector<EmergencyStopCallback> emergencyCallbacks;
+    EventBus<EmergencyStopEvent> emergencyBus;
 
     bool emergencyTriggered;
 
@@ -36,11 +37,7 @@ private:
 
         emergencyTriggered = true;
 
-        for (auto& callback : emergencyCallbacks) {
-            if (callback) {
-                callback(reason);
-            }
-        }
+        emergencyBus.publish(reason);
     }
 
 public:
@@ -106,7 +103,7 @@ public:
     }
 
     void registerEmergencyStopCallback(EmergencyStopCallback callback) override {
-        emergencyCallbacks.push_back(callback);
+        emergencyBus.subscribe(callback);
     }
 };
 
@@ -0,0 +1,68 @@
+#ifndef SLEEP_CONTROL_H
+#define SLEEP_CONTROL_H
+
+#include "../interfaces/ISleepControl.h"
+#include "../Config.h"
+
+#ifndef UNIT_TEST
+    #include <Arduino.h>
+    #include <esp_sleep.h>
+    #include <driver/gpio.h>
+#endif
+
+/**
+ * SleepControl - ESP32 light sleep with button wake
+ *
+ * lightSleep() arms a timer wake for the requested time plus a
+ * low-level GPIO wake on each button (they are INPUT_PULLUP, active
+ * LOW), then enters light sleep. RAM, GPIO state and millis() survive;
+ * OneButton sees the still-held button on the next poll.
+ *
+ * Serial is not serviced while asleep, so serialHostConnected() tells
+ * PowerManager to stay awake whenever a command could arrive: on the
+ * native USB serial (C3) while a host has the port open; on a UART
+ * console, which cannot tell, always - those boards never light-sleep.
+ *
+ * With DUAL_CORE_MODE light sleep would also halt the control core, so
+ * lightSleep() falls back to a plain delay there.
+ */
+class SleepControl : public ISleepControl {
+public:
+    SleepControl() {
+#if !defined(UNIT_TEST) && !defined(DUAL_CORE_MODE)
+        const uint8_t wakePins[] = { BUTTON_SET_PIN, BUTTON_UP_PIN, BUTTON_DOWN_PIN };
+        for (uint8_t pin : wakePins) {
+            gpio_wakeup_enable(static_cast<gpio_num_t>(pin), GPIO_INTR_LOW_LEVEL);
+        }
+        esp_sleep_enable_gpio_wakeup();
+#endif
+    }
+
+    void wait(uint32_t ms) override {
+#ifndef UNIT_TEST
+        delay(ms);
+#endif
+    }
+
+    bool lightSleep(uint32_t ms) override {
+#if !defined(UNIT_TEST) && !defined(DUAL_CORE_MODE)
+        esp_sleep_enable_timer_wakeup(static_cast<uint64_t>(ms) * 1000ULL);
+        esp_light_sleep_start();
+        return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO;
+#else
+        wait(ms);
+        return false;
+#endif
+    }
+
+    bool serialHostConnected() override {
+#ifndef UNIT_TEST
+        // USB CDC: true while a host has the port open. UART: always true
+        return static_cast<bool>(Serial);
+#else
+        return false;
+#endif
+    }
+};
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef ESP_HEALTH_PROBE_H
+#define ESP_HEALTH_PROBE_H
+
+#include "../interfaces/IHealthProbe.h"
+
+#ifndef UNIT_TEST
+    #include <Arduino.h>
+    #include <esp_heap_caps.h>
+#endif
+
+/**
+ * EspHealthProbe - ESP-IDF heap_caps and FreeRTOS readings
+ *
+ * Queries the 8-bit capable heap (what new/malloc/String use). On
+ * ESP-IDF uxTaskGetStackHighWaterMark() already reports bytes.
+ */
+class EspHealthProbe : public IHealthProbe {
+public:
+    HeapSample sampleHeap() override {
+        HeapSample sample;
+#ifndef UNIT_TEST
+        sample.freeBytes = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+        sample.largestFreeBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+        sample.minEverFreeBytes = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+#endif
+        return sample;
+    }
+
+    uint32_t stackFreeBytes(void* task) override {
+#ifndef UNIT_TEST
+        return uxTaskGetStackHighWaterMark(static_cast<TaskHandle_t>(task));
+#else
+        return 0;
+#endif
+    }
+};
+
+#endif
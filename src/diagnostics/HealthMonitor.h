@@ -0,0 +1,183 @@
+#ifndef HEALTH_MONITOR_H
+#define HEALTH_MONITOR_H
+
+#include "HealthStats.h"
+#include "../interfaces/IHealthProbe.h"
+#include "../events/EventBus.h"
+#include "../events/Events.h"
+#include "../Config.h"
+
+/**
+ * HealthMonitor - Heap fragmentation and stack high-water tracking
+ *
+ * update() takes one sample through IHealthProbe; the "health" scheduler
+ * task calls it every HEALTH_TASK_PERIOD_MS. It keeps:
+ * - the latest free heap / largest free block / fragmentation
+ * - minima since boot, including the allocator's own low-water mark
+ * - per-slot minima over the last HEALTH_TREND_SLOTS x HEALTH_TREND_SLOT_MS
+ *   (the trend of a long run: a largest block that only ever shrinks)
+ * - the stack high-water mark of each watched task
+ *
+ * A warning episode starts when a value drops below its HEALTH_WARN_*
+ * threshold: warning callbacks fire once with the newly raised flags.
+ * The flag clears only after the value is back above threshold + 25%,
+ * so a value hovering at the threshold does not spam the log.
+ *
+ * Fixed-size state, no heap use of its own.
+ */
+class HealthMonitor {
+private:
+    IHealthProbe* probe;
+
+    HealthStats stats;
+    void* taskHandles[MAX_HEALTH_TASKS];
+
+    HealthTrendSlot trend[HEALTH_TREND_SLOTS];
+    uint8_t trendHead;       // Slot being filled
+    uint8_t trendCount;      // Slots holding data
+    uint32_t trendSlotStart;
+
+    EventBus<HealthWarningEvent> warningBus;
+
+    static uint8_t fragmentationOf(uint32_t freeBytes, uint32_t largestBlock) {
+        if (freeBytes == 0 || largestBlock >= freeBytes) {
+            return 0;
+        }
+        return static_cast<uint8_t>(100 - (uint64_t)largestBlock * 100 / freeBytes);
+    }
+
+    // Raised below threshold, cleared above threshold + 25%
+    static bool evaluate(bool active, uint32_t value, uint32_t threshold) {
+        if (active) {
+            return value < threshold + threshold / 4;
+        }
+        return value < threshold;
+    }
+
+    void recordTrend(uint32_t currentMillis) {
+        if (trendCount == 0) {
+            trendCount = 1;
+            trendSlotStart = currentMillis;
+            trend[trendHead].minFreeHeap = stats.freeHeap;
+            trend[trendHead].minLargestFreeBlock = stats.largestFreeBlock;
+            return;
+        }
+
+        if (currentMillis - trendSlotStart >= HEALTH_TREND_SLOT_MS) {
+            trendHead = (trendHead + 1) % HEALTH_TREND_SLOTS;
+            if (trendCount < HEALTH_TREND_SLOTS) {
+                trendCount++;
+            }
+            trendSlotStart = currentMillis;
+            trend[trendHead].minFreeHeap = stats.freeHeap;
+            trend[trendHead].minLargestFreeBlock = stats.largestFreeBlock;
+            return;
+        }
+
+        HealthTrendSlot& slot = trend[trendHead];
+        if (stats.freeHeap < slot.minFreeHeap) slot.minFreeHeap = stats.freeHeap;
+        if (stats.largestFreeBlock < slot.minLargestFreeBlock) slot.minLargestFreeBlock = stats.largestFreeBlock;
+    }
+
+    void checkThresholds() {
+        uint8_t warnings = 0;
+
+        if (evaluate(stats.warnings & HEALTH_LOW_HEAP, stats.freeHeap, HEALTH_WARN_FREE_HEAP_BYTES)) {
+            warnings |= HEALTH_LOW_HEAP;
+        }
+        if (evaluate(stats.warnings & HEALTH_FRAGMENTED, stats.largestFreeBlock, HEALTH_WARN_LARGEST_BLOCK_BYTES)) {
+            warnings |= HEALTH_FRAGMENTED;
+        }
+
+        bool stackActive = stats.warnings & HEALTH_LOW_STACK;
+        for (uint8_t i = 0; i < stats.taskCount; i++) {
+            if (evaluate(stackActive, stats.tasks[i].freeBytes, HEALTH_WARN_STACK_BYTES)) {
+                warnings |= HEALTH_LOW_STACK;
+            }
+        }
+
+        uint8_t raised = warnings & ~stats.warnings;
+        stats.warnings = warnings;
+
+        if (raised) {
+            stats.warningCount++;
+            warningBus.publish(raised, stats);
+        }
+    }
+
+public:
+    explicit HealthMonitor(IHealthProbe* healthProbe)
+        : probe(healthProbe),
+          trendHead(0),
+          trendCount(0),
+          trendSlotStart(0) {
+        for (uint8_t i = 0; i < MAX_HEALTH_TASKS; i++) {
+            taskHandles[i] = nullptr;
+        }
+    }
+
+    /**
+     * Track a task's stack; name must outlive the monitor (a literal)
+     * @return false if MAX_HEALTH_TASKS are already watched
+     */
+    bool watchTask(const char* name, void* taskHandle) {
+        if (stats.taskCount >= MAX_HEALTH_TASKS || !taskHandle) {
+            return false;
+        }
+        taskHandles[stats.taskCount] = taskHandle;
+        stats.tasks[stats.taskCount].name = name;
+        stats.tasks[stats.taskCount].freeBytes = 0;
+        stats.taskCount++;
+        return true;
+    }
+
+    void update(uint32_t currentMillis) {
+        HeapSample heap = probe->sampleHeap();
+
+        stats.freeHeap = heap.freeBytes;
+        stats.largestFreeBlock = heap.largestFreeBlock;
+        stats.minEverFreeHeap = heap.minEverFreeBytes;
+        stats.fragmentationPercent = fragmentationOf(heap.freeBytes, heap.largestFreeBlock);
+
+        if (stats.sampleCount == 0) {
+            stats.minFreeHeap = heap.freeBytes;
+            stats.minLargestFreeBlock = heap.largestFreeBlock;
+        } else {
+            if (heap.freeBytes < stats.minFreeHeap) stats.minFreeHeap = heap.freeBytes;
+            if (heap.largestFreeBlock < stats.minLargestFreeBlock) stats.minLargestFreeBlock = heap.largestFreeBlock;
+        }
+        if (stats.fragmentationPercent > stats.maxFragmentationPercent) {
+            stats.maxFragmentationPercent = stats.fragmentationPercent;
+        }
+
+        for (uint8_t i = 0; i < stats.taskCount; i++) {
+            stats.tasks[i].freeBytes = probe->stackFreeBytes(taskHandles[i]);
+        }
+
+        stats.sampleCount++;
+        recordTrend(currentMillis);
+        checkThresholds();
+    }
+
+    const HealthStats& getStats() const {
+        return stats;
+    }
+
+    uint8_t getTrendCount() const {
+        return trendCount;
+    }
+
+    // age 0 = current slot, 1 = the one before, ... (age < getTrendCount())
+    HealthTrendSlot getTrendSlot(uint8_t age) const {
+        if (age >= trendCount) {
+            return HealthTrendSlot();
+        }
+        return trend[(trendHead + HEALTH_TREND_SLOTS - age) % HEALTH_TREND_SLOTS];
+    }
+
+    void registerWarningCallback(HealthWarningCallback callback) {
+        warningBus.subscribe(callback);
+    }
+};
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef HEALTH_STATS_H
+#define HEALTH_STATS_H
+
+#include "../Config.h"
+#include "../events/Delegate.h"
+
+/**
+ * HealthStats - Heap and stack health as seen by HealthMonitor
+ *
+ * Heap figures cover the default 8-bit capable heap. Fragmentation is
+ * how much of the free heap is NOT available as one block:
+ * 100 - largestFreeBlock * 100 / freeHeap. A long run that leaks or
+ * fragments shows up as minLargestFreeBlock falling while freeHeap
+ * holds steady.
+ */
+
+// Bits in HealthStats::warnings
+enum HealthWarningFlag : uint8_t {
+    HEALTH_LOW_HEAP = 0x01,    // freeHeap below HEALTH_WARN_FREE_HEAP_BYTES
+    HEALTH_FRAGMENTED = 0x02,  // largestFreeBlock below HEALTH_WARN_LARGEST_BLOCK_BYTES
+    HEALTH_LOW_STACK = 0x04    // A watched task below HEALTH_WARN_STACK_BYTES
+};
+
+struct TaskStackStats {
+    const char* name;
+    uint32_t freeBytes;  // High-water mark: stack never touched so far
+
+    TaskStackStats() : name(""), freeBytes(0) {}
+};
+
+// Minima over one HEALTH_TREND_SLOT_MS window
+struct HealthTrendSlot {
+    uint32_t minFreeHeap;
+    uint32_t minLargestFreeBlock;
+
+    HealthTrendSlot() : minFreeHeap(0), minLargestFreeBlock(0) {}
+};
+
+struct HealthStats {
+    // Latest sample
+    uint32_t freeHeap;
+    uint32_t largestFreeBlock;
+    uint8_t fragmentationPercent;
+
+    // Minima since boot
+    uint32_t minEverFreeHeap;       // Allocator's own low-water mark (catches dips between samples)
+    uint32_t minFreeHeap;           // Lowest sampled value
+    uint32_t minLargestFreeBlock;
+    uint8_t maxFragmentationPercent;
+
+    TaskStackStats tasks[MAX_HEALTH_TASKS];
+    uint8_t taskCount;
+
+    uint8_t warnings;               // Active HealthWarningFlag bits
+    uint32_t warningCount;          // Warning episodes since boot
+    uint32_t sampleCount;
+
+    HealthStats()
+        : freeHeap(0), largestFreeBlock(0), fragmentationPercent(0),
+          minEverFreeHeap(0), minFreeHeap(0), minLargestFreeBlock(0),
+          maxFragmentationPercent(0), taskCount(0),
+          warnings(0), warningCount(0), sampleCount(0) {}
+};
+
+// Fired once when a warning episode starts (newly raised flags only)
+using HealthWarningCallback = Delegate<void(uint8_t raised, const HealthStats& stats)>;
+
+#endif
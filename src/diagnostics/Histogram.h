@@ -0,0 +1,115 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <stdint.h>
+
+/**
+ * Histogram - Fixed-bucket log2 histogram
+ *
+ * Bucket 0 counts zero values, bucket i (i >= 1) counts values in
+ * [2^(i-1), 2^i - 1]; the last bucket also absorbs everything above.
+ * Recording is a count-leading-zeros and an increment - cheap enough
+ * for hot paths. Storage is fixed at compile time, no allocation.
+ *
+ * Units are up to the caller (µs, ms, counts, ...).
+ */
+template <uint8_t BUCKETS>
+class Histogram {
+public:
+    static_assert(BUCKETS >= 2 && BUCKETS <= 33, "Histogram needs 2..33 log2 buckets");
+
+private:
+    uint32_t counts[BUCKETS];
+    uint32_t total;
+    uint32_t minValue;
+    uint32_t maxValue;
+    uint64_t sum;
+
+public:
+    Histogram() {
+        reset();
+    }
+
+    void reset() {
+        for (uint8_t i = 0; i < BUCKETS; i++) {
+            counts[i] = 0;
+        }
+        total = 0;
+        minValue = 0;
+        maxValue = 0;
+        sum = 0;
+    }
+
+    static uint8_t bucketFor(uint32_t value) {
+        if (value == 0) {
+            return 0;
+        }
+        uint8_t bucket = 32 - __builtin_clz(value);
+        return bucket < BUCKETS ? bucket : BUCKETS - 1;
+    }
+
+    /**
+     * Largest value that lands in bucket (last bucket is open-ended)
+     */
+    static uint32_t bucketUpperBound(uint8_t bucket) {
+        if (bucket == 0) {
+            return 0;
+        }
+        if (bucket >= 32) {
+            return UINT32_MAX;
+        }
+        return (1UL << bucket) - 1;
+    }
+
+    void record(uint32_t value) {
+        counts[bucketFor(value)]++;
+        if (total == 0 || value < minValue) {
+            minValue = value;
+        }
+        if (value > maxValue) {
+            maxValue = value;
+        }
+        total++;
+        sum += value;
+    }
+
+    uint32_t getCount() const { return total; }
+    uint32_t getMin() const { return minValue; }
+    uint32_t getMax() const { return maxValue; }
+    uint32_t getMean() const { return total > 0 ? static_cast<uint32_t>(sum / total) : 0; }
+    uint8_t getBucketCount() const { return BUCKETS; }
+
+    uint32_t getBucket(uint8_t bucket) const {
+        return bucket < BUCKETS ? counts[bucket] : 0;
+    }
+
+    /**
+     * Upper bound of the bucket holding the given percentile (0-100),
+     * clamped to the observed maximum
+     */
+    uint32_t getPercentile(uint8_t percent) const {
+        if (total == 0) {
+            return 0;
+        }
+
+        uint64_t rank = (static_cast<uint64_t>(total) * percent + 99) / 100;
+        if (rank == 0) {
+            rank = 1;
+        }
+
+        uint64_t seen = 0;
+        for (uint8_t i = 0; i < BUCKETS; i++) {
+            seen += counts[i];
+            if (seen >= rank) {
+                uint32_t bound = bucketUpperBound(i);
+                if (i == BUCKETS - 1 || bound > maxValue) {
+                    return maxValue;
+                }
+                return bound;
+            }
+        }
+        return maxValue;
+    }
+};
+
+#endif
@@ -0,0 +1,186 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include "../Config.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifndef UNIT_TEST
+    #include <Arduino.h>
+#endif
+
+/**
+ * Log severities, most severe first. A module logs a statement when the
+ * statement's level is <= the module's level.
+ */
+enum class LogLevel : uint8_t {
+    NONE = 0,
+    ERROR = 1,
+    WARN = 2,
+    INFO = 3,
+    DEBUG = 4
+};
+
+/**
+ * Log sources. Each has a compile-time ceiling LOG_LEVEL_<module> in
+ * Config.h and a runtime level in LogFilter.
+ */
+enum class LogModule : uint8_t {
+    PID,
+    HEATER,
+    STORAGE,
+    UI,
+    COUNT
+};
+
+inline const char* logModuleName(LogModule module) {
+    switch (module) {
+        case LogModule::PID: return "pid";
+        case LogModule::HEATER: return "heater";
+        case LogModule::STORAGE: return "storage";
+        case LogModule::UI: return "ui";
+        default: return "?";
+    }
+}
+
+// The compile-time ceiling, for reporting
+inline LogLevel logCompiledLevel(LogModule module) {
+    switch (module) {
+        case LogModule::PID: return static_cast<LogLevel>(LOG_LEVEL_PID);
+        case LogModule::HEATER: return static_cast<LogLevel>(LOG_LEVEL_HEATER);
+        case LogModule::STORAGE: return static_cast<LogLevel>(LOG_LEVEL_STORAGE);
+        case LogModule::UI: return static_cast<LogLevel>(LOG_LEVEL_UI);
+        default: return LogLevel::NONE;
+    }
+}
+
+inline const char* logLevelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::NONE: return "none";
+        case LogLevel::ERROR: return "error";
+        case LogLevel::WARN: return "warn";
+        case LogLevel::INFO: return "info";
+        case LogLevel::DEBUG: return "debug";
+        default: return "?";
+    }
+}
+
+// Receives each formatted line (no trailing newline)
+using LogSink = void (*)(const char* line);
+
+/**
+ * LogFilter - Runtime level per module
+ *
+ * Only consulted for statements that survived the compile-time ceiling,
+ * so it can quieten an enabled module but never re-enable a compiled-out
+ * one. Reached through logFilter() like perfCounters(), so header-only
+ * components log without a pointer being threaded through constructors.
+ *
+ * Levels are single bytes: setLevel() from the serial task and a read
+ * on the control core need no lock.
+ */
+class LogFilter {
+private:
+    volatile uint8_t levels[static_cast<uint8_t>(LogModule::COUNT)];
+    LogSink sink;
+
+    static void serialSink(const char* line) {
+        Serial.println(line);
+    }
+
+public:
+    LogFilter() {
+#ifndef UNIT_TEST
+        sink = serialSink;
+#else
+        sink = nullptr;     // Native tests stay quiet unless they install a sink
+#endif
+        for (uint8_t i = 0; i < static_cast<uint8_t>(LogModule::COUNT); i++) {
+            levels[i] = LOG_RUNTIME_DEFAULT_LEVEL;
+        }
+    }
+
+    bool enabled(LogModule module, LogLevel level) const {
+        return static_cast<uint8_t>(level) <= levels[static_cast<uint8_t>(module)];
+    }
+
+    void setLevel(LogModule module, LogLevel level) {
+        levels[static_cast<uint8_t>(module)] = static_cast<uint8_t>(level);
+    }
+
+    void setAll(LogLevel level) {
+        for (uint8_t i = 0; i < static_cast<uint8_t>(LogModule::COUNT); i++) {
+            levels[i] = static_cast<uint8_t>(level);
+        }
+    }
+
+    LogLevel getLevel(LogModule module) const {
+        return static_cast<LogLevel>(levels[static_cast<uint8_t>(module)]);
+    }
+
+    void setSink(LogSink newSink) {
+        sink = newSink;
+    }
+
+    void write(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        if (!sink) {
+            return;
+        }
+        char line[LOG_LINE_BYTES];
+        va_list args;
+        va_start(args, format);
+        vsnprintf(line, sizeof(line), format, args);
+        va_end(args);
+        sink(line);
+    }
+
+    // Parse "pid" / "debug" etc. for the `log` serial command
+    static bool parseModule(const char* name, LogModule& module) {
+        for (uint8_t i = 0; i < static_cast<uint8_t>(LogModule::COUNT); i++) {
+            if (strcmp(name, logModuleName(static_cast<LogModule>(i))) == 0) {
+                module = static_cast<LogModule>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static bool parseLevel(const char* name, LogLevel& level) {
+        for (uint8_t i = 0; i <= static_cast<uint8_t>(LogLevel::DEBUG); i++) {
+            if (strcmp(name, logLevelName(static_cast<LogLevel>(i))) == 0) {
+                level = static_cast<LogLevel>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+inline LogFilter& logFilter() {
+    static LogFilter filter;
+    return filter;
+}
+
+/**
+ * LOG_ERROR/WARN/INFO/DEBUG(module, format, ...) - printf-style logging
+ *
+ * The compile-time test against LOG_LEVEL_<module> is a constant, so a
+ * statement above the ceiling is dead code: it compiles to nothing and
+ * its arguments are never evaluated. An enabled statement checks the
+ * runtime filter before evaluating its arguments or formatting.
+ */
+#define LOG_AT(module, level, ...)                                                  \
+    do {                                                                            \
+        if (static_cast<uint8_t>(level) <= LOG_LEVEL_##module &&                    \
+            logFilter().enabled(LogModule::module, level)) {                        \
+            logFilter().write(__VA_ARGS__);                                         \
+        }                                                                           \
+    } while (0)
+
+#define LOG_ERROR(module, ...) LOG_AT(module, LogLevel::ERROR, __VA_ARGS__)
+#define LOG_WARN(module, ...)  LOG_AT(module, LogLevel::WARN, __VA_ARGS__)
+#define LOG_INFO(module, ...)  LOG_AT(module, LogLevel::INFO, __VA_ARGS__)
+#define LOG_DEBUG(module, ...) LOG_AT(module, LogLevel::DEBUG, __VA_ARGS__)
+
+#endif
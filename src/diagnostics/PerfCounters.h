@@ -0,0 +1,172 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include "../Config.h"
+#include "Histogram.h"
+#include <atomic>
+
+#ifndef UNIT_TEST
+    #include <Arduino.h>
+#else
+    #include <chrono>
+#endif
+
+/**
+ * Profiled code paths. Each zone is only ever entered from one core, so
+ * its histogram has a single writer even with DUAL_CORE_MODE.
+ */
+enum class PerfZone : uint8_t {
+    CONTROL_TASK,       // Scheduler tasks (the body of each loop slice)
+    HEATER_TASK,
+    UI_TASK,
+    SERIAL_TASK,
+    DRYER_UPDATE,       // Dryer::update
+    SENSOR_UPDATE,      // SensorManager::update
+    PID_COMPUTE,        // PIDController::compute
+    UI_RENDER_HOME,     // UIController home screens
+    UI_RENDER_MENU,     // UIController menu / info screens
+    SETTINGS_WRITE,     // Settings slot write (storage worker, or boot)
+    RUNTIME_WRITE,      // Runtime journal append (storage worker)
+    COUNT
+};
+
+static_assert(static_cast<uint8_t>(PerfZone::COUNT) <= 32, "One reset bit per zone");
+
+inline const char* perfZoneName(PerfZone zone) {
+    switch (zone) {
+        case PerfZone::CONTROL_TASK: return "control task";
+        case PerfZone::HEATER_TASK: return "heater task";
+        case PerfZone::UI_TASK: return "ui task";
+        case PerfZone::SERIAL_TASK: return "serial task";
+        case PerfZone::DRYER_UPDATE: return "Dryer::update";
+        case PerfZone::SENSOR_UPDATE: return "SensorManager::update";
+        case PerfZone::PID_COMPUTE: return "PID::compute";
+        case PerfZone::UI_RENDER_HOME: return "UI render home";
+        case PerfZone::UI_RENDER_MENU: return "UI render menu";
+        case PerfZone::SETTINGS_WRITE: return "settings write";
+        case PerfZone::RUNTIME_WRITE: return "runtime write";
+        default: return "?";
+    }
+}
+
+/**
+ * Free-running cycle counter (CPU clock on hardware, nanoseconds native).
+ * 32-bit, so a single scope must stay under ~26s at 160MHz.
+ */
+inline uint32_t perfCycleCount() {
+#ifndef UNIT_TEST
+    return ESP.getCycleCount();
+#else
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+inline uint32_t perfCyclesPerMicro() {
+#ifndef UNIT_TEST
+    return ESP.getCpuFreqMHz();
+#else
+    return 1000;
+#endif
+}
+
+/**
+ * PerfCounters - Per-zone execution time histograms
+ *
+ * One fixed log2 histogram of microseconds per PerfZone, giving
+ * min/avg/max/p99 without storing samples. Reached through perfCounters()
+ * so header-only components can record without a pointer being threaded
+ * through every constructor.
+ *
+ * requestReset() only raises a flag per zone; the zone's own writer clears
+ * the histogram on its next record(), so a reset from the serial console
+ * never writes a histogram another core is recording into.
+ */
+class PerfCounters {
+public:
+    using ZoneHistogram = Histogram<PERF_HISTOGRAM_BUCKETS>;
+
+private:
+    static constexpr uint32_t ALL_ZONES =
+        (1ull << static_cast<uint8_t>(PerfZone::COUNT)) - 1;
+
+    ZoneHistogram zones[static_cast<uint8_t>(PerfZone::COUNT)];
+    std::atomic<uint32_t> resetPending;     // Bit per zone, cleared by its writer
+
+    static uint32_t zoneBit(PerfZone zone) {
+        return 1u << static_cast<uint8_t>(zone);
+    }
+
+public:
+    PerfCounters() : resetPending(0) {
+    }
+
+    void record(PerfZone zone, uint32_t micros) {
+        uint32_t bit = zoneBit(zone);
+        if ((resetPending.load(std::memory_order_acquire) & bit) != 0) {
+            resetPending.fetch_and(~bit, std::memory_order_acq_rel);
+            zones[static_cast<uint8_t>(zone)].reset();
+        }
+        zones[static_cast<uint8_t>(zone)].record(micros);
+    }
+
+    const ZoneHistogram& get(PerfZone zone) const {
+        return zones[static_cast<uint8_t>(zone)];
+    }
+
+    // Samples recorded since the last reset (a pending reset hides the old ones)
+    bool hasSamples(PerfZone zone) const {
+        return get(zone).getCount() > 0 &&
+               (resetPending.load(std::memory_order_acquire) & zoneBit(zone)) == 0;
+    }
+
+    // Clear every zone on its writer's next sample - safe from any core
+    void requestReset() {
+        resetPending.store(ALL_ZONES, std::memory_order_release);
+    }
+
+    // Clear every zone now - only while nothing else is recording
+    void reset() {
+        for (uint8_t i = 0; i < static_cast<uint8_t>(PerfZone::COUNT); i++) {
+            zones[i].reset();
+        }
+        resetPending.store(0, std::memory_order_release);
+    }
+};
+
+inline PerfCounters& perfCounters() {
+    static PerfCounters counters;
+    return counters;
+}
+
+/**
+ * PerfScope - Records the lifetime of the enclosing scope into a zone
+ */
+class PerfScope {
+private:
+    PerfZone zone;
+    uint32_t startCycles;
+
+public:
+    explicit PerfScope(PerfZone scopeZone)
+        : zone(scopeZone),
+          startCycles(perfCycleCount()) {
+    }
+
+    ~PerfScope() {
+        uint32_t elapsed = perfCycleCount() - startCycles;
+        perfCounters().record(zone, elapsed / perfCyclesPerMicro());
+    }
+
+    PerfScope(const PerfScope&) = delete;
+    PerfScope& operator=(const PerfScope&) = delete;
+};
+
+// One per scope; expands to nothing unless PERF_PROFILING is defined
+#ifdef PERF_PROFILING
+    #define PERF_SCOPE(zone) PerfScope perfScope(zone)
+#else
+    #define PERF_SCOPE(zone) do {} while (0)
+#endif
+
+#endif
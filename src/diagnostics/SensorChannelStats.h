@@ -0,0 +1,37 @@
+#ifndef SENSOR_CHANNEL_STATS_H
+#define SENSOR_CHANNEL_STATS_H
+
+#include "Histogram.h"
+#include "../Config.h"
+
+/**
+ * SensorChannelStats - Acquisition diagnostics for one sensor channel
+ *
+ * Filled in by SensorManager around each driver call. All histograms are
+ * fixed-size log2 buckets, so a full registry costs a known, static
+ * amount of RAM (MAX_SENSOR_CHANNELS * sizeof(SensorChannelStats)).
+ */
+struct SensorChannelStats {
+    using SensorHistogram = Histogram<SENSOR_HISTOGRAM_BUCKETS>;
+
+    SensorHistogram readDurationUs;    // Time spent in the driver read (bus transaction)
+    SensorHistogram conversionWaitMs;  // Async start -> result ready
+    SensorHistogram sampleAgeMs;       // Reading age when pulled from the cache
+    SensorHistogram errorStreaks;      // Length of each run of consecutive failed reads
+
+    uint16_t currentErrorStreak;       // Failed reads since the last success
+    uint32_t skippedSamples;           // Due while the previous acquisition was still in flight
+
+    SensorChannelStats() : currentErrorStreak(0), skippedSamples(0) {}
+
+    void reset() {
+        readDurationUs.reset();
+        conversionWaitMs.reset();
+        sampleAgeMs.reset();
+        errorStreaks.reset();
+        currentErrorStreak = 0;
+        skippedSamples = 0;
+    }
+};
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef SERIAL_TRACE_OUTPUT_H
+#define SERIAL_TRACE_OUTPUT_H
+
+#include "../interfaces/ITraceOutput.h"
+
+#ifndef UNIT_TEST
+    #include <Arduino.h>
+#endif
+
+/**
+ * SerialTraceOutput - Trace frames on the console serial port
+ *
+ * Shares the port with text output; frames are 0x00-delimited so
+ * tools/trace_decode.py can tell them apart. availableForWrite() is the
+ * free TX buffer space, so a drain that stays within it never blocks.
+ */
+class SerialTraceOutput : public ITraceOutput {
+public:
+    size_t availableForWrite() override {
+#ifndef UNIT_TEST
+        int room = Serial.availableForWrite();
+        return room > 0 ? static_cast<size_t>(room) : 0;
+#else
+        return 0;
+#endif
+    }
+
+    size_t write(const uint8_t* data, size_t length) override {
+#ifndef UNIT_TEST
+        return Serial.write(data, length);
+#else
+        return 0;
+#endif
+    }
+};
+
+#endif
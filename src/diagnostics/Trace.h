@@ -0,0 +1,156 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "TraceSites.h"
+#include "../concurrency/SpscQueue.h"
+#include "../Config.h"
+#include <atomic>
+#include <stdint.h>
+#include <string.h>
+
+#define TRACE_SITE_ENUM(name, format) name,
+#define TRACE_SITE_NAME(name, format) #name,
+#define TRACE_SITE_FORMAT(name, format) format,
+
+enum class TraceSite : uint16_t {
+    TRACE_SITES(TRACE_SITE_ENUM)
+    COUNT
+};
+
+// Only used in constant expressions - the strings never reach flash
+constexpr const char* TRACE_SITE_NAMES[] = { TRACE_SITES(TRACE_SITE_NAME) };
+constexpr const char* TRACE_SITE_FORMATS[] = { TRACE_SITES(TRACE_SITE_FORMAT) };
+
+// Arguments a format consumes (see TraceSites.h)
+constexpr uint8_t traceArgCount(const char* format, uint8_t count = 0) {
+    return *format == '\0' ? count
+         : (*format == '%' && format[1] == '%') ? traceArgCount(format + 2, count)
+         : (*format == '%' || *format == '{') ? traceArgCount(format + 1, count + 1)
+         : traceArgCount(format + 1, count);
+}
+
+constexpr uint32_t traceFnv1a(const char* text, uint32_t hash) {
+    return *text == '\0' ? hash
+         : traceFnv1a(text + 1, (hash ^ static_cast<uint8_t>(*text)) * 16777619UL);
+}
+
+// FNV-1a over every name and format, in order; the decoder computes the same
+constexpr uint32_t traceCatalogHash(size_t index = 0, uint32_t hash = 2166136261UL) {
+    return index == static_cast<size_t>(TraceSite::COUNT) ? hash
+         : traceCatalogHash(index + 1, traceFnv1a(TRACE_SITE_FORMATS[index],
+                                                  traceFnv1a(TRACE_SITE_NAMES[index], hash)));
+}
+
+constexpr uint32_t TRACE_CATALOG_HASH = traceCatalogHash();
+
+/**
+ * One trace call as stored in RAM: site, tick time and raw argument
+ * words (floats as their bit pattern). Nothing is formatted on the MCU.
+ */
+struct TraceRecord {
+    uint32_t timestamp;
+    uint16_t site;
+    uint8_t argCount;
+    uint32_t args[TRACE_MAX_ARGS];
+};
+
+inline uint32_t traceArg(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+inline uint32_t traceArg(double value) {
+    return traceArg(static_cast<float>(value));
+}
+
+// Integers, bools and enums
+template <typename T>
+inline uint32_t traceArg(T value) {
+    return static_cast<uint32_t>(value);
+}
+
+/**
+ * TraceBuffer - Lock-free RAM ring of trace records
+ *
+ * record() checks the runtime switch, builds a TraceRecord and pushes it
+ * into an SpscQueue: a few dozen cycles, no formatting, no UART. The
+ * timestamp is the control tick time set by setTime(), not a clock read.
+ *
+ * Single producer: only the control path (Dryer, PID - one task, on the
+ * control core in DUAL_CORE_MODE) records. TraceDrain is the consumer.
+ * A full ring drops the record and counts it.
+ *
+ * Reached through traceBuffer() like perfCounters(), so header-only
+ * components trace without a pointer being threaded through constructors.
+ */
+class TraceBuffer {
+private:
+    SpscQueue<TraceRecord, TRACE_RING_RECORDS> ring;
+    std::atomic<bool> enabled;
+    std::atomic<uint32_t> dropped;       // Producer-written
+    volatile uint32_t now;
+
+public:
+    TraceBuffer() : enabled(false), dropped(0), now(0) {
+    }
+
+    template <uint8_t EXPECTED_ARGS, typename... Args>
+    void record(TraceSite site, Args... args) {
+        static_assert(sizeof...(Args) == EXPECTED_ARGS, "TRACE arguments do not match the site's format");
+        static_assert(sizeof...(Args) <= TRACE_MAX_ARGS, "Too many TRACE arguments");
+
+        if (!enabled.load(std::memory_order_relaxed)) {
+            return;
+        }
+        TraceRecord entry = { now, static_cast<uint16_t>(site), sizeof...(Args), { traceArg(args)... } };
+        if (!ring.push(entry)) {
+            dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    }
+
+    // Consumer side
+    bool pop(TraceRecord& entry) {
+        return ring.pop(entry);
+    }
+
+    void setTime(uint32_t currentMillis) {
+        now = currentMillis;
+    }
+
+    uint32_t getTime() const {
+        return now;
+    }
+
+    void setEnabled(bool on) {
+        enabled.store(on, std::memory_order_relaxed);
+    }
+
+    bool isEnabled() const {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    uint32_t getDropped() const {
+        return dropped.load(std::memory_order_relaxed);
+    }
+
+    size_t getQueued() const {
+        return ring.size();
+    }
+};
+
+inline TraceBuffer& traceBuffer() {
+    static TraceBuffer buffer;
+    return buffer;
+}
+
+/**
+ * TRACE(SITE, args...) - record a catalog site (see TraceSites.h)
+ *
+ * The argument count is checked against the site's format at compile
+ * time.
+ */
+#define TRACE(site, ...) \
+    traceBuffer().record<traceArgCount(TRACE_SITE_FORMATS[static_cast<size_t>(TraceSite::site)])>(TraceSite::site, ##__VA_ARGS__)
+
+#endif
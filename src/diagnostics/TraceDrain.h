@@ -0,0 +1,167 @@
+#ifndef TRACE_DRAIN_H
+#define TRACE_DRAIN_H
+
+#include "Trace.h"
+#include "../interfaces/ITraceOutput.h"
+#include "../Config.h"
+
+// Frame payload: magic, site (LE16), timestamp (LE32), args (LE32 each), CRC-8
+constexpr uint8_t TRACE_FRAME_MAGIC = 0xA7;
+constexpr size_t TRACE_MAX_PAYLOAD_BYTES = 1 + 2 + 4 + 4 * TRACE_MAX_ARGS + 1;
+// COBS adds one byte per 254, plus the leading and trailing 0x00
+constexpr size_t TRACE_MAX_FRAME_BYTES = TRACE_MAX_PAYLOAD_BYTES + 1 + 2;
+
+static_assert(TRACE_MAX_PAYLOAD_BYTES < 254, "Trace payload must fit one COBS block");
+static_assert(TRACE_DRAIN_MAX_BYTES >= TRACE_MAX_FRAME_BYTES, "Trace drain budget below one frame");
+
+/**
+ * TraceDrain - Low-priority consumer of the trace ring
+ *
+ * update() runs as the last scheduler task. Each pass encodes records
+ * into frames and writes whole frames only, while they fit in both
+ * TRACE_DRAIN_MAX_BYTES and the output's free TX space - it never waits
+ * on the UART, and a frame is never split by other serial text.
+ *
+ * Frame on the wire: 0x00, COBS(payload), 0x00. Text output never
+ * contains 0x00, so the decoder can pick frames out of a mixed stream.
+ * A TRACE_START frame carrying TRACE_CATALOG_HASH opens every session
+ * (tracing switched on) and a TRACE_OVERFLOW frame reports records the
+ * producer had to drop.
+ */
+class TraceDrain {
+private:
+    TraceBuffer* buffer;
+    ITraceOutput* output;
+
+    uint8_t frame[TRACE_MAX_FRAME_BYTES];
+    size_t frameLength;          // 0 = no frame waiting
+    bool sessionStarted;
+    uint32_t reportedDrops;
+    uint32_t framesWritten;
+
+    static uint8_t crc8(const uint8_t* data, size_t length) {
+        uint8_t crc = 0;
+        for (size_t i = 0; i < length; i++) {
+            crc ^= data[i];
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                crc = (crc & 0x80) ? static_cast<uint8_t>((crc << 1) ^ 0x07) : static_cast<uint8_t>(crc << 1);
+            }
+        }
+        return crc;
+    }
+
+    static void putLe32(uint8_t* out, uint32_t value) {
+        out[0] = value & 0xFF;
+        out[1] = (value >> 8) & 0xFF;
+        out[2] = (value >> 16) & 0xFF;
+        out[3] = (value >> 24) & 0xFF;
+    }
+
+    void encode(const TraceRecord& entry) {
+        uint8_t payload[TRACE_MAX_PAYLOAD_BYTES];
+        size_t length = 0;
+
+        payload[length++] = TRACE_FRAME_MAGIC;
+        payload[length++] = entry.site & 0xFF;
+        payload[length++] = (entry.site >> 8) & 0xFF;
+        putLe32(&payload[length], entry.timestamp);
+        length += 4;
+        for (uint8_t i = 0; i < entry.argCount && i < TRACE_MAX_ARGS; i++) {
+            putLe32(&payload[length], entry.args[i]);
+            length += 4;
+        }
+        payload[length] = crc8(payload, length);
+        length++;
+
+        // COBS: each code byte gives the distance to the next zero
+        frame[0] = 0x00;
+        size_t out = 1;
+        size_t codeIndex = out++;
+        uint8_t code = 1;
+        for (size_t i = 0; i < length; i++) {
+            if (payload[i] == 0) {
+                frame[codeIndex] = code;
+                codeIndex = out++;
+                code = 1;
+            } else {
+                frame[out++] = payload[i];
+                code++;
+            }
+        }
+        frame[codeIndex] = code;
+        frame[out++] = 0x00;
+        frameLength = out;
+    }
+
+    // Next frame to send, in priority order; false if there is none
+    bool loadFrame() {
+        if (!sessionStarted) {
+            if (!buffer->isEnabled()) {
+                return false;
+            }
+            sessionStarted = true;
+            reportedDrops = buffer->getDropped();
+            encode(syntheticRecord(TraceSite::TRACE_START, TRACE_CATALOG_HASH));
+            return true;
+        }
+
+        uint32_t drops = buffer->getDropped();
+        if (drops != reportedDrops) {
+            encode(syntheticRecord(TraceSite::TRACE_OVERFLOW, drops - reportedDrops));
+            reportedDrops = drops;
+            return true;
+        }
+
+        TraceRecord entry;
+        if (buffer->pop(entry)) {
+            encode(entry);
+            return true;
+        }
+
+        if (!buffer->isEnabled()) {
+            sessionStarted = false;   // Next switch-on opens a new session
+        }
+        return false;
+    }
+
+    TraceRecord syntheticRecord(TraceSite site, uint32_t value) const {
+        TraceRecord entry = { buffer->getTime(), static_cast<uint16_t>(site), 1, { value } };
+        return entry;
+    }
+
+public:
+    TraceDrain(TraceBuffer* traceBuffer, ITraceOutput* traceOutput)
+        : buffer(traceBuffer),
+          output(traceOutput),
+          frameLength(0),
+          sessionStarted(false),
+          reportedDrops(0),
+          framesWritten(0) {
+    }
+
+    void update() {
+        size_t budget = output->availableForWrite();
+        if (budget > TRACE_DRAIN_MAX_BYTES) {
+            budget = TRACE_DRAIN_MAX_BYTES;
+        }
+
+        while (true) {
+            if (frameLength == 0 && !loadFrame()) {
+                return;
+            }
+            if (frameLength > budget) {
+                return;   // Kept for the next pass
+            }
+            output->write(frame, frameLength);
+            budget -= frameLength;
+            frameLength = 0;
+            framesWritten++;
+        }
+    }
+
+    uint32_t getFramesWritten() const {
+        return framesWritten;
+    }
+};
+
+#endif
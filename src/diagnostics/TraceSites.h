@@ -0,0 +1,36 @@
+#ifndef TRACE_SITES_H
+#define TRACE_SITES_H
+
+/**
+ * Trace site catalog - one X(NAME, "format") per TRACE() call site
+ *
+ * A site's ID is its position in this list, so the firmware only ever
+ * stores the ID and the raw arguments; tools/trace_decode.py parses this
+ * file to turn frames back into text. Append new sites at the end and
+ * keep the decoder's copy of the tree in step with the firmware (a hash
+ * of the catalog is sent when tracing starts, so a mismatch is reported).
+ *
+ * Formats are plain ASCII without escapes. Conversions:
+ *   %d %i       signed 32-bit
+ *   %u %x %X    unsigned 32-bit
+ *   %f %e %g    float (flags/width/precision as printf)
+ *   {EnumName}  enumerator name of `enum class EnumName` in src/Types.h
+ * Each conversion consumes one argument, at most TRACE_MAX_ARGS per site.
+ */
+#define TRACE_SITES(X)                                                                                  \
+    X(TRACE_START,          "trace start (catalog %08x)")                                               \
+    X(TRACE_OVERFLOW,       "trace ring overflow: %u records dropped")                                  \
+    X(DRYER_STATE,          "STATE: {DryerState} -> {DryerState}")                                      \
+    X(PID_COOLING,          "COOLING PREDICTION: BoxRate=%.3f HeaterRate=%.3f C/s | Predicted=%.1fC | Enhanced error=%.2f") \
+    X(PID_CONSERVATIVE,     "CONSERVATIVE MODE: BoxError=%.2fC | ApproachRatio=%.2f | HeaterLimit=%.1f") \
+    X(PID_BOX_AT_TARGET,    "BOX AT TARGET: HeaterLimit=%.1f")                                          \
+    X(PID_HEATER_LIMIT,     "HEATER LIMIT REACHED: Heater=%.1fC | Limit=%.1f")                          \
+    X(PID_HEATER_SLOWDOWN,  "HEATER SLOWDOWN: Margin=%.2fC | Scale=%.2f | Output reduced to %.1f")      \
+    X(PID_MIN_HEATER,       "MIN HEATER CONTROL: Heater=%.1fC | MinLimit=%.1f | Output boosted to %.1f") \
+    X(PID_MOMENTUM,         "HEATER MOMENTUM COMP: HeaterRate=%.3fC/s | Boost=+%.1f%%")                 \
+    X(PID_MIN_OUTPUT,       "MIN OUTPUT ENFORCED: Was=%.1f%% | Now=%.1f%%")                             \
+    X(PID_BASELINE_BOOST,   "BASELINE INSUFFICIENT: BoxRate=%.3fC/s | Duration=%ums | Boost=+%.1f%% | Output=%.1f") \
+    X(PID_STEADY_LEARNING,  "STEADY-STATE LEARNING: Output=%.1f%% | Learned=%.1f%%")                    \
+    X(PID_STEADY_BIAS,      "STEADY-STATE BIAS: Factor=%.2f | Output adjusted to %.1f")
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef DELEGATE_H
+#define DELEGATE_H
+
+#include <stddef.h>
+#include <string.h>
+#include <type_traits>
+#include <utility>
+#include "../Config.h"
+
+/**
+ * Delegate - Heap-free callable with inline storage
+ *
+ * A drop-in for std::function in callback slots: holds a function
+ * pointer or a lambda (e.g. [this](...) { ... }) in a fixed buffer of
+ * DELEGATE_STORAGE_BYTES, and dispatches through one plain function
+ * pointer. Never allocates, so registering and copying callbacks is
+ * safe after setup().
+ *
+ * Callables must fit the buffer and be trivially copyable - that covers
+ * function pointers and lambdas capturing pointers/references/PODs,
+ * which is all this codebase registers. Anything bigger fails to
+ * compile instead of silently falling back to the heap.
+ */
+template <typename Signature>
+class Delegate;
+
+template <typename R, typename... Args>
+class Delegate<R(Args...)> {
+public:
+    static constexpr size_t STORAGE_BYTES = DELEGATE_STORAGE_BYTES;
+
+private:
+    using Invoker = R (*)(void* storage, Args... args);
+
+    alignas(alignof(void*)) unsigned char storage[STORAGE_BYTES];
+    Invoker invoker;
+
+    template <typename F>
+    static R invoke(void* target, Args... args) {
+        return (*static_cast<F*>(target))(std::forward<Args>(args)...);
+    }
+
+public:
+    Delegate() : invoker(nullptr) {
+    }
+
+    Delegate(std::nullptr_t) : invoker(nullptr) {
+    }
+
+    template <typename F,
+              typename = typename std::enable_if<
+                  !std::is_same<typename std::decay<F>::type, Delegate>::value>::type>
+    Delegate(F callable) {
+        static_assert(sizeof(F) <= STORAGE_BYTES, "Callable too large for Delegate storage (raise DELEGATE_STORAGE_BYTES)");
+        static_assert(alignof(F) <= alignof(void*), "Callable alignment exceeds Delegate storage");
+        static_assert(std::is_trivially_copyable<F>::value, "Delegate callables must be trivially copyable (capture pointers/references)");
+
+        memcpy(storage, &callable, sizeof(F));
+        invoker = &invoke<F>;
+    }
+
+    // Only valid when bound (check with operator bool)
+    R operator()(Args... args) const {
+        return invoker(const_cast<unsigned char*>(storage), std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const {
+        return invoker != nullptr;
+    }
+
+    // Null comparisons, as with std::function
+    friend bool operator==(const Delegate& delegate, std::nullptr_t) {
+        return !delegate;
+    }
+
+    friend bool operator!=(const Delegate& delegate, std::nullptr_t) {
+        return static_cast<bool>(delegate);
+    }
+};
+
+#endif
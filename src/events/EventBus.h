@@ -0,0 +1,62 @@
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include <stdint.h>
+#include <utility>
+
+/**
+ * EventBus - Fixed-capacity subscriber list for one typed event
+ *
+ * EVENT is one of the event structs in Events.h; it names the handler
+ * Delegate type and the compile-time subscriber limit. Subscribers are
+ * stored inline, so subscribe() and publish() never touch the heap, and
+ * publish() is a loop of direct Delegate calls in subscription order.
+ *
+ * subscribe() refuses (returns false) once MAX_SUBSCRIBERS is reached;
+ * the limits in Config.h are sized for the components that subscribe.
+ */
+template <typename EVENT>
+class EventBus {
+public:
+    using Handler = typename EVENT::Handler;
+    static constexpr uint8_t CAPACITY = EVENT::MAX_SUBSCRIBERS;
+
+    static_assert(CAPACITY > 0, "EventBus needs at least one subscriber slot");
+
+private:
+    Handler handlers[CAPACITY];
+    uint8_t count;
+
+public:
+    EventBus() : count(0) {
+    }
+
+    bool subscribe(const Handler& handler) {
+        if (!handler || count >= CAPACITY) {
+            return false;
+        }
+        handlers[count++] = handler;
+        return true;
+    }
+
+    template <typename... Args>
+    void publish(Args&&... args) const {
+        for (uint8_t i = 0; i < count; i++) {
+            handlers[i](args...);
+        }
+    }
+
+    uint8_t getSubscriberCount() const {
+        return count;
+    }
+
+    bool isFull() const {
+        return count >= CAPACITY;
+    }
+
+    void clear() {
+        count = 0;
+    }
+};
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef EVENTS_H
+#define EVENTS_H
+
+#include "../Config.h"
+#include "../Types.h"
+#include "../diagnostics/HealthStats.h"
+
+/**
+ * Typed events for EventBus<EVENT>
+ *
+ * Each event names its handler signature (the callback types in
+ * Types.h, so register*Callback() signatures stay as they were) and the
+ * compile-time subscriber limit of its bus.
+ */
+
+// ==================== Sensor Events ====================
+
+struct HeaterTempEvent {
+    using Handler = HeaterTempCallback;
+    static constexpr uint8_t MAX_SUBSCRIBERS = MAX_SENSOR_SUBSCRIBERS;
+};
+
+struct BoxDataEvent {
+    using Handler = BoxDataCallback;
+    static constexpr uint8_t MAX_SUBSCRIBERS = MAX_SENSOR_SUBSCRIBERS;
+};
+
+struct SensorErrorEvent {
+    using Handler = SensorErrorCallback;
+    static constexpr uint8_t MAX_SUBSCRIBERS = MAX_SENSOR_SUBSCRIBERS;
+};
+
+struct SensorChannelEvent {
+    using Handler = SensorChannelCallback;
+    static constexpr uint8_t MAX_SUBSCRIBERS = MAX_SENSOR_SUBSCRIBERS;
+};
+
+// ==================== Safety Events ====================
+
+struct EmergencyStopEvent {
+    using Handler = EmergencyStopCallback;
+    static constexpr uint8_t MAX_SUBSCRIBERS = MAX_EMERGENCY_SUBSCRIBERS;
+};
+
+// ==================== Dryer Events ====================
+
+struct StateChangeEvent {
+    using Handler = StateChangeCallback;
+    static constexpr uint8_t MAX_SUBSCRIBERS = MAX_STATE_SUBSCRIBERS;
+};
+
+struct StatsUpdateEvent {
+    using Handler = StatsUpdateCallback;
+    static constexpr uint8_t MAX_SUBSCRIBERS = MAX_STATS_SUBSCRIBERS;
+};
+
+// ==================== UI Events ====================
+
+struct MenuSelectionEvent {
+    using Handler = MenuSelectionCallback;
+    static constexpr uint8_t MAX_SUBSCRIBERS = MAX_MENU_SUBSCRIBERS;
+};
+
+// ==================== Diagnostics Events ====================
+
+struct HealthWarningEvent {
+    using Handler = HealthWarningCallback;
+    static constexpr uint8_t MAX_SUBSCRIBERS = MAX_HEALTH_SUBSCRIBERS;
+};
+
+#endif
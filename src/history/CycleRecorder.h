@@ -0,0 +1,162 @@
+#ifndef CYCLE_RECORDER_H
+#define CYCLE_RECORDER_H
+
+#include "SensorHistory.h"
+#include "../storage/CycleRecord.h"
+#include "../Types.h"
+#include "../Config.h"
+
+/**
+ * CycleRecorder - Running statistics of the current drying cycle
+ *
+ * Dryer starts it when heating starts, feeds it while RUNNING and
+ * finishes it when the cycle ends; the finished CycleRecord goes to
+ * storage. Samples are gated to CYCLE_SAMPLE_INTERVAL_MS; energy is
+ * integrated as PWM x HEATER_RATED_POWER_W over the time between
+ * samples. A pause breaks the integration (resume()), so paused time
+ * costs nothing.
+ *
+ * Fixed size, no allocation: the record being built is the accumulator.
+ *
+ * Does NOT:
+ * - Store anything (SettingsStorage / CycleHistoryFile do)
+ * - Know the elapsed time - Dryer passes it to finish()
+ */
+class CycleRecorder {
+private:
+    CycleRecord record;
+    bool active;
+    bool sampled;               // At least one sample this cycle
+    bool timingValid;           // lastSampleTime is a base for the energy integral
+    uint32_t lastSampleTime;
+    uint32_t sampleCount;
+    int64_t boxTempSum;         // Hundredths: exact over any cycle length
+    float energyWh;
+    int16_t boxTempMin;
+    int16_t boxTempMax;
+    int16_t heaterTempMax;
+
+public:
+    CycleRecorder()
+        : active(false),
+          sampled(false),
+          timingValid(false),
+          lastSampleTime(0),
+          sampleCount(0),
+          boxTempSum(0),
+          energyWh(0),
+          boxTempMin(0),
+          boxTempMax(0),
+          heaterTempMax(0) {
+        memset(&record, 0, sizeof(record));
+    }
+
+    void begin(uint32_t currentMillis, PresetType preset, PIDProfile profile,
+               float targetTemp, uint32_t targetTime, bool recovered) {
+        memset(&record, 0, sizeof(record));
+        record.preset = static_cast<uint8_t>(preset);
+        record.pidProfile = static_cast<uint8_t>(profile);
+        record.targetTemp = targetTemp;
+        record.targetTime = targetTime;
+        record.flags = recovered ? CYCLE_FLAG_RECOVERED : 0;
+
+        active = true;
+        sampled = false;
+        timingValid = false;
+        lastSampleTime = currentMillis;
+        sampleCount = 0;
+        boxTempSum = 0;
+        energyWh = 0;
+        boxTempMin = 0;
+        boxTempMax = 0;
+        heaterTempMax = 0;
+    }
+
+    // Heating resumes after a pause: the pause contributes no energy
+    void resume(uint32_t currentMillis) {
+        timingValid = false;
+        lastSampleTime = currentMillis;
+    }
+
+    void sample(uint32_t currentMillis, float boxTemp, float heaterTemp,
+                float humidity, float pwmOutput) {
+        if (!active) {
+            return;
+        }
+        if (timingValid && currentMillis - lastSampleTime < CYCLE_SAMPLE_INTERVAL_MS) {
+            return;
+        }
+
+        if (timingValid) {
+            float hours = (currentMillis - lastSampleTime) / 3600000.0f;
+            energyWh += (pwmOutput / PWM_MAX) * HEATER_RATED_POWER_W * hours;
+        }
+        timingValid = true;
+        lastSampleTime = currentMillis;
+
+        int16_t box = HistorySample::encodeTemp(boxTemp);
+        int16_t heater = HistorySample::encodeTemp(heaterTemp);
+        if (!sampled) {
+            record.humidityStart = HistorySample::encodeHumidity(humidity);
+            boxTempMin = box;
+            boxTempMax = box;
+            heaterTempMax = heater;
+            sampled = true;
+        }
+        if (box < boxTempMin) boxTempMin = box;
+        if (box > boxTempMax) boxTempMax = box;
+        if (heater > heaterTempMax) heaterTempMax = heater;
+        record.humidityEnd = HistorySample::encodeHumidity(humidity);
+
+        boxTempSum += box;
+        sampleCount++;
+    }
+
+    // Sensor error or emergency stop during the cycle; the first reason given is kept
+    void noteFault(const char* reason = nullptr) {
+        if (!active) {
+            return;
+        }
+        if (record.faultCount < 255) {
+            record.faultCount++;
+        }
+        if (reason && record.faultReason[0] == '\0') {
+            strncpy(record.faultReason, reason, sizeof(record.faultReason) - 1);
+        }
+    }
+
+    /**
+     * Close the cycle. `out` gets everything but id, magic and CRC
+     * (CycleHistoryFile fills those in).
+     * @return false if no cycle was being recorded
+     */
+    bool finish(CycleEndReason reason, uint32_t elapsedSeconds, uint32_t targetTime,
+                float waterRemoved, CycleRecord& out) {
+        if (!active) {
+            return false;
+        }
+        active = false;
+
+        record.endReason = static_cast<uint8_t>(reason);
+        record.duration = elapsedSeconds;
+        record.targetTime = targetTime;
+        record.energyWh = energyWh;
+        record.boxTempMin = boxTempMin;
+        record.boxTempMax = boxTempMax;
+        record.boxTempMean = sampleCount > 0 ? static_cast<int16_t>(boxTempSum / static_cast<int64_t>(sampleCount)) : 0;
+        record.heaterTempMax = heaterTempMax;
+        record.waterRemoved = waterRemoved > 0 ? waterRemoved : 0;
+        out = record;
+        return true;
+    }
+
+    bool isActive() const {
+        return active;
+    }
+
+    float getEnergyWh() const {
+        return energyWh;
+    }
+};
+
+#endif
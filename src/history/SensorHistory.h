@@ -0,0 +1,309 @@
+#ifndef SENSOR_HISTORY_H
+#define SENSOR_HISTORY_H
+
+#include "../Types.h"
+#include "../Config.h"
+
+/**
+ * HistorySample - One packed history point (8 bytes)
+ *
+ * Temperatures and humidity are 16-bit fixed point in hundredths
+ * (0.01°C / 0.01 %RH), PWM is the raw duty 0-PWM_MAX.
+ */
+struct HistorySample {
+    int16_t heaterTemp;
+    int16_t boxTemp;
+    uint16_t humidity;
+    uint8_t pwm;
+    uint8_t reserved;
+
+    HistorySample() : heaterTemp(0), boxTemp(0), humidity(0), pwm(0), reserved(0) {}
+
+    static int16_t encodeTemp(float celsius) {
+        float scaled = constrain(celsius, -327.0f, 327.0f) * 100.0f;
+        return static_cast<int16_t>(scaled >= 0 ? scaled + 0.5f : scaled - 0.5f);
+    }
+
+    static uint16_t encodeHumidity(float percent) {
+        return static_cast<uint16_t>(constrain(percent, 0.0f, 100.0f) * 100.0f + 0.5f);
+    }
+
+    static uint8_t encodePWM(float pwmOutput) {
+        return static_cast<uint8_t>(constrain(pwmOutput, 0.0f, static_cast<float>(PWM_MAX)) + 0.5f);
+    }
+
+    static HistorySample from(float heater, float box, float humidityPercent, float pwmOutput) {
+        HistorySample sample;
+        sample.heaterTemp = encodeTemp(heater);
+        sample.boxTemp = encodeTemp(box);
+        sample.humidity = encodeHumidity(humidityPercent);
+        sample.pwm = encodePWM(pwmOutput);
+        return sample;
+    }
+
+    float getHeaterTemp() const { return heaterTemp / 100.0f; }
+    float getBoxTemp() const { return boxTemp / 100.0f; }
+    float getHumidity() const { return humidity / 100.0f; }
+    uint8_t getPWM() const { return pwm; }
+};
+
+/**
+ * HistoryAggregate - min/max/mean of the samples covered by one tier entry
+ *
+ * For the 1s tier all three are the raw sample.
+ */
+struct HistoryAggregate {
+    HistorySample minimum;
+    HistorySample maximum;
+    HistorySample mean;
+};
+
+enum class HistoryTier : uint8_t {
+    SECONDS,      // 1s resolution
+    TEN_SECONDS,  // 10s resolution
+    MINUTES       // 60s resolution
+};
+
+/**
+ * HistoryRing - Fixed-capacity overwrite-oldest ring
+ */
+template <typename T, uint16_t CAPACITY>
+class HistoryRing {
+private:
+    T items[CAPACITY];
+    uint16_t head;    // Next write position
+    uint16_t count;
+
+public:
+    HistoryRing() : head(0), count(0) {}
+
+    void push(const T& item) {
+        items[head] = item;
+        head = (head + 1) % CAPACITY;
+        if (count < CAPACITY) {
+            count++;
+        }
+    }
+
+    // 0 = newest
+    const T& fromNewest(uint16_t index) const {
+        return items[(head + CAPACITY - 1 - index) % CAPACITY];
+    }
+
+    uint16_t size() const { return count; }
+    static constexpr uint16_t capacity() { return CAPACITY; }
+
+    void clear() {
+        head = 0;
+        count = 0;
+    }
+};
+
+/**
+ * SensorHistory - Tiered in-RAM sensor history
+ *
+ * Keeps heater temp, box temp, humidity and PWM at three resolutions:
+ *   - 1s  x HISTORY_TIER0_SAMPLES (10 min)
+ *   - 10s x HISTORY_TIER1_SAMPLES (2 h)
+ *   - 60s x HISTORY_TIER2_SAMPLES (12 h)
+ *
+ * Coarser tiers are built incrementally: each new 1s sample is folded
+ * into running min/max/sum accumulators, which are flushed into the next
+ * tier every HISTORY_TIER1_FACTOR / HISTORY_TIER2_FACTOR samples. No
+ * re-scan of older data and no allocation; the whole store is a single
+ * fixed-size object (see FOOTPRINT_BYTES).
+ *
+ * Fed from the Dryer stats callback; record() gates to one sample per
+ * HISTORY_SAMPLE_INTERVAL_MS.
+ */
+class SensorHistory {
+private:
+    /**
+     * Running min/max/sum over a window of samples or aggregates
+     */
+    struct Accumulator {
+        HistorySample minimum;
+        HistorySample maximum;
+        int32_t heaterSum;
+        int32_t boxSum;
+        uint32_t humiditySum;
+        uint32_t pwmSum;
+        uint8_t count;
+
+        Accumulator() { reset(); }
+
+        void reset() {
+            heaterSum = 0;
+            boxSum = 0;
+            humiditySum = 0;
+            pwmSum = 0;
+            count = 0;
+        }
+
+        void add(const HistoryAggregate& entry) {
+            if (count == 0) {
+                minimum = entry.minimum;
+                maximum = entry.maximum;
+            } else {
+                if (entry.minimum.heaterTemp < minimum.heaterTemp) minimum.heaterTemp = entry.minimum.heaterTemp;
+                if (entry.minimum.boxTemp < minimum.boxTemp) minimum.boxTemp = entry.minimum.boxTemp;
+                if (entry.minimum.humidity < minimum.humidity) minimum.humidity = entry.minimum.humidity;
+                if (entry.minimum.pwm < minimum.pwm) minimum.pwm = entry.minimum.pwm;
+                if (entry.maximum.heaterTemp > maximum.heaterTemp) maximum.heaterTemp = entry.maximum.heaterTemp;
+                if (entry.maximum.boxTemp > maximum.boxTemp) maximum.boxTemp = entry.maximum.boxTemp;
+                if (entry.maximum.humidity > maximum.humidity) maximum.humidity = entry.maximum.humidity;
+                if (entry.maximum.pwm > maximum.pwm) maximum.pwm = entry.maximum.pwm;
+            }
+            // Windows are equal-sized, so the mean of means is the true mean
+            heaterSum += entry.mean.heaterTemp;
+            boxSum += entry.mean.boxTemp;
+            humiditySum += entry.mean.humidity;
+            pwmSum += entry.mean.pwm;
+            count++;
+        }
+
+        HistoryAggregate result() const {
+            HistoryAggregate aggregate;
+            aggregate.minimum = minimum;
+            aggregate.maximum = maximum;
+            aggregate.mean.heaterTemp = static_cast<int16_t>(roundedDiv(heaterSum, count));
+            aggregate.mean.boxTemp = static_cast<int16_t>(roundedDiv(boxSum, count));
+            aggregate.mean.humidity = static_cast<uint16_t>((humiditySum + count / 2) / count);
+            aggregate.mean.pwm = static_cast<uint8_t>((pwmSum + count / 2) / count);
+            return aggregate;
+        }
+
+        static int32_t roundedDiv(int32_t sum, uint8_t n) {
+            return sum >= 0 ? (sum + n / 2) / n : (sum - n / 2) / n;
+        }
+    };
+
+    HistoryRing<HistorySample, HISTORY_TIER0_SAMPLES> tier0;
+    HistoryRing<HistoryAggregate, HISTORY_TIER1_SAMPLES> tier1;
+    HistoryRing<HistoryAggregate, HISTORY_TIER2_SAMPLES> tier2;
+
+    Accumulator tier1Accumulator;
+    Accumulator tier2Accumulator;
+
+    uint32_t lastSampleTime;
+    bool hasSampled;
+
+public:
+    static constexpr size_t FOOTPRINT_BYTES =
+        sizeof(HistorySample) * HISTORY_TIER0_SAMPLES +
+        sizeof(HistoryAggregate) * HISTORY_TIER1_SAMPLES +
+        sizeof(HistoryAggregate) * HISTORY_TIER2_SAMPLES;
+
+    static_assert(sizeof(HistorySample) == 8, "HistorySample must stay packed to 8 bytes");
+    static_assert(FOOTPRINT_BYTES <= HISTORY_MAX_BYTES, "History tiers exceed HISTORY_MAX_BYTES");
+
+    SensorHistory() : lastSampleTime(0), hasSampled(false) {}
+
+    /**
+     * Record from Dryer stats, at most once per HISTORY_SAMPLE_INTERVAL_MS
+     */
+    void record(const CurrentStats& stats, uint32_t currentMillis) {
+        if (hasSampled && currentMillis - lastSampleTime < HISTORY_SAMPLE_INTERVAL_MS) {
+            return;
+        }
+
+        // Keep the 1s cadence even if this call came in late
+        lastSampleTime = hasSampled
+            ? currentMillis - (currentMillis - lastSampleTime) % HISTORY_SAMPLE_INTERVAL_MS
+            : currentMillis;
+        hasSampled = true;
+
+        addSample(HistorySample::from(stats.currentTemp, stats.boxTemp,
+                                      stats.boxHumidity, stats.pwmOutput));
+    }
+
+    /**
+     * Append one 1s sample and cascade into coarser tiers
+     */
+    void addSample(const HistorySample& sample) {
+        tier0.push(sample);
+
+        HistoryAggregate raw;
+        raw.minimum = sample;
+        raw.maximum = sample;
+        raw.mean = sample;
+        tier1Accumulator.add(raw);
+
+        if (tier1Accumulator.count < HISTORY_TIER1_FACTOR) {
+            return;
+        }
+
+        HistoryAggregate tenSeconds = tier1Accumulator.result();
+        tier1Accumulator.reset();
+        tier1.push(tenSeconds);
+        tier2Accumulator.add(tenSeconds);
+
+        if (tier2Accumulator.count < HISTORY_TIER2_FACTOR) {
+            return;
+        }
+
+        tier2.push(tier2Accumulator.result());
+        tier2Accumulator.reset();
+    }
+
+    void clear() {
+        tier0.clear();
+        tier1.clear();
+        tier2.clear();
+        tier1Accumulator.reset();
+        tier2Accumulator.reset();
+        hasSampled = false;
+    }
+
+    uint16_t getCount(HistoryTier tier) const {
+        switch (tier) {
+            case HistoryTier::SECONDS:     return tier0.size();
+            case HistoryTier::TEN_SECONDS: return tier1.size();
+            case HistoryTier::MINUTES:     return tier2.size();
+        }
+        return 0;
+    }
+
+    uint16_t getCapacity(HistoryTier tier) const {
+        switch (tier) {
+            case HistoryTier::SECONDS:     return tier0.capacity();
+            case HistoryTier::TEN_SECONDS: return tier1.capacity();
+            case HistoryTier::MINUTES:     return tier2.capacity();
+        }
+        return 0;
+    }
+
+    /**
+     * Entry from a tier, 0 = newest. Caller checks index < getCount(tier).
+     */
+    HistoryAggregate get(HistoryTier tier, uint16_t indexFromNewest) const {
+        HistoryAggregate entry;
+        switch (tier) {
+            case HistoryTier::SECONDS:
+                entry.minimum = tier0.fromNewest(indexFromNewest);
+                entry.maximum = entry.minimum;
+                entry.mean = entry.minimum;
+                break;
+            case HistoryTier::TEN_SECONDS:
+                entry = tier1.fromNewest(indexFromNewest);
+                break;
+            case HistoryTier::MINUTES:
+                entry = tier2.fromNewest(indexFromNewest);
+                break;
+        }
+        return entry;
+    }
+
+    // Resolution of one entry in seconds
+    static uint32_t getResolutionSeconds(HistoryTier tier) {
+        uint32_t base = HISTORY_SAMPLE_INTERVAL_MS / 1000;
+        switch (tier) {
+            case HistoryTier::SECONDS:     return base;
+            case HistoryTier::TEN_SECONDS: return base * HISTORY_TIER1_FACTOR;
+            case HistoryTier::MINUTES:     return base * HISTORY_TIER1_FACTOR * HISTORY_TIER2_FACTOR;
+        }
+        return base;
+    }
+};
+
+#endif
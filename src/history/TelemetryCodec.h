@@ -0,0 +1,279 @@
+#ifndef TELEMETRY_CODEC_H
+#define TELEMETRY_CODEC_H
+
+#include "SensorHistory.h"
+#include "../storage/TelemetryPage.h"
+#include "../Types.h"
+#include "../Config.h"
+
+// Channels of one telemetry sample, in encoding order (one mask bit each)
+enum class TelemetryField : uint8_t {
+    TIME,           // TELEMETRY_TIME_UNIT_MS since the recording started
+    HEATER_TEMP,    // 0.01°C
+    BOX_TEMP,       // 0.01°C
+    HUMIDITY,       // 0.01 %RH
+    PWM,            // Heater PWM, 0-PWM_MAX
+    P_TERM,         // 0.1 PWM counts
+    I_TERM,         // 0.1 PWM counts
+    D_TERM          // 0.1 PWM counts
+};
+
+constexpr uint8_t TELEMETRY_FIELDS = 8;
+constexpr float TELEMETRY_TERM_SCALE = 10.0f;
+
+/**
+ * TelemetrySample - One control tick in fixed point
+ *
+ * Scales as TelemetryField. Samples are compared and delta-encoded
+ * as integers, so what decodes is exactly what was encoded.
+ */
+struct TelemetrySample {
+    int32_t values[TELEMETRY_FIELDS];
+
+    TelemetrySample() {
+        memset(values, 0, sizeof(values));
+    }
+
+    static int32_t encodeTerm(float term) {
+        float scaled = constrain(term, -100000.0f, 100000.0f) * TELEMETRY_TERM_SCALE;
+        return static_cast<int32_t>(scaled >= 0 ? scaled + 0.5f : scaled - 0.5f);
+    }
+
+    static TelemetrySample from(uint32_t elapsedMillis, float heaterTemp, float boxTemp,
+                                float humidity, float pwmOutput, const PIDTerms& terms) {
+        TelemetrySample sample;
+        sample.set(TelemetryField::TIME, static_cast<int32_t>(elapsedMillis / TELEMETRY_TIME_UNIT_MS));
+        sample.set(TelemetryField::HEATER_TEMP, HistorySample::encodeTemp(heaterTemp));
+        sample.set(TelemetryField::BOX_TEMP, HistorySample::encodeTemp(boxTemp));
+        sample.set(TelemetryField::HUMIDITY, HistorySample::encodeHumidity(humidity));
+        sample.set(TelemetryField::PWM, HistorySample::encodePWM(pwmOutput));
+        sample.set(TelemetryField::P_TERM, encodeTerm(terms.proportional));
+        sample.set(TelemetryField::I_TERM, encodeTerm(terms.integral));
+        sample.set(TelemetryField::D_TERM, encodeTerm(terms.derivative));
+        return sample;
+    }
+
+    int32_t get(TelemetryField field) const { return values[static_cast<uint8_t>(field)]; }
+    void set(TelemetryField field, int32_t value) { values[static_cast<uint8_t>(field)] = value; }
+
+    uint32_t getTimeMillis() const { return static_cast<uint32_t>(get(TelemetryField::TIME)) * TELEMETRY_TIME_UNIT_MS; }
+    float getHeaterTemp() const { return get(TelemetryField::HEATER_TEMP) / 100.0f; }
+    float getBoxTemp() const { return get(TelemetryField::BOX_TEMP) / 100.0f; }
+    float getHumidity() const { return get(TelemetryField::HUMIDITY) / 100.0f; }
+    uint8_t getPWM() const { return static_cast<uint8_t>(get(TelemetryField::PWM)); }
+    float getPTerm() const { return get(TelemetryField::P_TERM) / TELEMETRY_TERM_SCALE; }
+    float getITerm() const { return get(TelemetryField::I_TERM) / TELEMETRY_TERM_SCALE; }
+    float getDTerm() const { return get(TelemetryField::D_TERM) / TELEMETRY_TERM_SCALE; }
+
+    bool operator==(const TelemetrySample& other) const {
+        return memcmp(values, other.values, sizeof(values)) == 0;
+    }
+};
+
+/**
+ * TelemetryCodec - zigzag + LEB128 varints
+ */
+namespace TelemetryCodec {
+    // Worst case for one sample: mask byte + a 5-byte varint per field
+    constexpr size_t MAX_SAMPLE_BYTES = 1 + TELEMETRY_FIELDS * 5;
+
+    inline uint32_t zigzag(int32_t value) {
+        return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+    }
+
+    inline int32_t unzigzag(uint32_t value) {
+        return static_cast<int32_t>((value >> 1) ^ (~(value & 1) + 1));
+    }
+
+    // @return bytes written (1-5)
+    inline size_t putVarint(uint8_t* out, uint32_t value) {
+        size_t length = 0;
+        while (value >= 0x80) {
+            out[length++] = static_cast<uint8_t>(value | 0x80);
+            value >>= 7;
+        }
+        out[length++] = static_cast<uint8_t>(value);
+        return length;
+    }
+
+    // @return bytes consumed, 0 if the varint runs past `end` or is too long
+    inline size_t getVarint(const uint8_t* in, const uint8_t* end, uint32_t& value) {
+        value = 0;
+        for (size_t i = 0; i < 5 && in + i < end; i++) {
+            value |= static_cast<uint32_t>(in[i] & 0x7F) << (7 * i);
+            if ((in[i] & 0x80) == 0) {
+                return i + 1;
+            }
+        }
+        return 0;
+    }
+}
+
+/**
+ * TelemetryPageEncoder - Fills one TelemetryPage with delta-encoded samples
+ *
+ * Per sample: a mask byte with one bit per field that changed, then a
+ * zigzag varint per set bit. Value fields store the difference from the
+ * previous sample; the time field stores the change of the interval
+ * (delta of delta), which is zero at a steady 1 Hz. A steady tick with
+ * two moving channels costs 3-4 bytes instead of 32.
+ *
+ * The first sample of a page is encoded against zero - a keyframe - so
+ * every page decodes on its own and a lost page loses only its samples.
+ *
+ * Does NOT:
+ * - Allocate, or own the page (the recorder's double buffer does)
+ * - Assign sequence or recording numbers (TelemetryLogFile does)
+ */
+class TelemetryPageEncoder {
+private:
+    TelemetryPage* page;
+    TelemetrySample previous;
+    int32_t previousInterval;
+
+public:
+    TelemetryPageEncoder() : page(nullptr), previousInterval(0) {}
+
+    // Start an empty page whose first sample is `firstSample` of the recording
+    void reset(TelemetryPage& target, uint32_t firstSample) {
+        page = &target;
+        memset(page, 0, sizeof(*page));
+        page->header.firstSample = firstSample;
+        previous = TelemetrySample();
+        previousInterval = 0;
+    }
+
+    /**
+     * @return false if the sample does not fit; the page is unchanged
+     */
+    bool append(const TelemetrySample& sample) {
+        if (!page) {
+            return false;
+        }
+
+        uint8_t encoded[TelemetryCodec::MAX_SAMPLE_BYTES];
+        uint8_t mask = 0;
+        size_t length = 1;
+        int32_t interval = sample.values[0] - previous.values[0];
+
+        for (uint8_t field = 0; field < TELEMETRY_FIELDS; field++) {
+            int32_t delta = field == 0
+                          ? interval - previousInterval
+                          : sample.values[field] - previous.values[field];
+            if (delta != 0) {
+                mask |= static_cast<uint8_t>(1u << field);
+                length += TelemetryCodec::putVarint(encoded + length, TelemetryCodec::zigzag(delta));
+            }
+        }
+        encoded[0] = mask;
+
+        TelemetryPageHeader& header = page->header;
+        if (header.payloadBytes + length > TELEMETRY_PAYLOAD_BYTES) {
+            return false;
+        }
+        memcpy(page->payload + header.payloadBytes, encoded, length);
+        header.payloadBytes += static_cast<uint16_t>(length);
+        header.sampleCount++;
+
+        previous = sample;
+        previousInterval = interval;
+        return true;
+    }
+
+    // Magic, version and payload CRC; sequence/recording and the header CRC come from the log
+    void seal(uint8_t flags) {
+        if (!page) {
+            return;
+        }
+        page->header.magic = TELEMETRY_PAGE_MAGIC;
+        page->header.version = TELEMETRY_PAGE_VERSION;
+        page->header.flags = flags;
+        page->header.payloadCrc = telemetryPayloadCrc(*page);
+    }
+
+    uint16_t getSampleCount() const {
+        return page ? page->header.sampleCount : 0;
+    }
+
+    uint16_t getPayloadBytes() const {
+        return page ? page->header.payloadBytes : 0;
+    }
+};
+
+/**
+ * TelemetryPageDecoder - Reads the samples back out of one page
+ *
+ * Checks the payload CRC up front; a torn or overwritten page yields no
+ * samples.
+ */
+class TelemetryPageDecoder {
+private:
+    const TelemetryPage& page;
+    const uint8_t* cursor;
+    const uint8_t* end;
+    uint16_t remaining;
+    bool valid;
+    TelemetrySample previous;
+    int32_t previousInterval;
+
+public:
+    explicit TelemetryPageDecoder(const TelemetryPage& source)
+        : page(source),
+          cursor(source.payload),
+          end(source.payload),
+          remaining(0),
+          valid(false),
+          previousInterval(0) {
+        if (page.header.payloadBytes <= TELEMETRY_PAYLOAD_BYTES &&
+            page.header.payloadCrc == telemetryPayloadCrc(page)) {
+            end = page.payload + page.header.payloadBytes;
+            remaining = page.header.sampleCount;
+            valid = true;
+        }
+    }
+
+    bool isValid() const {
+        return valid;
+    }
+
+    /**
+     * @return false at the end of the page or on a malformed sample
+     */
+    bool next(TelemetrySample& out) {
+        if (remaining == 0 || cursor >= end) {
+            return false;
+        }
+
+        uint8_t mask = *cursor++;
+        TelemetrySample sample = previous;
+        int32_t interval = previousInterval;
+
+        for (uint8_t field = 0; field < TELEMETRY_FIELDS; field++) {
+            int32_t delta = 0;
+            if (mask & (1u << field)) {
+                uint32_t raw;
+                size_t length = TelemetryCodec::getVarint(cursor, end, raw);
+                if (length == 0) {
+                    remaining = 0;
+                    return false;
+                }
+                cursor += length;
+                delta = TelemetryCodec::unzigzag(raw);
+            }
+            if (field == 0) {
+                interval += delta;
+                sample.values[0] = previous.values[0] + interval;
+            } else {
+                sample.values[field] += delta;
+            }
+        }
+
+        previous = sample;
+        previousInterval = interval;
+        remaining--;
+        out = sample;
+        return true;
+    }
+};
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef TELEMETRY_RECORDER_H
+#define TELEMETRY_RECORDER_H
+
+#include "TelemetryCodec.h"
+#include "../interfaces/ISettingsStorage.h"
+#include "../Types.h"
+#include "../Config.h"
+
+/**
+ * TelemetryRecorder - Every control tick of a heated stretch, to flash
+ *
+ * Dryer feeds it from the PID step (heater/box/humidity, PWM and the
+ * P/I/D terms). Samples are encoded into the active half of a double
+ * buffer; a full page is handed to storage (write-behind) and encoding
+ * continues in the other half while the worker programs it. The control
+ * path never waits on flash: if the other half is still being written
+ * when the active one fills, the full page is dropped and counted.
+ *
+ * A recording starts with begin() and closes with finish(); pause()
+ * hands the partial page over so a long pause holds nothing in RAM. What
+ * is lost on a power cut is the unwritten part of the active page (at
+ * most one page, about a minute at 1 Hz).
+ *
+ * Does NOT:
+ * - Know the file layout or number recordings (TelemetryLogFile does)
+ * - Decide when the dryer is heating (Dryer calls it while RUNNING)
+ */
+class TelemetryRecorder {
+private:
+    ISettingsStorage* storage;
+    TelemetryPageBuffer buffers[2];
+    uint8_t active;                 // Never pending
+    TelemetryPageEncoder encoder;
+
+    bool recording;
+    bool opened;                    // First page of the recording handed over
+    uint32_t startMillis;
+    uint32_t sampleIndex;
+
+    uint32_t pagesWritten;
+    uint32_t pagesDropped;
+
+    // Hand the active page to storage and continue in the other half
+    void rotate() {
+        if (encoder.getSampleCount() == 0) {
+            return;
+        }
+
+        uint8_t next = 1 - active;
+        if (buffers[next].isPending()) {
+            // Worker still busy with the previous page: lose this one, not the tick
+            pagesDropped++;
+            encoder.reset(buffers[active].page, sampleIndex);
+            return;
+        }
+
+        TelemetryPageBuffer& full = buffers[active];
+        encoder.seal(opened ? 0 : TELEMETRY_PAGE_FIRST);
+        full.pending.store(true, std::memory_order_release);
+        if (storage->saveTelemetryPage(full)) {
+            opened = true;
+            pagesWritten++;
+        } else {
+            full.release();
+            pagesDropped++;
+        }
+
+        active = next;
+        encoder.reset(buffers[active].page, sampleIndex);
+    }
+
+public:
+    explicit TelemetryRecorder(ISettingsStorage* settingsStorage)
+        : storage(settingsStorage),
+          active(0),
+          recording(false),
+          opened(false),
+          startMillis(0),
+          sampleIndex(0),
+          pagesWritten(0),
+          pagesDropped(0) {
+    }
+
+    // Start a new recording (any open one is closed first)
+    void begin(uint32_t currentMillis) {
+        finish();
+        recording = true;
+        opened = false;
+        startMillis = currentMillis;
+        sampleIndex = 0;
+        encoder.reset(buffers[active].page, 0);
+    }
+
+    void record(uint32_t currentMillis, float heaterTemp, float boxTemp, float humidity,
+                float pwmOutput, const PIDTerms& terms) {
+        if (!recording) {
+            return;
+        }
+
+        TelemetrySample sample = TelemetrySample::from(currentMillis - startMillis, heaterTemp,
+                                                       boxTemp, humidity, pwmOutput, terms);
+        if (!encoder.append(sample)) {
+            rotate();
+            encoder.append(sample);   // Always fits an empty page
+        }
+        sampleIndex++;
+    }
+
+    // Heating paused: write what is buffered, keep the recording open
+    void pause() {
+        if (recording) {
+            rotate();
+        }
+    }
+
+    // Cycle over: write the partial page and close the recording
+    void finish() {
+        if (!recording) {
+            return;
+        }
+        rotate();
+        recording = false;
+    }
+
+    bool isRecording() const { return recording; }
+    uint32_t getSampleCount() const { return sampleIndex; }
+    uint32_t getPagesWritten() const { return pagesWritten; }
+    uint32_t getPagesDropped() const { return pagesDropped; }
+};
+
+#endif
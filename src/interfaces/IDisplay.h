@@ -34,6 +34,9 @@ public:
     virtual void setTextSize(uint8_t size) = 0;
     virtual void print(const String& text) = 0;
     virtual void println(const String& text) = 0;
+
+    // Panel power (contrast / on-off), contents are preserved
+    virtual void setPowerMode(DisplayPowerMode mode) = 0;
 };
 
 #endif
\ No newline at end of file
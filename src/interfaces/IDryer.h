@@ -53,6 +53,10 @@ public:
     virtual void setSoundEnabled(bool enabled) = 0;
     virtual bool isSoundEnabled() const = 0;
 
+    // Spool scale (no-ops returning false without a weight sensor)
+    virtual bool tareScale() = 0;
+    virtual bool calibrateScale(float knownMassGrams) = 0;
+
     // State queries
     virtual DryerState getState() const = 0;
     virtual CurrentStats getCurrentStats() const = 0;
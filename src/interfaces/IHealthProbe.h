@@ -0,0 +1,35 @@
+#ifndef I_HEALTH_PROBE_H
+#define I_HEALTH_PROBE_H
+
+#include <stdint.h>
+
+// One allocator reading (bytes)
+struct HeapSample {
+    uint32_t freeBytes;
+    uint32_t largestFreeBlock;
+    uint32_t minEverFreeBytes;
+
+    HeapSample() : freeBytes(0), largestFreeBlock(0), minEverFreeBytes(0) {}
+};
+
+/**
+ * Interface for Health Probe
+ *
+ * Responsibilities:
+ * - Read allocator figures (free heap, largest free block, low-water mark)
+ * - Read a task's stack high-water mark
+ *
+ * Does NOT:
+ * - Keep history or decide what is unhealthy (HealthMonitor does this)
+ */
+class IHealthProbe {
+public:
+    virtual ~IHealthProbe() = default;
+
+    virtual HeapSample sampleHeap() = 0;
+
+    // Bytes of the task's stack never used; task is a FreeRTOS TaskHandle_t
+    virtual uint32_t stackFreeBytes(void* task) = 0;
+};
+
+#endif
@@ -2,6 +2,8 @@
 #define I_MENU_CONTROLLER_H
 
 #include "../Types.h"
+#include "../diagnostics/HealthStats.h"
+#include "../storage/CycleRecord.h"
 #include <vector>
 
 /**
@@ -43,6 +45,8 @@ public:
     virtual void setPIDProfile(const String& profile) = 0;
     virtual void setSoundEnabled(bool enabled) = 0;
     virtual void setRemainingTime(uint32_t seconds) = 0;
+    virtual void setHealthStats(const HealthStats& health) = 0;  // Shown under System Info
+    virtual void setCycleHistory(const CycleRecord* cycles, uint8_t count) = 0;  // Newest first, shown under History
 
     // Callbacks
     virtual void registerSelectionCallback(MenuSelectionCallback callback) = 0;
@@ -22,6 +22,15 @@ public:
     virtual float compute(float setpoint, float boxTemp, float heaterTemp, uint32_t currentMillis) = 0;
 
     virtual void reset() = 0;
+
+    // P, I and D of the last compute() (all zero after reset)
+    virtual PIDTerms getLastTerms() const = 0;
+
+    // Integrator and learned steady-state output, to carry over a reset
+    virtual PIDRecoveryState getRecoveryState() const = 0;
+
+    // After begin()/reset(): continue from `state` instead of from zero
+    virtual void restoreRecoveryState(const PIDRecoveryState& state) = 0;
 };
 
 #endif
\ No newline at end of file
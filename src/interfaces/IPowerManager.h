@@ -0,0 +1,35 @@
+#ifndef I_POWER_MANAGER_H
+#define I_POWER_MANAGER_H
+
+#include "../Types.h"
+
+/**
+ * Interface for Power Manager
+ *
+ * Responsibilities:
+ * - Track user activity (buttons, serial commands)
+ * - Step READY/FINISHED idle through DIMMED and SLEEPING
+ * - Slow sensor sampling and dim/blank the OLED while idle
+ * - Spend the loop's spare time in light sleep when SLEEPING
+ *
+ * Does NOT:
+ * - Change dryer state or touch the heater
+ * - Poll buttons (activity is reported to it)
+ */
+class IPowerManager {
+public:
+    virtual ~IPowerManager() = default;
+
+    virtual void begin(uint32_t currentMillis) = 0;
+    virtual void update(uint32_t currentMillis) = 0;
+
+    // Any user input; returns to ACTIVE immediately
+    virtual void notifyActivity(uint32_t currentMillis) = 0;
+
+    // Spend ms of idle loop time (delay or light sleep, depending on mode)
+    virtual void idle(uint32_t ms, uint32_t currentMillis) = 0;
+
+    virtual PowerMode getMode() const = 0;
+};
+
+#endif
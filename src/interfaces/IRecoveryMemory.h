@@ -0,0 +1,31 @@
+#ifndef I_RECOVERY_MEMORY_H
+#define I_RECOVERY_MEMORY_H
+
+#include "../Types.h"
+
+/**
+ * Interface for reset-surviving recovery memory
+ *
+ * Responsibilities:
+ * - Hold the latest RecoverySnapshot across a watchdog, brown-out or
+ *   software reset (written by Dryer every tick - no flash involved)
+ * - Tell an intact snapshot from leftover or half-written memory
+ *
+ * Does NOT:
+ * - Survive a power cut (the flash runtime journal covers that)
+ * - Decide which states are recoverable (Dryer does this)
+ */
+class IRecoveryMemory {
+public:
+    virtual ~IRecoveryMemory() = default;
+
+    /**
+     * The newest intact snapshot written before this boot
+     * @return false if there is none (power-on, damaged, other layout)
+     */
+    virtual bool load(RecoverySnapshot& out) = 0;
+
+    virtual void store(const RecoverySnapshot& snapshot) = 0;
+};
+
+#endif
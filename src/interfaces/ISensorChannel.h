@@ -0,0 +1,70 @@
+#ifndef I_SENSOR_CHANNEL_H
+#define I_SENSOR_CHANNEL_H
+
+#include "../Types.h"
+
+/**
+ * Result of starting a sample on a sensor channel
+ *
+ * PENDING - Acquisition started, poll isSampleReady() on later updates
+ * READY   - Result available immediately (synchronous drivers)
+ */
+enum class SampleStatus : uint8_t {
+    PENDING,
+    READY
+};
+
+/**
+ * Interface for a SensorManager channel driver
+ *
+ * A channel is one physical sensor (or one mux position) producing one or
+ * more values per sample, e.g. temperature + humidity.
+ *
+ * Responsibilities:
+ * - Start an acquisition without blocking
+ * - Report when the acquisition has completed
+ * - Read and validate the result
+ * - Report sensor status
+ *
+ * Does NOT:
+ * - Manage update timing (handled by SensorManager)
+ * - Fire callbacks (handled by SensorManager)
+ * - Enforce limits or interpret values
+ */
+class ISensorChannel {
+public:
+    virtual ~ISensorChannel() = default;
+
+    virtual void begin() = 0;
+
+    // Async acquisition pattern (non-blocking)
+    virtual SampleStatus startSample() = 0;
+    virtual bool isSampleReady() = 0;
+    virtual bool readSample() = 0;
+
+    // Values of the last successful sample
+    virtual uint8_t getValueCount() const = 0;
+    virtual float getValue(uint8_t index) const = 0;
+
+    virtual SensorType getSensorType() const = 0;
+    virtual bool isValid() const = 0;
+    virtual String getLastError() const = 0;
+};
+
+// Returned by SensorManager::registerChannel() when the registry is full
+constexpr uint8_t INVALID_SENSOR_CHANNEL = 0xFF;
+
+/**
+ * Per-channel schedule registered with SensorManager
+ */
+struct SensorChannelConfig {
+    uint32_t intervalMs;         // Period between acquisitions
+    uint32_t validityTimeoutMs;  // Reading is reported invalid once older than this (0 = never)
+    bool primeOnBegin;           // Start first acquisition in begin() for a faster first reading
+
+    SensorChannelConfig() : intervalMs(1000), validityTimeoutMs(0), primeOnBegin(false) {}
+    SensorChannelConfig(uint32_t interval, uint32_t timeout, bool prime = false)
+        : intervalMs(interval), validityTimeoutMs(timeout), primeOnBegin(prime) {}
+};
+
+#endif
@@ -2,16 +2,20 @@
 #define I_SENSOR_MANAGER_H
 
 #include "../Types.h"
+#include "ISensorChannel.h"
+#include "../diagnostics/SensorChannelStats.h"
 
 /**
  * Interface for SensorManager
  *
  * Responsibilities:
  * - Coordinate reading from multiple sensors at different rates
+ * - Keep a registry of sensor channels, each with its own schedule
  * - Maintain cached readings with timestamps and validity
  * - Push interface: Fire callbacks on new readings
  * - Pull interface: Provide cached values on demand
  * - Detect and report sensor failures
+ * - Keep per-channel acquisition histograms (latency, age, error streaks)
  *
  * Does NOT:
  * - Process or interpret readings
@@ -31,13 +35,31 @@ public:
     virtual void registerBoxDataCallback(BoxDataCallback callback) = 0;
     virtual void registerSensorErrorCallback(SensorErrorCallback callback) = 0;
 
-    // Getters (pull interface)
+    // Getters (pull interface). A reading older than its channel's validity
+    // timeout (SENSOR_TIMEOUT for heater and box) is reported invalid; the
+    // last value is still returned
     virtual SensorReadings getReadings() const = 0;
     virtual float getHeaterTemp() const = 0;
     virtual float getBoxTemp() const = 0;
     virtual float getBoxHumidity() const = 0;
     virtual bool isHeaterTempValid() const = 0;
     virtual bool isBoxDataValid() const = 0;
+
+    // Channel registry (heater and box are built-in channels)
+    virtual uint8_t registerChannel(ISensorChannel* channel, const SensorChannelConfig& config) = 0;
+    virtual void registerChannelCallback(SensorChannelCallback callback) = 0;
+    virtual uint8_t getChannelCount() const = 0;
+    virtual uint8_t findChannel(SensorType type) const = 0;   // INVALID_SENSOR_CHANNEL if none
+    virtual SensorReading getChannelReading(uint8_t channel, uint8_t valueIndex = 0) const = 0;
+
+    // Diagnostics
+    virtual const SensorChannelStats* getChannelStats(uint8_t channel) const = 0;
+    virtual void resetChannelStats() = 0;
+
+    // Idle power: stretch every channel's interval to at least intervalMs
+    // (0 = configured rates). Lowering it samples every channel on the next update.
+    virtual void setMinInterval(uint32_t intervalMs) = 0;
+    virtual uint32_t getMinInterval() const = 0;
 };
 
 #endif
\ No newline at end of file
@@ -3,6 +3,8 @@
 #define I_SETTINGS_STORAGE_H
 
 #include "../Types.h"
+#include "../storage/CycleRecord.h"
+#include "../storage/TelemetryPage.h"
 #ifndef UNIT_TEST
     #include <Arduino.h>
 #else
@@ -13,13 +15,25 @@
  * Interface for Settings Storage
  *
  * Responsibilities:
- * - Persist user settings (custom preset, selected preset, PID profile, sound)
+ * - Persist user settings (custom preset, selected preset, PID profile, sound,
+ *   spool scale calibration)
  * - Save/restore runtime state for power recovery
  * - Handle corruption and graceful degradation
+ * - Coalesce setting changes: save*() only marks a setting dirty; update()
+ *   writes once the changes settle, flush() writes now
+ * - Never block the caller on flash: writes may be queued and done later
+ *   (write-behind), emergency saves excepted
+ * - Keep a bounded history of finished drying cycles
+ * - Keep a bounded ring of per-tick control telemetry
+ * - Show and apply the settings as JSON (serial debug path)
  *
  * Storage Organization:
- * - Settings: Custom preset, selected preset, PID profile, sound enabled
+ * - Settings: Custom preset, selected preset, PID profile, sound enabled,
+ *   scale calibration
  * - Runtime: Current cycle state for power loss recovery
+ * - Cycle history: One CycleRecord per finished cycle, oldest rotated out
+ * - Telemetry: Delta-encoded control ticks, one flash page per write,
+ *   oldest pages rotated out
  */
 class ISettingsStorage {
 public:
@@ -30,6 +44,10 @@ public:
     virtual void loadSettings() = 0;
     virtual void saveSettings() = 0;
 
+    // Write coalescing
+    virtual void update(uint32_t currentMillis) = 0;   // Writes dirty settings after the debounce window
+    virtual void flush() = 0;                          // Writes dirty settings now (transitions)
+
     // Custom preset
     virtual void saveCustomPreset(const DryingPreset& preset) = 0;
     virtual DryingPreset loadCustomPreset() = 0;
@@ -46,6 +64,10 @@ public:
     virtual void saveSoundEnabled(bool enabled) = 0;
     virtual bool loadSoundEnabled() = 0;
 
+    // Spool scale calibration
+    virtual void saveScaleCalibration(const ScaleCalibration& calibration) = 0;
+    virtual ScaleCalibration loadScaleCalibration() = 0;
+
     // Runtime state (for power recovery)
     virtual void saveRuntimeState(DryerState state, uint32_t elapsed,
                                    float targetTemp, uint32_t targetTime,
@@ -61,6 +83,18 @@ public:
     virtual float getRuntimeTargetTemp() const = 0;
     virtual uint32_t getRuntimeTargetTime() const = 0;
     virtual PresetType getRuntimePreset() const = 0;
+
+    // Cycle history: `record` is copied; id and CRC are assigned when stored
+    virtual void saveCycleRecord(const CycleRecord& record) = 0;
+
+    // Telemetry: `buffer` is pending and must stay untouched until storage
+    // releases it. Returns false if it was not taken (caller releases it).
+    virtual bool saveTelemetryPage(TelemetryPageBuffer& buffer) = 0;
+
+    // Serial debug path: settings as JSON (SettingsJson.h layout). Call
+    // from the core that owns the storage (DryerBridge with DUAL_CORE_MODE).
+    virtual String exportJson() const = 0;
+    virtual bool importJson(const String& json) = 0;   // Full or partial document
 };
 
 #endif
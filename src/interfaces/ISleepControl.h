@@ -0,0 +1,34 @@
+#ifndef I_SLEEP_CONTROL_H
+#define I_SLEEP_CONTROL_H
+
+#include <stdint.h>
+
+/**
+ * Interface for Sleep Control
+ *
+ * Responsibilities:
+ * - Block the loop for a given time, either as a plain delay or in
+ *   light sleep with the button GPIOs armed as wake sources
+ * - Report whether a button ended the sleep early
+ * - Report whether a host is attached to the serial console, which
+ *   light sleep would leave unserviced
+ *
+ * Does NOT:
+ * - Decide when sleeping is allowed (PowerManager does this)
+ * - Handle the button press itself (ButtonManager still sees it)
+ */
+class ISleepControl {
+public:
+    virtual ~ISleepControl() = default;
+
+    // Ordinary blocking wait, peripherals stay up
+    virtual void wait(uint32_t ms) = 0;
+
+    // Light sleep for up to ms; true if a button woke the chip
+    virtual bool lightSleep(uint32_t ms) = 0;
+
+    // A serial command may arrive at any time: do not light-sleep
+    virtual bool serialHostConnected() = 0;
+};
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef I_TRACE_OUTPUT_H
+#define I_TRACE_OUTPUT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Interface for Trace Output
+ *
+ * Responsibilities:
+ * - Report how many bytes can be written without blocking
+ * - Write encoded trace frames
+ *
+ * Does NOT:
+ * - Encode frames or pace the drain (TraceDrain does this)
+ */
+class ITraceOutput {
+public:
+    virtual ~ITraceOutput() = default;
+
+    virtual size_t availableForWrite() = 0;
+
+    virtual size_t write(const uint8_t* data, size_t length) = 0;
+};
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef I_WEIGHT_SENSOR_H
+#define I_WEIGHT_SENSOR_H
+
+#include "../Types.h"
+
+/**
+ * Interface for Spool Weight Sensor (HX711 load cell amplifier)
+ *
+ * Responsibilities:
+ * - Read raw load cell counts (async)
+ * - Convert counts to grams using tare offset and scale factor
+ * - Tare and calibrate against a known mass
+ * - Report sensor status
+ *
+ * Async Pattern:
+ * - Call requestSample() to start waiting for the next conversion
+ * - The HX711 converts continuously (10 SPS), DOUT goes LOW when ready
+ * - Call isSampleReady() to check if ready
+ * - Call read() to clock out the result
+ *
+ * Does NOT:
+ * - Manage update timing (handled by SensorManager)
+ * - Persist calibration (handled by Dryer via ISettingsStorage)
+ * - Decide when the filament is dry (handled by Dryer)
+ */
+class IWeightSensor {
+public:
+    virtual ~IWeightSensor() = default;
+
+    virtual void begin() = 0;
+
+    // Asynchronous read pattern (non-blocking)
+    virtual void requestSample() = 0;
+    virtual bool isSampleReady() = 0;
+    virtual bool read() = 0;
+
+    virtual float getWeight() const = 0;        // grams, after tare and scale
+    virtual int32_t getRawValue() const = 0;    // last raw 24-bit reading
+
+    // Calibration (uses the average of recent raw readings)
+    virtual bool tare() = 0;
+    virtual bool calibrate(float knownMassGrams) = 0;
+    virtual void setCalibration(const ScaleCalibration& calibration) = 0;
+    virtual ScaleCalibration getCalibration() const = 0;
+    virtual bool isCalibrated() const = 0;
+
+    virtual bool isValid() const = 0;
+    virtual String getLastError() const = 0;
+};
+
+#endif
@@ -23,19 +23,43 @@
 #include "interfaces/IButtonManager.h"
 #include "interfaces/IMenuController.h"
 #include "interfaces/IFanControl.h"
+#include "interfaces/IWeightSensor.h"
+#include "interfaces/IPowerManager.h"
+#include "interfaces/ISleepControl.h"
+#include "interfaces/IRecoveryMemory.h"
 
 // Implementations
 #include "sensors/HeaterTempSensor.h"
 #include "sensors/BoxTempHumiditySensor.h"
 #include "sensors/SensorManager.h"
+#include "sensors/SpoolWeightSensor.h"
+#include "sensors/SensorChannelAdapters.h"
 #include "control/HeaterControl.h"
 #include "control/PIDController.h"
 #include "control/SafetyMonitor.h"
 #include "control/FanControl.h"
+#include "control/PowerManager.h"
+#include "control/SleepControl.h"
 #include "userInterface/OLEDDisplay.h"
 #include "userInterface/ButtonManager.h"
 #include "userInterface/MenuController.h"
 #include "userInterface/UIController.h"
+#include "history/SensorHistory.h"
+#include "history/TelemetryCodec.h"
+#include "scheduler/TaskScheduler.h"
+#include "diagnostics/PerfCounters.h"
+#include "diagnostics/Log.h"
+#include "diagnostics/Trace.h"
+#include "diagnostics/TraceDrain.h"
+#include "diagnostics/SerialTraceOutput.h"
+#include "diagnostics/HealthMonitor.h"
+#include "diagnostics/EspHealthProbe.h"
+#include "memory/StaticSlot.h"
+#ifdef DUAL_CORE_MODE
+    #include "concurrency/DryerLink.h"
+    #include "concurrency/DryerBridge.h"
+    #include "concurrency/DryerProxy.h"
+#endif
 
 #include "Dryer.h"
 
@@ -44,6 +68,7 @@
 #else
     #include "storage/SettingsStorage.h"
 #endif
+#include "storage/RtcRecoveryMemory.h"
 
 // Watchdog configuration
 constexpr uint32_t WATCHDOG_TIMEOUT_SECONDS = 10;  // Reset if loop doesn't run for 10 seconds
@@ -51,6 +76,8 @@ constexpr uint32_t WATCHDOG_TIMEOUT_SECONDS = 10;  // Reset if loop doesn't run
 // Global component pointers
 IHeaterTempSensor* heaterSensor = nullptr;
 IBoxTempHumiditySensor* boxSensor = nullptr;
+IWeightSensor* weightSensor = nullptr;
+ISensorChannel* weightChannel = nullptr;
 ISensorManager* sensorManager = nullptr;
 IDisplay* oledDisplay = nullptr;
 IHeaterControl* heaterControl = nullptr;
@@ -59,17 +86,817 @@ ISafetyMonitor* safetyMonitor = nullptr;
 ISettingsStorage* settingsStorage = nullptr;
 ISoundController* soundController = nullptr;
 IFanControl* fanControl = nullptr;
+IRecoveryMemory* recoveryMemory = nullptr;
 IDryer* dryer = nullptr;
+IDryer* uiDryer = nullptr;  // What UI and serial talk to: the Dryer itself, or its proxy when split across cores
 IButtonManager* buttonManager = nullptr;
 IMenuController* menuController = nullptr;
 UIController* uiController = nullptr;
+ISleepControl* sleepControl = nullptr;
+IPowerManager* powerManager = nullptr;
+SensorHistory* sensorHistory = nullptr;
+HealthMonitor* healthMonitor = nullptr;
+TraceDrain* traceDrain = nullptr;
+TaskScheduler* scheduler = nullptr;
+
+#ifdef DUAL_CORE_MODE
+DryerLink* dryerLink = nullptr;
+DryerBridge* dryerBridge = nullptr;
+DryerProxy* dryerProxy = nullptr;
+TaskScheduler* controlScheduler = nullptr;
+TaskHandle_t controlTaskHandle = nullptr;
+TaskHandle_t storageTaskHandle = nullptr;
+#endif
+
+#ifdef UNIT_TEST
+using SettingsStorageImpl = MockSettingsStorage;
+#else
+using SettingsStorageImpl = SettingsStorage;
+#endif
+
+// Firmware Dryer: control path bound to the concrete classes so the
+// calls devirtualize (tests use the interface-wired Dryer)
+#ifdef VIRTUAL_DRYER_WIRING
+using StaticDryer = Dryer;
+#else
+using StaticDryer = BasicDryer<SensorManager, HeaterControl, PIDController,
+                               SafetyMonitor, SettingsStorageImpl>;
+#endif
+
+// Recovery snapshot in RTC slow memory: not cleared by the startup code,
+// so it survives watchdog, brown-out and software resets (RtcRecoveryMemory.h)
+RTC_NOINIT_ATTR RtcRecoveryRegion rtcRecoveryRegion;
+
+// Static component storage - every long-lived object is placement-new'd
+// into .bss during setup(), nothing comes from the heap
+StaticSlot<HeaterTempSensor> heaterSensorSlot;
+StaticSlot<BoxTempHumiditySensor> boxSensorSlot;
+StaticSlot<SpoolWeightSensor> weightSensorSlot;
+StaticSlot<SpoolWeightChannel> weightChannelSlot;
+StaticSlot<SensorManager> sensorManagerSlot;
+StaticSlot<OLEDDisplay> oledDisplaySlot;
+StaticSlot<HeaterControl> heaterControlSlot;
+StaticSlot<PIDController> pidControllerSlot;
+StaticSlot<SafetyMonitor> safetyMonitorSlot;
+StaticSlot<FanControl> fanControlSlot;
+StaticSlot<SettingsStorageImpl> settingsStorageSlot;
+StaticSlot<RtcRecoveryMemory> recoveryMemorySlot;
+StaticSlot<StaticDryer> dryerSlot;
+StaticSlot<SensorHistory> sensorHistorySlot;
+StaticSlot<EspHealthProbe> healthProbeSlot;
+StaticSlot<HealthMonitor> healthMonitorSlot;
+StaticSlot<SerialTraceOutput> traceOutputSlot;
+StaticSlot<TraceDrain> traceDrainSlot;
+StaticSlot<ButtonManager> buttonManagerSlot;
+StaticSlot<MenuController> menuControllerSlot;
+StaticSlot<SleepControl> sleepControlSlot;
+StaticSlot<PowerManager> powerManagerSlot;
+StaticSlot<UIController> uiControllerSlot;
+StaticSlot<TaskScheduler> schedulerSlot;
+
+#ifdef DUAL_CORE_MODE
+StaticSlot<DryerLink> dryerLinkSlot;
+StaticSlot<DryerBridge> dryerBridgeSlot;
+StaticSlot<DryerProxy> dryerProxySlot;
+StaticSlot<TaskScheduler> controlSchedulerSlot;
+#endif
 
 
 // Serial command buffer
 String serialCommand = "";
-constexpr size_t MAX_SERIAL_COMMAND_LENGTH = 100;  // Prevent buffer overflow
+constexpr size_t MAX_SERIAL_COMMAND_LENGTH = 256;  // Prevent buffer overflow (fits `settings import` of a full export)
+
+// Boot path (times are millis() since reset; the ROM/2nd-stage bootloader
+// runs before millis() starts and is not included)
+uint32_t setupStartMillis = 0;
+volatile uint32_t firstControlTickMillis = 0;  // 0 until the first control tick
+bool bootReported = false;
+bool displayStarted = false;
+uint32_t constructionHeapBytes = 0;
+String storageErrorMessage = "";  // Non-empty: shown on the splash
+
+
+
+/**
+ * Print one histogram as a single line: count, min/p50/p99/max
+ */
+template <uint8_t BUCKETS>
+void printHistogram(const char* label, const Histogram<BUCKETS>& histogram, const char* unit) {
+    Serial.print("  ");
+    Serial.print(label);
+    Serial.print(": n=");
+    Serial.print(histogram.getCount());
+    if (histogram.getCount() > 0) {
+        Serial.print(" min=");
+        Serial.print(histogram.getMin());
+        Serial.print(" p50<=");
+        Serial.print(histogram.getPercentile(50));
+        Serial.print(" p99<=");
+        Serial.print(histogram.getPercentile(99));
+        Serial.print(" max=");
+        Serial.print(histogram.getMax());
+        Serial.print(unit);
+    }
+    Serial.println();
+}
+
+#ifdef DUAL_CORE_MODE
+/**
+ * Ask the control core for one channel's counters and wait for the reply
+ * (a control tick or two; the serial handler may block briefly)
+ */
+bool fetchSensorStats(uint8_t channel, SensorStatsReply& reply) {
+    uint32_t previousSerial = dryerProxy->getSensorStatsSerial();
+    if (!dryerProxy->requestSensorStats(channel)) {
+        return false;
+    }
+    uint32_t start = millis();
+    while (!dryerProxy->readSensorStats(previousSerial, reply)) {
+        if (millis() - start >= DIAGNOSTICS_REPLY_TIMEOUT_MS) {
+            return false;
+        }
+        delay(1);
+    }
+    return reply.channel == channel;
+}
+#endif
+
+/**
+ * Print acquisition diagnostics for every registered sensor channel
+ */
+void printSensorDiagnostics() {
+    Serial.println("\n========== SENSOR DIAGNOSTICS ==========");
+
+    // The channel table is fixed once setup() has registered the scale
+    for (uint8_t channel = 0; channel < sensorManager->getChannelCount(); channel++) {
+#ifdef DUAL_CORE_MODE
+        // The counters belong to the control core: print its copy
+        SensorStatsReply reply;
+        if (!fetchSensorStats(channel, reply)) {
+            Serial.print("Channel ");
+            Serial.print(channel);
+            Serial.println(": no reply from control core");
+            continue;
+        }
+        if (!reply.found) {
+            continue;
+        }
+        const SensorChannelStats* stats = &reply.stats;
+#else
+        const SensorChannelStats* stats = sensorManager->getChannelStats(channel);
+        if (!stats) {
+            continue;
+        }
+#endif
+
+        Serial.print("Channel ");
+        Serial.print(channel);
+        if (channel == SensorManager::HEATER_CHANNEL) {
+            Serial.print(" (heater)");
+        } else if (channel == SensorManager::BOX_CHANNEL) {
+            Serial.print(" (box)");
+        } else if (channel == sensorManager->findChannel(SensorType::SPOOL_WEIGHT)) {
+            Serial.print(" (scale)");
+        }
+        Serial.println(":");
+
+        printHistogram("Read duration  ", stats->readDurationUs, "us");
+        printHistogram("Conversion wait", stats->conversionWaitMs, "ms");
+        printHistogram("Sample age     ", stats->sampleAgeMs, "ms");
+        printHistogram("Error streaks  ", stats->errorStreaks, "");
+
+        Serial.print("  Current streak: ");
+        Serial.print(stats->currentErrorStreak);
+        Serial.print(", skipped samples: ");
+        Serial.println(stats->skippedSamples);
+    }
+
+    Serial.println("========================================\n");
+}
+
+/**
+ * Print period, deadline and timing record for every task in a scheduler
+ */
+void printTaskDiagnostics(const TaskScheduler* taskScheduler) {
+    for (uint8_t id = 0; id < taskScheduler->getTaskCount(); id++) {
+        const TaskStats* stats = taskScheduler->getTaskStats(id);
+
+        Serial.print(stats->name);
+        Serial.print(": every ");
+        Serial.print(stats->periodMs);
+        Serial.print("ms, deadline ");
+        Serial.print(stats->deadlineMs);
+        Serial.println("ms");
+
+        printHistogram("Execution", stats->executionMs, "ms");
+
+        Serial.print("  Runs: ");
+        Serial.print(stats->runs);
+        Serial.print(", overruns: ");
+        Serial.print(stats->overruns);
+        Serial.print(", skipped: ");
+        Serial.print(stats->skippedReleases);
+        Serial.print(", worst response: ");
+        Serial.print(stats->maxResponseMs);
+        Serial.println("ms");
+    }
+}
+
+/**
+ * Print min/avg/p99/max for every profiled zone that has run, then clear them
+ */
+void printPerfCounters() {
+    Serial.println("\n============ LOOP PROFILE (us) ============");
+#ifdef PERF_PROFILING
+    for (uint8_t i = 0; i < static_cast<uint8_t>(PerfZone::COUNT); i++) {
+        PerfZone zone = static_cast<PerfZone>(i);
+        if (!perfCounters().hasSamples(zone)) {
+            continue;
+        }
+        const PerfCounters::ZoneHistogram& histogram = perfCounters().get(zone);
+
+        Serial.print("  ");
+        Serial.print(perfZoneName(zone));
+        Serial.print(": n=");
+        Serial.print(histogram.getCount());
+        Serial.print(" min=");
+        Serial.print(histogram.getMin());
+        Serial.print(" avg=");
+        Serial.print(histogram.getMean());
+        Serial.print(" p99<=");
+        Serial.print(histogram.getPercentile(99));
+        Serial.print(" max=");
+        Serial.println(histogram.getMax());
+    }
+
+    // Each zone is cleared by its own writer (control, storage or UI core)
+    perfCounters().requestReset();
+    Serial.println("(counters reset)");
+#else
+    Serial.println("  Profiling not built in (define PERF_PROFILING in Config.h)");
+#endif
+    Serial.println("===========================================\n");
+}
+
+/**
+ * Heap/stack health: latest sample, minima since boot, hourly trend
+ */
+void printHealth() {
+    const HealthStats& health = healthMonitor->getStats();
+
+    Serial.println("\n============= SYSTEM HEALTH =============");
+    if (health.sampleCount == 0) {
+        Serial.println("  No samples yet");
+        Serial.println("=========================================\n");
+        return;
+    }
+
+    Serial.print("  Free heap:     ");
+    Serial.print(health.freeHeap);
+    Serial.print(" B (min sampled ");
+    Serial.print(health.minFreeHeap);
+    Serial.print(", min ever ");
+    Serial.print(health.minEverFreeHeap);
+    Serial.println(")");
+
+    Serial.print("  Largest block: ");
+    Serial.print(health.largestFreeBlock);
+    Serial.print(" B (min ");
+    Serial.print(health.minLargestFreeBlock);
+    Serial.println(")");
+
+    Serial.print("  Fragmentation: ");
+    Serial.print(health.fragmentationPercent);
+    Serial.print("% (max ");
+    Serial.print(health.maxFragmentationPercent);
+    Serial.println("%)");
+
+    Serial.println("  Stack never used:");
+    for (uint8_t i = 0; i < health.taskCount; i++) {
+        Serial.print("    ");
+        Serial.print(health.tasks[i].name);
+        Serial.print(": ");
+        Serial.print(health.tasks[i].freeBytes);
+        Serial.println(" B");
+    }
+
+    Serial.println("  Trend (slot minima, free / largest block):");
+    for (uint8_t age = 0; age < healthMonitor->getTrendCount(); age++) {
+        HealthTrendSlot slot = healthMonitor->getTrendSlot(age);
+        Serial.print("    -");
+        Serial.print(age * (HEALTH_TREND_SLOT_MS / 60000));
+        Serial.print(" min: ");
+        Serial.print(slot.minFreeHeap);
+        Serial.print(" / ");
+        Serial.println(slot.minLargestFreeBlock);
+    }
+
+    Serial.print("  Warnings: ");
+    Serial.print(health.warningCount);
+    Serial.println(health.warnings ? " (active)" : "");
+    Serial.println("=========================================\n");
+}
+
+/**
+ * Serial log for the start of a health warning episode
+ */
+void onHealthWarning(uint8_t raised, const HealthStats& health) {
+    if (raised & HEALTH_LOW_HEAP) {
+        Serial.print("⚠ HEALTH: free heap low (");
+        Serial.print(health.freeHeap);
+        Serial.println(" B)");
+    }
+    if (raised & HEALTH_FRAGMENTED) {
+        Serial.print("⚠ HEALTH: heap fragmented, largest block ");
+        Serial.print(health.largestFreeBlock);
+        Serial.print(" B of ");
+        Serial.print(health.freeHeap);
+        Serial.println(" B free");
+    }
+    if (raised & HEALTH_LOW_STACK) {
+        Serial.println("⚠ HEALTH: task stack nearly exhausted (see 'health')");
+    }
+}
 
+/**
+ * Runtime and compile-time log level of each module
+ */
+void printLogLevels() {
+    Serial.println("\n============== LOG LEVELS ==============");
+    for (uint8_t i = 0; i < static_cast<uint8_t>(LogModule::COUNT); i++) {
+        LogModule module = static_cast<LogModule>(i);
+        Serial.print("  ");
+        Serial.print(logModuleName(module));
+        Serial.print(": ");
+        Serial.print(logLevelName(logFilter().getLevel(module)));
+        Serial.print(" (built: ");
+        Serial.print(logLevelName(logCompiledLevel(module)));
+        Serial.println(")");
+    }
+    Serial.println("========================================\n");
+}
 
+/**
+ * `log <module|all> <level>` - set the runtime filter
+ */
+void handleLogCommand(const String& args) {
+    int space = args.indexOf(' ');
+    if (space < 0) {
+        Serial.println("✗ Usage: log <module|all> <none|error|warn|info|debug>");
+        return;
+    }
+    String moduleName = args.substring(0, space);
+    String levelName = args.substring(space + 1);
+
+    LogLevel level;
+    if (!LogFilter::parseLevel(levelName.c_str(), level)) {
+        Serial.print("✗ Unknown log level: ");
+        Serial.println(levelName);
+        return;
+    }
+
+    if (moduleName == "all") {
+        logFilter().setAll(level);
+    } else {
+        LogModule module;
+        if (!LogFilter::parseModule(moduleName.c_str(), module)) {
+            Serial.print("✗ Unknown log module: ");
+            Serial.println(moduleName);
+            return;
+        }
+        logFilter().setLevel(module, level);
+        if (level > logCompiledLevel(module)) {
+            Serial.println("  (above the compile-time level - raise LOG_LEVEL_* in Config.h)");
+        }
+    }
+    printLogLevels();
+}
+
+#ifdef DUAL_CORE_MODE
+/**
+ * Wait for the control core's answer to the settings command just sent
+ * (settings storage is fed by the Dryer's tick, so it is read and
+ * changed only there)
+ */
+bool fetchSettingsReply(uint32_t previousSerial, SettingsJsonReply& reply) {
+    uint32_t start = millis();
+    while (!dryerProxy->readSettingsReply(previousSerial, reply)) {
+        if (millis() - start >= DIAGNOSTICS_REPLY_TIMEOUT_MS) {
+            return false;
+        }
+        delay(1);
+    }
+    return reply.request == dryerProxy->getSettingsRequestSerial();
+}
+#endif
+
+/**
+ * `settings` - stored settings as JSON (the file itself is binary)
+ */
+void printSettingsJson() {
+#ifdef DUAL_CORE_MODE
+    SettingsJsonReply reply;
+    uint32_t previousSerial = dryerProxy->getSettingsReplySerial();
+    if (!dryerProxy->requestSettingsJson() || !fetchSettingsReply(previousSerial, reply)) {
+        Serial.println("✗ Settings: no reply from control core");
+        return;
+    }
+    if (!reply.ok) {
+        Serial.println("✗ Settings JSON too long to pass between cores");
+        return;
+    }
+    Serial.println(reply.json);
+#elif !defined(UNIT_TEST)
+    Serial.println(settingsStorageSlot.get()->exportJson());
+#endif
+}
+
+/**
+ * `storage` - write-behind queue counters, then flash traffic per file
+ * and the projected wear (FlashWear.h)
+ */
+void printStorageStats() {
+#ifndef UNIT_TEST
+    StorageWorker& worker = settingsStorageSlot.get()->getWorker();
+    Serial.println("\n============ STORAGE WORKER =============");
+    Serial.printf("  Submitted:   %lu\n", (unsigned long)worker.getSubmitted());
+    Serial.printf("  Written:     %lu\n", (unsigned long)worker.getCompleted());
+    Serial.printf("  Pending:     %lu\n", (unsigned long)worker.getPending());
+    Serial.printf("  Peak depth:  %u / %u\n", (unsigned)worker.getPeakDepth(), (unsigned)STORAGE_QUEUE_DEPTH);
+    Serial.printf("  Queue full:  %lu\n", (unsigned long)worker.getDropped());
+    Serial.printf("  Superseded:  %lu\n", (unsigned long)worker.getSuperseded());
+    Serial.printf("  Failed:      %lu\n", (unsigned long)worker.getFailedWrites());
+
+    FlashWearReport wear = settingsStorageSlot.get()->getWearReport(millis());
+    Serial.println("\n============== FLASH WEAR ===============");
+    Serial.printf("  LittleFS:    %u / %u bytes used\n", (unsigned)wear.usedBytes, (unsigned)wear.totalBytes);
+    Serial.printf("  Written:     %lu bytes in %lu sessions\n",
+                  (unsigned long)wear.bytesWritten, (unsigned long)wear.filesWritten);
+    for (uint8_t i = 0; i < static_cast<uint8_t>(FlashFile::COUNT); i++) {
+        FlashFile file = static_cast<FlashFile>(i);
+        const FlashWriteStats::FileStats& stats = flashWriteStats().get(file);
+        if (stats.sessions.load() == 0) {
+            continue;
+        }
+        bool nvs = stats.nvsEntries.load() > 0;
+        Serial.printf("  %-10s %lu B, %lu writes, %lu %s, us min=%lu avg=%lu p99<=%lu max=%lu\n",
+                      flashFileName(file), (unsigned long)stats.bytes.load(),
+                      (unsigned long)stats.sessions.load(),
+                      (unsigned long)(nvs ? stats.nvsEntries.load() : stats.blocks.load()),
+                      nvs ? "NVS entries" : "blocks",
+                      (unsigned long)stats.latency.getMin(), (unsigned long)stats.latency.getMean(),
+                      (unsigned long)stats.latency.getPercentile(99), (unsigned long)stats.latency.getMax());
+    }
+    Serial.printf("  Erases:      ~%lu (%lu NVS pages, %.1f/h) of %lu rated\n",
+                  (unsigned long)wear.estimatedErases, (unsigned long)wear.nvsPageErases,
+                  wear.erasesPerHour, (unsigned long)wear.eraseBudget);
+    if (wear.yearsAtThisRate > 0) {
+        Serial.printf("  Wear:        %.2f%% of the budget per year, %.1f years at this rate\n",
+                      wear.budgetPercentPerYear, wear.yearsAtThisRate);
+    } else {
+        Serial.println("  Wear:        (no rate yet - needs a minute since mount)");
+    }
+    Serial.println("=========================================");
+#endif
+}
+
+const char* cyclePresetName(uint8_t preset) {
+    switch (static_cast<PresetType>(preset)) {
+        case PresetType::PLA: return "PLA";
+        case PresetType::PETG: return "PETG";
+        default: return "CUSTOM";
+    }
+}
+
+/**
+ * `history` - one line per stored cycle, newest first (one slot read each)
+ */
+void printCycleHistory() {
+#ifndef UNIT_TEST
+    const CycleHistoryFile& history = settingsStorageSlot.get()->getCycleHistory();
+    uint32_t latest = history.getLatestId();
+    uint16_t count = history.getCount();
+
+    Serial.println("\n============= CYCLE HISTORY =============");
+    if (count == 0) {
+        Serial.println("  No cycles recorded yet");
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        CycleRecord cycle;
+        uint32_t id = latest - i;
+        if (!history.read(id, cycle)) {
+            Serial.printf("  #%-4lu (damaged)\n", (unsigned long)id);
+            continue;
+        }
+        Serial.printf("  #%-4lu %-6s %-8s %2luh%02lu  %5.1f°C  %4.0f Wh  %s\n",
+                      (unsigned long)id, cyclePresetName(cycle.preset),
+                      cycleEndReasonName(cycle.endReason),
+                      (unsigned long)(cycle.duration / 3600), (unsigned long)(cycle.duration / 60 % 60),
+                      cycle.getBoxTempMean(), cycle.energyWh,
+                      cycle.faultCount > 0 ? "faults" : "");
+    }
+    Serial.printf("  %u of %u slots used - `history <id>` for details\n",
+                  (unsigned)count, (unsigned)CYCLE_HISTORY_RECORDS);
+    Serial.println("=========================================");
+#endif
+}
+
+/**
+ * `history <id>` - one cycle in full
+ */
+void printCycleDetails(uint32_t id) {
+#ifndef UNIT_TEST
+    CycleRecord cycle;
+    if (!settingsStorageSlot.get()->getCycleHistory().read(id, cycle)) {
+        Serial.printf("✗ No cycle #%lu (see `history`)\n", (unsigned long)id);
+        return;
+    }
+
+    Serial.printf("\n=============== CYCLE #%-4lu ===============\n", (unsigned long)id);
+    Serial.printf("  Preset:       %s (PID %s)\n", cyclePresetName(cycle.preset),
+                  cycle.pidProfile == static_cast<uint8_t>(PIDProfile::SOFT) ? "soft" :
+                  cycle.pidProfile == static_cast<uint8_t>(PIDProfile::STRONG) ? "strong" : "normal");
+    Serial.printf("  Ended:        %s%s\n", cycleEndReasonName(cycle.endReason),
+                  (cycle.flags & CYCLE_FLAG_RECOVERED) ? " (resumed after power loss)" : "");
+    Serial.printf("  Target:       %.1f°C for %lu min\n", cycle.targetTemp, (unsigned long)(cycle.targetTime / 60));
+    Serial.printf("  Duration:     %lu min\n", (unsigned long)(cycle.duration / 60));
+    Serial.printf("  Energy:       %.1f Wh (estimate)\n", cycle.energyWh);
+    Serial.printf("  Box temp:     min %.1f / mean %.1f / max %.1f °C\n",
+                  cycle.getBoxTempMin(), cycle.getBoxTempMean(), cycle.getBoxTempMax());
+    Serial.printf("  Heater max:   %.1f °C\n", cycle.getHeaterTempMax());
+    Serial.printf("  Humidity:     %.1f -> %.1f %%RH\n", cycle.getHumidityStart(), cycle.getHumidityEnd());
+    Serial.printf("  Water:        %.1f g removed\n", cycle.waterRemoved);
+    Serial.printf("  Faults:       %u%s%s\n", (unsigned)cycle.faultCount,
+                  cycle.faultReason[0] ? " - " : "", cycle.faultReason);
+    Serial.println("=========================================");
+#endif
+}
+
+/**
+ * `telemetry` - recordings in the telemetry ring (header reads only)
+ */
+void printTelemetryRecordings() {
+#ifndef UNIT_TEST
+    const TelemetryLogFile& log = settingsStorageSlot.get()->getTelemetryLog();
+    if (!log.isLoaded()) {
+        Serial.println("✗ Telemetry log still being scanned - try again in a moment");
+        return;
+    }
+    TelemetryRecordingInfo recordings[8];
+    size_t count = log.listRecordings(recordings, 8);
+
+    Serial.println("\n=============== TELEMETRY ===============");
+    if (count == 0) {
+        Serial.println("  No recordings yet");
+    }
+    for (size_t i = 0; i < count; i++) {
+        const TelemetryRecordingInfo& info = recordings[i];
+        Serial.printf("  #%-4lu %6lu samples  %4u pages%s\n",
+                      (unsigned long)info.recording, (unsigned long)info.samples,
+                      (unsigned)info.pages, info.firstSample > 0 ? "  (start rotated out)" : "");
+    }
+    Serial.printf("  %lu of %u pages used (%lu KB) - `telemetry <n>` dumps CSV\n",
+                  (unsigned long)log.getPageCount(), (unsigned)TELEMETRY_LOG_PAGES,
+                  (unsigned long)(log.getFileBytes() / 1024));
+    Serial.println("=========================================");
+#endif
+}
+
+// `telemetry <n>` in progress: the page being printed and how far
+struct TelemetryCsvCursor {
+    uint32_t recording;     // 0: nothing to stream
+    uint32_t sequence;      // Next page to look at, or the page in `page`
+    bool havePage;
+    uint16_t samplesPrinted;
+    uint32_t pagesPrinted;
+    TelemetryPage page;
+};
+TelemetryCsvCursor telemetryCsv = {};
+
+/**
+ * `telemetry <n>` - one recording as CSV. Only starts the export:
+ * serialTask streams it with streamTelemetryCsv().
+ */
+void printTelemetryCsv(uint32_t recording) {
+#ifndef UNIT_TEST
+    if (!settingsStorageSlot.get()->getTelemetryLog().isLoaded()) {
+        Serial.println("✗ Telemetry log still being scanned - try again in a moment");
+        return;
+    }
+    if (recording == 0) {
+        Serial.println("✗ No recording #0 (see `telemetry`)");
+        return;
+    }
+    telemetryCsv.recording = recording;
+    telemetryCsv.sequence = 0;          // findPage() starts at the oldest page
+    telemetryCsv.havePage = false;
+    telemetryCsv.samplesPrinted = 0;
+    telemetryCsv.pagesPrinted = 0;
+    Serial.println("t_s,heater_c,box_c,rh_pct,pwm,p,i,d");
+#endif
+}
+
+/**
+ * Next slice of a `telemetry <n>` export: at most
+ * TELEMETRY_CSV_LINES_PER_PASS lines, and only while the serial TX buffer
+ * has room, so the pass never waits on the UART
+ */
+void streamTelemetryCsv() {
+#ifndef UNIT_TEST
+    if (telemetryCsv.recording == 0) {
+        return;
+    }
+    const TelemetryLogFile& log = settingsStorageSlot.get()->getTelemetryLog();
+
+    uint16_t lines = 0;
+    for (;;) {
+        if (!telemetryCsv.havePage) {
+            TelemetryScan scan = log.findPage(telemetryCsv.recording, telemetryCsv.sequence,
+                                              telemetryCsv.page, TELEMETRY_CSV_HEADERS_PER_PASS);
+            if (scan == TelemetryScan::PENDING) {
+                return;
+            }
+            if (scan == TelemetryScan::END) {
+                if (telemetryCsv.pagesPrinted == 0) {
+                    Serial.printf("✗ No recording #%lu (see `telemetry`)\n", (unsigned long)telemetryCsv.recording);
+                }
+                telemetryCsv.recording = 0;
+                return;
+            }
+            telemetryCsv.havePage = true;
+            telemetryCsv.samplesPrinted = 0;
+        }
+
+        // Decoding is cheap: replay the samples printed in earlier passes
+        TelemetryPageDecoder decoder(telemetryCsv.page);
+        TelemetrySample sample;
+        uint16_t replayed = 0;
+        while (replayed < telemetryCsv.samplesPrinted && decoder.next(sample)) {
+            replayed++;
+        }
+        for (;;) {
+            if (lines == TELEMETRY_CSV_LINES_PER_PASS || Serial.availableForWrite() < TELEMETRY_CSV_LINE_BYTES) {
+                return;
+            }
+            if (!decoder.next(sample)) {
+                break;
+            }
+            Serial.printf("%.1f,%.2f,%.2f,%.2f,%u,%.1f,%.1f,%.1f\n",
+                          sample.getTimeMillis() / 1000.0f, sample.getHeaterTemp(),
+                          sample.getBoxTemp(), sample.getHumidity(), (unsigned)sample.getPWM(),
+                          sample.getPTerm(), sample.getITerm(), sample.getDTerm());
+            telemetryCsv.samplesPrinted++;
+            lines++;
+        }
+        telemetryCsv.havePage = false;
+        telemetryCsv.pagesPrinted++;
+        telemetryCsv.sequence++;
+    }
+#endif
+}
+
+/**
+ * Hand the newest cycles to the History screen once a new one is stored
+ */
+void refreshCycleHistory() {
+#ifndef UNIT_TEST
+    static uint32_t shownCycleId = 0;
+    const CycleHistoryFile& history = settingsStorageSlot.get()->getCycleHistory();
+    uint32_t latest = history.getLatestId();
+    if (latest == shownCycleId) {
+        return;
+    }
+
+    CycleRecord recent[CYCLE_HISTORY_SCREEN_ENTRIES];
+    size_t count = history.readRecent(recent, CYCLE_HISTORY_SCREEN_ENTRIES);
+    menuController->setCycleHistory(recent, (uint8_t)count);
+    shownCycleId = latest;
+#endif
+}
+
+/**
+ * `settings import <json>` - apply a full or partial JSON document
+ */
+void importSettingsJson(const String& json) {
+#ifdef DUAL_CORE_MODE
+    // Applied by the control core, between two Dryer ticks
+    SettingsJsonReply reply;
+    uint32_t previousSerial = dryerProxy->getSettingsReplySerial();
+    if (!dryerProxy->importSettingsJson(json.c_str()) || !fetchSettingsReply(previousSerial, reply)) {
+        Serial.println("✗ Settings: no reply from control core");
+        return;
+    }
+    if (reply.ok) {
+        Serial.println("✓ Settings imported - restart to apply");
+    } else {
+        Serial.println("✗ Invalid settings JSON (see `settings` for the layout)");
+    }
+#elif !defined(UNIT_TEST)
+    if (settingsStorageSlot.get()->importJson(json)) {
+        Serial.println("✓ Settings imported - restart to apply");
+    } else {
+        Serial.println("✗ Invalid settings JSON (see `settings` for the layout)");
+    }
+#endif
+}
+
+/**
+ * Trace ring fill, drops and frames sent
+ */
+void printTraceStatus() {
+    TraceBuffer& trace = traceBuffer();
+
+    Serial.println("\n============== BINARY TRACE ==============");
+    Serial.print("  State:   ");
+    Serial.println(trace.isEnabled() ? "on" : "off");
+    Serial.print("  Queued:  ");
+    Serial.print((unsigned long)trace.getQueued());
+    Serial.print(" / ");
+    Serial.println((unsigned long)TRACE_RING_RECORDS);
+    Serial.print("  Dropped: ");
+    Serial.println(trace.getDropped());
+    Serial.print("  Frames:  ");
+    Serial.println(traceDrain->getFramesWritten());
+    Serial.print("  Catalog: ");
+    Serial.println(TRACE_CATALOG_HASH, HEX);
+    Serial.println("==========================================\n");
+}
+
+/**
+ * Print one static slot's size and return it for the total
+ */
+template <typename T>
+size_t printSlotFootprint(const char* name, const StaticSlot<T>& slot) {
+    Serial.print("  ");
+    Serial.print(name);
+    Serial.print(": ");
+    Serial.print((unsigned long)StaticSlot<T>::SIZE_BYTES);
+    Serial.println(" B");
+    return StaticSlot<T>::SIZE_BYTES;
+}
+
+/**
+ * Boot-time RAM report: static component storage plus heap state
+ * @param constructionHeapBytes heap consumed while the components were built
+ */
+void printRamFootprint(uint32_t constructionHeapBytes) {
+    Serial.println("\n============= RAM FOOTPRINT =============");
+    Serial.println("Static components (.bss):");
+
+    size_t total = 0;
+    total += printSlotFootprint("HeaterTempSensor     ", heaterSensorSlot);
+    total += printSlotFootprint("BoxTempHumiditySensor", boxSensorSlot);
+    total += printSlotFootprint("SpoolWeightSensor    ", weightSensorSlot);
+    total += printSlotFootprint("SpoolWeightChannel   ", weightChannelSlot);
+    total += printSlotFootprint("SensorManager        ", sensorManagerSlot);
+    total += printSlotFootprint("OLEDDisplay          ", oledDisplaySlot);
+    total += printSlotFootprint("HeaterControl        ", heaterControlSlot);
+    total += printSlotFootprint("PIDController        ", pidControllerSlot);
+    total += printSlotFootprint("SafetyMonitor        ", safetyMonitorSlot);
+    total += printSlotFootprint("FanControl           ", fanControlSlot);
+    total += printSlotFootprint("SettingsStorage      ", settingsStorageSlot);
+    total += printSlotFootprint("RtcRecoveryMemory    ", recoveryMemorySlot);
+    total += printSlotFootprint("Dryer                ", dryerSlot);
+    total += printSlotFootprint("SensorHistory        ", sensorHistorySlot);
+    total += printSlotFootprint("EspHealthProbe       ", healthProbeSlot);
+    total += printSlotFootprint("HealthMonitor        ", healthMonitorSlot);
+    total += printSlotFootprint("SerialTraceOutput    ", traceOutputSlot);
+    total += printSlotFootprint("TraceDrain           ", traceDrainSlot);
+    total += printSlotFootprint("ButtonManager        ", buttonManagerSlot);
+    total += printSlotFootprint("MenuController       ", menuControllerSlot);
+    total += printSlotFootprint("SleepControl         ", sleepControlSlot);
+    total += printSlotFootprint("PowerManager         ", powerManagerSlot);
+    total += printSlotFootprint("UIController         ", uiControllerSlot);
+    total += printSlotFootprint("TaskScheduler        ", schedulerSlot);
+#ifdef DUAL_CORE_MODE
+    total += printSlotFootprint("DryerLink            ", dryerLinkSlot);
+    total += printSlotFootprint("DryerBridge          ", dryerBridgeSlot);
+    total += printSlotFootprint("DryerProxy           ", dryerProxySlot);
+    total += printSlotFootprint("TaskScheduler (ctrl) ", controlSchedulerSlot);
+#endif
+    Serial.print("  TraceBuffer (ring)    ");
+    Serial.print((unsigned long)sizeof(TraceBuffer));
+    Serial.println(" B");
+    total += sizeof(TraceBuffer);
+    Serial.print("  Total: ");
+    Serial.print((unsigned long)total);
+    Serial.println(" B");
+
+    Serial.println("Heap:");
+    Serial.print("  Used constructing components: ");
+    Serial.print(constructionHeapBytes);
+    Serial.println(" B");
+    Serial.print("  Free: ");
+    Serial.print(ESP.getFreeHeap());
+    Serial.print(" / ");
+    Serial.print(ESP.getHeapSize());
+    Serial.print(" B, min ever ");
+    Serial.print(ESP.getMinFreeHeap());
+    Serial.print(" B, largest block ");
+    Serial.print(ESP.getMaxAllocHeap());
+    Serial.println(" B");
+    Serial.println("=========================================\n");
+}
 
 /**
  * Handle serial commands for controlling the dryer
@@ -88,66 +915,89 @@ constexpr size_t MAX_SERIAL_COMMAND_LENGTH = 100;  // Prevent buffer overflow
  *   sound on      - Enable sound
  *   sound off     - Disable sound
  *   status        - Print current status
+ *   sensors       - Print sensor acquisition histograms
+ *   sensors reset - Clear sensor acquisition histograms
+ *   tasks         - Print main loop task timing and overruns
+ *   tasks reset   - Clear task timing records
+ *   perf          - Print and reset per-component timings (PERF_PROFILING)
+ *   health        - Print heap, fragmentation and stack high-water marks
+ *   log           - Print log levels per module
+ *   log <m> <lvl> - Set a module's (or all) runtime log level
+ *   trace on|off  - Start/stop binary trace frames (tools/trace_decode.py)
+ *   trace         - Print trace ring status
+ *   settings      - Print stored settings as JSON
+ *   settings import <json> - Apply a (partial) JSON settings document
+ *   storage       - Print write-behind queue counters and flash wear
+ *   history       - List stored drying cycles
+ *   history <id>  - Print one stored cycle
+ *   telemetry     - List recordings in the telemetry log
+ *   telemetry <n> - Dump one recording as CSV
  *   help          - Show available commands
+ *
+ * Any command counts as user activity for the PowerManager.
  */
 void handleSerialCommand(String cmd) {
     cmd.trim();
+    String rawCmd = cmd;   // Case kept for JSON arguments
     cmd.toLowerCase();
 
+    // Serial input counts as user activity (keeps the dryer out of idle)
+    powerManager->notifyActivity(millis());
+
     if (cmd == "start") {
-        dryer->start();
+        uiDryer->start();
         Serial.println("✓ Started");
     }
     else if (cmd == "pause") {
-        dryer->pause();
+        uiDryer->pause();
         Serial.println("✓ Paused");
     }
     else if (cmd == "resume") {
-        dryer->resume();
+        uiDryer->resume();
         Serial.println("✓ Resumed");
     }
     else if (cmd == "stop") {
-        dryer->stop();
+        uiDryer->stop();
         Serial.println("✓ Stopped");
     }
     else if (cmd == "reset") {
-        dryer->reset();
+        uiDryer->reset();
         Serial.println("✓ Reset");
     }
     else if (cmd == "preset pla") {
-        dryer->selectPreset(PresetType::PLA);
+        uiDryer->selectPreset(PresetType::PLA);
         Serial.println("✓ PLA preset selected (50°C, 4h)");
     }
     else if (cmd == "preset petg") {
-        dryer->selectPreset(PresetType::PETG);
+        uiDryer->selectPreset(PresetType::PETG);
         Serial.println("✓ PETG preset selected (65°C, 5h)");
     }
     else if (cmd == "preset custom") {
-        dryer->selectPreset(PresetType::CUSTOM);
+        uiDryer->selectPreset(PresetType::CUSTOM);
         Serial.println("✓ Custom preset selected");
     }
     else if (cmd == "pid soft") {
-        dryer->setPIDProfile(PIDProfile::SOFT);
+        uiDryer->setPIDProfile(PIDProfile::SOFT);
         Serial.println("✓ PID profile: SOFT");
     }
     else if (cmd == "pid normal") {
-        dryer->setPIDProfile(PIDProfile::NORMAL);
+        uiDryer->setPIDProfile(PIDProfile::NORMAL);
         Serial.println("✓ PID profile: NORMAL");
     }
     else if (cmd == "pid strong") {
-        dryer->setPIDProfile(PIDProfile::STRONG);
+        uiDryer->setPIDProfile(PIDProfile::STRONG);
         Serial.println("✓ PID profile: STRONG");
     }
     else if (cmd == "sound on") {
-        dryer->setSoundEnabled(true);
+        uiDryer->setSoundEnabled(true);
         Serial.println("✓ Sound enabled");
     }
     else if (cmd == "sound off") {
-        dryer->setSoundEnabled(false);
+        uiDryer->setSoundEnabled(false);
         Serial.println("✓ Sound disabled");
     }
     else if (cmd == "status") {
-        CurrentStats stats = dryer->getCurrentStats();
+        CurrentStats stats = uiDryer->getCurrentStats();
 
         Serial.println("\n========== DRYER STATUS ==========");
 
@@ -190,7 +1040,7 @@ void handleSerialCommand(String cmd) {
 
         // PID profile
         Serial.print("PID Profile: ");
-        switch(dryer->getPIDProfile()) {
+        switch(uiDryer->getPIDProfile()) {
             case PIDProfile::SOFT:
                 Serial.println("SOFT");
                 break;
@@ -203,8 +1053,10 @@ void handleSerialCommand(String cmd) {
         }
 
         // Temperatures
+        // Everything below comes from the stats snapshot: with DUAL_CORE_MODE
+        // the sensors, scale and fan are being updated on the control core
         Serial.print("Heater Temp: ");
-        if (sensorManager->isHeaterTempValid()) {
+        if (stats.heaterTempValid) {
             Serial.print(stats.currentTemp, 1);
             Serial.print("°C / ");
             Serial.print(stats.targetTemp, 0);
@@ -214,7 +1066,7 @@ void handleSerialCommand(String cmd) {
         }
 
         Serial.print("Box Temp: ");
-        if (sensorManager->isBoxDataValid()) {
+        if (stats.boxDataValid) {
             Serial.print(stats.boxTemp, 1);
             Serial.println("°C");
         } else {
@@ -222,13 +1074,39 @@ void handleSerialCommand(String cmd) {
         }
 
         Serial.print("Box Humidity: ");
-        if (sensorManager->isBoxDataValid()) {
+        if (stats.boxDataValid) {
             Serial.print(stats.boxHumidity, 1);
             Serial.println("%");
         } else {
             Serial.println("INVALID");
         }
 
+        if (stats.boxDataValid) {
+            Serial.print("Absolute Humidity: ");
+            Serial.print(stats.absoluteHumidity, 1);
+            Serial.println(" g/m3");
+
+            Serial.print("Dew Point: ");
+            Serial.print(stats.dewPoint, 1);
+            Serial.println("°C");
+        }
+
+        Serial.print("Water Removed: ");
+        Serial.print(stats.waterRemoved, 1);
+        Serial.println(" g (est.)");
+
+        Serial.print("Spool Weight: ");
+        if (!stats.scaleCalibrated) {
+            Serial.println("NOT CALIBRATED");
+        } else if (!stats.scaleValid) {
+            Serial.println("INVALID");
+        } else {
+            Serial.print(stats.spoolWeight, 1);
+            Serial.print(" g, loss ");
+            Serial.print(stats.massLossRate, 2);
+            Serial.println(" g/h");
+        }
+
         // Timer info
         if (stats.state == DryerState::RUNNING || stats.state == DryerState::PAUSED) {
             Serial.print("Elapsed: ");
@@ -251,17 +1129,91 @@ void handleSerialCommand(String cmd) {
         // Fan status
         Serial.print("Fan: ");
         if (fanControl) {
-            Serial.println(fanControl->isRunning() ? "RUNNING" : "STOPPED");
+            Serial.println(stats.fanRunning ? "RUNNING" : "STOPPED");
         } else {
             Serial.println("NOT CONNECTED");
         }
 
         // Sound
         Serial.print("Sound: ");
-        Serial.println(dryer->isSoundEnabled() ? "ON" : "OFF");
+        Serial.println(uiDryer->isSoundEnabled() ? "ON" : "OFF");
 
         Serial.println("==================================\n");
     }
+    else if (cmd == "sensors") {
+        printSensorDiagnostics();
+    }
+    else if (cmd == "sensors reset") {
+#ifdef DUAL_CORE_MODE
+        dryerProxy->resetSensorStats();   // Applied on the control core's next tick
+#else
+        sensorManager->resetChannelStats();
+#endif
+        Serial.println("✓ Sensor diagnostics reset");
+    }
+    else if (cmd == "tasks") {
+        Serial.println("\n=========== TASK DIAGNOSTICS ===========");
+#ifdef DUAL_CORE_MODE
+        // Control core counters are read without a lock - good enough for diagnostics
+        Serial.println("[control core]");
+        printTaskDiagnostics(controlScheduler);
+        Serial.println("[ui core]");
+#endif
+        printTaskDiagnostics(scheduler);
+        Serial.println("========================================\n");
+    }
+    else if (cmd == "tasks reset") {
+        scheduler->resetStats();
+#ifdef DUAL_CORE_MODE
+        // The control core owns its stats: cleared at its next tick
+        controlScheduler->requestResetStats();
+#endif
+        Serial.println("✓ Task diagnostics reset");
+    }
+    else if (cmd == "perf") {
+        printPerfCounters();
+    }
+    else if (cmd == "health") {
+        printHealth();
+    }
+    else if (cmd == "log") {
+        printLogLevels();
+    }
+    else if (cmd.startsWith("log ")) {
+        handleLogCommand(cmd.substring(4));
+    }
+    else if (cmd == "trace on") {
+        traceBuffer().setEnabled(true);
+        Serial.println("✓ Trace on - decode with tools/trace_decode.py");
+    }
+    else if (cmd == "trace off") {
+        traceBuffer().setEnabled(false);
+        Serial.println("✓ Trace off");
+    }
+    else if (cmd == "trace") {
+        printTraceStatus();
+    }
+    else if (cmd == "settings") {
+        printSettingsJson();
+    }
+    else if (cmd.startsWith("settings import ")) {
+        importSettingsJson(rawCmd.substring(16));
+    }
+    else if (cmd == "storage") {
+        printStorageStats();
+    }
+    else if (cmd == "history") {
+        printCycleHistory();
+    }
+    else if (cmd.startsWith("history ")) {
+        printCycleDetails((uint32_t)cmd.substring(8).toInt());
+    }
+    else if (cmd == "telemetry") {
+        printTelemetryRecordings();
+    }
+    else if (cmd.startsWith("telemetry ")) {
+        printTelemetryCsv((uint32_t)cmd.substring(10).toInt());
+    }
     else if (cmd == "help" || cmd == "?") {
         Serial.println("\n========== AVAILABLE COMMANDS ==========");
         Serial.println("State Control:");
@@ -281,8 +1233,25 @@ void handleSerialCommand(String cmd) {
         Serial.println("\nSettings:");
         Serial.println("  sound on      - Enable sound");
         Serial.println("  sound off     - Disable sound");
+        Serial.println("  settings      - Stored settings as JSON");
+        Serial.println("  settings import {...} - Apply JSON (restart to apply)");
         Serial.println("\nInfo:");
         Serial.println("  status        - Print current status");
+        Serial.println("  sensors       - Sensor timing/error histograms");
+        Serial.println("  sensors reset - Clear sensor histograms");
+        Serial.println("  tasks         - Loop task timing/overruns");
+        Serial.println("  tasks reset   - Clear task timing");
+        Serial.println("  perf          - Component timings (then reset)");
+        Serial.println("  health        - Heap/fragmentation/stack health");
+        Serial.println("  storage       - Write-behind queue counters, flash wear");
+        Serial.println("  history       - Stored drying cycles");
+        Serial.println("  history 12    - One stored cycle in full");
+        Serial.println("  telemetry     - Per-tick telemetry recordings");
+        Serial.println("  telemetry 3   - One recording as CSV");
+        Serial.println("  log           - Log levels per module");
+        Serial.println("  log pid debug - Set a module's (or 'all') log level");
+        Serial.println("  trace on|off  - Binary trace frames (trace_decode.py)");
+        Serial.println("  trace         - Trace ring status");
         Serial.println("  help          - Show this help");
         Serial.println("========================================\n");
     }
@@ -312,13 +1281,235 @@ void processSerialInput() {
                 serialCommand += c;
             } else {
                 // Buffer full - discard command and reset
-                Serial.println("✗ Command too long (max 100 chars)");
+                Serial.print("✗ Command too long (max ");
+                Serial.print((unsigned)MAX_SERIAL_COMMAND_LENGTH);
+                Serial.println(" chars)");
                 serialCommand = "";
             }
         }
     }
 }
 
+// ==================== Boot Path ====================
+
+/**
+ * Draw the boot splash and hand it to the UIController, which keeps it
+ * up for a while without blocking (buttons dismiss it early)
+ */
+void showSplash(uint32_t currentMillis) {
+    oledDisplay->clear();
+    oledDisplay->setCursor(0, 0);
+    oledDisplay->setTextSize(1);
+
+    uint32_t holdMs = SPLASH_DURATION_MS;
+
+    if (storageErrorMessage.length() > 0) {
+        oledDisplay->println("Storage Error");
+        oledDisplay->println("");
+        oledDisplay->println("System continuing");
+        oledDisplay->println("with defaults");
+        holdMs = STORAGE_ERROR_SPLASH_MS;
+    } else if (uiDryer->getState() == DryerState::POWER_RECOVERED) {
+        oledDisplay->println("Power Loss");
+        oledDisplay->println("Detected");
+        oledDisplay->println("");
+        oledDisplay->println("Press SET to");
+        oledDisplay->println("resume cycle");
+    } else {
+        oledDisplay->println("Dryer Ready");
+        oledDisplay->println("");
+        oledDisplay->println("Press SET for");
+        oledDisplay->println("menu");
+    }
+
+    oledDisplay->display();
+    uiController->holdSplashUntil(currentMillis + holdMs);
+}
+
+/**
+ * First UI pass: initialize the OLED (I2C bring-up and a full frame
+ * clear) and show the splash. Runs after the first control tick.
+ */
+void startDisplay(uint32_t currentMillis) {
+    oledDisplay->begin();
+    showSplash(currentMillis);
+    displayStarted = true;
+}
+
+/**
+ * One-shot serial report once the control loop is running: boot time
+ * against BOOT_BUDGET_MS, then the (long) RAM footprint
+ */
+void reportBoot() {
+    bootReported = true;
+
+    Serial.println("\n================= BOOT ==================");
+    Serial.print("  setup() entered:       ");
+    Serial.print(setupStartMillis);
+    Serial.println(" ms after reset");
+    Serial.print("  First control tick:    ");
+    Serial.print(firstControlTickMillis);
+    Serial.println(" ms after reset");
+    Serial.print("  Budget:                ");
+    Serial.print(BOOT_BUDGET_MS);
+    Serial.println(firstControlTickMillis <= BOOT_BUDGET_MS ? " ms (OK)" : " ms (⚠ EXCEEDED)");
+    Serial.println("=========================================");
+
+    printRamFootprint(constructionHeapBytes);
+}
+
+// ==================== Scheduled Tasks ====================
+
+// Dryer::update() drives the sensor manager and safety monitor itself
+void controlTask(uint32_t currentMillis) {
+    PERF_SCOPE(PerfZone::CONTROL_TASK);
+    traceBuffer().setTime(currentMillis);   // Timestamp for this tick's TRACE() records
+#ifdef DUAL_CORE_MODE
+    dryerBridge->update(currentMillis);  // Queued UI commands, Dryer tick, snapshot publish
+#else
+    dryer->update(currentMillis);
+#endif
+
+    if (firstControlTickMillis == 0) {
+        firstControlTickMillis = currentMillis;  // Reported by serialTask
+    }
+}
+
+void heaterTask(uint32_t currentMillis) {
+    PERF_SCOPE(PerfZone::HEATER_TASK);
+    heaterControl->update(currentMillis);
+}
+
+void uiTask(uint32_t currentMillis) {
+    PERF_SCOPE(PerfZone::UI_TASK);
+
+    // Display bring-up is deferred off the boot path; this pass does only that
+    if (!displayStarted) {
+        startDisplay(currentMillis);
+        return;
+    }
+
+    refreshCycleHistory();
+    uiController->update(currentMillis);
+}
+
+void healthTask(uint32_t currentMillis) {
+    healthMonitor->update(currentMillis);
+    menuController->setHealthStats(healthMonitor->getStats());
+}
+
+void powerTask(uint32_t currentMillis) {
+    powerManager->update(currentMillis);
+}
+
+void traceTask(uint32_t currentMillis) {
+    traceDrain->update();
+}
+
+#ifndef DUAL_CORE_MODE
+// One queued flash write per pass, so a burst never stalls the loop for long
+void storageTask(uint32_t currentMillis) {
+#ifndef UNIT_TEST
+    settingsStorageSlot.get()->getWorker().runOnce();
+#endif
+}
+#endif
+
+void serialTask(uint32_t currentMillis) {
+    PERF_SCOPE(PerfZone::SERIAL_TASK);
+
+    if (!bootReported && firstControlTickMillis != 0) {
+        reportBoot();
+    }
+
+    processSerialInput();
+    streamTelemetryCsv();
+}
+
+#ifdef DUAL_CORE_MODE
+// UI core: deliver the control core's state changes and stats to UI callbacks
+void dryerProxyTask(uint32_t currentMillis) {
+    dryerProxy->update(currentMillis);
+}
+
+/**
+ * Control core task body - same scheduler, its own table
+ */
+void controlCoreMain(void* parameter) {
+    esp_task_wdt_add(NULL);
+
+    for (;;) {
+        esp_task_wdt_reset();
+        controlScheduler->runDue();
+
+        // Always give up at least one tick so the idle task on this core runs
+        uint32_t sleepMs = controlScheduler->getSleepTime();
+        vTaskDelay(sleepMs > 0 ? pdMS_TO_TICKS(sleepMs) : 1);
+    }
+}
+
+/**
+ * Storage worker task body - sleeps until a write is queued, then drains
+ */
+void storageCoreMain(void* parameter) {
+    StorageWorker& worker = settingsStorageSlot.get()->getWorker();
+
+    for (;;) {
+        worker.drain();
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(STORAGE_TASK_IDLE_MS));
+    }
+}
+#endif
+
+/**
+ * Build the main loop task table
+ *
+ * Table order is run order within a pass: sensors/safety/PID first, so
+ * the heater applies this pass's output, then UI, then serial.
+ *
+ * With DUAL_CORE_MODE the control and heater tasks move to their own
+ * high-priority task pinned to CONTROL_CORE; the Arduino loop keeps the
+ * UI side and talks to the Dryer only through the DryerProxy.
+ *
+ * Queued flash writes run in the "storage" slice on a single core, or in
+ * their own low-priority task on the UI core with DUAL_CORE_MODE.
+ */
+void setupScheduler() {
+    scheduler = schedulerSlot.construct();
+
+#ifdef DUAL_CORE_MODE
+    controlScheduler = controlSchedulerSlot.construct();
+    controlScheduler->addTask("control", controlTask, CONTROL_TASK_PERIOD_MS, CONTROL_TASK_DEADLINE_MS);
+    controlScheduler->addTask("heater", heaterTask, HEATER_TASK_PERIOD_MS, HEATER_TASK_DEADLINE_MS);
+
+    scheduler->addTask("dryer-proxy", dryerProxyTask, DRYER_PROXY_TASK_PERIOD_MS, DRYER_PROXY_TASK_DEADLINE_MS);
+#else
+    scheduler->addTask("control", controlTask, CONTROL_TASK_PERIOD_MS, CONTROL_TASK_DEADLINE_MS);
+    scheduler->addTask("heater", heaterTask, HEATER_TASK_PERIOD_MS, HEATER_TASK_DEADLINE_MS);
+#endif
+
+    scheduler->addTask("ui", uiTask, UI_TASK_PERIOD_MS, UI_TASK_DEADLINE_MS);
+    scheduler->addTask("serial", serialTask, SERIAL_TASK_PERIOD_MS, SERIAL_TASK_DEADLINE_MS);
+    scheduler->addTask("power", powerTask, POWER_TASK_PERIOD_MS, POWER_TASK_DEADLINE_MS);
+    scheduler->addTask("health", healthTask, HEALTH_TASK_PERIOD_MS, HEALTH_TASK_DEADLINE_MS);
+#ifndef DUAL_CORE_MODE
+    scheduler->addTask("storage", storageTask, STORAGE_TASK_PERIOD_MS, STORAGE_TASK_DEADLINE_MS);
+#endif
+    scheduler->addTask("trace", traceTask, TRACE_TASK_PERIOD_MS, TRACE_TASK_DEADLINE_MS);  // Last: lowest priority
+
+#ifdef DUAL_CORE_MODE
+    // Storage worker first: once the control core runs, it is the only consumer
+    xTaskCreatePinnedToCore(storageCoreMain, "storage", STORAGE_TASK_STACK, nullptr,
+                            STORAGE_TASK_PRIORITY, &storageTaskHandle, 1 - CONTROL_CORE);
+    settingsStorageSlot.get()->getWorker().attachTask(storageTaskHandle);
+
+    xTaskCreatePinnedToCore(controlCoreMain, "control", CONTROL_TASK_STACK, nullptr,
+                            CONTROL_TASK_PRIORITY, &controlTaskHandle, CONTROL_CORE);
+    Serial.print("  ✓ Control task pinned to core ");
+    Serial.println(CONTROL_CORE);
+#endif
+}
+
 /**
  * Initialize hardware watchdog timer
  *
@@ -358,9 +1549,10 @@ void setupWatchdog() {
  * Initialize all hardware and create component instances
  */
 void setup() {
-    // Initialize serial for debugging
+    setupStartMillis = millis();
+
+    // Initialize serial for debugging (no settle delay - boot is timed)
     Serial.begin(115200);
-    delay(100);
 
     Serial.println("\n\n========================================");
     Serial.println("ESP32 Dryer Initializing...");
@@ -368,136 +1560,176 @@ void setup() {
 
     setupWatchdog();
 
+    // Component construction should not touch the heap (see StaticSlot)
+    uint32_t heapBeforeConstruction = ESP.getFreeHeap();
+
     // ==================== Create Sensor Components ====================
     Serial.println("Creating sensor components...");
-    heaterSensor = new HeaterTempSensor(HEATER_TEMP_PIN);
+    heaterSensor = heaterSensorSlot.construct(HEATER_TEMP_PIN);
     Serial.println("  - Heater temperature sensor created");
 
-    boxSensor = new BoxTempHumiditySensor();
+    boxSensor = boxSensorSlot.construct();
     Serial.println("  - Box temp/humidity sensor created");
 
-    sensorManager = new SensorManager(heaterSensor, boxSensor);
+    sensorManager = sensorManagerSlot.construct(heaterSensor, boxSensor);
     Serial.println("  - SensorManager created");
 
+    weightSensor = weightSensorSlot.construct(HX711_DOUT_PIN, HX711_SCK_PIN);
+    weightChannel = weightChannelSlot.construct(weightSensor);
+    sensorManager->registerChannel(weightChannel,
+        SensorChannelConfig(WEIGHT_SENSOR_INTERVAL, SENSOR_TIMEOUT));
+    Serial.println("  - Spool scale (HX711) registered");
+
     // ==================== Create Display ====================
     Serial.println("\nCreating display...");
 
-    oledDisplay = new OLEDDisplay(DISPLAY_WIDTH, DISPLAY_HEIGHT, 0x3C);
+    oledDisplay = oledDisplaySlot.construct(DISPLAY_WIDTH, DISPLAY_HEIGHT, 0x3C);
     Serial.println("  - OLED Display created");
 
     // ==================== Create Control Components ====================
     Serial.println("\nCreating control components...");
-    heaterControl = new HeaterControl();
+    heaterControl = heaterControlSlot.construct();
     Serial.println("  - HeaterControl created");
 
-    pidController = new PIDController();
+    pidController = pidControllerSlot.construct();
     Serial.println("  - PIDController created");
 
-    safetyMonitor = new SafetyMonitor();
+    safetyMonitor = safetyMonitorSlot.construct();
     Serial.println("  - SafetyMonitor created");
 
-    fanControl = new FanControl(FAN_PIN);
+    fanControl = fanControlSlot.construct(FAN_PIN);
     Serial.println("  - FanControl created");
 
     // ==================== Create Storage & Sound ====================
     Serial.println("\nCreating storage and sound components...");
-#ifdef UNIT_TEST
-    settingsStorage = new MockSettingsStorage();
-    Serial.println("  - SettingsStorage (mock) created");
-#else
-    settingsStorage = new SettingsStorage();
+    settingsStorage = settingsStorageSlot.construct();
     Serial.println("  - SettingsStorage created");
-#endif
 
     soundController = nullptr; // Not implemented yet
     Serial.println("  - Sound controller placeholder set");
 
+    RtcRecoveryMemory* rtcMemory = recoveryMemorySlot.construct(rtcRecoveryRegion);
+    if (esp_reset_reason() == ESP_RST_POWERON) {
+        rtcMemory->invalidate();   // RTC memory holds noise after power-up
+        Serial.println("  - RTC recovery memory cleared (power-on)");
+    } else {
+        Serial.println("  - RTC recovery memory kept across reset");
+    }
+    recoveryMemory = rtcMemory;
+
     // ==================== Create Dryer ====================
     Serial.println("\nCreating Dryer orchestrator...");
-    dryer = new Dryer(
-        sensorManager,
-        heaterControl,
-        pidController,
-        safetyMonitor,
-        settingsStorage,
+    // Concrete pointers from the slots, so StaticDryer binds to the real types
+    dryer = dryerSlot.construct(
+        sensorManagerSlot.get(),
+        heaterControlSlot.get(),
+        pidControllerSlot.get(),
+        safetyMonitorSlot.get(),
+        settingsStorageSlot.get(),
         soundController,
-        fanControl
+        fanControl,
+        weightSensor,
+        recoveryMemory
     );
     Serial.println("  - Dryer created");
 
+#ifdef DUAL_CORE_MODE
+    // UI side gets a proxy; only the control core calls the Dryer itself
+    dryerLink = dryerLinkSlot.construct();
+    dryerBridge = dryerBridgeSlot.construct(dryer, dryerLink, sensorManager, settingsStorage);
+    dryerProxy = dryerProxySlot.construct(dryerLink);
+    uiDryer = dryerProxy;
+    Serial.println("  - Dual-core bridge created");
+#else
+    uiDryer = dryer;
+#endif
+
+    // ==================== Create History ====================
+    sensorHistory = sensorHistorySlot.construct();
+    Serial.print("  - SensorHistory created (");
+    Serial.print((unsigned long)SensorHistory::FOOTPRINT_BYTES);
+    Serial.println(" bytes)");
+
+    healthMonitor = healthMonitorSlot.construct(healthProbeSlot.construct());
+    Serial.println("  - HealthMonitor created");
+
+    traceDrain = traceDrainSlot.construct(&traceBuffer(), traceOutputSlot.construct());
+    Serial.println("  - TraceDrain created");
+
     // ==================== Create UI Components ====================
     Serial.println("\nCreating UI components...");
 
     // Create ButtonManager first
-    buttonManager = new ButtonManager();
+    buttonManager = buttonManagerSlot.construct();
     Serial.println("  - ButtonManager created");
 
     // Create MenuController second
-    menuController = new MenuController();
+    menuController = menuControllerSlot.construct();
     Serial.println("  - MenuController created");
 
+    // Idle power policy (dim/blank display, slow sensors, light sleep)
+    sleepControl = sleepControlSlot.construct();
+#ifdef DUAL_CORE_MODE
+    // Sensors belong to the control core there; only the display idles
+    powerManager = powerManagerSlot.construct(uiDryer, nullptr, oledDisplay, sleepControl);
+#else
+    powerManager = powerManagerSlot.construct(uiDryer, sensorManager, oledDisplay, sleepControl);
+#endif
+    Serial.println("  - PowerManager created");
+
     // Create UIController last (needs all other components)
-    uiController = new UIController(
+    uiController = uiControllerSlot.construct(
         oledDisplay,      // Must not be null
         menuController,   // Must not be null
         buttonManager,    // Must not be null
         soundController,  // Can be null
-        dryer             // Must not be null
+        uiDryer,          // Must not be null
+        powerManager      // Can be null
     );
     Serial.println("  - UIController created");
 
+    constructionHeapBytes = heapBeforeConstruction - ESP.getFreeHeap();
+
     // ==================== Initialize All Components ====================
     Serial.println("\n========================================");
     Serial.println("Initializing components...");
     Serial.println("========================================\n");
 
-    // Initialize basic components first
-    sensorManager->begin();
-    Serial.println("  ✓ SensorManager initialized");
-
-    oledDisplay->begin();
-    Serial.println("  ✓ OLED Display initialized");
-
+    // Heater output first: drive the SSR low before anything slow runs.
+    // Dryer::begin() repeats it, which only sets the pin low again.
     heaterControl->begin(millis());
     Serial.println("  ✓ HeaterControl initialized");
 
-    pidController->begin();
-    Serial.println("  ✓ PIDController initialized");
+    // OLED bring-up is deferred to the first UI pass (see startDisplay)
 
-    safetyMonitor->begin();
-    Serial.println("  ✓ SafetyMonitor initialized");
+    // FanControl initializes in constructor, no begin() needed
+    Serial.println("  ✓ FanControl initialized");
 
-    settingsStorage->begin();
-    Serial.println("  ✓ SettingsStorage initialized");
+    // Sensors, PID, safety and storage are begun once, by the Dryer that
+    // owns them (sets up callbacks, loads settings and recovery state)
+    dryer->begin(millis());
+    Serial.println("  ✓ Dryer initialized (sensors, PID, safety, storage)");
 
 #ifndef UNIT_TEST
-    // Check storage health and display error if needed
+    // Check storage health; the splash shows the error once the display is up
     SettingsStorage* realStorage = static_cast<SettingsStorage*>(settingsStorage);
     if (realStorage && !realStorage->isHealthy()) {
-        String errorMsg = realStorage->getInitErrorMessage();
+        storageErrorMessage = realStorage->getInitErrorMessage();
         Serial.println("  ⚠ WARNING: Storage error detected");
-        Serial.println("    Error: " + errorMsg);
+        Serial.println("    Error: " + storageErrorMessage);
         Serial.println("    System will continue with defaults");
-
-        // Display error on OLED for 5 seconds
-        oledDisplay->clear();
-        oledDisplay->setCursor(0, 0);
-        oledDisplay->setTextSize(1);
-        oledDisplay->println("Storage Error");
-        oledDisplay->println("");
-        oledDisplay->println("System continuing");
-        oledDisplay->println("with defaults");
-        oledDisplay->display();
-        delay(5000);
     }
 #endif
 
-    // FanControl initializes in constructor, no begin() needed
-    Serial.println("  ✓ FanControl initialized");
+#ifdef DUAL_CORE_MODE
+    dryerBridge->begin();
+    dryerProxy->begin(millis());
+#endif
 
-    // Initialize dryer (sets up callbacks, loads settings)
-    dryer->begin(millis());
-    Serial.println("  ✓ Dryer initialized");
+    // Feed history from the stats stream (gated to 1 Hz inside SensorHistory)
+    uiDryer->registerStatsUpdateCallback([](const CurrentStats& stats) {
+        sensorHistory->record(stats, millis());
+    });
 
     // Initialize UI components AFTER dryer
     Serial.println("\nInitializing UI components...");
@@ -510,20 +1742,12 @@ void setup() {
     uiController->begin();
     Serial.println("  ✓ UIController initialized");
 
-    // ==================== Show Startup Message ====================
-    DryerState initialState = dryer->getState();
-
-    oledDisplay->clear();
-    oledDisplay->setCursor(0, 0);
-    oledDisplay->setTextSize(1);
-
-    if (initialState == DryerState::POWER_RECOVERED) {
-        oledDisplay->println("Power Loss");
-        oledDisplay->println("Detected");
-        oledDisplay->println("");
-        oledDisplay->println("Press SET to");
-        oledDisplay->println("resume cycle");
+    powerManager->begin(millis());
+    Serial.println("  ✓ PowerManager initialized");
 
+    // ==================== Startup Message ====================
+    // The OLED splash follows on the first UI pass (non-blocking)
+    if (dryer->getState() == DryerState::POWER_RECOVERED) {
         Serial.println("\n========================================");
         Serial.println("POWER RECOVERY MODE");
         Serial.println("========================================");
@@ -531,11 +1755,6 @@ void setup() {
         Serial.println("Press SET button to resume or use serial commands");
         Serial.println("========================================\n");
     } else {
-        oledDisplay->println("Dryer Ready");
-        oledDisplay->println("");
-        oledDisplay->println("Press SET for");
-        oledDisplay->println("menu");
-
         Serial.println("\n========================================");
         Serial.println("SYSTEM READY");
         Serial.println("========================================");
@@ -543,34 +1762,35 @@ void setup() {
         Serial.println("========================================\n");
     }
 
-    oledDisplay->display();
-    delay(3000);
+    setupScheduler();
+
+    // Stack high-water marks for the loop task (and the control core and storage tasks)
+    healthMonitor->watchTask("LOOP", xTaskGetCurrentTaskHandle());
+#ifdef DUAL_CORE_MODE
+    healthMonitor->watchTask("CONTROL", controlTaskHandle);
+    healthMonitor->watchTask("STORAGE", storageTaskHandle);
+#endif
+    healthMonitor->registerWarningCallback(onHealthWarning);
 
+    // Boot time and RAM footprint are reported once the first control tick has run
     Serial.println("✓ System operational!");
     Serial.println("Type 'help' for available commands\n");
 }
 
 void loop() {
-    uint32_t currentMillis = millis();
-
     // ==================== Pet the Watchdog ====================
     // CRITICAL: This must be called every loop iteration
     // If loop hangs for >10 seconds, watchdog triggers ESP32 reset
     esp_task_wdt_reset();
 
-    // ==================== Process Serial Commands ====================
-    processSerialInput();
-
-    // ==================== Update All Components ====================
+    // ==================== Run Due Tasks ====================
+    scheduler->runDue();
 
-    // Update sensors (reads at configured intervals)
-    sensorManager->update(currentMillis);
-    safetyMonitor->update(currentMillis);
-    dryer->update(currentMillis);
-    heaterControl->update(currentMillis);
-
-    // Update UI (replaces old display update code)
-    uiController->update(currentMillis);
-
-    delay(10);
+    // ==================== Sleep Until Next Release ====================
+    // A plain delay normally; light sleep (button wake) once the
+    // PowerManager has put an idle dryer to SLEEPING
+    uint32_t sleepMs = scheduler->getSleepTime();
+    if (sleepMs > 0) {
+        powerManager->idle(sleepMs, millis());
+    }
 }
\ No newline at end of file
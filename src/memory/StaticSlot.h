@@ -0,0 +1,54 @@
+#ifndef STATIC_SLOT_H
+#define STATIC_SLOT_H
+
+#include <stddef.h>
+#include <new>
+#include <utility>
+
+/**
+ * StaticSlot - Statically allocated storage for one long-lived object
+ *
+ * Declared at namespace scope, the buffer lives in .bss with a fixed
+ * address and a size known at link time; construct() placement-news the
+ * object into it during setup(). Components in this firmware live until
+ * reset, so there is deliberately no destroy().
+ *
+ * construct() only builds the object once; later calls return the
+ * existing instance, so a slot can never be silently overwritten.
+ */
+template <typename T>
+class StaticSlot {
+public:
+    static constexpr size_t SIZE_BYTES = sizeof(T);
+
+private:
+    alignas(T) unsigned char storage[sizeof(T)];
+    bool constructed;
+
+public:
+    StaticSlot() : constructed(false) {
+    }
+
+    StaticSlot(const StaticSlot&) = delete;
+    StaticSlot& operator=(const StaticSlot&) = delete;
+
+    template <typename... Args>
+    T* construct(Args&&... args) {
+        if (!constructed) {
+            new (storage) T(std::forward<Args>(args)...);
+            constructed = true;
+        }
+        return get();
+    }
+
+    // nullptr until construct() has run
+    T* get() {
+        return constructed ? reinterpret_cast<T*>(storage) : nullptr;
+    }
+
+    bool isConstructed() const {
+        return constructed;
+    }
+};
+
+#endif
@@ -0,0 +1,208 @@
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+#include "../Config.h"
+#include "../Types.h"
+#include "../diagnostics/Histogram.h"
+#include <atomic>
+
+constexpr uint8_t INVALID_TASK = 0xFF;
+
+// Task body, called with the time it was started
+using TaskFunction = void (*)(uint32_t currentMillis);
+
+// Time source (millis() on hardware, injectable for tests)
+using SchedulerClock = uint32_t (*)();
+
+/**
+ * TaskStats - Timing record for one scheduled task
+ *
+ * Response time is measured from the task's release (when it became
+ * due) to the moment its body returned. A run whose response time
+ * exceeds the deadline counts as an overrun; releases that passed by
+ * entirely while the loop was busy elsewhere count as skipped.
+ */
+struct TaskStats {
+    using TaskHistogram = Histogram<SCHEDULER_HISTOGRAM_BUCKETS>;
+
+    const char* name;
+    uint32_t periodMs;
+    uint32_t deadlineMs;
+
+    uint32_t runs;
+    uint32_t overruns;
+    uint32_t skippedReleases;
+    uint32_t maxResponseMs;
+    TaskHistogram executionMs;   // Time spent inside the task body
+
+    TaskStats() : name(""), periodMs(0), deadlineMs(0) {
+        reset();
+    }
+
+    void reset() {
+        runs = 0;
+        overruns = 0;
+        skippedReleases = 0;
+        maxResponseMs = 0;
+        executionMs.reset();
+    }
+};
+
+/**
+ * TaskScheduler - Deadline-aware cooperative scheduler for the main loop
+ *
+ * Replaces "update everything, then delay(10)". Each component declares
+ * a period and a deadline in a fixed task table; runDue() runs the tasks
+ * whose release time has passed, in table order (so ordering is
+ * deterministic - register producers before consumers), and
+ * getSleepTime() says how long the loop may block before the next one
+ * is due.
+ *
+ * Releases stay phase-locked to the original schedule (release += period)
+ * so a slow pass doesn't make every later run drift. If a whole period
+ * was missed, the task runs once and the missed releases are counted
+ * instead of being replayed back to back.
+ *
+ * No dynamic allocation; the table is sized by MAX_SCHEDULER_TASKS.
+ *
+ * Stats are written only by the thread calling runDue(). Another core
+ * clears them with requestResetStats(), applied at the start of the next
+ * runDue().
+ */
+class TaskScheduler {
+private:
+    struct Task {
+        TaskFunction function;
+        uint32_t nextRelease;
+    };
+
+    Task tasks[MAX_SCHEDULER_TASKS];
+    TaskStats stats[MAX_SCHEDULER_TASKS];
+    uint8_t taskCount;
+
+    SchedulerClock clock;
+    std::atomic<bool> resetRequested;
+
+    uint32_t now() const {
+        return clock ? clock() : millis();
+    }
+
+    static bool isDue(uint32_t release, uint32_t currentMillis) {
+        // Wrap-safe comparison of millis() timestamps
+        return static_cast<int32_t>(currentMillis - release) >= 0;
+    }
+
+    void runTask(uint8_t id, uint32_t startMillis) {
+        Task& task = tasks[id];
+        TaskStats& taskStats = stats[id];
+        uint32_t release = task.nextRelease;
+
+        task.function(startMillis);
+
+        uint32_t finishMillis = now();
+        uint32_t response = finishMillis - release;
+
+        taskStats.runs++;
+        taskStats.executionMs.record(finishMillis - startMillis);
+        if (response > taskStats.maxResponseMs) {
+            taskStats.maxResponseMs = response;
+        }
+        if (response > taskStats.deadlineMs) {
+            taskStats.overruns++;
+        }
+
+        // Next release on the original phase; skip any that already passed
+        uint32_t periods = (finishMillis - release) / taskStats.periodMs + 1;
+        taskStats.skippedReleases += periods - 1;
+        task.nextRelease = release + periods * taskStats.periodMs;
+    }
+
+public:
+    TaskScheduler(SchedulerClock clockSource = nullptr)
+        : taskCount(0),
+          clock(clockSource),
+          resetRequested(false) {
+    }
+
+    /**
+     * Add a task to the table, first release immediately
+     * @return task id, or INVALID_TASK if the table is full or the period is 0
+     */
+    uint8_t addTask(const char* name, TaskFunction function, uint32_t periodMs, uint32_t deadlineMs) {
+        if (taskCount >= MAX_SCHEDULER_TASKS || !function || periodMs == 0) {
+            return INVALID_TASK;
+        }
+
+        uint8_t id = taskCount++;
+        tasks[id].function = function;
+        tasks[id].nextRelease = now();
+
+        stats[id].name = name;
+        stats[id].periodMs = periodMs;
+        stats[id].deadlineMs = deadlineMs;
+        stats[id].reset();
+        return id;
+    }
+
+    /**
+     * Run every task that is due, in table order
+     * @return number of tasks run
+     */
+    uint8_t runDue() {
+        if (resetRequested.exchange(false, std::memory_order_acq_rel)) {
+            resetStats();
+        }
+
+        uint8_t ran = 0;
+        for (uint8_t id = 0; id < taskCount; id++) {
+            uint32_t currentMillis = now();
+            if (isDue(tasks[id].nextRelease, currentMillis)) {
+                runTask(id, currentMillis);
+                ran++;
+            }
+        }
+        return ran;
+    }
+
+    /**
+     * Milliseconds until the next task is due (0 if one already is),
+     * capped at SCHEDULER_MAX_SLEEP_MS so the loop stays responsive
+     */
+    uint32_t getSleepTime() const {
+        uint32_t currentMillis = now();
+        uint32_t sleep = SCHEDULER_MAX_SLEEP_MS;
+
+        for (uint8_t id = 0; id < taskCount; id++) {
+            if (isDue(tasks[id].nextRelease, currentMillis)) {
+                return 0;
+            }
+            uint32_t untilDue = tasks[id].nextRelease - currentMillis;
+            if (untilDue < sleep) {
+                sleep = untilDue;
+            }
+        }
+        return sleep;
+    }
+
+    uint8_t getTaskCount() const {
+        return taskCount;
+    }
+
+    const TaskStats* getTaskStats(uint8_t id) const {
+        return id < taskCount ? &stats[id] : nullptr;
+    }
+
+    // Clear stats now - only from the thread that calls runDue()
+    void resetStats() {
+        for (uint8_t id = 0; id < taskCount; id++) {
+            stats[id].reset();
+        }
+    }
+
+    // Clear stats at the start of the next runDue() - safe from any core
+    void requestResetStats() {
+        resetRequested.store(true, std::memory_order_release);
+    }
+};
+
+#endif
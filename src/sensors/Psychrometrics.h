@@ -0,0 +1,99 @@
+#ifndef PSYCHROMETRICS_H
+#define PSYCHROMETRICS_H
+
+#include <stdint.h>
+
+/**
+ * Psychrometrics - Humidity math without expf/logf
+ *
+ * Saturation vapour pressure comes from a 5°C lookup table (Magnus/Buck
+ * over water, -20..100°C) with linear interpolation, which stays within
+ * ~1% - well inside the AM2320's ±3 %RH. Dew point inverts the same
+ * table, so both directions cost a handful of multiplies - cheap on
+ * the FPU-less C3 where expf/logf are slow software routines.
+ */
+class Psychrometrics {
+private:
+    static constexpr int8_t TABLE_MIN_TEMP = -20;
+    static constexpr uint8_t TABLE_STEP = 5;
+    static constexpr uint8_t TABLE_SIZE = 25;   // -20..100°C
+
+    // Saturation vapour pressure over water (hPa) at TABLE_MIN_TEMP + i * TABLE_STEP
+    static const float* saturationTable() {
+        static const float table[TABLE_SIZE] = {
+            1.2558f,   1.9141f,   2.8656f,   4.2184f,   6.1121f,    // -20 .. 0
+            8.7244f,   12.2786f,  17.0517f,  23.3834f,  31.6853f,   //   5 .. 25
+            42.4513f,  56.2675f,  73.8236f,  95.9230f,  123.4940f,  //  30 .. 50
+            157.6004f, 199.4515f, 250.4117f, 312.0098f, 385.9468f,  //  55 .. 75
+            474.1027f, 578.5427f, 701.5214f, 845.4860f, 1013.0778f  //  80 .. 100
+        };
+        return table;
+    }
+
+public:
+    static constexpr float TABLE_MAX_TEMP = TABLE_MIN_TEMP + TABLE_STEP * (TABLE_SIZE - 1);
+
+    // g/m³ per hPa/K: 100 Pa/hPa * 1000 g/kg / 461.5 J/(kg·K)
+    static constexpr float WATER_VAPOUR_FACTOR = 216.68f;
+
+    /**
+     * Saturation vapour pressure (hPa), clamped to the table range
+     */
+    static float saturationVaporPressure(float tempC) {
+        const float* table = saturationTable();
+
+        if (tempC <= TABLE_MIN_TEMP) {
+            return table[0];
+        }
+        if (tempC >= TABLE_MAX_TEMP) {
+            return table[TABLE_SIZE - 1];
+        }
+
+        float position = (tempC - TABLE_MIN_TEMP) / TABLE_STEP;
+        uint8_t index = static_cast<uint8_t>(position);
+        float fraction = position - index;
+        return table[index] + (table[index + 1] - table[index]) * fraction;
+    }
+
+    /**
+     * Actual vapour pressure (hPa) from temperature and relative humidity
+     */
+    static float vaporPressure(float tempC, float relativeHumidity) {
+        if (relativeHumidity <= 0.0f) {
+            return 0.0f;
+        }
+        if (relativeHumidity > 100.0f) {
+            relativeHumidity = 100.0f;
+        }
+        return saturationVaporPressure(tempC) * relativeHumidity / 100.0f;
+    }
+
+    /**
+     * Absolute humidity (g/m³)
+     */
+    static float absoluteHumidity(float tempC, float relativeHumidity) {
+        return WATER_VAPOUR_FACTOR * vaporPressure(tempC, relativeHumidity) / (tempC + 273.15f);
+    }
+
+    /**
+     * Dew point (°C) by inverse table lookup, clamped to -20°C below range
+     */
+    static float dewPoint(float tempC, float relativeHumidity) {
+        const float* table = saturationTable();
+        float pressure = vaporPressure(tempC, relativeHumidity);
+
+        if (pressure <= table[0]) {
+            return TABLE_MIN_TEMP;
+        }
+
+        for (uint8_t i = 1; i < TABLE_SIZE; i++) {
+            if (pressure <= table[i]) {
+                float fraction = (pressure - table[i - 1]) / (table[i] - table[i - 1]);
+                return TABLE_MIN_TEMP + (i - 1 + fraction) * TABLE_STEP;
+            }
+        }
+        return TABLE_MAX_TEMP;
+    }
+};
+
+#endif
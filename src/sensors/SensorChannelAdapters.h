@@ -0,0 +1,116 @@
+#ifndef SENSOR_CHANNEL_ADAPTERS_H
+#define SENSOR_CHANNEL_ADAPTERS_H
+
+#include "../interfaces/ISensorChannel.h"
+#include "../interfaces/IHeaterTempSensor.h"
+#include "../interfaces/IBoxTempHumiditySensor.h"
+#include "../interfaces/IWeightSensor.h"
+
+/**
+ * HeaterTempChannel - Adapts IHeaterTempSensor (DS18B20) to ISensorChannel
+ *
+ * Async: startSample() requests a conversion, the result is collected
+ * on a later update once isConversionReady() reports completion.
+ *
+ * Values: [0] = heater temperature (°C)
+ */
+class HeaterTempChannel : public ISensorChannel {
+private:
+    IHeaterTempSensor* sensor;
+
+public:
+    explicit HeaterTempChannel(IHeaterTempSensor* heaterSensor)
+        : sensor(heaterSensor) {
+    }
+
+    void begin() override { sensor->begin(); }
+
+    SampleStatus startSample() override {
+        sensor->requestConversion();
+        return SampleStatus::PENDING;
+    }
+
+    bool isSampleReady() override { return sensor->isConversionReady(); }
+    bool readSample() override { return sensor->read(); }
+
+    uint8_t getValueCount() const override { return 1; }
+    float getValue(uint8_t index) const override { return sensor->getTemperature(); }
+
+    SensorType getSensorType() const override { return SensorType::HEATER_TEMP; }
+    bool isValid() const override { return sensor->isValid(); }
+    String getLastError() const override { return sensor->getLastError(); }
+};
+
+/**
+ * BoxTempHumidityChannel - Adapts IBoxTempHumiditySensor (AM2320) to ISensorChannel
+ *
+ * Synchronous: the I2C read is fast enough to complete within startSample().
+ *
+ * Values: [0] = box temperature (°C), [1] = relative humidity (%)
+ */
+class BoxTempHumidityChannel : public ISensorChannel {
+private:
+    IBoxTempHumiditySensor* sensor;
+
+public:
+    static constexpr uint8_t TEMP_INDEX = 0;
+    static constexpr uint8_t HUMIDITY_INDEX = 1;
+
+    explicit BoxTempHumidityChannel(IBoxTempHumiditySensor* boxSensor)
+        : sensor(boxSensor) {
+    }
+
+    void begin() override { sensor->begin(); }
+
+    SampleStatus startSample() override { return SampleStatus::READY; }
+    bool isSampleReady() override { return true; }
+    bool readSample() override { return sensor->read(); }
+
+    uint8_t getValueCount() const override { return 2; }
+
+    float getValue(uint8_t index) const override {
+        return index == HUMIDITY_INDEX ? sensor->getHumidity() : sensor->getTemperature();
+    }
+
+    // Box errors are reported against the temperature channel (covers both values)
+    SensorType getSensorType() const override { return SensorType::BOX_TEMP; }
+    bool isValid() const override { return sensor->isValid(); }
+    String getLastError() const override { return sensor->getLastError(); }
+};
+
+/**
+ * SpoolWeightChannel - Adapts IWeightSensor (HX711) to ISensorChannel
+ *
+ * Async: startSample() arms the data-ready wait, the 24-bit result is
+ * clocked out on a later update once DOUT goes LOW.
+ *
+ * Values: [0] = spool weight (g, after tare/scale)
+ */
+class SpoolWeightChannel : public ISensorChannel {
+private:
+    IWeightSensor* sensor;
+
+public:
+    explicit SpoolWeightChannel(IWeightSensor* weightSensor)
+        : sensor(weightSensor) {
+    }
+
+    void begin() override { sensor->begin(); }
+
+    SampleStatus startSample() override {
+        sensor->requestSample();
+        return SampleStatus::PENDING;
+    }
+
+    bool isSampleReady() override { return sensor->isSampleReady(); }
+    bool readSample() override { return sensor->read(); }
+
+    uint8_t getValueCount() const override { return 1; }
+    float getValue(uint8_t index) const override { return sensor->getWeight(); }
+
+    SensorType getSensorType() const override { return SensorType::SPOOL_WEIGHT; }
+    bool isValid() const override { return sensor->isValid(); }
+    String getLastError() const override { return sensor->getLastError(); }
+};
+
+#endif
@@ -2,128 +2,223 @@
 #define SENSOR_MANAGER_H
 
 #include "../interfaces/ISensorManager.h"
+#include "../interfaces/ISensorChannel.h"
 #include "../interfaces/IHeaterTempSensor.h"
 #include "../interfaces/IBoxTempHumiditySensor.h"
+#include "SensorChannelAdapters.h"
+#include "TimerWheel.h"
+#include "../events/EventBus.h"
+#include "../events/Events.h"
+#include "../diagnostics/PerfCounters.h"
 #include "../Types.h"
 #include "../Config.h"
-#include <vector>
 
 /**
  * SensorManager - Multi-sensor coordinator
  *
- * Coordinates reading from multiple sensors at different rates,
- * maintains cached readings, and notifies callbacks on updates.
+ * Keeps a fixed-capacity registry of sensor channels, each with its own
+ * interval, async driver and validity timeout. Channel schedules live in
+ * a timer wheel, so update() only touches channels that are due or have
+ * an acquisition in flight - no per-loop scan over the registry and no
+ * heap allocation after setup.
  *
- * Uses async reading pattern for DS18B20 to avoid blocking.
+ * Every driver call is timed into per-channel SensorChannelStats
+ * (read duration, conversion wait, sample age, error streaks).
+ *
+ * The heater (DS18B20) and box (AM2320) sensors are registered as the
+ * built-in channels HEATER_CHANNEL and BOX_CHANNEL; the legacy heater/box
+ * callbacks and getters are served from those channels.
  *
  * Sensors are injected as dependencies for better testability.
  */
-class SensorManager : public ISensorManager {
-private:
-    // Injected sensor dependencies
-    IHeaterTempSensor* heaterSensor;
-    IBoxTempHumiditySensor* boxSensor;
-
-    // Cached readings
-    SensorReading heaterTemp;
-    SensorReading boxTemp;
-    SensorReading boxHumidity;
+class SensorManager final : public ISensorManager {
+public:
+    static constexpr uint8_t HEATER_CHANNEL = 0;
+    static constexpr uint8_t BOX_CHANNEL = 1;
 
-    // Timing
-    uint32_t lastHeaterUpdate;
-    uint32_t lastBoxUpdate;
+    static_assert(MAX_SENSOR_CHANNELS <= 32, "Pending mask is 32 bits wide");
 
-    // Heater sensor async state
-    bool heaterConversionRequested;
-    uint32_t heaterConversionRequestTime;
+private:
+    struct ChannelSlot {
+        ISensorChannel* driver;
+        SensorChannelConfig config;
+        SensorReading readings[MAX_SENSOR_CHANNEL_VALUES];
+        uint32_t sampleStartTime;
+    };
+
+    // Built-in channel adapters for the injected sensors
+    HeaterTempChannel heaterChannel;
+    BoxTempHumidityChannel boxChannel;
+
+    // Channel registry
+    ChannelSlot channels[MAX_SENSOR_CHANNELS];
+    uint8_t channelCount;
+
+    // Acquisition diagnostics (mutable: sample age is recorded by const getters)
+    mutable SensorChannelStats stats[MAX_SENSOR_CHANNELS];
+
+    // Scheduling
+    TimerWheel<MAX_SENSOR_CHANNELS, SENSOR_WHEEL_SLOTS, SENSOR_WHEEL_TICK_MS> wheel;
+    uint32_t pendingMask;        // Channels with an acquisition in flight
+    uint32_t lastUpdateTime;
+    uint32_t minIntervalMs;      // Idle floor on every channel's interval (0 = none)
+    bool started;
 
     // Callbacks
-    std::vector<HeaterTempCallback> heaterTempCallbacks;
-    std::vector<BoxDataCallback> boxDataCallbacks;
-    std::vector<SensorErrorCallback> errorCallbacks;
+    EventBus<HeaterTempEvent> heaterTempBus;
+    EventBus<BoxDataEvent> boxDataBus;
+    EventBus<SensorErrorEvent> errorBus;
+    EventBus<SensorChannelEvent> channelBus;
 
     void notifyHeaterTemp(float temp, uint32_t timestamp) {
-        for (auto& callback : heaterTempCallbacks) {
-            if (callback) {
-                callback(temp, timestamp);
-            }
-        }
+        heaterTempBus.publish(temp, timestamp);
     }
 
     void notifyBoxData(float temp, float humidity, uint32_t timestamp) {
-        for (auto& callback : boxDataCallbacks) {
-            if (callback) {
-                callback(temp, humidity, timestamp);
-            }
-        }
+        boxDataBus.publish(temp, humidity, timestamp);
     }
 
     void notifyError(SensorType type, const String& error) {
-        for (auto& callback : errorCallbacks) {
-            if (callback) {
-                callback(type, error);
-            }
+        errorBus.publish(type, error);
+    }
+
+    void notifyChannel(uint8_t id) {
+        ChannelSlot& slot = channels[id];
+        channelBus.publish(id, static_cast<const SensorReading*>(slot.readings), slot.driver->getValueCount());
+    }
+
+    uint8_t addChannel(ISensorChannel* driver, const SensorChannelConfig& config) {
+        if (driver == nullptr || channelCount >= MAX_SENSOR_CHANNELS) {
+            return INVALID_SENSOR_CHANNEL;
+        }
+
+        uint8_t id = channelCount++;
+        ChannelSlot& slot = channels[id];
+        slot.driver = driver;
+        slot.config = config;
+        slot.sampleStartTime = 0;
+        for (uint8_t i = 0; i < MAX_SENSOR_CHANNEL_VALUES; i++) {
+            slot.readings[i] = SensorReading();
         }
+
+        // Schedule is measured from time zero, same as a fresh lastUpdate = 0
+        wheel.schedule(id, config.intervalMs);
+        return id;
     }
 
-    void updateHeaterTemp(uint32_t currentMillis) {
-        // Async pattern: request conversion, then read result later
-        if (!heaterConversionRequested) {
-            // Request new conversion
-            heaterSensor->requestConversion();
-            heaterConversionRequested = true;
-            heaterConversionRequestTime = currentMillis;
-            return;
+    void startSample(uint8_t id, uint32_t currentMillis) {
+        ChannelSlot& slot = channels[id];
+        slot.sampleStartTime = currentMillis;
+
+        if (slot.driver->startSample() == SampleStatus::READY) {
+            completeSample(id, currentMillis);
+        } else {
+            pendingMask |= (1UL << id);
+        }
+    }
+
+    void pollSample(uint8_t id, uint32_t currentMillis) {
+        if (!channels[id].driver->isSampleReady()) {
+            return;  // Still waiting, check again next update
         }
+        pendingMask &= ~(1UL << id);
+        stats[id].conversionWaitMs.record(currentMillis - channels[id].sampleStartTime);
+        completeSample(id, currentMillis);
+    }
 
-        // Check if conversion is ready
-        if (!heaterSensor->isConversionReady()) {
-            return;  // Still waiting, check again next loop
+    void completeSample(uint8_t id, uint32_t currentMillis) {
+        ChannelSlot& slot = channels[id];
+        uint8_t valueCount = slot.driver->getValueCount();
+        if (valueCount > MAX_SENSOR_CHANNEL_VALUES) {
+            valueCount = MAX_SENSOR_CHANNEL_VALUES;
         }
 
-        // Conversion ready, read the result
-        if (!heaterSensor->read()) {
-            // Reading failed
-            if (!heaterSensor->isValid()) {
-                heaterTemp.isValid = false;
-                notifyError(SensorType::HEATER_TEMP, heaterSensor->getLastError());
+        SensorChannelStats& channelStats = stats[id];
+        uint32_t readStart = micros();
+        bool success = slot.driver->readSample();
+        channelStats.readDurationUs.record(micros() - readStart);
+
+        if (!success) {
+            if (channelStats.currentErrorStreak < UINT16_MAX) {
+                channelStats.currentErrorStreak++;
+            }
+
+            // Reading failed - drivers tolerate a few errors before going invalid
+            if (!slot.driver->isValid()) {
+                for (uint8_t i = 0; i < valueCount; i++) {
+                    slot.readings[i].isValid = false;
+                }
+                notifyError(slot.driver->getSensorType(), slot.driver->getLastError());
             }
-            heaterConversionRequested = false;
             return;
         }
 
+        if (channelStats.currentErrorStreak > 0) {
+            channelStats.errorStreaks.record(channelStats.currentErrorStreak);
+            channelStats.currentErrorStreak = 0;
+        }
+
         // Successful read
-        heaterTemp.value = heaterSensor->getTemperature();
-        heaterTemp.timestamp = currentMillis;
-        heaterTemp.isValid = true;
+        for (uint8_t i = 0; i < valueCount; i++) {
+            slot.readings[i].value = slot.driver->getValue(i);
+            slot.readings[i].timestamp = currentMillis;
+            slot.readings[i].isValid = true;
+        }
 
-        notifyHeaterTemp(heaterTemp.value, currentMillis);
+        dispatch(id, currentMillis);
+    }
 
-        // Reset for next conversion
-        heaterConversionRequested = false;
+    void dispatch(uint8_t id, uint32_t currentMillis) {
+        const ChannelSlot& slot = channels[id];
+
+        if (id == HEATER_CHANNEL) {
+            notifyHeaterTemp(slot.readings[0].value, currentMillis);
+        } else if (id == BOX_CHANNEL) {
+            notifyBoxData(slot.readings[BoxTempHumidityChannel::TEMP_INDEX].value,
+                          slot.readings[BoxTempHumidityChannel::HUMIDITY_INDEX].value,
+                          currentMillis);
+        }
+
+        notifyChannel(id);
     }
 
-    void updateBoxData(uint32_t currentMillis) {
-        if (!boxSensor->read()) {
-            // Reading failed
-            if (!boxSensor->isValid()) {
-                boxTemp.isValid = false;
-                boxHumidity.isValid = false;
-                notifyError(SensorType::BOX_TEMP, boxSensor->getLastError());
-            }
-            return;
+    uint32_t intervalFor(uint8_t id) const {
+        uint32_t interval = channels[id].config.intervalMs;
+        return interval > minIntervalMs ? interval : minIntervalMs;
+    }
+
+    void onChannelDue(uint8_t id, uint32_t currentMillis) {
+        // Interval is measured from the last update attempt, not the last successful read
+        wheel.schedule(id, currentMillis + intervalFor(id));
+
+        if (pendingMask & (1UL << id)) {
+            stats[id].skippedSamples++;
+            return;  // Acquisition still in flight, already polled this update
         }
+        startSample(id, currentMillis);
+    }
 
-        // Successful read
-        boxTemp.value = boxSensor->getTemperature();
-        boxTemp.timestamp = currentMillis;
-        boxTemp.isValid = true;
+    SensorReading readingAt(uint8_t id, uint8_t valueIndex) const {
+        if (id >= channelCount || valueIndex >= MAX_SENSOR_CHANNEL_VALUES) {
+            return SensorReading();
+        }
 
-        boxHumidity.value = boxSensor->getHumidity();
-        boxHumidity.timestamp = currentMillis;
-        boxHumidity.isValid = true;
+        const ChannelSlot& slot = channels[id];
+        SensorReading reading = slot.readings[valueIndex];
+        if (reading.isValid && slot.config.validityTimeoutMs > 0 &&
+            lastUpdateTime - reading.timestamp > slot.config.validityTimeoutMs) {
+            reading.isValid = false;  // Stale
+        }
+        return reading;
+    }
 
-        notifyBoxData(boxTemp.value, boxHumidity.value, currentMillis);
+    // Reading handed to a consumer - record how old it is
+    SensorReading consume(uint8_t id, uint8_t valueIndex) const {
+        SensorReading reading = readingAt(id, valueIndex);
+        if (reading.isValid) {
+            stats[id].sampleAgeMs.record(lastUpdateTime - reading.timestamp);
+        }
+        return reading;
     }
 
 public:
@@ -134,86 +229,166 @@ public:
      * @param box - Box temperature/humidity sensor (AM2320)
      */
     SensorManager(IHeaterTempSensor* heater, IBoxTempHumiditySensor* box)
-        : heaterSensor(heater),
-          boxSensor(box),
-          lastHeaterUpdate(0),
-          lastBoxUpdate(0),
-          heaterConversionRequested(false),
-          heaterConversionRequestTime(0) {
-
-        heaterTemp.isValid = false;
-        boxTemp.isValid = false;
-        boxHumidity.isValid = false;
+        : heaterChannel(heater),
+          boxChannel(box),
+          channelCount(0),
+          pendingMask(0),
+          lastUpdateTime(0),
+          minIntervalMs(0),
+          started(false) {
+
+        // Heater conversion is primed in begin() to get the first reading faster
+        addChannel(&heaterChannel, SensorChannelConfig(HEATER_TEMP_INTERVAL, SENSOR_TIMEOUT, true));
+        // Box read is synchronous (relatively fast I2C read)
+        addChannel(&boxChannel, SensorChannelConfig(BOX_DATA_INTERVAL, SENSOR_TIMEOUT));
     }
 
     void begin() override {
-        heaterSensor->begin();
-        boxSensor->begin();
-
-        // Request initial conversion to get first reading faster
-        heaterSensor->requestConversion();
-        heaterConversionRequested = true;
-        heaterConversionRequestTime = 0;
+        for (uint8_t id = 0; id < channelCount; id++) {
+            channels[id].driver->begin();
+        }
+        for (uint8_t id = 0; id < channelCount; id++) {
+            if (channels[id].config.primeOnBegin) {
+                startSample(id, 0);
+            }
+        }
+        started = true;
     }
 
     void update(uint32_t currentMillis) override {
-        // Update heater temp at configured interval (1000ms)
-        // Note: This checks interval from last UPDATE attempt, not last successful read
-        // The async pattern means we request conversion at interval, then read when ready
-        if (currentMillis - lastHeaterUpdate >= HEATER_TEMP_INTERVAL) {
-            lastHeaterUpdate = currentMillis;
-            updateHeaterTemp(currentMillis);
-        } else if (heaterConversionRequested) {
-            // Even if interval hasn't elapsed, check if pending conversion is ready
-            updateHeaterTemp(currentMillis);
+        PERF_SCOPE(PerfZone::SENSOR_UPDATE);
+
+        lastUpdateTime = currentMillis;
+
+        // Poll only the channels with a conversion in flight
+        uint32_t pending = pendingMask;
+        while (pending) {
+            uint8_t id = __builtin_ctz(pending);
+            pending &= pending - 1;
+            pollSample(id, currentMillis);
         }
 
-        // Update box data every 2000ms (synchronous, relatively fast I2C read)
-        if (currentMillis - lastBoxUpdate >= BOX_DATA_INTERVAL) {
-            lastBoxUpdate = currentMillis;
-            updateBoxData(currentMillis);
+        // Start acquisitions for channels whose interval elapsed
+        wheel.advance(currentMillis, [this, currentMillis](uint8_t id) {
+            onChannelDue(id, currentMillis);
+        });
+    }
+
+    // ==================== Channel Registry ====================
+
+    /**
+     * Register an additional sensor channel
+     *
+     * @return channel id, or INVALID_SENSOR_CHANNEL when the registry is full
+     */
+    uint8_t registerChannel(ISensorChannel* channel, const SensorChannelConfig& config) override {
+        uint8_t id = addChannel(channel, config);
+        if (id != INVALID_SENSOR_CHANNEL && started) {
+            channel->begin();
+            if (config.primeOnBegin) {
+                startSample(id, lastUpdateTime);
+            }
         }
+        return id;
     }
 
+    void registerChannelCallback(SensorChannelCallback callback) override {
+        channelBus.subscribe(callback);
+    }
+
+    uint8_t getChannelCount() const override {
+        return channelCount;
+    }
+
+    uint8_t findChannel(SensorType type) const override {
+        for (uint8_t id = 0; id < channelCount; id++) {
+            if (channels[id].driver->getSensorType() == type) {
+                return id;
+            }
+        }
+        return INVALID_SENSOR_CHANNEL;
+    }
+
+    SensorReading getChannelReading(uint8_t channel, uint8_t valueIndex = 0) const override {
+        return consume(channel, valueIndex);
+    }
+
+    // ==================== Diagnostics ====================
+
+    const SensorChannelStats* getChannelStats(uint8_t channel) const override {
+        return channel < channelCount ? &stats[channel] : nullptr;
+    }
+
+    void resetChannelStats() override {
+        for (uint8_t id = 0; id < MAX_SENSOR_CHANNELS; id++) {
+            stats[id].reset();
+        }
+    }
+
+    // ==================== Idle Rate ====================
+
+    void setMinInterval(uint32_t intervalMs) override {
+        bool faster = intervalMs < minIntervalMs;
+        minIntervalMs = intervalMs;
+
+        if (faster) {
+            // Leaving idle: don't wait out the long interval, sample everything now
+            for (uint8_t id = 0; id < channelCount; id++) {
+                if (wheel.isArmed(id)) {
+                    wheel.schedule(id, lastUpdateTime);
+                }
+            }
+        }
+    }
+
+    uint32_t getMinInterval() const override {
+        return minIntervalMs;
+    }
+
+    // ==================== Legacy Heater/Box Interface ====================
+
     void registerHeaterTempCallback(HeaterTempCallback callback) override {
-        heaterTempCallbacks.push_back(callback);
+        heaterTempBus.subscribe(callback);
     }
 
     void registerBoxDataCallback(BoxDataCallback callback) override {
-        boxDataCallbacks.push_back(callback);
+        boxDataBus.subscribe(callback);
     }
 
     void registerSensorErrorCallback(SensorErrorCallback callback) override {
-        errorCallbacks.push_back(callback);
+        errorBus.subscribe(callback);
     }
 
     SensorReadings getReadings() const override {
         SensorReadings readings;
-        readings.heaterTemp = heaterTemp;
-        readings.boxTemp = boxTemp;
-        readings.boxHumidity = boxHumidity;
+        readings.heaterTemp = consume(HEATER_CHANNEL, 0);
+        readings.boxTemp = consume(BOX_CHANNEL, BoxTempHumidityChannel::TEMP_INDEX);
+        readings.boxHumidity = readingAt(BOX_CHANNEL, BoxTempHumidityChannel::HUMIDITY_INDEX);
         return readings;
     }
 
     float getHeaterTemp() const override {
-        return heaterTemp.value;
+        consume(HEATER_CHANNEL, 0);
+        return channels[HEATER_CHANNEL].readings[0].value;
     }
 
     float getBoxTemp() const override {
-        return boxTemp.value;
+        consume(BOX_CHANNEL, BoxTempHumidityChannel::TEMP_INDEX);
+        return channels[BOX_CHANNEL].readings[BoxTempHumidityChannel::TEMP_INDEX].value;
     }
 
     float getBoxHumidity() const override {
-        return boxHumidity.value;
+        return channels[BOX_CHANNEL].readings[BoxTempHumidityChannel::HUMIDITY_INDEX].value;
     }
 
     bool isHeaterTempValid() const override {
-        return heaterTemp.isValid;
+        return readingAt(HEATER_CHANNEL, 0).isValid;
     }
 
     bool isBoxDataValid() const override {
-        return boxTemp.isValid && boxHumidity.isValid;
+        return readingAt(BOX_CHANNEL, BoxTempHumidityChannel::TEMP_INDEX).isValid &&
+               readingAt(BOX_CHANNEL, BoxTempHumidityChannel::HUMIDITY_INDEX).isValid;
     }
 };
 
-#endif
\ No newline at end of file
+#endif
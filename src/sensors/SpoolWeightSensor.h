@@ -0,0 +1,212 @@
+#ifndef SPOOL_WEIGHT_SENSOR_H
+#define SPOOL_WEIGHT_SENSOR_H
+
+#include "../interfaces/IWeightSensor.h"
+#include "../Config.h"
+
+/**
+ * SpoolWeightSensor - HX711 load cell under the spool holder
+ *
+ * Bit-bangs the HX711 two-wire interface (DOUT/PD_SCK), channel A,
+ * gain 128. The chip converts continuously at 10 SPS and pulls DOUT
+ * LOW when a conversion is waiting, so the async pattern only has to
+ * watch the pin - nothing is started on the chip itself.
+ *
+ * Async Pattern:
+ * 1. Call requestSample() - remembers when we started waiting
+ * 2. Call isSampleReady() - true once DOUT is LOW (or on timeout, so
+ *    that read() can report the sensor as not responding)
+ * 3. Call read() - clocks out 24 bits (~50us) and validates
+ *
+ * Tare and calibration use the mean of the last SCALE_AVERAGE_SAMPLES
+ * raw readings, so the HX711's few-count noise doesn't end up baked
+ * into the offset.
+ */
+class SpoolWeightSensor : public IWeightSensor {
+private:
+    uint8_t doutPin;
+    uint8_t sckPin;
+
+    int32_t lastRaw;
+    bool valid;
+    String lastError;
+    uint8_t consecutiveErrors;
+
+    // Recent raw readings for tare/calibration
+    int32_t rawHistory[SCALE_AVERAGE_SAMPLES];
+    uint8_t rawHistoryHead;
+    uint8_t rawHistoryCount;
+
+    ScaleCalibration calibration;
+
+    bool waiting;
+    uint32_t requestTime;
+
+    static constexpr uint8_t MAX_CONSECUTIVE_ERRORS = 3;
+    static constexpr uint8_t GAIN_128_PULSES = 1;   // 25th pulse selects channel A, gain 128
+    static constexpr int32_t RAW_MAX = 0x7FFFFF;
+    static constexpr int32_t RAW_MIN = -0x800000;
+    static constexpr float MIN_COUNTS_PER_GRAM = 1.0f;   // A 5 kg cell at gain 128 gives ~400
+
+    void recordError(const String& error) {
+        consecutiveErrors++;
+        if (consecutiveErrors >= MAX_CONSECUTIVE_ERRORS) {
+            valid = false;
+            lastError = error;
+        }
+    }
+
+    int32_t averageRaw() const {
+        int64_t sum = 0;
+        for (uint8_t i = 0; i < rawHistoryCount; i++) {
+            sum += rawHistory[i];
+        }
+        return static_cast<int32_t>(sum / rawHistoryCount);
+    }
+
+    uint32_t shiftIn24() {
+        uint32_t value = 0;
+
+        // PD_SCK held HIGH for >60us powers the HX711 down, so keep
+        // interrupts off for the ~50us transfer
+        noInterrupts();
+        for (uint8_t i = 0; i < 24; i++) {
+            digitalWrite(sckPin, HIGH);
+            delayMicroseconds(1);
+            value = (value << 1) | (digitalRead(doutPin) ? 1 : 0);
+            digitalWrite(sckPin, LOW);
+            delayMicroseconds(1);
+        }
+        for (uint8_t i = 0; i < GAIN_128_PULSES; i++) {
+            digitalWrite(sckPin, HIGH);
+            delayMicroseconds(1);
+            digitalWrite(sckPin, LOW);
+            delayMicroseconds(1);
+        }
+        interrupts();
+
+        return value;
+    }
+
+public:
+    SpoolWeightSensor(uint8_t dout, uint8_t sck)
+        : doutPin(dout),
+          sckPin(sck),
+          lastRaw(0),
+          valid(false),
+          consecutiveErrors(0),
+          rawHistoryHead(0),
+          rawHistoryCount(0),
+          waiting(false),
+          requestTime(0) {
+    }
+
+    void begin() override {
+        pinMode(doutPin, INPUT);
+        pinMode(sckPin, OUTPUT);
+        digitalWrite(sckPin, LOW);  // Power up / stay awake
+        waiting = false;
+    }
+
+    void requestSample() override {
+        waiting = true;
+        requestTime = millis();
+    }
+
+    bool isSampleReady() override {
+        if (!waiting) {
+            return false;
+        }
+        if (digitalRead(doutPin) == LOW) {
+            return true;
+        }
+        return millis() - requestTime >= SCALE_READY_TIMEOUT_MS;
+    }
+
+    bool read() override {
+        waiting = false;
+
+        if (digitalRead(doutPin) != LOW) {
+            recordError("HX711 not responding");
+            return false;
+        }
+
+        // Sign-extend the 24-bit two's complement result
+        uint32_t value = shiftIn24();
+        int32_t raw = (value & 0x800000) ? static_cast<int32_t>(value | 0xFF000000) : static_cast<int32_t>(value);
+
+        if (raw == RAW_MAX || raw == RAW_MIN) {
+            recordError("HX711 reading saturated");
+            return false;
+        }
+
+        consecutiveErrors = 0;
+        lastRaw = raw;
+        valid = true;
+        lastError = "";
+
+        rawHistory[rawHistoryHead] = raw;
+        rawHistoryHead = (rawHistoryHead + 1) % SCALE_AVERAGE_SAMPLES;
+        if (rawHistoryCount < SCALE_AVERAGE_SAMPLES) {
+            rawHistoryCount++;
+        }
+        return true;
+    }
+
+    float getWeight() const override {
+        if (!isCalibrated()) {
+            return 0.0f;
+        }
+        return (lastRaw - calibration.tareOffset) / calibration.countsPerGram;
+    }
+
+    int32_t getRawValue() const override {
+        return lastRaw;
+    }
+
+    bool tare() override {
+        if (!valid || rawHistoryCount == 0) {
+            return false;
+        }
+        calibration.tareOffset = averageRaw();
+        return true;
+    }
+
+    bool calibrate(float knownMassGrams) override {
+        if (!valid || rawHistoryCount == 0 || knownMassGrams <= 0.0f) {
+            return false;
+        }
+
+        float scale = (averageRaw() - calibration.tareOffset) / knownMassGrams;
+        if (fabsf(scale) < MIN_COUNTS_PER_GRAM) {
+            lastError = "Calibration mass not detected";
+            return false;
+        }
+
+        // Negative scale is fine - it just means the cell is mounted inverted
+        calibration.countsPerGram = scale;
+        return true;
+    }
+
+    void setCalibration(const ScaleCalibration& newCalibration) override {
+        calibration = newCalibration;
+    }
+
+    ScaleCalibration getCalibration() const override {
+        return calibration;
+    }
+
+    bool isCalibrated() const override {
+        return calibration.countsPerGram != 0.0f;
+    }
+
+    bool isValid() const override {
+        return valid;
+    }
+
+    String getLastError() const override {
+        return lastError;
+    }
+};
+
+#endif
@@ -0,0 +1,157 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <stdint.h>
+
+/**
+ * TimerWheel - Hashed timer wheel for fixed-capacity periodic schedules
+ *
+ * Each timer id (0..CAPACITY-1) may be armed once. Timers hash into
+ * SLOTS buckets of TICK_MS each and are chained through an intrusive
+ * index list, so scheduling is O(1) and advance() only visits the
+ * buckets that elapsed since the previous call - never the whole table.
+ *
+ * Timers store their exact due time, so intervals longer than one wheel
+ * revolution (SLOTS * TICK_MS) simply stay in their bucket until due.
+ *
+ * No dynamic allocation; all storage is sized at compile time.
+ */
+template <uint8_t CAPACITY, uint16_t SLOTS, uint32_t TICK_MS>
+class TimerWheel {
+public:
+    static constexpr uint8_t NONE = 0xFF;
+
+    static_assert(CAPACITY > 0 && CAPACITY < NONE, "TimerWheel capacity must fit the index type");
+    static_assert(SLOTS > 0, "TimerWheel needs at least one slot");
+    static_assert(TICK_MS > 0, "TimerWheel tick must be non-zero");
+
+private:
+    uint8_t slotHead[SLOTS];
+    uint8_t next[CAPACITY];
+    uint8_t prev[CAPACITY];
+    uint16_t slotOf[CAPACITY];
+    uint32_t dueTime[CAPACITY];
+    bool armed[CAPACITY];
+    uint32_t cursorTick;    // Last tick processed by advance()
+
+    static bool isDue(uint32_t due, uint32_t now) {
+        // Wrap-safe comparison of millis() timestamps
+        return static_cast<int32_t>(now - due) >= 0;
+    }
+
+    void link(uint8_t id, uint16_t slot) {
+        slotOf[id] = slot;
+        prev[id] = NONE;
+        next[id] = slotHead[slot];
+        if (slotHead[slot] != NONE) {
+            prev[slotHead[slot]] = id;
+        }
+        slotHead[slot] = id;
+    }
+
+    void unlink(uint8_t id) {
+        if (prev[id] != NONE) {
+            next[prev[id]] = next[id];
+        } else {
+            slotHead[slotOf[id]] = next[id];
+        }
+        if (next[id] != NONE) {
+            prev[next[id]] = prev[id];
+        }
+        next[id] = NONE;
+        prev[id] = NONE;
+    }
+
+public:
+    TimerWheel() : cursorTick(0) {
+        for (uint16_t i = 0; i < SLOTS; i++) {
+            slotHead[i] = NONE;
+        }
+        for (uint8_t i = 0; i < CAPACITY; i++) {
+            next[i] = NONE;
+            prev[i] = NONE;
+            slotOf[i] = 0;
+            dueTime[i] = 0;
+            armed[i] = false;
+        }
+    }
+
+    /**
+     * Arm (or re-arm) timer id to expire at dueMillis
+     * Timers already in the past fire on the next advance()
+     */
+    void schedule(uint8_t id, uint32_t dueMillis) {
+        if (id >= CAPACITY) {
+            return;
+        }
+        if (armed[id]) {
+            unlink(id);
+        }
+
+        uint32_t dueTick = dueMillis / TICK_MS;
+        if (static_cast<int32_t>(dueTick - cursorTick) < 0) {
+            // Bucket already swept - park in the current one
+            dueTick = cursorTick;
+        }
+
+        dueTime[id] = dueMillis;
+        armed[id] = true;
+        link(id, dueTick % SLOTS);
+    }
+
+    void cancel(uint8_t id) {
+        if (id >= CAPACITY || !armed[id]) {
+            return;
+        }
+        unlink(id);
+        armed[id] = false;
+    }
+
+    bool isArmed(uint8_t id) const {
+        return id < CAPACITY && armed[id];
+    }
+
+    uint32_t getDueTime(uint8_t id) const {
+        return id < CAPACITY ? dueTime[id] : 0;
+    }
+
+    /**
+     * Expire every timer due at or before currentMillis
+     *
+     * Expired timers are disarmed before onExpire(id) runs, so the
+     * handler may re-arm them. Visits at most one revolution of buckets.
+     */
+    template <typename Handler>
+    void advance(uint32_t currentMillis, Handler&& onExpire) {
+        uint32_t nowTick = currentMillis / TICK_MS;
+        uint32_t span = nowTick - cursorTick;
+        if (span >= SLOTS) {
+            span = SLOTS - 1;
+        }
+
+        uint8_t expired[CAPACITY];
+        uint8_t expiredCount = 0;
+
+        for (uint32_t i = 0; i <= span; i++) {
+            uint16_t slot = (cursorTick + i) % SLOTS;
+            uint8_t id = slotHead[slot];
+            while (id != NONE) {
+                uint8_t following = next[id];
+                if (isDue(dueTime[id], currentMillis)) {
+                    unlink(id);
+                    armed[id] = false;
+                    expired[expiredCount++] = id;
+                }
+                id = following;
+            }
+        }
+
+        cursorTick = nowTick;
+
+        for (uint8_t i = 0; i < expiredCount; i++) {
+            onExpire(expired[i]);
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,130 @@
+#ifndef WEIGHT_TREND_H
+#define WEIGHT_TREND_H
+
+#include "../Config.h"
+
+/**
+ * WeightTrend - Mass-loss rate from a least-squares fit over recent weight
+ *
+ * Raw scale samples (1 Hz) are averaged into one point per
+ * WEIGHT_TREND_INTERVAL_MS, and the last WEIGHT_TREND_POINTS points are
+ * fitted with a straight line. Averaging first keeps the HX711 noise and
+ * the fan's vibration out of the slope; the fit over a 30 min window
+ * keeps a single bumped spool from ending a cycle.
+ *
+ * The rate is refitted only when a point closes (once a minute), so
+ * addSample() is a couple of adds in the common case.
+ */
+class WeightTrend {
+private:
+    struct Point {
+        uint32_t time;   // ms, mean timestamp of the averaged samples
+        float grams;
+    };
+
+    Point points[WEIGHT_TREND_POINTS];
+    uint8_t head;    // Next write position
+    uint8_t count;
+
+    // Samples in the point currently being averaged
+    uint32_t bucketStart;
+    uint32_t bucketTimeSum;   // Offsets from bucketStart
+    float bucketWeightSum;
+    uint16_t bucketCount;
+
+    float lossRate;   // g/h, positive while the spool is losing mass
+
+    void closeBucket() {
+        Point point;
+        point.time = bucketStart + bucketTimeSum / bucketCount;
+        point.grams = bucketWeightSum / bucketCount;
+
+        points[head] = point;
+        head = (head + 1) % WEIGHT_TREND_POINTS;
+        if (count < WEIGHT_TREND_POINTS) {
+            count++;
+        }
+
+        bucketTimeSum = 0;
+        bucketWeightSum = 0;
+        bucketCount = 0;
+
+        refit();
+    }
+
+    const Point& oldest(uint8_t index) const {
+        return points[(head + WEIGHT_TREND_POINTS - count + index) % WEIGHT_TREND_POINTS];
+    }
+
+    void refit() {
+        if (count < 2) {
+            lossRate = 0;
+            return;
+        }
+
+        // Hours relative to the oldest point keeps the floats small
+        uint32_t origin = oldest(0).time;
+        float meanX = 0;
+        float meanY = 0;
+        for (uint8_t i = 0; i < count; i++) {
+            meanX += (oldest(i).time - origin) / 3600000.0f;
+            meanY += oldest(i).grams;
+        }
+        meanX /= count;
+        meanY /= count;
+
+        float covariance = 0;
+        float variance = 0;
+        for (uint8_t i = 0; i < count; i++) {
+            float dx = (oldest(i).time - origin) / 3600000.0f - meanX;
+            covariance += dx * (oldest(i).grams - meanY);
+            variance += dx * dx;
+        }
+
+        lossRate = variance > 0 ? -covariance / variance : 0;
+    }
+
+public:
+    WeightTrend() {
+        clear();
+    }
+
+    void addSample(float grams, uint32_t timestamp) {
+        if (bucketCount > 0 && timestamp - bucketStart >= WEIGHT_TREND_INTERVAL_MS) {
+            closeBucket();
+        }
+        if (bucketCount == 0) {
+            bucketStart = timestamp;
+        }
+
+        bucketTimeSum += timestamp - bucketStart;
+        bucketWeightSum += grams;
+        bucketCount++;
+    }
+
+    void clear() {
+        head = 0;
+        count = 0;
+        bucketStart = 0;
+        bucketTimeSum = 0;
+        bucketWeightSum = 0;
+        bucketCount = 0;
+        lossRate = 0;
+    }
+
+    // True once the regression window is full
+    bool isReady() const {
+        return count == WEIGHT_TREND_POINTS;
+    }
+
+    uint8_t getPointCount() const {
+        return count;
+    }
+
+    // g/h, positive = losing mass
+    float getLossRate() const {
+        return lossRate;
+    }
+};
+
+#endif
@@ -0,0 +1,299 @@
+#ifndef CYCLE_HISTORY_FILE_H
+#define CYCLE_HISTORY_FILE_H
+
+#include "CycleRecord.h"
+#include "FlashWear.h"
+#include "../Config.h"
+#include "../diagnostics/Log.h"
+#include <atomic>
+
+#ifndef UNIT_TEST
+    #include <LittleFS.h>
+#else
+    #include "../../test/mocks/arduino_mock.h"
+#endif
+
+/**
+ * Index header at the start of the history file (16 bytes, padded to
+ * one record slot). `nextId` is the id the next cycle gets; with the
+ * fixed capacity it locates every record, so the header is all the
+ * index there is.
+ */
+struct CycleHistoryHeader {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t reserved;
+    uint16_t capacity;          // CYCLE_HISTORY_RECORDS the file was laid out for
+    uint16_t recordBytes;       // sizeof(CycleRecord)
+    uint32_t nextId;
+    uint32_t crc;
+};
+
+static_assert(sizeof(CycleHistoryHeader) <= sizeof(CycleRecord), "Header must fit its slot");
+
+constexpr uint16_t CYCLE_HISTORY_MAGIC = 0x4849;   // "IH"
+constexpr uint8_t CYCLE_HISTORY_VERSION = 1;
+constexpr size_t CYCLE_HISTORY_BYTES = (1 + CYCLE_HISTORY_RECORDS) * sizeof(CycleRecord);
+
+/**
+ * CycleHistoryFile - Ring of the last CYCLE_HISTORY_RECORDS cycles
+ *
+ * The file is preallocated: one header slot, then CYCLE_HISTORY_RECORDS
+ * erased (0xFF) record slots. Cycle `id` always lives in slot
+ * (id - 1) % CYCLE_HISTORY_RECORDS, so listing and fetching by id are a
+ * seek and one record read - no scan.
+ *
+ * append() writes the record slot first and the header second, both in
+ * place ("r+" + seek). A power cut between the two leaves the header one
+ * behind; load() finds the record in the slot the header points at and
+ * rolls it forward. A header that fails its CRC is rebuilt from the
+ * highest valid id in the slots.
+ *
+ * Threading: append() runs on the storage worker; readers (serial, UI)
+ * may run on the other core. The newest id is published only after its
+ * slot is written, and read() checks the id and CRC it finds, so a
+ * reader racing an overwrite gets `false`, never a mixed record.
+ *
+ * Responsibilities:
+ * - Record slots, ids, the index header and its repair
+ *
+ * Does NOT:
+ * - Collect the cycle statistics (CycleRecorder does)
+ * - Decide when to write (the storage worker does)
+ */
+class CycleHistoryFile {
+private:
+    const char* path;
+    std::atomic<uint32_t> nextId;
+    uint32_t headerRepairs;
+
+    static size_t slotOffset(uint32_t id) {
+        return (1 + (id - 1) % CYCLE_HISTORY_RECORDS) * sizeof(CycleRecord);
+    }
+
+    static uint32_t headerCrc(const CycleHistoryHeader& header) {
+        return crc32(&header, offsetof(CycleHistoryHeader, crc));
+    }
+
+    static bool isValid(const CycleRecord& record, uint32_t id) {
+        return record.magic == CYCLE_RECORD_MAGIC &&
+               record.version == CYCLE_RECORD_VERSION &&
+               record.id == id &&
+               record.crc == cycleRecordCrc(record);
+    }
+
+    static bool readSlot(File& file, uint32_t id, CycleRecord& out) {
+        return file.seek(slotOffset(id)) &&
+               file.readBytes(reinterpret_cast<char*>(&out), sizeof(out)) == sizeof(out) &&
+               isValid(out, id);
+    }
+
+    bool writeHeader(uint32_t id) {
+        CycleHistoryHeader header;
+        header.magic = CYCLE_HISTORY_MAGIC;
+        header.version = CYCLE_HISTORY_VERSION;
+        header.reserved = 0;
+        header.capacity = CYCLE_HISTORY_RECORDS;
+        header.recordBytes = sizeof(CycleRecord);
+        header.nextId = id;
+        header.crc = headerCrc(header);
+
+        FlashWriteSession session(FlashFile::CYCLES);
+        File file = LittleFS.open(path, "r+");
+        if (!file) {
+            return false;
+        }
+        bool ok = file.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) == sizeof(header);
+        session.wrote(0, sizeof(header));
+        session.fileEnds(file.size());
+        file.close();
+        return ok;
+    }
+
+    // Fresh file: header at id 1, every record slot erased
+    bool preallocate() {
+        {   // Own scope: writeHeader() is a write session of its own
+            FlashWriteSession session(FlashFile::CYCLES);
+            File file = LittleFS.open(path, "w");
+            if (!file) {
+                return false;
+            }
+            CycleRecord erased;
+            memset(&erased, 0xFF, sizeof(erased));
+            bool ok = true;
+            for (uint16_t slot = 0; slot <= CYCLE_HISTORY_RECORDS && ok; slot++) {
+                ok = file.write(reinterpret_cast<const uint8_t*>(&erased), sizeof(erased)) == sizeof(erased);
+                session.wrote(slot * sizeof(erased), sizeof(erased));
+            }
+            file.close();
+            if (!ok) {
+                return false;
+            }
+        }
+        return writeHeader(1);
+    }
+
+public:
+    explicit CycleHistoryFile(const char* historyPath = CYCLE_HISTORY_FILE)
+        : path(historyPath),
+          nextId(1),
+          headerRepairs(0) {
+    }
+
+    /**
+     * Boot: read the header, repair it if needed. A missing or wrongly
+     * sized file is preallocated (empty history).
+     * @return false if the file could not be created
+     */
+    bool load() {
+        nextId.store(1, std::memory_order_relaxed);
+
+        File file = LittleFS.open(path, "r");
+        if (!file || file.size() != CYCLE_HISTORY_BYTES) {
+            if (file) {
+                file.close();
+            }
+            LOG_INFO(STORAGE, "  Cycle history missing or resized - preallocating");
+            return preallocate();
+        }
+
+        CycleHistoryHeader header;
+        bool headerOk = file.readBytes(reinterpret_cast<char*>(&header), sizeof(header)) == sizeof(header) &&
+                        header.magic == CYCLE_HISTORY_MAGIC &&
+                        header.version == CYCLE_HISTORY_VERSION &&
+                        header.capacity == CYCLE_HISTORY_RECORDS &&
+                        header.recordBytes == sizeof(CycleRecord) &&
+                        header.nextId != 0 &&
+                        header.crc == headerCrc(header);
+
+        uint32_t id = 1;
+        bool repaired = false;
+        CycleRecord record;
+
+        if (headerOk) {
+            id = header.nextId;
+            // Roll forward over a record written just before a power cut
+            while (readSlot(file, id, record)) {
+                id++;
+                repaired = true;
+            }
+        } else {
+            // Rebuild the index from the slots: the highest valid id wins
+            for (uint16_t slot = 0; slot < CYCLE_HISTORY_RECORDS; slot++) {
+                uint32_t position = (1 + slot) * sizeof(CycleRecord);
+                if (file.seek(position) &&
+                    file.readBytes(reinterpret_cast<char*>(&record), sizeof(record)) == sizeof(record) &&
+                    record.id != 0 && isValid(record, record.id) &&
+                    slotOffset(record.id) == position && record.id >= id) {
+                    id = record.id + 1;
+                }
+            }
+            repaired = true;
+        }
+        file.close();
+
+        nextId.store(id, std::memory_order_release);
+        if (repaired) {
+            headerRepairs++;
+            LOG_WARN(STORAGE, "  Cycle history index repaired (next id %lu)", (unsigned long)id);
+            return writeHeader(id);
+        }
+        return true;
+    }
+
+    /**
+     * Store `record` as the next cycle; fills in id, magic, version and CRC.
+     * Storage worker only.
+     */
+    bool append(CycleRecord& record) {
+        uint32_t id = nextId.load(std::memory_order_relaxed);
+        record.magic = CYCLE_RECORD_MAGIC;
+        record.version = CYCLE_RECORD_VERSION;
+        record.id = id;
+        record.crc = cycleRecordCrc(record);
+
+        bool ok;
+        {   // Own scope: the header write below is a write session of its own
+            FlashWriteSession session(FlashFile::CYCLES);
+            File file = LittleFS.open(path, "r+");
+            if (!file) {
+                return false;
+            }
+            ok = file.seek(slotOffset(id)) &&
+                 file.write(reinterpret_cast<const uint8_t*>(&record), sizeof(record)) == sizeof(record);
+            session.wrote(slotOffset(id), sizeof(record));
+            session.fileEnds(file.size());
+            file.close();
+        }
+        if (!ok) {
+            return false;
+        }
+
+        // The record is what counts; a failed header write is rolled forward at boot
+        writeHeader(id + 1);
+        nextId.store(id + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Fetch one cycle by id: a seek and one record read.
+     * @return false if the id was never written, has rotated out, or its slot is damaged
+     */
+    bool read(uint32_t id, CycleRecord& out) const {
+        if (!contains(id)) {
+            return false;
+        }
+        File file = LittleFS.open(path, "r");
+        if (!file) {
+            return false;
+        }
+        bool ok = readSlot(file, id, out);
+        file.close();
+        return ok;
+    }
+
+    /**
+     * The newest cycles, newest first, with one file open.
+     * @return records stored in `out` (damaged slots are skipped)
+     */
+    size_t readRecent(CycleRecord* out, size_t maxRecords) const {
+        uint32_t latest = getLatestId();
+        uint16_t available = getCount();
+        if (available == 0 || maxRecords == 0) {
+            return 0;
+        }
+        File file = LittleFS.open(path, "r");
+        if (!file) {
+            return 0;
+        }
+        size_t stored = 0;
+        for (uint32_t i = 0; i < available && stored < maxRecords; i++) {
+            if (readSlot(file, latest - i, out[stored])) {
+                stored++;
+            }
+        }
+        file.close();
+        return stored;
+    }
+
+    bool contains(uint32_t id) const {
+        uint32_t latest = getLatestId();
+        return id != 0 && id <= latest && latest - id < CYCLE_HISTORY_RECORDS;
+    }
+
+    // Id of the newest cycle stored (0 = none yet)
+    uint32_t getLatestId() const {
+        return nextId.load(std::memory_order_acquire) - 1;
+    }
+
+    uint16_t getCount() const {
+        uint32_t latest = getLatestId();
+        return latest < CYCLE_HISTORY_RECORDS ? latest : CYCLE_HISTORY_RECORDS;
+    }
+
+    uint32_t getHeaderRepairs() const {
+        return headerRepairs;
+    }
+};
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef CYCLE_RECORD_H
+#define CYCLE_RECORD_H
+
+#include "Crc32.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// How a drying cycle ended
+enum class CycleEndReason : uint8_t {
+    FINISHED,       // Target time reached
+    DRY,            // Weight trend flattened out before the target time
+    STOPPED,        // Stopped or reset by the user
+    FAILED          // Emergency stop
+};
+
+constexpr uint8_t CYCLE_FLAG_RECOVERED = 0x01;   // Resumed after a power loss: stats cover the resumed part only
+constexpr size_t CYCLE_FAULT_REASON_LENGTH = 16;
+
+/**
+ * One finished drying cycle as stored in the history file (64 bytes,
+ * little-endian). Temperatures and humidity are fixed point in
+ * hundredths (0.01°C / 0.01 %RH), as HistorySample. The CRC covers every
+ * byte before it; an erased (0xFF) or torn slot fails the magic or CRC
+ * check.
+ */
+struct CycleRecord {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t endReason;          // CycleEndReason
+    uint32_t id;                // 1, 2, 3 ... never reused; 0 = none
+    uint8_t preset;             // PresetType
+    uint8_t pidProfile;         // PIDProfile
+    uint8_t faultCount;         // Sensor errors + emergency stop (saturates)
+    uint8_t flags;              // CYCLE_FLAG_*
+    float targetTemp;
+    uint32_t targetTime;        // Seconds, after any timer adjustment
+    uint32_t duration;          // Seconds heated (pauses excluded)
+    float energyWh;             // Heater energy estimate (PWM x HEATER_RATED_POWER_W)
+    int16_t boxTempMin;
+    int16_t boxTempMax;
+    int16_t boxTempMean;
+    int16_t heaterTempMax;
+    uint16_t humidityStart;
+    uint16_t humidityEnd;
+    float waterRemoved;         // Grams (Dryer's humidity estimate)
+    char faultReason[CYCLE_FAULT_REASON_LENGTH];   // Emergency stop reason, truncated
+    uint32_t crc;
+
+    float getBoxTempMin() const { return boxTempMin / 100.0f; }
+    float getBoxTempMax() const { return boxTempMax / 100.0f; }
+    float getBoxTempMean() const { return boxTempMean / 100.0f; }
+    float getHeaterTempMax() const { return heaterTempMax / 100.0f; }
+    float getHumidityStart() const { return humidityStart / 100.0f; }
+    float getHumidityEnd() const { return humidityEnd / 100.0f; }
+};
+
+static_assert(sizeof(CycleRecord) == 64, "CycleRecord layout changed");
+
+constexpr uint16_t CYCLE_RECORD_MAGIC = 0x4843;   // "CH"
+constexpr uint8_t CYCLE_RECORD_VERSION = 1;
+
+inline uint32_t cycleRecordCrc(const CycleRecord& record) {
+    return crc32(&record, offsetof(CycleRecord, crc));
+}
+
+inline const char* cycleEndReasonName(uint8_t reason) {
+    switch (static_cast<CycleEndReason>(reason)) {
+        case CycleEndReason::FINISHED: return "FINISHED";
+        case CycleEndReason::DRY:      return "DRY";
+        case CycleEndReason::STOPPED:  return "STOPPED";
+        case CycleEndReason::FAILED:   return "FAILED";
+    }
+    return "?";
+}
+
+#endif
@@ -0,0 +1,254 @@
+#ifndef FLASH_WEAR_H
+#define FLASH_WEAR_H
+
+#include "../Config.h"
+#include "../diagnostics/Histogram.h"
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef UNIT_TEST
+    #include <Arduino.h>
+#else
+    #include "../../test/mocks/arduino_mock.h"
+#endif
+
+// Files that write to flash, one set of counters each
+enum class FlashFile : uint8_t {
+    SETTINGS,       // SettingsSlots
+    RUNTIME,        // RuntimeJournal (NVS)
+    CYCLES,         // CycleHistoryFile
+    TELEMETRY,      // TelemetryLogFile
+    EMERGENCY,      // Emergency reason (StorageWorker)
+    COUNT
+};
+
+inline const char* flashFileName(FlashFile file) {
+    switch (file) {
+        case FlashFile::SETTINGS: return "settings";
+        case FlashFile::RUNTIME: return "runtime";
+        case FlashFile::CYCLES: return "cycles";
+        case FlashFile::TELEMETRY: return "telemetry";
+        case FlashFile::EMERGENCY: return "emergency";
+        default: return "?";
+    }
+}
+
+/**
+ * FlashWriteStats - Flash traffic per file since the filesystem was mounted
+ *
+ * Bytes written, write sessions (one open ... close that wrote), erase
+ * blocks those sessions touched, and a log2 histogram of how long each
+ * session took (µs, open to close). An NVS write is a session that
+ * touched no block but appended NVS entries. Reached through
+ * flashWriteStats() like perfCounters(), so the file classes record
+ * without a pointer threaded through every constructor.
+ *
+ * Writes come from the storage worker, or from boot before it runs: one
+ * writer. Counters are atomic so the serial side reads whole values; a
+ * histogram read mid-update may be one sample behind, as with PerfCounters.
+ */
+class FlashWriteStats {
+public:
+    using LatencyHistogram = Histogram<FLASH_LATENCY_BUCKETS>;
+
+    struct FileStats {
+        std::atomic<uint32_t> bytes;
+        std::atomic<uint32_t> sessions;
+        std::atomic<uint32_t> blocks;
+        std::atomic<uint32_t> nvsEntries;
+        LatencyHistogram latency;
+
+        FileStats() : bytes(0), sessions(0), blocks(0), nvsEntries(0) {}
+    };
+
+private:
+    FileStats files[static_cast<uint8_t>(FlashFile::COUNT)];
+    std::atomic<uint32_t> nvsWrites;
+    uint32_t startMillis;
+
+    template <typename Field>
+    uint32_t sum(Field field) const {
+        uint32_t total = 0;
+        for (uint8_t i = 0; i < static_cast<uint8_t>(FlashFile::COUNT); i++) {
+            total += (files[i].*field).load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+public:
+    FlashWriteStats() : nvsWrites(0), startMillis(0) {}
+
+    void record(FlashFile file, size_t bytes, uint32_t blocks, uint32_t micros) {
+        FileStats& stats = files[static_cast<uint8_t>(file)];
+        stats.bytes.fetch_add(static_cast<uint32_t>(bytes), std::memory_order_relaxed);
+        stats.sessions.fetch_add(1, std::memory_order_relaxed);
+        stats.blocks.fetch_add(blocks, std::memory_order_relaxed);
+        stats.latency.record(micros);
+    }
+
+    // One NVS write of `bytes` that appended `entries` entries
+    void recordNvs(FlashFile file, size_t bytes, uint32_t entries, uint32_t micros) {
+        FileStats& stats = files[static_cast<uint8_t>(file)];
+        stats.bytes.fetch_add(static_cast<uint32_t>(bytes), std::memory_order_relaxed);
+        stats.sessions.fetch_add(1, std::memory_order_relaxed);
+        stats.nvsEntries.fetch_add(entries, std::memory_order_relaxed);
+        stats.latency.record(micros);
+        nvsWrites.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Start counting from zero (filesystem mounted)
+    void reset(uint32_t currentMillis) {
+        for (uint8_t i = 0; i < static_cast<uint8_t>(FlashFile::COUNT); i++) {
+            files[i].bytes.store(0, std::memory_order_relaxed);
+            files[i].sessions.store(0, std::memory_order_relaxed);
+            files[i].blocks.store(0, std::memory_order_relaxed);
+            files[i].nvsEntries.store(0, std::memory_order_relaxed);
+            files[i].latency.reset();
+        }
+        nvsWrites.store(0, std::memory_order_relaxed);
+        startMillis = currentMillis;
+    }
+
+    const FileStats& get(FlashFile file) const {
+        return files[static_cast<uint8_t>(file)];
+    }
+
+    uint32_t getBytesWritten() const { return sum(&FileStats::bytes); }
+    uint32_t getFilesWritten() const { return sum(&FileStats::sessions); }
+    uint32_t getBlocksTouched() const { return sum(&FileStats::blocks); }
+    uint32_t getNvsEntries() const { return sum(&FileStats::nvsEntries); }
+    uint32_t getStartMillis() const { return startMillis; }
+
+    // NVS pages garbage-collected for the entries appended so far
+    uint32_t getNvsPageErases() const {
+        return getNvsEntries() / NVS_ENTRIES_PER_PAGE;
+    }
+
+    /**
+     * Erases these writes cost: one per block a LittleFS session touched
+     * (LittleFS copies it), a metadata block compaction every
+     * FLASH_COMMITS_PER_METADATA_ERASE LittleFS sessions, and one NVS
+     * page per NVS_ENTRIES_PER_PAGE entries appended
+     */
+    uint32_t getEstimatedErases() const {
+        uint32_t littleFsSessions = getFilesWritten() - nvsWrites.load(std::memory_order_relaxed);
+        return getBlocksTouched() + littleFsSessions / FLASH_COMMITS_PER_METADATA_ERASE +
+               getNvsPageErases();
+    }
+};
+
+inline FlashWriteStats& flashWriteStats() {
+    static FlashWriteStats stats;
+    return stats;
+}
+
+// NVS entries one blob write appends: data header, data, blob index
+inline uint32_t nvsBlobEntries(size_t bytes) {
+    return static_cast<uint32_t>(2 + (bytes + NVS_ENTRY_BYTES - 1) / NVS_ENTRY_BYTES);
+}
+
+/**
+ * FlashWriteSession - Records one open ... close of a file written to
+ *
+ * Declare it before the file is opened; report every write with wrote()
+ * and, for a write before EOF, the file's length with fileEnds(): LittleFS
+ * rewrites every block from the first one written to the end of the file.
+ * On scope exit the bytes, that span of erase blocks and the elapsed time
+ * go to flashWriteStats(). A session that wrote nothing records nothing.
+ */
+class FlashWriteSession {
+private:
+    FlashFile file;
+    uint32_t startMicros;
+    size_t bytes;
+    size_t lowOffset;
+    size_t highOffset;
+    size_t endOffset;
+
+public:
+    explicit FlashWriteSession(FlashFile target)
+        : file(target),
+          startMicros(micros()),
+          bytes(0),
+          lowOffset(SIZE_MAX),
+          highOffset(0),
+          endOffset(0) {
+    }
+
+    // `length` bytes written at file offset `offset`
+    void wrote(size_t offset, size_t length) {
+        if (length == 0) {
+            return;
+        }
+        bytes += length;
+        if (offset < lowOffset) lowOffset = offset;
+        if (offset + length > highOffset) highOffset = offset + length;
+    }
+
+    // The file is `fileBytes` long at close: its tail is rewritten too
+    void fileEnds(size_t fileBytes) {
+        if (fileBytes > endOffset) endOffset = fileBytes;
+    }
+
+    ~FlashWriteSession() {
+        if (bytes == 0) {
+            return;
+        }
+        size_t end = endOffset > highOffset ? endOffset : highOffset;
+        uint32_t blocks = (end - 1) / FLASH_ERASE_BLOCK_BYTES - lowOffset / FLASH_ERASE_BLOCK_BYTES + 1;
+        flashWriteStats().record(file, bytes, blocks, micros() - startMicros);
+    }
+
+    FlashWriteSession(const FlashWriteSession&) = delete;
+    FlashWriteSession& operator=(const FlashWriteSession&) = delete;
+};
+
+/**
+ * What the writes so far mean for the partition's life. LittleFS levels
+ * wear across every block of the partition, so the budget is blocks x
+ * FLASH_ERASE_CYCLES; the rate is this boot's, so the projection holds
+ * for as long as the device keeps doing what it did since boot.
+ */
+struct FlashWearReport {
+    uint32_t bytesWritten;
+    uint32_t filesWritten;          // Write sessions
+    uint32_t estimatedErases;       // LittleFS and NVS
+    uint32_t nvsPageErases;         // Of estimatedErases
+    size_t usedBytes;
+    size_t totalBytes;
+    uint32_t eraseBudget;           // Erases the partition is rated for
+    float erasesPerHour;            // 0 until a minute of data
+    float budgetPercentPerYear;     // Of eraseBudget, at erasesPerHour
+    float yearsAtThisRate;          // Until eraseBudget is spent; 0 = unknown
+};
+
+inline FlashWearReport estimateFlashWear(const FlashWriteStats& stats, size_t usedBytes,
+                                         size_t totalBytes, uint32_t currentMillis) {
+    FlashWearReport report;
+    report.bytesWritten = stats.getBytesWritten();
+    report.filesWritten = stats.getFilesWritten();
+    report.estimatedErases = stats.getEstimatedErases();
+    report.nvsPageErases = stats.getNvsPageErases();
+    report.usedBytes = usedBytes;
+    report.totalBytes = totalBytes;
+    report.eraseBudget = static_cast<uint32_t>(totalBytes / FLASH_ERASE_BLOCK_BYTES) * FLASH_ERASE_CYCLES;
+    report.erasesPerHour = 0;
+    report.budgetPercentPerYear = 0;
+    report.yearsAtThisRate = 0;
+
+    uint32_t elapsed = currentMillis - stats.getStartMillis();
+    if (elapsed < 60000UL || report.eraseBudget == 0) {
+        return report;
+    }
+
+    report.erasesPerHour = report.estimatedErases * 3600000.0f / elapsed;
+    float erasesPerYear = report.erasesPerHour * 24.0f * 365.0f;
+    report.budgetPercentPerYear = erasesPerYear * 100.0f / report.eraseBudget;
+    if (erasesPerYear > 0) {
+        report.yearsAtThisRate = report.eraseBudget / erasesPerYear;
+    }
+    return report;
+}
+
+#endif
@@ -0,0 +1,165 @@
+#ifndef RTC_RECOVERY_MEMORY_H
+#define RTC_RECOVERY_MEMORY_H
+
+#include "Crc32.h"
+#include "../interfaces/IRecoveryMemory.h"
+#include "../Types.h"
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * One recovery snapshot as held in RTC memory (36 bytes). The CRC covers
+ * every byte before it; memory left over from a power-on or another
+ * firmware fails the magic, version or CRC check.
+ */
+struct RtcRecoveryRecord {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t state;              // DryerState
+    uint8_t preset;             // PresetType
+    uint8_t reserved[3];
+    uint32_t sequence;          // Increases by one per store
+    uint32_t elapsed;
+    float targetTemp;
+    uint32_t targetTime;
+    float pidIntegral;
+    float pidSteadyStateOutput;
+    uint32_t crc;
+};
+
+static_assert(sizeof(RtcRecoveryRecord) == 36, "RtcRecoveryRecord layout changed");
+
+/**
+ * The reset-surviving region: two records, written alternately. On the
+ * firmware it is an RTC_NOINIT_ATTR variable (main.cpp); native tests
+ * pass a plain one and "reset" by building a new RtcRecoveryMemory on it.
+ */
+struct RtcRecoveryRegion {
+    RtcRecoveryRecord slots[2];
+};
+
+constexpr uint16_t RTC_RECOVERY_MAGIC = 0x5252;   // "RR"
+constexpr uint8_t RTC_RECOVERY_VERSION = 1;
+
+/**
+ * RtcRecoveryMemory - Recovery snapshot in memory that survives a reset
+ *
+ * RTC slow memory keeps its contents through watchdog, brown-out, panic
+ * and software resets, but not a power cut. Dryer stores a snapshot here
+ * every tick, so after such a reset recovery resumes from the last tick
+ * instead of the last flash journal record (up to STATE_SAVE_INTERVAL
+ * old), and with the PID's integrator and learned output intact.
+ *
+ * store() writes the slot that is not the newest, so a reset in the
+ * middle of a store damages only that slot; the previous tick's record
+ * is still intact. Storing a snapshot equal to the newest one writes
+ * nothing.
+ *
+ * Responsibilities:
+ * - Record encoding, CRC, slot and sequence bookkeeping
+ *
+ * Does NOT:
+ * - Own the memory (the region is injected) or know about flash
+ * - Decide which states are recoverable (Dryer does this)
+ */
+class RtcRecoveryMemory final : public IRecoveryMemory {
+private:
+    RtcRecoveryRegion& region;
+    int8_t newestSlot;          // -1: no valid record
+    uint32_t sequence;          // Of the newest record
+
+    static uint32_t recordCrc(const RtcRecoveryRecord& record) {
+        return crc32(&record, offsetof(RtcRecoveryRecord, crc));
+    }
+
+    static bool isValid(const RtcRecoveryRecord& record) {
+        return record.magic == RTC_RECOVERY_MAGIC &&
+               record.version == RTC_RECOVERY_VERSION &&
+               record.crc == recordCrc(record) &&
+               record.state <= static_cast<uint8_t>(DryerState::POWER_RECOVERED) &&
+               record.preset <= static_cast<uint8_t>(PresetType::CUSTOM);
+    }
+
+    static void encode(const RecoverySnapshot& snapshot, RtcRecoveryRecord& record) {
+        memset(&record, 0, sizeof(record));
+        record.magic = RTC_RECOVERY_MAGIC;
+        record.version = RTC_RECOVERY_VERSION;
+        record.state = static_cast<uint8_t>(snapshot.state);
+        record.preset = static_cast<uint8_t>(snapshot.preset);
+        record.elapsed = snapshot.elapsed;
+        record.targetTemp = snapshot.targetTemp;
+        record.targetTime = snapshot.targetTime;
+        record.pidIntegral = snapshot.pid.integral;
+        record.pidSteadyStateOutput = snapshot.pid.steadyStateOutput;
+    }
+
+    void scan() {
+        newestSlot = -1;
+        sequence = 0;
+        for (uint8_t slot = 0; slot < 2; slot++) {
+            const RtcRecoveryRecord& record = region.slots[slot];
+            if (isValid(record) && (newestSlot < 0 || record.sequence > sequence)) {
+                newestSlot = slot;
+                sequence = record.sequence;
+            }
+        }
+    }
+
+public:
+    explicit RtcRecoveryMemory(RtcRecoveryRegion& rtcRegion)
+        : region(rtcRegion),
+          newestSlot(-1),
+          sequence(0) {
+        scan();
+    }
+
+    bool load(RecoverySnapshot& out) override {
+        if (newestSlot < 0) {
+            return false;
+        }
+        const RtcRecoveryRecord& record = region.slots[newestSlot];
+        out.state = static_cast<DryerState>(record.state);
+        out.preset = static_cast<PresetType>(record.preset);
+        out.elapsed = record.elapsed;
+        out.targetTemp = record.targetTemp;
+        out.targetTime = record.targetTime;
+        out.pid.integral = record.pidIntegral;
+        out.pid.steadyStateOutput = record.pidSteadyStateOutput;
+        return true;
+    }
+
+    void store(const RecoverySnapshot& snapshot) override {
+        RtcRecoveryRecord record;
+        encode(snapshot, record);
+
+        if (newestSlot >= 0) {
+            // Unchanged (idle, paused within the same second): nothing to write
+            record.sequence = sequence;
+            record.crc = recordCrc(record);
+            if (memcmp(&record, &region.slots[newestSlot], sizeof(record)) == 0) {
+                return;
+            }
+        }
+
+        uint8_t target = newestSlot == 0 ? 1 : 0;
+        record.sequence = sequence + 1;
+        record.crc = recordCrc(record);
+        region.slots[target] = record;
+
+        newestSlot = target;
+        sequence = record.sequence;
+    }
+
+    // Forget everything (power-on reset: the region holds noise)
+    void invalidate() {
+        memset(&region, 0, sizeof(region));
+        newestSlot = -1;
+        sequence = 0;
+    }
+
+    uint32_t getSequence() const {
+        return sequence;
+    }
+};
+
+#endif
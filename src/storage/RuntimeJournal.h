@@ -0,0 +1,187 @@
+#ifndef RUNTIME_JOURNAL_H
+#define RUNTIME_JOURNAL_H
+
+#include "Crc32.h"
+#include "FlashWear.h"
+#include "../Types.h"
+#include "../Config.h"
+#include "../diagnostics/Log.h"
+#include <stddef.h>
+#include <string.h>
+
+#ifndef UNIT_TEST
+    #include <Preferences.h>
+#else
+    #include "../../test/mocks/arduino_mock.h"
+#endif
+
+/**
+ * One runtime snapshot as stored in NVS (32 bytes, little-endian).
+ * The CRC covers every byte before it; a blob that is foreign, from an
+ * older layout or damaged fails the magic or CRC check and is ignored.
+ */
+struct RuntimeRecord {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t flags;          // RUNTIME_RECORD_CLEARED = tombstone, no cycle to recover
+    uint32_t sequence;      // Increases by one per record, never reused
+    uint8_t state;          // DryerState
+    uint8_t preset;         // PresetType
+    uint16_t reserved;
+    uint32_t elapsed;
+    float targetTemp;
+    uint32_t targetTime;
+    uint32_t timestamp;
+    uint32_t crc;
+};
+
+static_assert(sizeof(RuntimeRecord) == 32, "RuntimeRecord layout changed");
+
+constexpr uint16_t RUNTIME_RECORD_MAGIC = 0x4A52;   // "RJ"
+constexpr uint8_t RUNTIME_RECORD_VERSION = 1;
+constexpr uint8_t RUNTIME_RECORD_CLEARED = 0x01;
+
+/**
+ * RuntimeJournal - Power-recovery snapshot kept in NVS
+ *
+ * Each save writes one CRC-protected record as an NVS blob. NVS is a
+ * journal itself: the write appends three 32-byte entries to its active
+ * page and marks the previous value's entries erased, so a save costs
+ * about 1/42 of a page erase. A LittleFS file write, even 32 bytes in
+ * place, copies its whole 4 KB block - one erase per save.
+ *
+ * NVS replaces a value atomically, so power loss leaves either the old
+ * record or the new one. Clearing writes a tombstone record rather than
+ * removing the key, so the sequence keeps rising across cycles.
+ *
+ * Responsibilities:
+ * - Record encoding, CRC and sequence bookkeeping
+ * - Ignoring a stored value that is not a valid record
+ *
+ * Does NOT:
+ * - Decide which states are recoverable (Dryer does)
+ * - Cache the snapshot for callers (SettingsStorage does)
+ * - Remove the LittleFS files of older formats (SettingsStorage does)
+ */
+class RuntimeJournal {
+private:
+    const char* nvsNamespace;
+    Preferences preferences;
+    bool opened;
+    uint32_t nextSequence;
+
+    static uint32_t recordCrc(const RuntimeRecord& record) {
+        return crc32(&record, offsetof(RuntimeRecord, crc));
+    }
+
+    static bool isValid(const RuntimeRecord& record) {
+        return record.magic == RUNTIME_RECORD_MAGIC &&
+               record.version == RUNTIME_RECORD_VERSION &&
+               record.crc == recordCrc(record) &&
+               record.state <= static_cast<uint8_t>(DryerState::POWER_RECOVERED) &&
+               record.preset <= static_cast<uint8_t>(PresetType::CUSTOM);
+    }
+
+    bool open() {
+        if (!opened) {
+            opened = preferences.begin(nvsNamespace, false);
+        }
+        return opened;
+    }
+
+    bool write(RuntimeRecord& record) {
+        if (!open()) {
+            return false;
+        }
+
+        record.magic = RUNTIME_RECORD_MAGIC;
+        record.version = RUNTIME_RECORD_VERSION;
+        record.sequence = nextSequence;
+        record.reserved = 0;
+        record.crc = recordCrc(record);
+
+        uint32_t startMicros = micros();
+        size_t written = preferences.putBytes(RUNTIME_NVS_KEY, &record, sizeof(record));
+        if (written != sizeof(record)) {
+            return false;
+        }
+        flashWriteStats().recordNvs(FlashFile::RUNTIME, written, nvsBlobEntries(written),
+                                    micros() - startMicros);
+        nextSequence++;
+        return true;
+    }
+
+public:
+    explicit RuntimeJournal(const char* nvsNamespaceName = RUNTIME_NVS_NAMESPACE)
+        : nvsNamespace(nvsNamespaceName),
+          opened(false),
+          nextSequence(1) {
+    }
+
+    ~RuntimeJournal() {
+        if (opened) {
+            preferences.end();
+        }
+    }
+
+    RuntimeJournal(const RuntimeJournal&) = delete;
+    RuntimeJournal& operator=(const RuntimeJournal&) = delete;
+
+    /**
+     * Read the stored record (one NVS read)
+     * @return true if `latest` holds a live (non-tombstone) snapshot
+     */
+    bool recover(RuntimeRecord& latest) {
+        nextSequence = 1;
+
+        if (!open()) {
+            LOG_ERROR(STORAGE, "  ✗ Cannot open NVS for the runtime journal");
+            return false;
+        }
+
+        size_t length = preferences.getBytesLength(RUNTIME_NVS_KEY);
+        if (length == 0) {
+            return false;
+        }
+
+        RuntimeRecord record;
+        if (length != sizeof(record) ||
+            preferences.getBytes(RUNTIME_NVS_KEY, &record, sizeof(record)) != sizeof(record) ||
+            !isValid(record)) {
+            LOG_WARN(STORAGE, "  Runtime record in NVS is damaged - ignored");
+            return false;
+        }
+
+        latest = record;
+        nextSequence = record.sequence + 1;
+        return !(record.flags & RUNTIME_RECORD_CLEARED);
+    }
+
+    bool save(DryerState state, uint32_t elapsed, float targetTemp,
+              uint32_t targetTime, PresetType preset, uint32_t timestamp) {
+        RuntimeRecord record;
+        record.flags = 0;
+        record.state = static_cast<uint8_t>(state);
+        record.preset = static_cast<uint8_t>(preset);
+        record.elapsed = elapsed;
+        record.targetTemp = targetTemp;
+        record.targetTime = targetTime;
+        record.timestamp = timestamp;
+        return write(record);
+    }
+
+    // Tombstone: recovery finds no cycle until the next save
+    bool clear(uint32_t timestamp) {
+        RuntimeRecord record;
+        memset(&record, 0, sizeof(record));
+        record.flags = RUNTIME_RECORD_CLEARED;
+        record.timestamp = timestamp;
+        return write(record);
+    }
+
+    uint32_t getSequence() const {
+        return nextSequence - 1;
+    }
+};
+
+#endif
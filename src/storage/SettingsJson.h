@@ -0,0 +1,109 @@
+#ifndef SETTINGS_JSON_H
+#define SETTINGS_JSON_H
+
+#include "SettingsRecord.h"
+#include "../Types.h"
+
+#ifndef UNIT_TEST
+    #include <ArduinoJson.h>
+#else
+    #include "../../test/mocks/arduino_mock.h"
+#endif
+
+/**
+ * SettingsJson - Human-readable form of a SettingsRecord
+ *
+ * Debug path only: the `settings` / `settings import` serial commands,
+ * and a one-time import of the /settings.json written by older firmware
+ * (the layout here is that file's, "version": 1). Boot and the control
+ * path read the binary record and never touch ArduinoJson.
+ */
+
+constexpr uint8_t SETTINGS_JSON_VERSION = 1;
+
+inline const char* settingsPresetName(uint8_t preset) {
+    switch (static_cast<PresetType>(preset)) {
+        case PresetType::PETG: return "PETG";
+        case PresetType::CUSTOM: return "CUSTOM";
+        default: return "PLA";
+    }
+}
+
+inline const char* settingsProfileName(uint8_t profile) {
+    switch (static_cast<PIDProfile>(profile)) {
+        case PIDProfile::SOFT: return "SOFT";
+        case PIDProfile::STRONG: return "STRONG";
+        default: return "NORMAL";
+    }
+}
+
+inline String settingsToJson(const SettingsRecord& record) {
+    JsonDocument doc;
+
+    doc["version"] = SETTINGS_JSON_VERSION;
+
+    JsonObject preset = doc["customPreset"].to<JsonObject>();
+    preset["temp"] = record.customTemp;
+    preset["time"] = record.customTime;
+    preset["overshoot"] = record.customOvershoot;
+
+    doc["selectedPreset"] = settingsPresetName(record.selectedPreset);
+    doc["pidProfile"] = settingsProfileName(record.pidProfile);
+    doc["soundEnabled"] = record.soundEnabled != 0;
+
+    JsonObject scale = doc["scale"].to<JsonObject>();
+    scale["offset"] = record.scaleTareOffset;
+    scale["countsPerGram"] = record.scaleCountsPerGram;
+
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
+
+/**
+ * Overwrite `record` with the fields present in `input` (a String or a
+ * File); absent fields keep their value, so a partial document edits
+ * just those settings.
+ * @return false if the input is not valid JSON or has an unknown version
+ */
+template <typename TInput>
+inline bool settingsFromJson(TInput& input, SettingsRecord& record) {
+    JsonDocument doc;
+    if (deserializeJson(doc, input)) {
+        return false;
+    }
+
+    uint8_t version = doc["version"] | SETTINGS_JSON_VERSION;
+    if (version == 0 || version > SETTINGS_JSON_VERSION) {
+        return false;
+    }
+
+    if (doc["customPreset"].is<JsonObject>()) {
+        JsonObject preset = doc["customPreset"];
+        record.customTemp = preset["temp"] | record.customTemp;
+        record.customTime = preset["time"] | record.customTime;
+        record.customOvershoot = preset["overshoot"] | record.customOvershoot;
+    }
+
+    String presetStr = doc["selectedPreset"] | settingsPresetName(record.selectedPreset);
+    if (presetStr == "PLA") record.selectedPreset = static_cast<uint8_t>(PresetType::PLA);
+    else if (presetStr == "PETG") record.selectedPreset = static_cast<uint8_t>(PresetType::PETG);
+    else if (presetStr == "CUSTOM") record.selectedPreset = static_cast<uint8_t>(PresetType::CUSTOM);
+
+    String pidStr = doc["pidProfile"] | settingsProfileName(record.pidProfile);
+    if (pidStr == "SOFT") record.pidProfile = static_cast<uint8_t>(PIDProfile::SOFT);
+    else if (pidStr == "NORMAL") record.pidProfile = static_cast<uint8_t>(PIDProfile::NORMAL);
+    else if (pidStr == "STRONG") record.pidProfile = static_cast<uint8_t>(PIDProfile::STRONG);
+
+    record.soundEnabled = (doc["soundEnabled"] | (record.soundEnabled != 0)) ? 1 : 0;
+
+    if (doc["scale"].is<JsonObject>()) {
+        JsonObject scale = doc["scale"];
+        record.scaleTareOffset = scale["offset"] | record.scaleTareOffset;
+        record.scaleCountsPerGram = scale["countsPerGram"] | record.scaleCountsPerGram;
+    }
+
+    return true;
+}
+
+#endif
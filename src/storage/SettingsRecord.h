@@ -0,0 +1,143 @@
+#ifndef SETTINGS_RECORD_H
+#define SETTINGS_RECORD_H
+
+#include "Crc32.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * User settings as stored on flash (36 bytes, little-endian).
+ * Enums are stored as their numeric value; the CRC covers every byte
+ * before it. `length` is the size of the record as written, so an older
+ * layout can be read before it is migrated.
+ *
+ * Version history:
+ * 1 - single record per file
+ * 2 - adds `sequence` for the A/B slots
+ */
+struct SettingsRecord {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t length;             // Bytes including this header and the CRC
+    uint32_t sequence;          // A/B slot generation: the higher valid one wins
+    float customTemp;
+    uint32_t customTime;
+    float customOvershoot;
+    uint8_t selectedPreset;     // PresetType
+    uint8_t pidProfile;         // PIDProfile
+    uint8_t soundEnabled;
+    uint8_t reserved;
+    int32_t scaleTareOffset;
+    float scaleCountsPerGram;
+    uint32_t crc;
+};
+
+static_assert(sizeof(SettingsRecord) == 36, "SettingsRecord layout changed");
+
+constexpr uint16_t SETTINGS_RECORD_MAGIC = 0x5344;   // "DS"
+constexpr uint8_t SETTINGS_RECORD_VERSION = 2;
+constexpr size_t SETTINGS_RECORD_MAX_BYTES = 64;     // Largest layout any version used
+constexpr size_t SETTINGS_RECORD_MIN_BYTES = 4 + sizeof(uint32_t);   // Header + CRC
+
+/**
+ * Upgrade a record of version N to N+1 in place. The buffer holds the
+ * whole record (SETTINGS_RECORD_MAX_BYTES); the step moves fields as the
+ * new layout needs and returns the new length, or 0 if it cannot.
+ * The chain rewrites version, length and CRC after each step.
+ */
+using SettingsMigrationStep = size_t (*)(uint8_t* record, size_t length);
+
+// v1 -> v2: insert the slot sequence after the header (0 = oldest)
+inline size_t migrateSettingsV1(uint8_t* record, size_t length) {
+    if (length + sizeof(uint32_t) > SETTINGS_RECORD_MAX_BYTES) {
+        return 0;
+    }
+    memmove(record + 8, record + 4, length - 4);
+    memset(record + 4, 0, sizeof(uint32_t));
+    return length + sizeof(uint32_t);
+}
+
+// SETTINGS_MIGRATIONS[N] upgrades version N to N+1. Index 0 is unused;
+// add a step here whenever SETTINGS_RECORD_VERSION goes up.
+constexpr SettingsMigrationStep SETTINGS_MIGRATIONS[SETTINGS_RECORD_VERSION] = {
+    nullptr,
+    migrateSettingsV1
+};
+
+enum class SettingsDecodeResult {
+    OK,
+    MIGRATED,      // Valid, but written by an older version - save it again
+    CORRUPT,       // Bad magic, length or CRC
+    UNSUPPORTED    // Newer than this firmware, or no migration step
+};
+
+inline uint32_t settingsRecordCrc(const uint8_t* record, size_t length) {
+    return crc32(record, length - sizeof(uint32_t));
+}
+
+inline void sealSettingsRecord(uint8_t* record, size_t length) {
+    uint32_t crc = settingsRecordCrc(record, length);
+    memcpy(record + length - sizeof(crc), &crc, sizeof(crc));
+}
+
+inline void sealSettingsRecord(SettingsRecord& record) {
+    record.magic = SETTINGS_RECORD_MAGIC;
+    record.version = SETTINGS_RECORD_VERSION;
+    record.length = sizeof(SettingsRecord);
+    record.reserved = 0;
+    sealSettingsRecord(reinterpret_cast<uint8_t*>(&record), sizeof(record));
+}
+
+/**
+ * Check and, if needed, migrate a raw record read from flash.
+ * `buffer` must hold SETTINGS_RECORD_MAX_BYTES; it is modified by
+ * migration. The table and target version are parameters so tests can
+ * run the chain against their own steps.
+ */
+inline SettingsDecodeResult decodeSettingsRecord(uint8_t* buffer, size_t length, SettingsRecord& out,
+                                                 const SettingsMigrationStep* migrations = SETTINGS_MIGRATIONS,
+                                                 uint8_t currentVersion = SETTINGS_RECORD_VERSION) {
+    if (length < SETTINGS_RECORD_MIN_BYTES || length > SETTINGS_RECORD_MAX_BYTES) {
+        return SettingsDecodeResult::CORRUPT;
+    }
+
+    uint16_t magic;
+    memcpy(&magic, buffer, sizeof(magic));
+    uint8_t version = buffer[2];
+    if (magic != SETTINGS_RECORD_MAGIC || buffer[3] != length) {
+        return SettingsDecodeResult::CORRUPT;
+    }
+
+    uint32_t storedCrc;
+    memcpy(&storedCrc, buffer + length - sizeof(storedCrc), sizeof(storedCrc));
+    if (storedCrc != settingsRecordCrc(buffer, length)) {
+        return SettingsDecodeResult::CORRUPT;
+    }
+
+    if (version == 0 || version > currentVersion) {
+        return SettingsDecodeResult::UNSUPPORTED;
+    }
+
+    bool migrated = false;
+    while (version < currentVersion) {
+        SettingsMigrationStep step = migrations[version];
+        size_t newLength = step ? step(buffer, length) : 0;
+        if (newLength < SETTINGS_RECORD_MIN_BYTES || newLength > SETTINGS_RECORD_MAX_BYTES) {
+            return SettingsDecodeResult::UNSUPPORTED;
+        }
+        length = newLength;
+        buffer[2] = ++version;
+        buffer[3] = static_cast<uint8_t>(length);
+        sealSettingsRecord(buffer, length);
+        migrated = true;
+    }
+
+    if (length != sizeof(SettingsRecord)) {
+        return SettingsDecodeResult::UNSUPPORTED;
+    }
+    memcpy(&out, buffer, sizeof(out));
+    return migrated ? SettingsDecodeResult::MIGRATED : SettingsDecodeResult::OK;
+}
+
+#endif
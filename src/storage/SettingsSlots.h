@@ -0,0 +1,178 @@
+#ifndef SETTINGS_SLOTS_H
+#define SETTINGS_SLOTS_H
+
+#include "SettingsRecord.h"
+#include "FlashWear.h"
+#include "../Config.h"
+#include "../diagnostics/Log.h"
+
+#ifndef UNIT_TEST
+    #include <LittleFS.h>
+#else
+    #include "../../test/mocks/arduino_mock.h"
+#endif
+
+constexpr size_t SETTINGS_SLOT_BYTES = SETTINGS_RECORD_MAX_BYTES;
+constexpr size_t SETTINGS_FILE_BYTES = 2 * SETTINGS_SLOT_BYTES;
+
+/**
+ * SettingsSlots - A/B double-buffered settings file
+ *
+ * The settings file holds two fixed-size slots. save() writes the new
+ * record, with the next sequence number, into the slot that is NOT
+ * active, in place ("r+" + seek), and only then makes it the active
+ * one. A power cut mid-write damages the slot being written; the other
+ * still holds the previous settings, and its CRC proves it intact.
+ *
+ * load() reads the whole file once and takes the valid slot with the
+ * higher sequence. A file from before the slots (one version-1 record)
+ * is slot A on its own; it migrates like any old record.
+ *
+ * Responsibilities:
+ * - Slot selection, sequence numbers, in-place slot writes
+ *
+ * Does NOT:
+ * - Map records to settings values (SettingsStorage does)
+ * - Ever truncate or format - there is always one intact slot
+ */
+class SettingsSlots {
+private:
+    const char* path;
+    uint8_t activeSlot;
+    uint32_t activeSequence;
+
+    bool writeSlot(uint8_t slot, const SettingsRecord& record) {
+        FlashWriteSession session(FlashFile::SETTINGS);
+        if (!LittleFS.exists(path)) {
+            File created = LittleFS.open(path, "w");   // Empty file; never truncates one with data
+            if (!created) {
+                return false;
+            }
+            created.close();
+        }
+
+        File file = LittleFS.open(path, "r+");
+        if (!file) {
+            return false;
+        }
+
+        // Slot image: the record, then erased padding. A shorter (older)
+        // file is padded up to the slot first.
+        uint8_t image[SETTINGS_SLOT_BYTES];
+        memset(image, 0xFF, sizeof(image));
+        memcpy(image, &record, sizeof(record));
+
+        size_t offset = slot * SETTINGS_SLOT_BYTES;
+        size_t position = file.size() < offset ? file.size() : offset;
+        bool ok = file.seek(position);
+        if (ok && position < offset) {
+            uint8_t pad[SETTINGS_SLOT_BYTES];
+            memset(pad, 0xFF, sizeof(pad));
+            ok = file.write(pad, offset - position) == offset - position;
+            session.wrote(position, offset - position);
+        }
+        ok = ok && file.write(image, sizeof(image)) == sizeof(image);
+        session.wrote(offset, sizeof(image));
+        session.fileEnds(file.size());
+        file.close();
+        return ok;
+    }
+
+public:
+    explicit SettingsSlots(const char* settingsPath = SETTINGS_FILE)
+        : path(settingsPath),
+          activeSlot(1),          // First save lands in slot A
+          activeSequence(0) {
+    }
+
+    /**
+     * Read both slots (one file read) and return the newest valid record.
+     * @return OK/MIGRATED with `out` filled; CORRUPT if no slot is valid
+     *         (or there is no file); UNSUPPORTED if the only intact slots
+     *         are newer than this firmware
+     */
+    SettingsDecodeResult load(SettingsRecord& out) {
+        activeSlot = 1;
+        activeSequence = 0;
+
+        uint8_t buffer[SETTINGS_FILE_BYTES];
+        size_t length = 0;
+        File file = LittleFS.open(path, "r");
+        if (file) {
+            length = file.readBytes(reinterpret_cast<char*>(buffer), sizeof(buffer));
+            file.close();
+        }
+
+        SettingsDecodeResult best = SettingsDecodeResult::CORRUPT;
+        uint8_t damaged = 0;
+
+        for (uint8_t slot = 0; slot < 2; slot++) {
+            size_t start = slot * SETTINGS_SLOT_BYTES;
+            if (length <= start) {
+                break;
+            }
+            uint8_t* record = buffer + start;
+            if (record[0] == 0xFF && record[1] == 0xFF) {
+                continue;   // Erased: never written
+            }
+            size_t available = length - start;
+            size_t recordLength = available >= 4 ? record[3] : 0;
+            if (recordLength > available || recordLength > SETTINGS_SLOT_BYTES) {
+                damaged++;
+                continue;
+            }
+
+            SettingsRecord candidate;
+            SettingsDecodeResult result = decodeSettingsRecord(record, recordLength, candidate);
+            bool valid = (result == SettingsDecodeResult::OK || result == SettingsDecodeResult::MIGRATED);
+            if (!valid) {
+                if (result == SettingsDecodeResult::UNSUPPORTED && best == SettingsDecodeResult::CORRUPT) {
+                    best = result;
+                } else if (result == SettingsDecodeResult::CORRUPT) {
+                    damaged++;
+                }
+                continue;
+            }
+
+            bool haveValid = (best == SettingsDecodeResult::OK || best == SettingsDecodeResult::MIGRATED);
+            if (!haveValid || candidate.sequence > out.sequence) {
+                out = candidate;
+                best = result;
+                activeSlot = slot;
+                activeSequence = candidate.sequence;
+            }
+        }
+
+        if (damaged > 0 && (best == SettingsDecodeResult::OK || best == SettingsDecodeResult::MIGRATED)) {
+            LOG_WARN(STORAGE, "  Settings slot damaged - using slot %c", 'A' + activeSlot);
+        }
+        return best;
+    }
+
+    /**
+     * Write `record` into the inactive slot and make it active.
+     * On failure the active slot, and so the stored settings, are unchanged.
+     */
+    bool save(SettingsRecord& record) {
+        record.sequence = activeSequence + 1;
+        sealSettingsRecord(record);
+
+        uint8_t target = activeSlot ^ 1;
+        if (!writeSlot(target, record)) {
+            return false;
+        }
+        activeSlot = target;
+        activeSequence = record.sequence;
+        return true;
+    }
+
+    uint8_t getActiveSlot() const {
+        return activeSlot;
+    }
+
+    uint32_t getSequence() const {
+        return activeSequence;
+    }
+};
+
+#endif
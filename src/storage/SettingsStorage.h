@@ -3,37 +3,87 @@
 #define SETTINGS_STORAGE_H
 
 #include "../interfaces/ISettingsStorage.h"
+#include "RuntimeJournal.h"
+#include "SettingsSlots.h"
+#include "SettingsJson.h"
+#include "StorageWorker.h"
+#include "CycleHistoryFile.h"
+#include "FlashWear.h"
 #include "../Config.h"
+#include "../diagnostics/PerfCounters.h"
+#include "../diagnostics/Log.h"
 
 #ifndef UNIT_TEST
     #include <LittleFS.h>
-    #include <ArduinoJson.h>
 #else
     #include "../../test/mocks/arduino_mock.h"
-    // MockFileSystem.h and MockArduinoJson.h are included via arduino_mock.h
+    // MockFileSystem.h is included via arduino_mock.h
 #endif
 
 /**
  * SettingsStorage - LittleFS-based persistent storage
  *
  * Features:
- * - Versioned settings for future migration
- * - Separate files for settings and runtime state
- * - Corruption detection and recovery
+ * - Settings as one packed binary record (SettingsRecord) with CRC32;
+ *   older record versions are upgraded through SETTINGS_MIGRATIONS
+ * - Settings and runtime state stored apart
+ * - Runtime state as one 32-byte record in NVS (RuntimeJournal): a save
+ *   appends NVS entries instead of rewriting a LittleFS block
+ * - A/B settings slots (SettingsSlots): a save overwrites only the older
+ *   slot, so a power cut mid-write never loses the settings and
+ *   recovery never formats the filesystem
+ * - Single-pass boot: each file is parsed once; the load result doubles
+ *   as the corruption check
  * - Graceful degradation on write failures
- * - Immediate saves on setting changes
+ * - Coalesced setting writes: save*() marks the setting dirty; update()
+ *   writes one slot once changes have been quiet for
+ *   SETTINGS_WRITE_DEBOUNCE_MS, flush() (state transitions, emergency,
+ *   shutdown) writes at once. Saving an unchanged value writes nothing
+ * - Write-behind (StorageWorker): after boot, every write is an immutable
+ *   snapshot queued to the worker, so no caller waits on flash; sync()
+ *   waits for the queue to empty
+ * - Cycle history (CycleHistoryFile): the last CYCLE_HISTORY_RECORDS
+ *   finished cycles in a fixed-slot ring, appended by the worker
+ * - Telemetry log (TelemetryLogFile): per-tick control samples in
+ *   TELEMETRY_LOG_PAGES whole pages, in segment files that are only
+ *   appended to; scanned and appended by the worker
+ * - Flash wear accounting (FlashWear.h): bytes, write sessions, blocks
+ *   touched and write latency per file since mount; getWearReport()
+ *   turns them into an erase rate against the partition's erase budget
  *
  * File Structure:
- * - /settings.json: User preferences (preset, PID, sound, custom preset)
- * - /runtime.json: Current cycle state for power recovery
+ * - /settings.bin: Two settings slots - user preferences (preset, PID,
+ *   sound, custom preset, scale)
+ * - /settings.json: Written by older firmware; imported once, then removed
+ * - /runtime.json, /runtime.bin: Runtime state of older firmware; removed
+ * - /cycles.bin: Cycle history ring - index header + one slot per cycle
+ * - /telemetry.bin: Telemetry ring - self-contained 256-byte pages
+ * - NVS "dryer"/"runtime": Runtime journal - current cycle state for power
+ *   recovery (RuntimeJournal)
+ *
+ * JSON (SettingsJson.h) is only the serial debug view: exportJson() and
+ * importJson().
  */
-class SettingsStorage : public ISettingsStorage {
+class SettingsStorage final : public ISettingsStorage {
 private:
-    // Versioning for future migrations
-    static constexpr uint8_t SETTINGS_VERSION = 1;
-    static constexpr uint8_t RUNTIME_VERSION = 1;
+    // Outcome of parsing one file (begin() decides recovery from this)
+    enum class LoadResult {
+        OK,
+        MISSING,   // No file (first boot, or cleared)
+        CORRUPT,   // Unopenable, bad length or CRC
+        REJECTED   // Intact record with an unknown version
+    };
+
+    // Dirty mask bits: which settings changed since the last slot write
+    static constexpr uint8_t DIRTY_CUSTOM_PRESET = 0x01;
+    static constexpr uint8_t DIRTY_SELECTED_PRESET = 0x02;
+    static constexpr uint8_t DIRTY_PID_PROFILE = 0x04;
+    static constexpr uint8_t DIRTY_SOUND = 0x08;
+    static constexpr uint8_t DIRTY_SCALE = 0x10;
+    static constexpr uint8_t DIRTY_ALL = 0x1F;
 
     // Storage state
+    SettingsSlots settingsSlots;
     bool initialized;
     bool storageHealthy;  // False if critical errors detected
     String lastError;
@@ -43,8 +93,16 @@ private:
     PresetType selectedPreset;
     PIDProfile selectedPIDProfile;
     bool soundEnabled;
+    ScaleCalibration scaleCalibration;
+
+    // Write coalescing
+    uint8_t dirtyMask;
+    bool changeStamped;         // update() has seen the latest change
+    uint32_t lastChangeTime;    // When update() first saw it
+    uint32_t coalescedChanges;  // Changes folded into an already pending write
 
     // Cached runtime state
+    RuntimeJournal runtimeJournal;
     bool hasValidRuntime;
     DryerState runtimeState;
     uint32_t runtimeElapsed;
@@ -53,338 +111,205 @@ private:
     PresetType runtimePreset;
     uint32_t runtimeTimestamp;
 
+    // Must-not-lose writes the queue was too full for; update() resubmits
+    // them, since their callers run inside a state transition
+    bool cyclePending;
+    CycleRecord pendingCycle;
+    bool clearPending;
+    uint32_t pendingClearTime;
+
+    // Finished cycles (read directly by serial/UI, appended by the worker)
+    CycleHistoryFile cycleHistory;
+
+    // Control telemetry (read directly by serial, appended by the worker)
+    TelemetryLogFile telemetryLog;
+
+    // Writes after boot go through here (declared after the files it writes)
+    StorageWorker worker;
+
     /**
      * Initialize LittleFS filesystem
      * Formats if mount fails
      */
     bool initializeFilesystem() {
-#ifndef UNIT_TEST
-        Serial.println("Initializing LittleFS...");
-#endif
+        LOG_INFO(STORAGE, "Initializing LittleFS...");
 
         if (!LittleFS.begin(true)) {  // true = format on fail
             lastError = "LittleFS mount failed";
-#ifndef UNIT_TEST
-            Serial.println("  ✗ LittleFS mount failed");
-#endif
+            LOG_ERROR(STORAGE, "  ✗ LittleFS mount failed");
             return false;
         }
 
-#ifndef UNIT_TEST
-        Serial.println("  ✓ LittleFS mounted successfully");
+        LOG_INFO(STORAGE, "  ✓ LittleFS mounted successfully");
+        flashWriteStats().reset(millis());
 
         // Check filesystem health
-        size_t totalBytes = LittleFS.totalBytes();
-        size_t usedBytes = LittleFS.usedBytes();
-
-        Serial.print("  Storage: ");
-        Serial.print(usedBytes);
-        Serial.print(" / ");
-        Serial.print(totalBytes);
-        Serial.println(" bytes used");
-#endif
+        LOG_INFO(STORAGE, "  Storage: %u / %u bytes used",
+                 (unsigned)LittleFS.usedBytes(), (unsigned)LittleFS.totalBytes());
 
         return true;
     }
 
-    /**
-     * Verify a JSON file is readable
-     * Returns true if file exists and can be parsed
-     */
-    bool verifyJsonFile(const char* path) {
-        if (!LittleFS.exists(path)) {
-            return false;
-        }
+    SettingsRecord toRecord() const {
+        SettingsRecord record;
+        memset(&record, 0, sizeof(record));
+        record.customTemp = customPreset.targetTemp;
+        record.customTime = customPreset.targetTime;
+        record.customOvershoot = customPreset.maxOvershoot;
+        record.selectedPreset = static_cast<uint8_t>(selectedPreset);
+        record.pidProfile = static_cast<uint8_t>(selectedPIDProfile);
+        record.soundEnabled = soundEnabled ? 1 : 0;
+        record.scaleTareOffset = scaleCalibration.tareOffset;
+        record.scaleCountsPerGram = scaleCalibration.countsPerGram;
+        return record;
+    }
 
-        File file = LittleFS.open(path, "r");
-        if (!file) {
-            return false;
-        }
+    void fromRecord(const SettingsRecord& record) {
+        customPreset.targetTemp = record.customTemp;
+        customPreset.targetTime = record.customTime;
+        customPreset.maxOvershoot = record.customOvershoot;
 
-        JsonDocument doc;
-        DeserializationError error = deserializeJson(doc, file);
-        file.close();
+        selectedPreset = record.selectedPreset <= static_cast<uint8_t>(PresetType::CUSTOM)
+                       ? static_cast<PresetType>(record.selectedPreset) : PresetType::PLA;
+        selectedPIDProfile = record.pidProfile <= static_cast<uint8_t>(PIDProfile::STRONG)
+                           ? static_cast<PIDProfile>(record.pidProfile) : PIDProfile::NORMAL;
+        soundEnabled = record.soundEnabled != 0;
 
-        return (error == DeserializationError::Ok);
+        scaleCalibration.tareOffset = record.scaleTareOffset;
+        scaleCalibration.countsPerGram = record.scaleCountsPerGram;
     }
 
     /**
-     * Format entire filesystem and recreate files
-     * Nuclear option for corruption recovery
+     * One-time import of the JSON settings file older firmware wrote.
+     * The JSON file is removed either way; an unreadable one leaves defaults.
      */
-    void formatAndRecreate() {
-#ifndef UNIT_TEST
-        Serial.println("Formatting LittleFS...");
-#endif
-
-        LittleFS.format();
-
-        if (!LittleFS.begin(true)) {
-            lastError = "Failed to reinitialize after format";
-            storageHealthy = false;
-            return;
+    LoadResult importLegacySettings() {
+        File file = LittleFS.open(LEGACY_SETTINGS_FILE, "r");
+        SettingsRecord record = toRecord();
+        bool imported = file && settingsFromJson(file, record);
+        if (file) {
+            file.close();
         }
 
-#ifndef UNIT_TEST
-        Serial.println("  ✓ Filesystem formatted");
-#endif
-
-        // Create fresh settings with defaults
-        saveSettingsInternal();
+        if (!imported) {
+            LOG_WARN(STORAGE, "  Legacy settings file unreadable - using defaults");
+            LittleFS.remove(LEGACY_SETTINGS_FILE);
+            return LoadResult::MISSING;
+        }
 
-        // Verify we can read it back
-        if (!verifyJsonFile(SETTINGS_FILE)) {
-            lastError = "Settings file unreadable after creation";
-            storageHealthy = false;
-#ifndef UNIT_TEST
-            Serial.println("  ✗ CRITICAL: Cannot create valid settings file");
-#endif
-        } else {
-#ifndef UNIT_TEST
-            Serial.println("  ✓ Settings file created and verified");
-#endif
+        fromRecord(record);
+        if (saveSettingsInternal()) {
+            LittleFS.remove(LEGACY_SETTINGS_FILE);
         }
+        LOG_INFO(STORAGE, "  ✓ Settings imported from %s", LEGACY_SETTINGS_FILE);
+        return LoadResult::OK;
     }
 
     /**
-     * Load settings from JSON file
+     * Load settings from the binary record
      */
-    bool loadSettingsInternal() {
+    LoadResult loadSettingsInternal() {
         if (!LittleFS.exists(SETTINGS_FILE)) {
-#ifndef UNIT_TEST
-            Serial.println("Settings file not found - using defaults");
-#endif
-            return false;
-        }
-
-        File file = LittleFS.open(SETTINGS_FILE, "r");
-        if (!file) {
-            lastError = "Cannot open settings file";
-            return false;
+            if (LittleFS.exists(LEGACY_SETTINGS_FILE)) {
+                return importLegacySettings();
+            }
+            LOG_INFO(STORAGE, "Settings file not found - using defaults");
+            return LoadResult::MISSING;
         }
 
-        JsonDocument doc;
-        DeserializationError error = deserializeJson(doc, file);
-        file.close();
+        SettingsRecord record;
+        switch (settingsSlots.load(record)) {
+            case SettingsDecodeResult::CORRUPT:
+                lastError = "No intact settings slot (length or CRC)";
+                LOG_ERROR(STORAGE, "  ✗ %s", lastError.c_str());
+                return LoadResult::CORRUPT;
 
-        if (error) {
-            lastError = String("Settings JSON parse error: ") + String(error.c_str());
-#ifndef UNIT_TEST
-            Serial.print("  ✗ ");
-            Serial.println(lastError);
-#endif
-            return false;
-        }
+            case SettingsDecodeResult::UNSUPPORTED:
+                lastError = "Settings written by newer firmware";
+                return LoadResult::REJECTED;
 
-        // Version check (for future migrations)
-        uint8_t version = doc["version"] | 0;
-        if (version == 0 || version > SETTINGS_VERSION) {
-            lastError = String("Unknown settings version: ") + String(version);
-            return false;
-        }
+            case SettingsDecodeResult::MIGRATED:
+                fromRecord(record);
+                saveSettingsInternal();   // Store in the current layout
+                LOG_INFO(STORAGE, "  ✓ Settings migrated to version %u", (unsigned)SETTINGS_RECORD_VERSION);
+                return LoadResult::OK;
 
-        // Load custom preset
-        if (doc["customPreset"].is<JsonObject>()) {
-            JsonObject preset = doc["customPreset"];
-            customPreset.targetTemp = preset["temp"] | PRESET_CUSTOM_TEMP;
-            customPreset.targetTime = preset["time"] | PRESET_CUSTOM_TIME;
-            customPreset.maxOvershoot = preset["overshoot"] | PRESET_CUSTOM_OVERSHOOT;
+            case SettingsDecodeResult::OK:
+                break;
         }
 
-        // Load selected preset
-        String presetStr = doc["selectedPreset"] | "PLA";
-        if (presetStr == "PLA") selectedPreset = PresetType::PLA;
-        else if (presetStr == "PETG") selectedPreset = PresetType::PETG;
-        else if (presetStr == "CUSTOM") selectedPreset = PresetType::CUSTOM;
-        else selectedPreset = PresetType::PLA;
-
-        // Load PID profile
-        String pidStr = doc["pidProfile"] | "NORMAL";
-        if (pidStr == "SOFT") selectedPIDProfile = PIDProfile::SOFT;
-        else if (pidStr == "NORMAL") selectedPIDProfile = PIDProfile::NORMAL;
-        else if (pidStr == "STRONG") selectedPIDProfile = PIDProfile::STRONG;
-        else selectedPIDProfile = PIDProfile::NORMAL;
-
-        // Load sound setting
-        soundEnabled = doc["soundEnabled"] | true;
-
-#ifndef UNIT_TEST
-        Serial.println("  ✓ Settings loaded");
-#endif
-        return true;
+        fromRecord(record);
+        LOG_INFO(STORAGE, "  ✓ Settings loaded");
+        return LoadResult::OK;
     }
 
     /**
-     * Save settings to JSON file
+     * Save settings into the inactive A/B slot, synchronously - boot only
+     * (defaults, migration, legacy import), before the worker runs.
+     * The record holds every cached setting, so a write clears the dirty mask
      */
     bool saveSettingsInternal() {
-        JsonDocument doc;
-
-        doc["version"] = SETTINGS_VERSION;
-
-        // Custom preset
-        JsonObject preset = doc["customPreset"].to<JsonObject>();
-        preset["temp"] = customPreset.targetTemp;
-        preset["time"] = customPreset.targetTime;
-        preset["overshoot"] = customPreset.maxOvershoot;
-
-        // Selected preset
-        switch (selectedPreset) {
-            case PresetType::PLA: doc["selectedPreset"] = "PLA"; break;
-            case PresetType::PETG: doc["selectedPreset"] = "PETG"; break;
-            case PresetType::CUSTOM: doc["selectedPreset"] = "CUSTOM"; break;
-        }
-
-        // PID profile
-        switch (selectedPIDProfile) {
-            case PIDProfile::SOFT: doc["pidProfile"] = "SOFT"; break;
-            case PIDProfile::NORMAL: doc["pidProfile"] = "NORMAL"; break;
-            case PIDProfile::STRONG: doc["pidProfile"] = "STRONG"; break;
-        }
+        PERF_SCOPE(PerfZone::SETTINGS_WRITE);
+        SettingsRecord record = toRecord();
 
-        // Sound setting
-        doc["soundEnabled"] = soundEnabled;
-
-        // Write to file
-        File file = LittleFS.open(SETTINGS_FILE, "w");
-        if (!file) {
-            lastError = "Cannot open settings file for writing";
-#ifndef UNIT_TEST
-            Serial.print("  ✗ ");
-            Serial.println(lastError);
-#endif
+        if (!settingsSlots.save(record)) {
+            lastError = "Failed to write settings slot";
+            LOG_ERROR(STORAGE, "  ✗ %s", lastError.c_str());
             return false;
         }
 
-        size_t bytesWritten = serializeJson(doc, file);
-        file.close();
+        dirtyMask = 0;
+        return true;
+    }
 
-        if (bytesWritten == 0) {
-            lastError = "Failed to write settings";
-            return false;
+    void markDirty(uint8_t bit) {
+        if (dirtyMask != 0) {
+            coalescedChanges++;
         }
-
-        return true;
+        dirtyMask |= bit;
+        changeStamped = false;   // Restart the debounce window
     }
 
     /**
-     * Load runtime state from JSON file
+     * Load runtime state from the journal
      * Loads whatever state is stored - no business logic filtering
      * Dryer layer decides which states are valid for recovery
      */
-    bool loadRuntimeInternal() {
-        if (!LittleFS.exists(RUNTIME_FILE)) {
-            hasValidRuntime = false;
-            return false;
-        }
-
-        File file = LittleFS.open(RUNTIME_FILE, "r");
-        if (!file) {
-            hasValidRuntime = false;
-            return false;
-        }
-
-        JsonDocument doc;
-        DeserializationError error = deserializeJson(doc, file);
-        file.close();
-
-        if (error) {
-            lastError = String("Runtime JSON parse error: ") + String(error.c_str());
-            hasValidRuntime = false;
-            return false;
+    void loadRuntimeInternal() {
+        // Files from firmware before the NVS journal: never recovered from
+        if (LittleFS.exists(LEGACY_RUNTIME_FILE)) {
+            LittleFS.remove(LEGACY_RUNTIME_FILE);
         }
-
-        // Version check
-        uint8_t version = doc["version"] | 0;
-        if (version == 0 || version > RUNTIME_VERSION) {
-            hasValidRuntime = false;
-            return false;
+        if (LittleFS.exists(LEGACY_RUNTIME_JOURNAL_FILE)) {
+            LittleFS.remove(LEGACY_RUNTIME_JOURNAL_FILE);
         }
 
-        // Load state string and convert to enum
-        // No filtering - load whatever was saved
-        String stateStr = doc["state"] | "READY";
-        if (stateStr == "RUNNING") {
-            runtimeState = DryerState::RUNNING;
-        } else if (stateStr == "PAUSED") {
-            runtimeState = DryerState::PAUSED;
-        } else if (stateStr == "FINISHED") {
-            runtimeState = DryerState::FINISHED;
-        } else if (stateStr == "FAILED") {
-            runtimeState = DryerState::FAILED;
-        } else {
-            runtimeState = DryerState::READY;
+        RuntimeRecord record;
+        hasValidRuntime = runtimeJournal.recover(record);
+        if (!hasValidRuntime) {
+            return;
         }
 
-        runtimeElapsed = doc["elapsed"] | 0;
-        runtimeTargetTemp = doc["targetTemp"] | 50.0;
-        runtimeTargetTime = doc["targetTime"] | 14400;
-
-        String presetStr = doc["preset"] | "PLA";
-        if (presetStr == "PLA") runtimePreset = PresetType::PLA;
-        else if (presetStr == "PETG") runtimePreset = PresetType::PETG;
-        else if (presetStr == "CUSTOM") runtimePreset = PresetType::CUSTOM;
-        else runtimePreset = PresetType::PLA;
+        runtimeState = static_cast<DryerState>(record.state);
+        runtimeElapsed = record.elapsed;
+        runtimeTargetTemp = record.targetTemp;
+        runtimeTargetTime = record.targetTime;
+        runtimePreset = static_cast<PresetType>(record.preset);
+        runtimeTimestamp = record.timestamp;
 
-        runtimeTimestamp = doc["timestamp"] | 0;
-
-#ifndef UNIT_TEST
-        // Log the timestamp for informational purposes
-        Serial.print("  Runtime saved at timestamp: ");
-        Serial.println(runtimeTimestamp);
-
-        hasValidRuntime = true;
-        Serial.print("  ✓ Runtime state loaded (");
-        Serial.print(stateStr);
-        Serial.println(")");
-#else
-        hasValidRuntime = true;
-#endif
-        return true;
+        LOG_INFO(STORAGE, "  Runtime saved at timestamp: %lu", (unsigned long)runtimeTimestamp);
+        LOG_INFO(STORAGE, "  ✓ Runtime state loaded (record %lu)", (unsigned long)record.sequence);
     }
 
-    /**
-     * Save runtime state to JSON file
-     */
-    bool saveRuntimeInternal(DryerState state, uint32_t elapsed,
-                            float targetTemp, uint32_t targetTime,
-                            PresetType preset, uint32_t timestamp) {
-        JsonDocument doc;
-
-        doc["version"] = RUNTIME_VERSION;
-
-        // State
-        switch (state) {
-            case DryerState::RUNNING: doc["state"] = "RUNNING"; break;
-            case DryerState::PAUSED: doc["state"] = "PAUSED"; break;
-            default: doc["state"] = "READY"; break;
-        }
-
-        doc["elapsed"] = elapsed;
-        doc["targetTemp"] = targetTemp;
-        doc["targetTime"] = targetTime;
-
-        // Preset
-        switch (preset) {
-            case PresetType::PLA: doc["preset"] = "PLA"; break;
-            case PresetType::PETG: doc["preset"] = "PETG"; break;
-            case PresetType::CUSTOM: doc["preset"] = "CUSTOM"; break;
-        }
-
-        doc["timestamp"] = timestamp;
-
-        // Write to file
-        File file = LittleFS.open(RUNTIME_FILE, "w");
-        if (!file) {
-            lastError = "Cannot open runtime file for writing";
-            // Don't print error - this happens frequently during normal operation
-            return false;
-        }
-
-        size_t bytesWritten = serializeJson(doc, file);
-        file.close();
-
-        return (bytesWritten > 0);
+    RuntimeSnapshot runtimeSnapshot() const {
+        RuntimeSnapshot snapshot;
+        snapshot.state = runtimeState;
+        snapshot.preset = runtimePreset;
+        snapshot.elapsed = runtimeElapsed;
+        snapshot.targetTemp = runtimeTargetTemp;
+        snapshot.targetTime = runtimeTargetTime;
+        snapshot.timestamp = runtimeTimestamp;
+        return snapshot;
     }
 
 public:
@@ -394,85 +319,88 @@ public:
           selectedPreset(PresetType::PLA),
           selectedPIDProfile(PIDProfile::NORMAL),
           soundEnabled(true),
+          dirtyMask(0),
+          changeStamped(false),
+          lastChangeTime(0),
+          coalescedChanges(0),
           hasValidRuntime(false),
           runtimeState(DryerState::READY),
           runtimeElapsed(0),
           runtimeTargetTemp(50.0),
           runtimeTargetTime(14400),
           runtimePreset(PresetType::PLA),
-          runtimeTimestamp(0) {
+          runtimeTimestamp(0),
+          cyclePending(false),
+          clearPending(false),
+          pendingClearTime(0),
+          worker(settingsSlots, runtimeJournal, cycleHistory, telemetryLog) {
 
         // Initialize custom preset with defaults
         customPreset.targetTemp = PRESET_CUSTOM_TEMP;
         customPreset.targetTime = PRESET_CUSTOM_TIME;
         customPreset.maxOvershoot = PRESET_CUSTOM_OVERSHOOT;
+        memset(&pendingCycle, 0, sizeof(pendingCycle));
     }
 
     void begin() override {
-#ifndef UNIT_TEST
-        Serial.println("\n========================================");
-        Serial.println("Initializing SettingsStorage");
-        Serial.println("========================================");
-#endif
+        // Boot reads each file once: a second begin() is a no-op
+        if (initialized) {
+            LOG_DEBUG(STORAGE, "SettingsStorage already initialized");
+            return;
+        }
+
+        LOG_INFO(STORAGE, "\n========================================");
+        LOG_INFO(STORAGE, "Initializing SettingsStorage");
+        LOG_INFO(STORAGE, "========================================");
 
         // Initialize filesystem
         if (!initializeFilesystem()) {
             storageHealthy = false;
             initialized = true;
-#ifndef UNIT_TEST
-            Serial.println("✗ Storage initialization failed");
-            Serial.println("  System will continue with defaults");
-            Serial.println("========================================\n");
-#endif
+            LOG_ERROR(STORAGE, "✗ Storage initialization failed");
+            LOG_ERROR(STORAGE, "  System will continue with defaults");
             return;
         }
 
-#ifndef UNIT_TEST
-        // Check for corrupted files
-        bool settingsValid = verifyJsonFile(SETTINGS_FILE);
-        bool runtimeValid = verifyJsonFile(RUNTIME_FILE);
-
-        if (!settingsValid && LittleFS.exists(SETTINGS_FILE)) {
-            Serial.println("⚠ Corrupted settings file detected");
-            formatAndRecreate();
-        } else if (!settingsValid) {
-            // File doesn't exist - create it
-            Serial.println("Creating initial settings file...");
-            saveSettingsInternal();
-
-            if (!verifyJsonFile(SETTINGS_FILE)) {
-                lastError = "Cannot create valid settings file";
+        // One read per file: loading is also the corruption check
+        LoadResult settingsResult = loadSettingsInternal();
+
+        if (settingsResult == LoadResult::CORRUPT || settingsResult == LoadResult::MISSING) {
+            // Start from defaults. A damaged file is overwritten slot by
+            // slot like any save - never a format
+            if (settingsResult == LoadResult::CORRUPT) {
+                LOG_WARN(STORAGE, "⚠ No intact settings slot - using defaults");
+            } else {
+                LOG_INFO(STORAGE, "Creating initial settings file...");
+            }
+
+            if (!saveSettingsInternal()) {
                 storageHealthy = false;
-                Serial.println("✗ CRITICAL: Settings file verification failed");
+                LOG_ERROR(STORAGE, "✗ CRITICAL: Cannot create settings file");
             }
         }
 
-        if (!runtimeValid && LittleFS.exists(RUNTIME_FILE)) {
-            Serial.println("⚠ Corrupted runtime file detected - removing");
-            LittleFS.remove(RUNTIME_FILE);
-        }
-#endif
+        // Load runtime state (for power recovery); a damaged record is
+        // ignored and replaced by the next save
+        loadRuntimeInternal();
 
-        // Load settings
-        if (storageHealthy) {
-            loadSettingsInternal();
+        // Cycle history index (repaired here if a write was cut short)
+        if (!cycleHistory.load()) {
+            LOG_ERROR(STORAGE, "  ✗ Cannot create cycle history file");
         }
 
-        // Load runtime state (for power recovery)
-        loadRuntimeInternal();
+        // Telemetry ring: its header scan is the storage worker's first
+        // pass, not part of boot (only serial reads need it before then)
 
         initialized = true;
 
-#ifndef UNIT_TEST
         if (storageHealthy) {
-            Serial.println("✓ Storage initialized successfully");
+            LOG_INFO(STORAGE, "✓ Storage initialized successfully");
         } else {
-            Serial.println("⚠ Storage initialized with errors");
-            Serial.print("  Last error: ");
-            Serial.println(lastError);
+            LOG_WARN(STORAGE, "⚠ Storage initialized with errors");
+            LOG_WARN(STORAGE, "  Last error: %s", lastError.c_str());
         }
-        Serial.println("========================================\n");
-#endif
+        LOG_INFO(STORAGE, "========================================\n");
     }
 
     void loadSettings() override {
@@ -487,16 +415,67 @@ public:
             return;
         }
 
-        if (!saveSettingsInternal()) {
-#ifndef UNIT_TEST
-            Serial.println("⚠ Failed to save settings (system will continue)");
-#endif
+        markDirty(DIRTY_ALL);
+        flush();
+    }
+
+    /**
+     * Write dirty settings once no change has arrived for
+     * SETTINGS_WRITE_DEBOUNCE_MS. The window is timed from the first
+     * update() after a change, so save*() needs no clock.
+     */
+    void update(uint32_t currentMillis) override {
+        retryPendingWrites();
+        if (worker.takeSettingsFailure()) {
+            // The worker could not write the last snapshot: try again later
+            lastError = "Failed to write settings slot";
+            markDirty(DIRTY_ALL);
+        }
+        if (dirtyMask == 0) {
+            return;
+        }
+        if (!changeStamped) {
+            changeStamped = true;
+            lastChangeTime = currentMillis;
+            return;
+        }
+        if (currentMillis - lastChangeTime >= SETTINGS_WRITE_DEBOUNCE_MS) {
+            flush();
+        }
+    }
+
+    // Resubmit a cycle record or tombstone the queue had no room for
+    void retryPendingWrites() {
+        if (cyclePending && worker.submitCycle(pendingCycle)) {
+            cyclePending = false;
+        }
+        if (clearPending && worker.submitRuntimeClear(pendingClearTime)) {
+            clearPending = false;
+        }
+    }
+
+    // Queue a snapshot of the dirty settings; returns without touching flash
+    void flush() override {
+        if (!initialized || dirtyMask == 0) {
+            return;
+        }
+        if (worker.submitSettings(toRecord())) {
+            dirtyMask = 0;
+        } else {
+            // Queue full: still dirty, update() retries after another window
+            changeStamped = false;
+            LOG_WARN(STORAGE, "⚠ Storage queue full - settings write deferred");
         }
     }
 
     void saveCustomPreset(const DryingPreset& preset) override {
+        if (preset.targetTemp == customPreset.targetTemp &&
+            preset.targetTime == customPreset.targetTime &&
+            preset.maxOvershoot == customPreset.maxOvershoot) {
+            return;
+        }
         customPreset = preset;
-        saveSettings();  // Save immediately
+        markDirty(DIRTY_CUSTOM_PRESET);
     }
 
     DryingPreset loadCustomPreset() override {
@@ -504,8 +483,11 @@ public:
     }
 
     void saveSelectedPreset(PresetType preset) override {
+        if (preset == selectedPreset) {
+            return;
+        }
         selectedPreset = preset;
-        saveSettings();  // Save immediately
+        markDirty(DIRTY_SELECTED_PRESET);
     }
 
     PresetType loadSelectedPreset() override {
@@ -513,8 +495,11 @@ public:
     }
 
     void savePIDProfile(PIDProfile profile) override {
+        if (profile == selectedPIDProfile) {
+            return;
+        }
         selectedPIDProfile = profile;
-        saveSettings();  // Save immediately
+        markDirty(DIRTY_PID_PROFILE);
     }
 
     PIDProfile loadPIDProfile() override {
@@ -522,14 +507,30 @@ public:
     }
 
     void saveSoundEnabled(bool enabled) override {
+        if (enabled == soundEnabled) {
+            return;
+        }
         soundEnabled = enabled;
-        saveSettings();  // Save immediately
+        markDirty(DIRTY_SOUND);
     }
 
     bool loadSoundEnabled() override {
         return soundEnabled;
     }
 
+    void saveScaleCalibration(const ScaleCalibration& calibration) override {
+        if (calibration.tareOffset == scaleCalibration.tareOffset &&
+            calibration.countsPerGram == scaleCalibration.countsPerGram) {
+            return;
+        }
+        scaleCalibration = calibration;
+        markDirty(DIRTY_SCALE);
+    }
+
+    ScaleCalibration loadScaleCalibration() override {
+        return scaleCalibration;
+    }
+
     void saveRuntimeState(DryerState state, uint32_t elapsed,
                          float targetTemp, uint32_t targetTime,
                          PresetType preset, uint32_t timestamp) override {
@@ -549,8 +550,12 @@ public:
         // Note: On restart, the state will be loaded and validated by Dryer
         hasValidRuntime = true;
 
-        // Save to file (don't fail if write fails - graceful degradation)
-        saveRuntimeInternal(state, elapsed, targetTemp, targetTime, preset, timestamp);
+        // A new snapshot supersedes a tombstone still waiting for room
+        clearPending = false;
+
+        // Queue it; if the queue is full it is dropped - the next periodic
+        // snapshot supersedes it anyway
+        worker.submitRuntime(runtimeSnapshot());
     }
 
     bool hasValidRuntimeState() override {
@@ -563,11 +568,18 @@ public:
     }
 
     void clearRuntimeState() override {
-        hasValidRuntime = false;
-
-        if (initialized && LittleFS.exists(RUNTIME_FILE)) {
-            LittleFS.remove(RUNTIME_FILE);
+        // Tombstone only if a live snapshot could still be recovered
+        if (initialized && hasValidRuntime) {
+            uint32_t now = millis();
+            // Must not be lost, or a finished cycle comes back after a
+            // reboot; called from a state transition, so never wait here
+            if (!worker.submitRuntimeClear(now)) {
+                clearPending = true;
+                pendingClearTime = now;
+                LOG_WARN(STORAGE, "⚠ Storage queue full - runtime clear deferred");
+            }
         }
+        hasValidRuntime = false;
     }
 
     void saveEmergencyState(const String& reason) override {
@@ -575,23 +587,138 @@ public:
             return;
         }
 
-#ifndef UNIT_TEST
-        // Save special emergency marker
-        File file = LittleFS.open("/emergency.txt", "w");
-        if (file) {
-            file.print(reason);
-            file.close();
+        // Runtime record marked FAILED plus the reason (EMERGENCY_FILE),
+        // ahead of anything already queued
+        RuntimeSnapshot snapshot = runtimeSnapshot();
+        snapshot.timestamp = millis();
+        if (!worker.submitEmergency(snapshot, reason.c_str())) {
+            worker.barrier();
+            worker.submitEmergency(snapshot, reason.c_str());
         }
-#endif
 
-        // Also save runtime state marked as FAILED
-        saveRuntimeInternal(DryerState::FAILED, runtimeElapsed,
-                          runtimeTargetTemp, runtimeTargetTime,
-                          runtimePreset, millis());
+        // Don't leave a pending setting change to a debounce that may never come
+        flush();
+        retryPendingWrites();
+
+        // Power may be cut next: wait until all of it is on flash
+        if (!worker.barrier()) {
+            LOG_ERROR(STORAGE, "  ✗ Emergency state not confirmed on flash");
+        }
+    }
+
+    /**
+     * Queue a finished cycle for the history ring. Dryer calls this from a
+     * state transition, so a full queue is never waited out: the record
+     * is held and update() resubmits it. Only one is held; cycles end
+     * minutes apart, so a second one finding it still there means the
+     * worker is stuck and the older record is dropped.
+     */
+    void saveCycleRecord(const CycleRecord& record) override {
+        if (!initialized || !storageHealthy) {
+            return;
+        }
+        retryPendingWrites();
+        if (worker.submitCycle(record)) {
+            return;
+        }
+        if (cyclePending) {
+            LOG_ERROR(STORAGE, "✗ Storage queue stuck - older cycle record dropped");
+        } else {
+            LOG_WARN(STORAGE, "⚠ Storage queue full - cycle record deferred");
+        }
+        pendingCycle = record;
+        cyclePending = true;
+    }
+
+    /**
+     * Queue a full telemetry page. Telemetry is best effort: a full queue
+     * drops the page rather than stall the control tick.
+     */
+    bool saveTelemetryPage(TelemetryPageBuffer& buffer) override {
+        if (!initialized || !storageHealthy) {
+            return false;
+        }
+        return worker.submitTelemetry(buffer);
     }
 
     // ==================== Additional Methods ====================
 
+    // Serial debug path: the settings as JSON (SettingsJson.h layout)
+    String exportJson() const override {
+        return settingsToJson(toRecord());
+    }
+
+    /**
+     * Apply a (partial) JSON settings document. It is written like any
+     * change, by the next update() window, so only Dryer's tick queues
+     * writes. Components that cached settings at boot see them after a restart.
+     */
+    bool importJson(const String& json) override {
+        SettingsRecord record = toRecord();
+        if (!settingsFromJson(json, record)) {
+            lastError = "Settings JSON rejected";
+            return false;
+        }
+        fromRecord(record);
+        markDirty(DIRTY_ALL);
+        return true;
+    }
+
+    /**
+     * Shutdown path: queue dirty settings and wait until everything queued
+     * is on flash
+     * @return false if the worker task did not finish in time
+     */
+    bool sync() {
+        flush();
+        if (cyclePending || clearPending) {
+            worker.barrier();
+            retryPendingWrites();
+        }
+        return worker.barrier();
+    }
+
+    // A cycle record or tombstone is waiting for room in the queue
+    bool hasPendingWrites() const {
+        return cyclePending || clearPending;
+    }
+
+    // Runs the queued writes: the C3 scheduler slice or the dual-core task
+    StorageWorker& getWorker() {
+        return worker;
+    }
+
+    // Finished cycles: read(id), readRecent() - safe from the UI/serial side
+    const CycleHistoryFile& getCycleHistory() const {
+        return cycleHistory;
+    }
+
+    // Telemetry recordings: listRecordings(), forEachPage() - safe from the serial side
+    const TelemetryLogFile& getTelemetryLog() const {
+        return telemetryLog;
+    }
+
+    /**
+     * Flash traffic since mount, LittleFS used/total and the projected
+     * wear - safe from the serial side
+     */
+    FlashWearReport getWearReport(uint32_t currentMillis) const {
+        if (!initialized || !storageHealthy) {
+            return estimateFlashWear(flashWriteStats(), 0, 0, currentMillis);
+        }
+        return estimateFlashWear(flashWriteStats(), LittleFS.usedBytes(), LittleFS.totalBytes(),
+                                 currentMillis);
+    }
+
+    // Bitmask of settings changed but not yet written (0 = flash is current)
+    uint8_t getDirtyMask() const {
+        return dirtyMask;
+    }
+
+    uint32_t getCoalescedChanges() const {
+        return coalescedChanges;
+    }
+
     bool isHealthy() const {
         return storageHealthy;
     }
@@ -619,10 +746,6 @@ public:
     PresetType getRuntimePreset() const override { return runtimePreset; }
 };
 
-// Define static const members outside the class for ODR compliance
-constexpr uint8_t SettingsStorage::SETTINGS_VERSION;
-constexpr uint8_t SettingsStorage::RUNTIME_VERSION;
-
 #endif
 
 
@@ -0,0 +1,382 @@
+#ifndef STORAGE_WORKER_H
+#define STORAGE_WORKER_H
+
+#include "SettingsRecord.h"
+#include "SettingsSlots.h"
+#include "RuntimeJournal.h"
+#include "CycleHistoryFile.h"
+#include "TelemetryLogFile.h"
+#include "../concurrency/SpscQueue.h"
+#include "../Types.h"
+#include "../Config.h"
+#include "../diagnostics/PerfCounters.h"
+#include "../diagnostics/Log.h"
+#include <atomic>
+#include <string.h>
+
+#ifndef UNIT_TEST
+    #include <Arduino.h>
+    #include <LittleFS.h>
+#else
+    #include "../../test/mocks/arduino_mock.h"
+#endif
+
+/**
+ * Runtime snapshot as handed to the worker - a copy, never a reference
+ * into the caller's state
+ */
+struct RuntimeSnapshot {
+    DryerState state;
+    PresetType preset;
+    uint32_t elapsed;
+    float targetTemp;
+    uint32_t targetTime;
+    uint32_t timestamp;
+};
+
+enum class StorageOp : uint8_t {
+    SETTINGS,       // Write `settings` into the inactive A/B slot
+    RUNTIME,        // Append `runtime` to the journal
+    RUNTIME_CLEAR,  // Tombstone at `runtime.timestamp`
+    CYCLE,          // Append `cycle` to the history ring
+    TELEMETRY       // Append `telemetry->page` to the telemetry ring, then release it
+};
+
+struct StorageRequest {
+    StorageOp op;
+    uint32_t ticket;            // Submission order; a lower ticket never overwrites a higher one
+    union {
+        SettingsRecord settings;
+        RuntimeSnapshot runtime;
+        CycleRecord cycle;
+        TelemetryPageBuffer* telemetry;   // Owned by the recorder; pending until executed
+    };
+
+    StorageRequest() : op(StorageOp::SETTINGS), ticket(0) {
+        memset(&cycle, 0, sizeof(cycle));   // Largest member
+    }
+};
+
+struct EmergencyRequest {
+    uint32_t ticket;
+    RuntimeSnapshot runtime;    // Written with state FAILED
+    char reason[STORAGE_EMERGENCY_REASON_LENGTH];
+};
+
+/**
+ * StorageWorker - Write-behind queue in front of the settings slots, the
+ * runtime journal, the cycle history and the telemetry log
+ *
+ * Callers submit immutable snapshots and return at once; the erase and
+ * program time of a LittleFS write is paid by whoever runs the worker:
+ * - ESP32-C3: a scheduler slice (runOnce(), one request per pass)
+ * - DUAL_CORE_MODE: its own low-priority FreeRTOS task on the UI core,
+ *   woken by a task notification (attachTask())
+ *
+ * Two lanes, both bounded single-producer / single-consumer rings: the
+ * normal FIFO (STORAGE_QUEUE_DEPTH) and a small emergency lane that is
+ * always served first. Every request carries a ticket in submission
+ * order; a runtime request older than the last one written (passed by
+ * an emergency) is dropped as superseded, so the FAILED record is never
+ * followed by a stale RUNNING one.
+ *
+ * A full queue is backpressure, not blocking: submit*() returns false
+ * and the caller decides - settings stay dirty and retry, periodic
+ * runtime snapshots are dropped (the next one supersedes them), cycle
+ * records and tombstones are held and resubmitted on the next tick (they
+ * come from state transitions, which must not wait), and emergencies
+ * call barrier() and submit again.
+ *
+ * barrier() returns once everything submitted before it is on flash. With
+ * no worker task attached (C3, tests, boot) it drains the queue inline.
+ *
+ * Responsibilities:
+ * - Queueing, ordering, superseding, executing writes
+ * - Counters for the queue (depth, drops, failures)
+ *
+ * Does NOT:
+ * - Decide what to write or when (SettingsStorage does)
+ * - Touch the files before begin() has loaded them (boot is synchronous)
+ */
+class StorageWorker {
+private:
+    SettingsSlots& settingsSlots;
+    RuntimeJournal& runtimeJournal;
+    CycleHistoryFile& cycleHistory;
+    TelemetryLogFile& telemetryLog;
+
+    SpscQueue<StorageRequest, STORAGE_QUEUE_DEPTH> queue;
+    SpscQueue<EmergencyRequest, STORAGE_EMERGENCY_QUEUE_DEPTH> emergencyQueue;
+
+    // Producer side
+    uint32_t submitted;
+    uint32_t dropped;           // Rejected: queue full
+    uint8_t peakDepth;
+
+    // Consumer side
+    std::atomic<uint32_t> completed;
+    std::atomic<bool> settingsFailed;
+    uint32_t lastRuntimeTicket;
+    uint32_t superseded;
+    uint32_t failedWrites;
+
+#if defined(DUAL_CORE_MODE) && !defined(UNIT_TEST)
+    TaskHandle_t workerTask;
+#endif
+
+    void wake() {
+#if defined(DUAL_CORE_MODE) && !defined(UNIT_TEST)
+        if (workerTask) {
+            xTaskNotifyGive(workerTask);
+        }
+#endif
+    }
+
+    bool submit(StorageRequest& request) {
+        request.ticket = submitted + 1;
+        if (!queue.push(request)) {
+            dropped++;
+            return false;
+        }
+        submitted++;
+        uint8_t depth = static_cast<uint8_t>(queue.size());
+        if (depth > peakDepth) {
+            peakDepth = depth;
+        }
+        wake();
+        return true;
+    }
+
+    bool writeRuntime(const RuntimeSnapshot& runtime) {
+        PERF_SCOPE(PerfZone::RUNTIME_WRITE);
+        return runtimeJournal.save(runtime.state, runtime.elapsed, runtime.targetTemp,
+                                   runtime.targetTime, runtime.preset, runtime.timestamp);
+    }
+
+    void execute(StorageRequest& request) {
+        switch (request.op) {
+            case StorageOp::SETTINGS: {
+                PERF_SCOPE(PerfZone::SETTINGS_WRITE);
+                if (!settingsSlots.save(request.settings)) {
+                    failedWrites++;
+                    settingsFailed.store(true, std::memory_order_release);
+                    LOG_ERROR(STORAGE, "  ✗ Failed to write settings slot");
+                }
+                break;
+            }
+
+            case StorageOp::RUNTIME:
+            case StorageOp::RUNTIME_CLEAR:
+                if (request.ticket < lastRuntimeTicket) {
+                    superseded++;   // An emergency record already went out after it
+                    break;
+                }
+                lastRuntimeTicket = request.ticket;
+                {
+                    bool ok = request.op == StorageOp::RUNTIME
+                            ? writeRuntime(request.runtime)
+                            : runtimeJournal.clear(request.runtime.timestamp);
+                    if (!ok) {
+                        failedWrites++;   // Not logged - the next snapshot retries
+                    }
+                }
+                break;
+
+            case StorageOp::CYCLE:
+                if (!cycleHistory.append(request.cycle)) {
+                    failedWrites++;
+                    LOG_ERROR(STORAGE, "  ✗ Failed to write cycle history");
+                }
+                break;
+
+            case StorageOp::TELEMETRY:
+                if (!telemetryLog.append(request.telemetry->page)) {
+                    failedWrites++;   // Not logged - one page of telemetry is lost
+                }
+                request.telemetry->release();
+                break;
+        }
+    }
+
+    void executeEmergency(const EmergencyRequest& request) {
+        // Runtime record first: it is what recovery looks at
+        lastRuntimeTicket = request.ticket;
+        if (!writeRuntime(request.runtime)) {
+            failedWrites++;
+        }
+
+        FlashWriteSession session(FlashFile::EMERGENCY);
+        File file = LittleFS.open(EMERGENCY_FILE, "w");
+        if (file) {
+            session.wrote(0, file.print(request.reason));
+            file.close();
+        }
+    }
+
+public:
+    StorageWorker(SettingsSlots& slots, RuntimeJournal& journal, CycleHistoryFile& history,
+                  TelemetryLogFile& telemetry)
+        : settingsSlots(slots),
+          runtimeJournal(journal),
+          cycleHistory(history),
+          telemetryLog(telemetry),
+          submitted(0),
+          dropped(0),
+          peakDepth(0),
+          completed(0),
+          settingsFailed(false),
+          lastRuntimeTicket(0),
+          superseded(0),
+          failedWrites(0) {
+#if defined(DUAL_CORE_MODE) && !defined(UNIT_TEST)
+        workerTask = nullptr;
+#endif
+    }
+
+    // ==================== Producer Side ====================
+
+    bool submitSettings(const SettingsRecord& record) {
+        StorageRequest request;
+        request.op = StorageOp::SETTINGS;
+        request.settings = record;
+        return submit(request);
+    }
+
+    bool submitRuntime(const RuntimeSnapshot& runtime) {
+        StorageRequest request;
+        request.op = StorageOp::RUNTIME;
+        request.runtime = runtime;
+        return submit(request);
+    }
+
+    bool submitRuntimeClear(uint32_t timestamp) {
+        StorageRequest request;
+        request.op = StorageOp::RUNTIME_CLEAR;
+        memset(&request.runtime, 0, sizeof(request.runtime));
+        request.runtime.timestamp = timestamp;
+        return submit(request);
+    }
+
+    bool submitCycle(const CycleRecord& record) {
+        StorageRequest request;
+        request.op = StorageOp::CYCLE;
+        request.cycle = record;
+        return submit(request);
+    }
+
+    // The buffer stays pending until the page is written (or the request fails)
+    bool submitTelemetry(TelemetryPageBuffer& buffer) {
+        StorageRequest request;
+        request.op = StorageOp::TELEMETRY;
+        request.telemetry = &buffer;
+        return submit(request);
+    }
+
+    /**
+     * Emergency lane: served before anything in the normal queue.
+     * Call barrier() afterwards to wait for it.
+     */
+    bool submitEmergency(const RuntimeSnapshot& runtime, const char* reason) {
+        EmergencyRequest request;
+        request.ticket = submitted + 1;
+        request.runtime = runtime;
+        request.runtime.state = DryerState::FAILED;
+        strncpy(request.reason, reason, sizeof(request.reason) - 1);
+        request.reason[sizeof(request.reason) - 1] = '\0';
+
+        if (!emergencyQueue.push(request)) {
+            dropped++;
+            return false;
+        }
+        submitted++;
+        wake();
+        return true;
+    }
+
+    /**
+     * Wait until every request submitted so far is written.
+     * @return false if the worker task did not finish within timeoutMs
+     */
+    bool barrier(uint32_t timeoutMs = STORAGE_BARRIER_TIMEOUT_MS) {
+#if defined(DUAL_CORE_MODE) && !defined(UNIT_TEST)
+        if (workerTask) {
+            uint32_t target = submitted;
+            uint32_t start = millis();
+            xTaskNotifyGive(workerTask);
+            while (completed.load(std::memory_order_acquire) < target) {
+                if (millis() - start >= timeoutMs) {
+                    return false;
+                }
+                vTaskDelay(1);
+            }
+            return true;
+        }
+#endif
+        (void)timeoutMs;
+        drain();
+        return true;
+    }
+
+    // True (once) if a settings write failed since the last call
+    bool takeSettingsFailure() {
+        return settingsFailed.exchange(false, std::memory_order_acq_rel);
+    }
+
+    // Requests accepted but not yet written
+    uint32_t getPending() const {
+        return submitted - completed.load(std::memory_order_acquire);
+    }
+
+    uint32_t getSubmitted() const { return submitted; }
+    uint32_t getDropped() const { return dropped; }
+    uint8_t getPeakDepth() const { return peakDepth; }
+
+    // ==================== Consumer Side ====================
+
+#if defined(DUAL_CORE_MODE) && !defined(UNIT_TEST)
+    // From here on only `task` consumes; submit*() and barrier() wake it
+    void attachTask(TaskHandle_t task) {
+        workerTask = task;
+    }
+#endif
+
+    /**
+     * Execute one request, emergency lane first. The first pass with no
+     * emergency waiting scans the telemetry log instead (deferred from
+     * boot); queued requests wait for the next pass.
+     * @return false if there was nothing to do
+     */
+    bool runOnce() {
+        EmergencyRequest emergency;
+        if (emergencyQueue.pop(emergency)) {
+            executeEmergency(emergency);
+        } else if (!telemetryLog.isLoaded()) {
+            if (!telemetryLog.load()) {
+                LOG_ERROR(STORAGE, "  ✗ Cannot read telemetry log");
+            }
+            return true;
+        } else {
+            StorageRequest request;
+            if (!queue.pop(request)) {
+                return false;
+            }
+            execute(request);
+        }
+        completed.fetch_add(1, std::memory_order_release);
+        return true;
+    }
+
+    // Run passes until both lanes are empty; returns the requests written
+    size_t drain() {
+        uint32_t before = completed.load(std::memory_order_relaxed);
+        while (runOnce()) {
+        }
+        return completed.load(std::memory_order_relaxed) - before;
+    }
+
+    uint32_t getCompleted() const { return completed.load(std::memory_order_acquire); }
+    uint32_t getSuperseded() const { return superseded; }
+    uint32_t getFailedWrites() const { return failedWrites; }
+};
+
+#endif
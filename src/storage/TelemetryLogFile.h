@@ -0,0 +1,429 @@
+#ifndef TELEMETRY_LOG_FILE_H
+#define TELEMETRY_LOG_FILE_H
+
+#include "TelemetryPage.h"
+#include "FlashWear.h"
+#include "../Config.h"
+#include "../diagnostics/Log.h"
+#include <atomic>
+
+#ifndef UNIT_TEST
+    #include <LittleFS.h>
+#else
+    #include "../../test/mocks/arduino_mock.h"
+#endif
+
+constexpr size_t TELEMETRY_LOG_BYTES = static_cast<size_t>(TELEMETRY_LOG_PAGES) * TELEMETRY_PAGE_BYTES;
+constexpr uint16_t TELEMETRY_LOG_SEGMENTS = TELEMETRY_LOG_PAGES / TELEMETRY_SEGMENT_PAGES;
+static_assert(TELEMETRY_LOG_PAGES % TELEMETRY_SEGMENT_PAGES == 0, "Telemetry ring must be whole segments");
+
+// Outcome of TelemetryLogFile::findPage()
+enum class TelemetryScan : uint8_t {
+    FOUND,      // Page stored in `out`
+    PENDING,    // Header budget used up; call again from `sequence`
+    END         // No more pages of the recording
+};
+
+// One recording as found in the log
+struct TelemetryRecordingInfo {
+    uint32_t recording;
+    uint32_t firstSequence;     // Oldest page still stored
+    uint32_t firstSample;       // > 0: the start has rotated out
+    uint32_t samples;           // Samples in the stored pages
+    uint16_t pages;
+};
+
+/**
+ * TelemetryLogFile - Ring of TELEMETRY_LOG_PAGES telemetry pages
+ *
+ * The ring is TELEMETRY_LOG_SEGMENTS segment files of
+ * TELEMETRY_SEGMENT_PAGES pages each. Page `sequence` belongs to segment
+ * (sequence - 1) / TELEMETRY_SEGMENT_PAGES, which is stored in file
+ * <prefix><segment % TELEMETRY_LOG_SEGMENTS>.bin. Pages are only ever
+ * appended at the end of a segment file: LittleFS stores a file as a
+ * skip list of blocks, so a write before EOF would rewrite every block
+ * after it on close, while an append copies at most the last block.
+ * Starting a segment deletes the file of the oldest one, so old cycles
+ * rotate out a segment at a time and the flash budget is fixed.
+ *
+ * There is no index header to rewrite: every append is exactly one page
+ * program, and load() finds the newest page from the page headers.
+ *
+ * Recordings are numbered here: a page flagged TELEMETRY_PAGE_FIRST opens
+ * the next recording, every other page continues the current one.
+ *
+ * The boot scan reads up to TELEMETRY_LOG_PAGES headers, so it is not
+ * part of boot: the storage worker runs load() on its first pass, before
+ * the first append. Until then isLoaded() is false and the log reads as
+ * empty.
+ *
+ * Threading: load() and append() run on the storage worker; readers
+ * (serial) may run on the other core. The newest sequence is published
+ * only after its page is written, the oldest before its segment is
+ * deleted, and readers check the sequence and both CRCs, so a page
+ * rotated out under a reader is skipped, never mixed.
+ *
+ * Responsibilities:
+ * - Page placement, segment rotation, sequence and recording numbers,
+ *   the boot scan
+ * - Listing recordings and reading their pages in order
+ *
+ * Does NOT:
+ * - Encode samples (TelemetryCodec.h) or decide when a page is full
+ *   (TelemetryRecorder)
+ */
+class TelemetryLogFile {
+private:
+    static constexpr size_t PATH_LENGTH = 32;
+
+    const char* prefix;
+    std::atomic<uint32_t> nextSequence;
+    std::atomic<uint32_t> oldestSequence;   // == nextSequence: empty
+    std::atomic<uint32_t> currentRecording;
+    std::atomic<bool> loaded;
+    uint32_t damagedPages;
+
+    static uint32_t segmentOf(uint32_t sequence) {
+        return (sequence - 1) / TELEMETRY_SEGMENT_PAGES;
+    }
+
+    static size_t pageOffset(uint32_t sequence) {
+        return static_cast<size_t>((sequence - 1) % TELEMETRY_SEGMENT_PAGES) * TELEMETRY_PAGE_BYTES;
+    }
+
+    void slotPath(uint32_t slot, char* out) const {
+        snprintf(out, PATH_LENGTH, "%s%lu.bin", prefix, (unsigned long)slot);
+    }
+
+    void segmentPath(uint32_t segment, char* out) const {
+        slotPath(segment % TELEMETRY_LOG_SEGMENTS, out);
+    }
+
+    // Walking sequences in order: reopen only when the segment changes
+    bool openSegmentFor(File& file, uint32_t& openSegment, uint32_t sequence) const {
+        uint32_t segment = segmentOf(sequence);
+        if (segment != openSegment) {
+            if (file) {
+                file.close();
+            }
+            char name[PATH_LENGTH];
+            segmentPath(segment, name);
+            file = LittleFS.exists(name) ? LittleFS.open(name, "r") : File();
+            openSegment = segment;
+        }
+        return static_cast<bool>(file);
+    }
+
+    static bool readHeader(File& file, uint32_t sequence, TelemetryPageHeader& out) {
+        return file.seek(pageOffset(sequence)) &&
+               file.readBytes(reinterpret_cast<char*>(&out), sizeof(out)) == sizeof(out) &&
+               telemetryHeaderValid(out) &&
+               out.sequence == sequence;
+    }
+
+    static bool readPage(File& file, uint32_t sequence, TelemetryPage& out) {
+        return file.seek(pageOffset(sequence)) &&
+               file.readBytes(reinterpret_cast<char*>(&out), sizeof(out)) == sizeof(out) &&
+               telemetryHeaderValid(out.header) &&
+               out.header.sequence == sequence &&
+               out.header.payloadCrc == telemetryPayloadCrc(out);
+    }
+
+    // Scan one segment file's headers into the running newest/oldest
+    void scanSlot(uint32_t slot, uint32_t& newest, uint32_t& newestRecording, uint32_t& oldest) {
+        char name[PATH_LENGTH];
+        slotPath(slot, name);
+        if (!LittleFS.exists(name)) {
+            return;
+        }
+        File file = LittleFS.open(name, "r");
+        if (!file) {
+            return;
+        }
+
+        size_t size = file.size();
+        if (size > static_cast<size_t>(TELEMETRY_SEGMENT_PAGES) * TELEMETRY_PAGE_BYTES) {
+            file.close();
+            LOG_WARN(STORAGE, "  Telemetry segment %lu has an unexpected size - discarding", (unsigned long)slot);
+            LittleFS.remove(name);
+            return;
+        }
+        if (size % TELEMETRY_PAGE_BYTES != 0) {
+            damagedPages++;     // Torn append at the end
+        }
+
+        uint32_t pages = size / TELEMETRY_PAGE_BYTES;
+        for (uint32_t index = 0; index < pages; index++) {
+            TelemetryPageHeader header;
+            if (!file.seek(index * TELEMETRY_PAGE_BYTES) ||
+                file.readBytes(reinterpret_cast<char*>(&header), sizeof(header)) != sizeof(header) ||
+                !telemetryHeaderValid(header) ||
+                header.sequence == 0 ||
+                pageOffset(header.sequence) != index * TELEMETRY_PAGE_BYTES ||
+                segmentOf(header.sequence) % TELEMETRY_LOG_SEGMENTS != slot) {
+                damagedPages++;
+                continue;
+            }
+            if (header.sequence > newest) {
+                newest = header.sequence;
+                newestRecording = header.recording;
+            }
+            if (oldest == 0 || header.sequence < oldest) {
+                oldest = header.sequence;
+            }
+        }
+        file.close();
+    }
+
+public:
+    explicit TelemetryLogFile(const char* segmentPrefix = TELEMETRY_SEGMENT_PREFIX)
+        : prefix(segmentPrefix),
+          nextSequence(1),
+          oldestSequence(1),
+          currentRecording(0),
+          loaded(false),
+          damagedPages(0) {
+    }
+
+    /**
+     * Find the newest page by scanning the page headers of every segment
+     * (28 bytes each, one open per segment file). A segment larger than
+     * TELEMETRY_SEGMENT_PAGES is from another layout and is dropped, as is
+     * the single-file ring of older firmware. Storage worker's first pass
+     * (or a test) only.
+     * @return true (a segment that cannot be read is skipped)
+     */
+    bool load() {
+        loaded.store(false, std::memory_order_relaxed);
+        damagedPages = 0;
+
+        if (LittleFS.exists(LEGACY_TELEMETRY_FILE)) {
+            LOG_INFO(STORAGE, "  Removing single-file telemetry ring of older firmware");
+            LittleFS.remove(LEGACY_TELEMETRY_FILE);
+        }
+
+        uint32_t newest = 0;
+        uint32_t newestRecording = 0;
+        uint32_t oldest = 0;
+        for (uint32_t slot = 0; slot < TELEMETRY_LOG_SEGMENTS; slot++) {
+            scanSlot(slot, newest, newestRecording, oldest);
+        }
+
+        currentRecording.store(newestRecording, std::memory_order_relaxed);
+        oldestSequence.store(newest == 0 ? 1 : oldest, std::memory_order_relaxed);
+        nextSequence.store(newest + 1, std::memory_order_release);
+        loaded.store(true, std::memory_order_release);
+        if (damagedPages > 0) {
+            LOG_WARN(STORAGE, "  Telemetry log: %lu damaged pages skipped", (unsigned long)damagedPages);
+        }
+        return true;
+    }
+
+    /**
+     * Store `page` as the next page of the ring, at the end of the current
+     * segment file (or as the first page of a new one, deleting the oldest);
+     * fills in sequence, recording and the header CRC. Storage worker only.
+     */
+    bool append(TelemetryPage& page) {
+        uint32_t sequence = nextSequence.load(std::memory_order_relaxed);
+        uint32_t current = currentRecording.load(std::memory_order_relaxed);
+        uint32_t recording = (page.header.flags & TELEMETRY_PAGE_FIRST) || current == 0
+                           ? current + 1 : current;
+
+        char name[PATH_LENGTH];
+        segmentPath(segmentOf(sequence), name);
+        FlashWriteSession session(FlashFile::TELEMETRY);
+        File file;
+        if (pageOffset(sequence) != 0) {
+            file = LittleFS.open(name, "a");
+            if (!file || file.size() != pageOffset(sequence)) {
+                // A torn or missing page: appending here would misplace
+                // this one, so start the next segment instead
+                file.close();
+                sequence = segmentOf(sequence) * TELEMETRY_SEGMENT_PAGES + TELEMETRY_SEGMENT_PAGES + 1;
+                segmentPath(segmentOf(sequence), name);
+            }
+        }
+        if (pageOffset(sequence) == 0) {
+            uint32_t segment = segmentOf(sequence);
+            if (segment >= TELEMETRY_LOG_SEGMENTS) {
+                // Readers stop looking at the oldest segment before it goes
+                uint32_t oldest = (segment - TELEMETRY_LOG_SEGMENTS + 1) * TELEMETRY_SEGMENT_PAGES + 1;
+                if (oldest > oldestSequence.load(std::memory_order_relaxed)) {
+                    oldestSequence.store(oldest, std::memory_order_release);
+                }
+            }
+            if (LittleFS.exists(name)) {
+                LittleFS.remove(name);
+            }
+            file = LittleFS.open(name, "w");
+        }
+        if (!file) {
+            return false;
+        }
+
+        page.header.sequence = sequence;
+        page.header.recording = recording;
+        page.header.headerCrc = telemetryHeaderCrc(page.header);
+
+        size_t offset = pageOffset(sequence);
+        bool ok = file.write(reinterpret_cast<const uint8_t*>(&page), sizeof(page)) == sizeof(page);
+        session.wrote(offset, sizeof(page));
+        file.close();
+        if (!ok) {
+            return false;
+        }
+
+        currentRecording.store(recording, std::memory_order_release);
+        if (oldestSequence.load(std::memory_order_relaxed) == nextSequence.load(std::memory_order_relaxed)) {
+            oldestSequence.store(sequence, std::memory_order_release);   // First page of an empty log
+        }
+        nextSequence.store(sequence + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Recordings still (partly) in the log, oldest first, one segment file
+     * open at a time.
+     * @return entries stored in `out`
+     */
+    size_t listRecordings(TelemetryRecordingInfo* out, size_t maxEntries) const {
+        uint32_t next = nextSequence.load(std::memory_order_acquire);
+        uint32_t oldest = oldestSequence.load(std::memory_order_acquire);
+        if (oldest >= next || maxEntries == 0) {
+            return 0;
+        }
+
+        File file;
+        uint32_t openSegment = UINT32_MAX;
+        size_t count = 0;
+        for (uint32_t sequence = oldest; sequence < next; sequence++) {
+            TelemetryPageHeader header;
+            if (!openSegmentFor(file, openSegment, sequence) || !readHeader(file, sequence, header)) {
+                continue;
+            }
+            if (count == 0 || out[count - 1].recording != header.recording) {
+                if (count == maxEntries) {
+                    // Keep the newest: drop the oldest entry
+                    memmove(out, out + 1, (maxEntries - 1) * sizeof(*out));
+                    count--;
+                }
+                TelemetryRecordingInfo& info = out[count++];
+                info.recording = header.recording;
+                info.firstSequence = sequence;
+                info.firstSample = header.firstSample;
+                info.samples = 0;
+                info.pages = 0;
+            }
+            out[count - 1].samples += header.sampleCount;
+            out[count - 1].pages++;
+        }
+        if (file) {
+            file.close();
+        }
+        return count;
+    }
+
+    /**
+     * Every stored page of `recording`, in order, one segment file open
+     * at a time.
+     * Pages that fail their CRC are skipped.
+     * @return pages passed to `visit`
+     */
+    template <typename Visitor>
+    size_t forEachPage(uint32_t recording, Visitor visit) const {
+        uint32_t next = nextSequence.load(std::memory_order_acquire);
+        uint32_t oldest = oldestSequence.load(std::memory_order_acquire);
+        if (oldest >= next) {
+            return 0;
+        }
+
+        File file;
+        uint32_t openSegment = UINT32_MAX;
+        size_t visited = 0;
+        TelemetryPage page;
+        for (uint32_t sequence = oldest; sequence < next; sequence++) {
+            TelemetryPageHeader header;
+            if (!openSegmentFor(file, openSegment, sequence) ||
+                !readHeader(file, sequence, header) || header.recording != recording) {
+                continue;
+            }
+            if (readPage(file, sequence, page)) {
+                visit(page);
+                visited++;
+            }
+        }
+        if (file) {
+            file.close();
+        }
+        return visited;
+    }
+
+    /**
+     * Resumable read for streaming a recording out a little at a time:
+     * the first intact page of `recording` at or after `sequence`, reading
+     * at most `maxHeaders` page headers. On FOUND `sequence` is the page's;
+     * continue from sequence + 1. Stops at the first page of a later
+     * recording (recordings only grow with the sequence).
+     */
+    TelemetryScan findPage(uint32_t recording, uint32_t& sequence, TelemetryPage& out,
+                           uint16_t maxHeaders) const {
+        uint32_t next = nextSequence.load(std::memory_order_acquire);
+        uint32_t oldest = oldestSequence.load(std::memory_order_acquire);
+        if (sequence < oldest) {
+            sequence = oldest;      // Rotated out meanwhile
+        }
+
+        File file;
+        uint32_t openSegment = UINT32_MAX;
+        TelemetryScan result = TelemetryScan::PENDING;
+        for (uint16_t read = 0; read < maxHeaders; read++, sequence++) {
+            if (sequence >= next) {
+                result = TelemetryScan::END;
+                break;
+            }
+            TelemetryPageHeader header;
+            if (!openSegmentFor(file, openSegment, sequence) || !readHeader(file, sequence, header)) {
+                continue;
+            }
+            if (header.recording > recording) {
+                result = TelemetryScan::END;
+                break;
+            }
+            if (header.recording == recording && readPage(file, sequence, out)) {
+                result = TelemetryScan::FOUND;
+                break;
+            }
+        }
+        if (file) {
+            file.close();
+        }
+        return result;
+    }
+
+    // load() has run: the counts below describe the file
+    bool isLoaded() const {
+        return loaded.load(std::memory_order_acquire);
+    }
+
+    // Number of the newest recording (0 = none yet)
+    uint32_t getLatestRecording() const {
+        return currentRecording.load(std::memory_order_acquire);
+    }
+
+    uint32_t getPageCount() const {
+        uint32_t next = nextSequence.load(std::memory_order_acquire);
+        return next - oldestSequence.load(std::memory_order_acquire);
+    }
+
+    // Flash taken by the stored pages, across all segment files
+    size_t getFileBytes() const {
+        return static_cast<size_t>(getPageCount()) * TELEMETRY_PAGE_BYTES;
+    }
+
+    uint32_t getDamagedPages() const {
+        return damagedPages;
+    }
+};
+
+#endif
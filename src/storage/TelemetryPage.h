@@ -0,0 +1,91 @@
+#ifndef TELEMETRY_PAGE_H
+#define TELEMETRY_PAGE_H
+
+#include "Crc32.h"
+#include "../Config.h"
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+constexpr uint8_t TELEMETRY_PAGE_FIRST = 0x01;   // Page opens a new recording
+
+/**
+ * Header of one telemetry page as stored (28 bytes, little-endian).
+ * The header has its own CRC so load() can index the log from headers
+ * alone; `payloadCrc` is checked when the page is decoded.
+ */
+struct TelemetryPageHeader {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t flags;              // TELEMETRY_PAGE_*
+    uint32_t sequence;          // Page number in the log: 1, 2, 3 ... never reused
+    uint32_t recording;         // Recording (one per heated stretch of a cycle), assigned by the log
+    uint32_t firstSample;       // Index of the page's first sample within its recording
+    uint16_t sampleCount;
+    uint16_t payloadBytes;
+    uint32_t payloadCrc;
+    uint32_t headerCrc;
+};
+
+static_assert(sizeof(TelemetryPageHeader) == 28, "TelemetryPageHeader layout changed");
+
+constexpr size_t TELEMETRY_PAYLOAD_BYTES = TELEMETRY_PAGE_BYTES - sizeof(TelemetryPageHeader);
+
+/**
+ * One flash page of telemetry: the header, then the delta-encoded samples
+ * (TelemetryCodec.h). Every page starts with a keyframe, so it decodes
+ * on its own.
+ */
+struct TelemetryPage {
+    TelemetryPageHeader header;
+    uint8_t payload[TELEMETRY_PAYLOAD_BYTES];
+};
+
+static_assert(sizeof(TelemetryPage) == TELEMETRY_PAGE_BYTES, "TelemetryPage must be exactly one flash page");
+
+constexpr uint16_t TELEMETRY_PAGE_MAGIC = 0x4C54;   // "TL"
+constexpr uint8_t TELEMETRY_PAGE_VERSION = 1;
+
+inline uint32_t telemetryHeaderCrc(const TelemetryPageHeader& header) {
+    return crc32(&header, offsetof(TelemetryPageHeader, headerCrc));
+}
+
+inline uint32_t telemetryPayloadCrc(const TelemetryPage& page) {
+    size_t length = page.header.payloadBytes <= TELEMETRY_PAYLOAD_BYTES
+                  ? page.header.payloadBytes : TELEMETRY_PAYLOAD_BYTES;
+    return crc32(page.payload, length);
+}
+
+inline bool telemetryHeaderValid(const TelemetryPageHeader& header) {
+    return header.magic == TELEMETRY_PAGE_MAGIC &&
+           header.version == TELEMETRY_PAGE_VERSION &&
+           header.sequence != 0 &&
+           header.payloadBytes <= TELEMETRY_PAYLOAD_BYTES &&
+           header.headerCrc == telemetryHeaderCrc(header);
+}
+
+/**
+ * One half of the recorder's double buffer. The producer (Dryer) fills
+ * `page` and marks it pending when it hands it to storage; the storage
+ * worker writes it and calls release(). The producer never touches a
+ * pending buffer.
+ */
+struct TelemetryPageBuffer {
+    TelemetryPage page;
+    std::atomic<bool> pending;
+
+    TelemetryPageBuffer() : pending(false) {
+        memset(&page, 0, sizeof(page));
+    }
+
+    bool isPending() const {
+        return pending.load(std::memory_order_acquire);
+    }
+
+    void release() {
+        pending.store(false, std::memory_order_release);
+    }
+};
+
+#endif
@@ -4,7 +4,6 @@
 #include "../interfaces/IButtonManager.h"
 #include "../Config.h"
 #include <OneButton.h>
-#include <map>
 
 /**
  * ButtonManager - OneButton wrapper with callback system
@@ -19,8 +18,9 @@ private:
     OneButton upButton;
     OneButton downButton;
 
-    // Callback storage per button type
-    std::map<ButtonType, ButtonCallback> callbacks;
+    // One callback slot per button type, indexed by ButtonType
+    static constexpr uint8_t BUTTON_COUNT = 3;
+    ButtonCallback callbacks[BUTTON_COUNT];
 
     // Static callback wrappers (OneButton requires static functions)
     static ButtonManager* instance;
@@ -50,9 +50,9 @@ private:
     }
 
     void fireCallback(ButtonType button, ButtonEvent event) {
-        auto it = callbacks.find(button);
-        if (it != callbacks.end() && it->second) {
-            it->second(event);
+        const ButtonCallback& callback = callbacks[static_cast<uint8_t>(button)];
+        if (callback) {
+            callback(event);
         }
     }
 
@@ -97,7 +97,7 @@ public:
     }
 
     void registerButtonCallback(ButtonType button, ButtonCallback callback) override {
-        callbacks[button] = callback;
+        callbacks[static_cast<uint8_t>(button)] = callback;
     }
 
     bool isButtonPressed(ButtonType button) const override {
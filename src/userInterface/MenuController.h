@@ -3,6 +3,8 @@
 
 #include "../interfaces/IMenuController.h"
 #include "../Config.h"
+#include "../events/EventBus.h"
+#include "../events/Events.h"
 #include <vector>
 
 /**
@@ -44,18 +46,24 @@ private:
     // Current remaining time for adjust timer (in seconds)
     uint32_t currentRemainingTime;
 
+    // Last reference mass used for scale calibration (grams)
+    int scaleCalibrationMass;
+
+    // Latest heap/stack health (System Info); sampleCount 0 = none yet
+    HealthStats healthStats;
+
+    // Newest finished cycles (History), newest first
+    CycleRecord recentCycles[CYCLE_HISTORY_SCREEN_ENTRIES];
+    uint8_t recentCycleCount;
+
     // Callbacks
-    std::vector<MenuSelectionCallback> callbacks;
+    EventBus<MenuSelectionEvent> selectionBus;
 
     // Menu navigation history (for back navigation)
     std::vector<MenuPath> menuHistory;
 
     void notifyCallbacks(MenuPath path, int value) {
-        for (auto& callback : callbacks) {
-            if (callback) {
-                callback(path, value);
-            }
-        }
+        selectionBus.publish(path, value);
     }
 
     void navigateUp() {
@@ -139,6 +147,9 @@ private:
             case MenuPath::CUSTOM_OVERSHOOT:
                 customDraft.overshoot = editValue;
                 break;
+            case MenuPath::SCALE_CALIBRATE:
+                scaleCalibrationMass = editValue;
+                break;
             case MenuPath::ADJUST_TIMER:
                 // Notify with the new value in minutes
                 notifyCallbacks(editingItem.path, editValue);
@@ -264,6 +275,20 @@ private:
         sound.path = soundEnabled ? MenuPath::SOUND_OFF : MenuPath::SOUND_ON;
         items.push_back(sound);
 
+        MenuItem scale;
+        scale.label = "Scale";
+        scale.type = MenuItemType::SUBMENU;
+        scale.path = MenuPath::SCALE;
+        scale.submenuPath = MenuPath::SCALE;
+        items.push_back(scale);
+
+        MenuItem history;
+        history.label = "History";
+        history.type = MenuItemType::SUBMENU;
+        history.path = MenuPath::HISTORY;
+        history.submenuPath = MenuPath::HISTORY;
+        items.push_back(history);
+
         MenuItem sysInfo;
         sysInfo.label = "System Info";
         sysInfo.type = MenuItemType::SUBMENU;
@@ -421,9 +446,121 @@ private:
         return items;
     }
 
+    /**
+     * Tare with the holder empty, then put a known mass on it and
+     * confirm Calibrate with that mass
+     */
+    std::vector<MenuItem> getScaleMenu() {
+        std::vector<MenuItem> items;
+
+        MenuItem tare;
+        tare.label = "Tare";
+        tare.type = MenuItemType::ACTION;
+        tare.path = MenuPath::SCALE_TARE;
+        items.push_back(tare);
+
+        MenuItem calibrate;
+        calibrate.label = "Calibrate";
+        calibrate.type = MenuItemType::VALUE_EDIT;
+        calibrate.path = MenuPath::SCALE_CALIBRATE;
+        calibrate.currentValue = scaleCalibrationMass;
+        calibrate.minValue = SCALE_MIN_CAL_MASS_G;
+        calibrate.maxValue = SCALE_MAX_CAL_MASS_G;
+        calibrate.step = SCALE_CAL_MASS_STEP_G;
+        calibrate.unit = "g";
+        items.push_back(calibrate);
+
+        MenuItem back;
+        back.label = "Back";
+        back.type = MenuItemType::ACTION;
+        back.path = MenuPath::BACK;
+        items.push_back(back);
+
+        return items;
+    }
+
+    void addInfoItem(std::vector<MenuItem>& items, const String& label, int value, const char* unit) {
+        MenuItem item;
+        item.label = label;
+        item.type = MenuItemType::ACTION;
+        item.path = MenuPath::SYSTEM_INFO;
+        item.currentValue = value;
+        item.unit = unit;
+        items.push_back(item);
+    }
+
+    // "#12 PLA FINISHED"
+    static String formatCycleTitle(const CycleRecord& cycle) {
+        String preset;
+        switch (static_cast<PresetType>(cycle.preset)) {
+            case PresetType::PLA: preset = "PLA"; break;
+            case PresetType::PETG: preset = "PETG"; break;
+            default: preset = "CUST"; break;
+        }
+        return String("#") + String((unsigned long)cycle.id) + " " + preset + " " +
+               cycleEndReasonName(cycle.endReason);
+    }
+
+    // "4h05 50C 35Wh 42>18%"
+    static String formatCycleDetail(const CycleRecord& cycle) {
+        uint32_t minutes = cycle.duration / 60;
+        String mm = String((unsigned long)(minutes % 60));
+        if (mm.length() < 2) {
+            mm = "0" + mm;
+        }
+        return String((unsigned long)(minutes / 60)) + "h" + mm + " " +
+               String((int)(cycle.getBoxTempMean() + 0.5f)) + "C " +
+               String((int)(cycle.energyWh + 0.5f)) + "Wh " +
+               String((int)(cycle.getHumidityStart() + 0.5f)) + ">" +
+               String((int)(cycle.getHumidityEnd() + 0.5f)) + "%";
+    }
+
+    std::vector<MenuItem> getHistoryMenu() {
+        std::vector<MenuItem> items;
+
+        // One item per cycle: title (line 1) + summary in the unit (line 2)
+        for (uint8_t i = 0; i < recentCycleCount; i++) {
+            MenuItem item;
+            item.label = formatCycleTitle(recentCycles[i]);
+            item.type = MenuItemType::ACTION;
+            item.path = MenuPath::HISTORY;
+            item.currentValue = (int)recentCycles[i].id;
+            item.unit = formatCycleDetail(recentCycles[i]);
+            items.push_back(item);
+        }
+        if (recentCycleCount == 0) {
+            MenuItem none;
+            none.label = "No cycles yet";
+            none.type = MenuItemType::ACTION;
+            none.path = MenuPath::HISTORY;
+            items.push_back(none);
+        }
+
+        MenuItem back;
+        back.label = "Back";
+        back.type = MenuItemType::ACTION;
+        back.path = MenuPath::BACK;
+        items.push_back(back);
+
+        return items;
+    }
+
     std::vector<MenuItem> getSystemInfoMenu() {
         std::vector<MenuItem> items;
 
+        // Runtime health first (latest sample, minima since boot)
+        if (healthStats.sampleCount > 0) {
+            addInfoItem(items, "FREE_HEAP", healthStats.freeHeap, "B");
+            addInfoItem(items, "MIN_FREE_HEAP", healthStats.minEverFreeHeap, "B");
+            addInfoItem(items, "LARGEST_BLOCK", healthStats.largestFreeBlock, "B");
+            addInfoItem(items, "MIN_LARGEST_BLK", healthStats.minLargestFreeBlock, "B");
+            addInfoItem(items, "HEAP_FRAG", healthStats.fragmentationPercent, "%");
+            for (uint8_t i = 0; i < healthStats.taskCount; i++) {
+                addInfoItem(items, String("STACK_") + healthStats.tasks[i].name,
+                            healthStats.tasks[i].freeBytes, "B");
+            }
+        }
+
         // Create info items showing config values
         MenuItem stateSave;
         stateSave.label = "STATE_SAVE_INT";
@@ -521,13 +658,16 @@ public:
         : currentMenu(MenuPath::ROOT),
           currentSelection(0),
           inEditMode(false),
+          editValue(240),  // Default 4 hours in minutes
           minTemp(MIN_TEMP),
           maxTemp(MAX_BOX_TEMP),
           maxTime(MAX_TIME_SECONDS),
           maxOvershoot(DEFAULT_MAX_OVERSHOOT),
           currentPIDProfile("NORMAL"),
           soundEnabled(true),
-          currentRemainingTime(14400) {  // Default 4 hours
+          currentRemainingTime(14400),  // Default 4 hours
+          scaleCalibrationMass(SCALE_DEFAULT_CAL_MASS_G),
+          recentCycleCount(0) {
 
         customDraft.temp = PRESET_CUSTOM_TEMP;
         customDraft.time = PRESET_CUSTOM_TIME;
@@ -554,6 +694,10 @@ public:
                 return getCustomPresetMenu();
             case MenuPath::PID_PROFILE:
                 return getPIDProfileMenu();
+            case MenuPath::SCALE:
+                return getScaleMenu();
+            case MenuPath::HISTORY:
+                return getHistoryMenu();
             case MenuPath::SYSTEM_INFO:
                 return getSystemInfoMenu();
             default:
@@ -586,8 +730,19 @@ public:
         currentRemainingTime = seconds;
     }
 
+    void setHealthStats(const HealthStats& health) override {
+        healthStats = health;
+    }
+
+    void setCycleHistory(const CycleRecord* cycles, uint8_t count) override {
+        recentCycleCount = count < CYCLE_HISTORY_SCREEN_ENTRIES ? count : CYCLE_HISTORY_SCREEN_ENTRIES;
+        for (uint8_t i = 0; i < recentCycleCount; i++) {
+            recentCycles[i] = cycles[i];
+        }
+    }
+
     void registerSelectionCallback(MenuSelectionCallback callback) override {
-        callbacks.push_back(callback);
+        selectionBus.subscribe(callback);
     }
 
     void reset() override {
@@ -40,6 +40,22 @@ public:
         oledDisplay.clearDisplay();
     }
 
+    void setPowerMode(DisplayPowerMode mode) override {
+        switch (mode) {
+            case DisplayPowerMode::NORMAL:
+                oledDisplay.ssd1306_command(SSD1306_DISPLAYON);
+                oledDisplay.dim(false);
+                break;
+            case DisplayPowerMode::DIMMED:
+                oledDisplay.ssd1306_command(SSD1306_DISPLAYON);
+                oledDisplay.dim(true);
+                break;
+            case DisplayPowerMode::OFF:
+                oledDisplay.ssd1306_command(SSD1306_DISPLAYOFF);
+                break;
+        }
+    }
+
     void display() override {
         oledDisplay.display();
     }
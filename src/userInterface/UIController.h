@@ -6,7 +6,10 @@
 #include "../interfaces/IButtonManager.h"
 #include "../interfaces/ISoundController.h"
 #include "../interfaces/IDryer.h"
+#include "../interfaces/IPowerManager.h"
 #include "../Config.h"
+#include "../diagnostics/PerfCounters.h"
+#include "../diagnostics/Log.h"
 
 /**
  * UIController - Main UI coordinator
@@ -26,6 +29,7 @@ private:
     IButtonManager* buttonManager;
     ISoundController* soundController;
     IDryer* dryer;
+    IPowerManager* powerManager;  // Optional - idle dimming/sleep
 
     // Timing - stored from update() for use in callbacks
     uint32_t currentTime;
@@ -45,11 +49,17 @@ private:
         HEATER_TEMP,        // Large heater temp with "H:" prefix
         STATUS_OVERVIEW,    // State, Elapsed, Fan, Sound (all size 1)
         PRESET_CONFIG,      // Preset, PID, Temp/Overshoot, Target time (all size 1)
-        SENSOR_READINGS     // Box, Heater, PID/PWM_MAX, Humidity (all size 1)
+        SENSOR_READINGS,    // Box, Heater, PID/PWM_MAX, Humidity (all size 1)
+        HUMIDITY_ANALYSIS   // Absolute humidity, Dew point, Water removed, RH (all size 1)
     };
 
+    static constexpr StatsScreen LAST_STATS_SCREEN = StatsScreen::HUMIDITY_ANALYSIS;
+
     StatsScreen currentStatsScreen;
 
+    // Boot splash: rendering held until this time (0 = no splash)
+    uint32_t splashUntil;
+
     // Inactivity timeout for menu
     uint32_t lastMenuActivity;
     static constexpr uint32_t MENU_TIMEOUT_MS = 30000;  // 30 seconds
@@ -62,18 +72,20 @@ private:
         float boxTemp;
         float heaterTemp;
         float boxHumidity;
+        float waterRemoved;
         uint32_t remainingTime;
         DryerState state;
         PresetType preset;
 
         CachedDisplayValues()
-            : boxTemp(-999), heaterTemp(-999), boxHumidity(-999),
+            : boxTemp(-999), heaterTemp(-999), boxHumidity(-999), waterRemoved(-999),
               remainingTime(0), state(DryerState::READY), preset(PresetType::PLA) {}
 
         bool operator!=(const CachedDisplayValues& other) const {
             return (abs(boxTemp - other.boxTemp) > 0.05f) ||
                    (abs(heaterTemp - other.heaterTemp) > 0.05f) ||
                    (abs(boxHumidity - other.boxHumidity) > 0.5f) ||
+                   (abs(waterRemoved - other.waterRemoved) > 0.05f) ||
                    (remainingTime != other.remainingTime) ||
                    (state != other.state) ||
                    (preset != other.preset);
@@ -87,16 +99,18 @@ private:
 
     void setupButtonCallbacks() {
         if (!buttonManager) {
-            Serial.println("ERROR: Cannot setup button callbacks - buttonManager is null!");
+            LOG_ERROR(UI, "ERROR: Cannot setup button callbacks - buttonManager is null!");
             return;
         }
 
-        Serial.println("    Registering SET button...");
+        LOG_INFO(UI, "    Registering SET button...");
         // SET button
         buttonManager->registerButtonCallback(ButtonType::SET,
             [this](ButtonEvent event) {
                 lastMenuActivity = currentTime;  // Use stored currentTime
                 displayNeedsUpdate = true;
+                splashUntil = 0;  // Any button dismisses the splash
+                if (powerManager) powerManager->notifyActivity(currentTime);
 
                 if (currentMode == UIMode::HOME) {
                     if (event == ButtonEvent::SINGLE_CLICK) {
@@ -126,12 +140,14 @@ private:
             }
         );
 
-        Serial.println("    Registering UP button...");
+        LOG_INFO(UI, "    Registering UP button...");
         // UP button
         buttonManager->registerButtonCallback(ButtonType::UP,
             [this](ButtonEvent event) {
                 lastMenuActivity = currentTime;  // Use stored currentTime
                 displayNeedsUpdate = true;
+                splashUntil = 0;  // Any button dismisses the splash
+                if (powerManager) powerManager->notifyActivity(currentTime);
 
                 if (event == ButtonEvent::SINGLE_CLICK) {
                     if (currentMode == UIMode::HOME) {
@@ -146,12 +162,14 @@ private:
             }
         );
 
-        Serial.println("    Registering DOWN button...");
+        LOG_INFO(UI, "    Registering DOWN button...");
         // DOWN button
         buttonManager->registerButtonCallback(ButtonType::DOWN,
             [this](ButtonEvent event) {
                 lastMenuActivity = currentTime;  // Use stored currentTime
                 displayNeedsUpdate = true;
+                splashUntil = 0;  // Any button dismisses the splash
+                if (powerManager) powerManager->notifyActivity(currentTime);
 
                 if (event == ButtonEvent::SINGLE_CLICK) {
                     if (currentMode == UIMode::HOME) {
@@ -166,7 +184,7 @@ private:
             }
         );
 
-        Serial.println("    Button callbacks registered successfully!");
+        LOG_INFO(UI, "    Button callbacks registered successfully!");
     }
 
     void setupMenuCallbacks() {
@@ -188,6 +206,7 @@ private:
                     newValues.boxTemp = stats.boxTemp;
                     newValues.heaterTemp = stats.currentTemp;
                     newValues.boxHumidity = stats.boxHumidity;
+                    newValues.waterRemoved = stats.waterRemoved;
                     newValues.remainingTime = stats.remainingTime;
                     newValues.state = stats.state;
                     newValues.preset = stats.activePreset;
@@ -233,13 +252,13 @@ private:
 
         if (forward) {
             current++;
-            if (current > (int)StatsScreen::SENSOR_READINGS) {
+            if (current > (int)LAST_STATS_SCREEN) {
                 current = 0;
             }
         } else {
             current--;
             if (current < 0) {
-                current = (int)StatsScreen::SENSOR_READINGS;
+                current = (int)LAST_STATS_SCREEN;
             }
         }
 
@@ -357,6 +376,19 @@ private:
                 menuController->setSoundEnabled(false);
                 break;
 
+            case MenuPath::SCALE_TARE:
+                // Only confirm audibly when the scale accepted it
+                if (dryer->tareScale() && soundController) {
+                    soundController->playConfirm();
+                }
+                break;
+
+            case MenuPath::SCALE_CALIBRATE:
+                if (dryer->calibrateScale(value) && soundController) {
+                    soundController->playConfirm();
+                }
+                break;
+
             case MenuPath::BACK:
                 // Check if we're at the root menu
                 if (menuController->getCurrentMenuPath() == MenuPath::ROOT) {
@@ -402,6 +434,10 @@ private:
             case StatsScreen::SENSOR_READINGS:
                 renderSensorReadingsScreen();
                 break;
+
+            case StatsScreen::HUMIDITY_ANALYSIS:
+                renderHumidityAnalysisScreen();
+                break;
         }
 
         display->display();
@@ -629,6 +665,34 @@ private:
         display->print("%");
     }
 
+    void renderHumidityAnalysisScreen() {
+        display->setTextSize(1);
+
+        // Line 0 (Y=0): Absolute humidity
+        display->setCursor(0, 0);
+        display->print("AH: ");
+        display->print(String(lastStats.absoluteHumidity, 1));
+        display->print(" g/m3");
+
+        // Line 1 (Y=8): Dew point
+        display->setCursor(0, 8);
+        display->print("Dew: ");
+        display->print(String(lastStats.dewPoint, 1));
+        display->print("C");
+
+        // Line 2 (Y=16): Estimated water removed this cycle
+        display->setCursor(0, 16);
+        display->print("Water: ");
+        display->print(String(lastStats.waterRemoved, 1));
+        display->print(" g");
+
+        // Line 3 (Y=24): Relative humidity for reference
+        display->setCursor(0, 24);
+        display->print("RH: ");
+        display->print(String(lastStats.boxHumidity, 0));
+        display->print("%");
+    }
+
     void renderMenuScreen() {
         display->clear();
 
@@ -651,6 +715,10 @@ private:
             // System info: show as scrollable label + value list
             renderSystemInfoScreen();
         }
+        else if (menuController->getCurrentMenuPath() == MenuPath::HISTORY) {
+            // History: one finished cycle per page
+            renderHistoryScreen();
+        }
         else {
             // Navigation mode: show menu items
             std::vector<MenuItem> items = menuController->getCurrentMenuItems();
@@ -742,6 +810,34 @@ private:
         display->display();
     }
 
+    void renderHistoryScreen() {
+        // One cycle per page: title (line 1) + summary (line 2), both small
+        std::vector<MenuItem> items = menuController->getCurrentMenuItems();
+        int selection = menuController->getCurrentSelection();
+
+        if (items.empty() || selection >= (int)items.size()) {
+            display->display();
+            return;
+        }
+
+        MenuItem currentItem = items[selection];
+
+        if (currentItem.path == MenuPath::BACK) {
+            display->setTextSize(2);
+            display->setCursor(0, 8);
+            display->print("Back");
+        } else {
+            display->setTextSize(1);
+            display->setCursor(0, 4);
+            display->print(currentItem.label);
+
+            display->setCursor(0, 18);
+            display->print(currentItem.unit);
+        }
+
+        display->display();
+    }
+
     void checkMenuTimeout(uint32_t currentMillis) {
         if (currentMode == UIMode::MENU) {
             if (currentMillis - lastMenuActivity >= MENU_TIMEOUT_MS) {
@@ -755,15 +851,18 @@ public:
                  IMenuController* menu,
                  IButtonManager* buttons,
                  ISoundController* sound,
-                 IDryer* dryerInstance)
+                 IDryer* dryerInstance,
+                 IPowerManager* power = nullptr)
         : display(disp),
           menuController(menu),
           buttonManager(buttons),
           soundController(sound),
           dryer(dryerInstance),
+          powerManager(power),
           currentTime(0),
           currentMode(UIMode::HOME),
           currentStatsScreen(StatsScreen::BOX_TEMP),
+          splashUntil(0),
           lastMenuActivity(0),
           displayNeedsUpdate(true) {
     }
@@ -771,26 +870,26 @@ public:
     void begin() {
         // Validate all required components are present
         if (!display) {
-            Serial.println("ERROR: Display is null!");
+            LOG_ERROR(UI, "ERROR: Display is null!");
             return;
         }
         if (!menuController) {
-            Serial.println("ERROR: MenuController is null!");
+            LOG_ERROR(UI, "ERROR: MenuController is null!");
             return;
         }
         if (!buttonManager) {
-            Serial.println("ERROR: ButtonManager is null!");
+            LOG_ERROR(UI, "ERROR: ButtonManager is null!");
             return;
         }
         if (!dryer) {
-            Serial.println("ERROR: Dryer is null!");
+            LOG_ERROR(UI, "ERROR: Dryer is null!");
             return;
         }
 
-        Serial.println("UIController::begin() - Starting initialization...");
+        LOG_INFO(UI, "UIController::begin() - Starting initialization...");
 
         // Pass constraints from Dryer to MenuController
-        Serial.println("  Setting constraints...");
+        LOG_INFO(UI, "  Setting constraints...");
         menuController->setConstraints(
             dryer->getMinTemp(),
             dryer->getMaxTemp(),
@@ -799,7 +898,7 @@ public:
         );
 
         // Initialize menu with current custom preset values
-        Serial.println("  Setting custom preset values...");
+        LOG_INFO(UI, "  Setting custom preset values...");
         DryingPreset preset = dryer->getCustomPreset();
         menuController->setCustomPresetValues(
             preset.targetTemp,
@@ -808,7 +907,7 @@ public:
         );
 
         // Set initial PID profile name
-        Serial.println("  Setting PID profile...");
+        LOG_INFO(UI, "  Setting PID profile...");
         switch (dryer->getPIDProfile()) {
             case PIDProfile::SOFT:
                 menuController->setPIDProfile("SOFT");
@@ -822,32 +921,33 @@ public:
         }
 
         // Set sound state
-        Serial.println("  Setting sound state...");
+        LOG_INFO(UI, "  Setting sound state...");
         menuController->setSoundEnabled(dryer->isSoundEnabled());
 
         // Setup callbacks
-        Serial.println("  Setting up button callbacks...");
+        LOG_INFO(UI, "  Setting up button callbacks...");
         setupButtonCallbacks();
 
-        Serial.println("  Setting up menu callbacks...");
+        LOG_INFO(UI, "  Setting up menu callbacks...");
         setupMenuCallbacks();
 
-        Serial.println("  Setting up dryer callbacks...");
+        LOG_INFO(UI, "  Setting up dryer callbacks...");
         setupDryerCallbacks();
 
         // Initialize display with current stats
-        Serial.println("  Getting initial stats...");
+        LOG_INFO(UI, "  Getting initial stats...");
         lastStats = dryer->getCurrentStats();
 
         // Initialize cached values
         cachedValues.boxTemp = lastStats.boxTemp;
         cachedValues.heaterTemp = lastStats.currentTemp;
         cachedValues.boxHumidity = lastStats.boxHumidity;
+        cachedValues.waterRemoved = lastStats.waterRemoved;
         cachedValues.remainingTime = lastStats.remainingTime;
         cachedValues.state = lastStats.state;
         cachedValues.preset = lastStats.activePreset;
 
-        Serial.println("UIController::begin() - Initialization complete!");
+        LOG_INFO(UI, "UIController::begin() - Initialization complete!");
     }
 
     void update(uint32_t currentMillis) {
@@ -860,17 +960,45 @@ public:
         // Check menu timeout
         checkMenuTimeout(currentMillis);
 
+        // Boot splash stays up until it times out or a button is pressed
+        if (splashUntil != 0) {
+            if (static_cast<int32_t>(currentMillis - splashUntil) < 0) {
+                return;
+            }
+            splashUntil = 0;
+            displayNeedsUpdate = true;
+        }
+
+        // Display is off while sleeping - keep the dirty flag for wake-up
+        if (powerManager && powerManager->getMode() == PowerMode::SLEEPING) {
+            return;
+        }
+
         // Only render if display needs update (dirty flag optimization)
         if (displayNeedsUpdate) {
             if (currentMode == UIMode::HOME) {
+                PERF_SCOPE(PerfZone::UI_RENDER_HOME);
                 renderHomeScreen();
             } else {
+                PERF_SCOPE(PerfZone::UI_RENDER_MENU);
                 renderMenuScreen();
             }
             displayNeedsUpdate = false;  // Clear dirty flag
         }
     }
 
+    /**
+     * Keep whatever is on screen (the boot splash) until untilMillis
+     * without blocking; buttons are still polled and dismiss it early
+     */
+    void holdSplashUntil(uint32_t untilMillis) {
+        splashUntil = untilMillis;
+    }
+
+    bool isSplashActive() const {
+        return splashUntil != 0;
+    }
+
     // Getters for debugging
     bool isInMenuMode() const {
         return currentMode == UIMode::MENU;
@@ -15,6 +15,7 @@ private:
     uint32_t clearCallCount;
     uint32_t displayCallCount;
     uint32_t showSensorReadingsCallCount;
+    DisplayPowerMode powerMode;
 
     // Last values shown
     float lastHeaterTemp;
@@ -42,6 +43,7 @@ public:
           clearCallCount(0),
           displayCallCount(0),
           showSensorReadingsCallCount(0),
+          powerMode(DisplayPowerMode::NORMAL),
           lastHeaterTemp(0),
           lastHeaterValid(false),
           lastBoxTemp(0),
@@ -98,12 +100,17 @@ public:
         currentCursorY += 8 * currentTextSize; // Simulate newline
     }
 
+    void setPowerMode(DisplayPowerMode mode) override {
+        powerMode = mode;
+    }
+
     // ==================== Test Helper Methods ====================
 
     bool isInitialized() const { return initialized; }
     uint32_t getClearCallCount() const { return clearCallCount; }
     uint32_t getDisplayCallCount() const { return displayCallCount; }
     uint32_t getShowSensorReadingsCallCount() const { return showSensorReadingsCallCount; }
+    DisplayPowerMode getPowerMode() const { return powerMode; }
 
     float getLastHeaterTemp() const { return lastHeaterTemp; }
     bool getLastHeaterValid() const { return lastHeaterValid; }
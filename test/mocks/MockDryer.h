@@ -32,6 +32,9 @@ private:
     uint32_t stopCallCount;
     uint32_t adjustRemainingTimeCallCount;
     int32_t lastAdjustRemainingTimeDelta;
+    uint32_t tareScaleCallCount;
+    uint32_t calibrateScaleCallCount;
+    float lastCalibrationMass;
 
 public:
     MockDryer()
@@ -47,7 +50,10 @@ public:
           resetCallCount(0),
           stopCallCount(0),
           adjustRemainingTimeCallCount(0),
-          lastAdjustRemainingTimeDelta(0) {
+          lastAdjustRemainingTimeDelta(0),
+          tareScaleCallCount(0),
+          calibrateScaleCallCount(0),
+          lastCalibrationMass(0) {
 
         customPreset.targetTemp = 50.0;
         customPreset.targetTime = 14400;
@@ -172,6 +178,17 @@ public:
         soundEnabled = enabled;
     }
 
+    bool tareScale() override {
+        tareScaleCallCount++;
+        return true;
+    }
+
+    bool calibrateScale(float knownMassGrams) override {
+        calibrateScaleCallCount++;
+        lastCalibrationMass = knownMassGrams;
+        return true;
+    }
+
     bool isSoundEnabled() const override {
         return soundEnabled;
     }
@@ -247,6 +264,9 @@ public:
     uint32_t getStopCallCount() const { return stopCallCount; }
     uint32_t getAdjustRemainingTimeCallCount() const { return adjustRemainingTimeCallCount; }
     int32_t getLastAdjustRemainingTimeDelta() const { return lastAdjustRemainingTimeDelta; }
+    uint32_t getTareScaleCallCount() const { return tareScaleCallCount; }
+    uint32_t getCalibrateScaleCallCount() const { return calibrateScaleCallCount; }
+    float getLastCalibrationMass() const { return lastCalibrationMass; }
 
     size_t getStateCallbackCount() const { return stateCallbacks.size(); }
     size_t getStatsCallbackCount() const { return statsCallbacks.size(); }
@@ -3,6 +3,7 @@
 #ifdef UNIT_TEST
 
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -11,12 +12,58 @@
  *
  * Simulates LittleFS behavior without actual flash operations.
  * Files are stored in static maps that persist across object instances.
+ *
+ * Flash wear model (LittleFS on 256-byte pages / 4 KB erase blocks):
+ * blocks are never rewritten in place, and a file is a skip list in
+ * which every block points back at the ones before it. Closing a file
+ * that was written therefore copies every block from the first one the
+ * session wrote to the end of the file to freshly erased ones - one
+ * erase each, plus a program of each page that holds data. An append
+ * copies only the last block; a write before EOF copies the whole tail.
+ * Each such close, and each remove, is also one metadata commit (one
+ * page); every COMMITS_PER_METADATA_ERASE commits compact the metadata
+ * block (one erase). Tests read the totals to hold storage to a write budget.
  */
 class MockFileSystemClass {
+public:
+    static constexpr size_t PAGE_BYTES = 256;
+    static constexpr size_t BLOCK_BYTES = 4096;
+    static constexpr uint32_t COMMITS_PER_METADATA_ERASE = 16;
+
 private:
     static std::map<std::string, std::vector<char>> files;
     static bool formatted;
     static bool mounted;
+    static uint32_t readOpenCount;
+
+    // Flash wear model
+    static uint64_t bytesWritten;
+    static uint32_t pagesProgrammed;
+    static uint32_t blockErases;
+    static uint32_t commits;
+
+    static void commit(const std::set<size_t>& touched, size_t fileSize) {
+        // The first block written and every block after it (see class comment)
+        std::set<size_t> blocks(touched);
+        if (!touched.empty() && fileSize > 0) {
+            for (size_t block = *touched.begin(); block <= (fileSize - 1) / BLOCK_BYTES; block++) {
+                blocks.insert(block);
+            }
+        }
+        for (size_t block : blocks) {
+            size_t start = block * BLOCK_BYTES;
+            size_t end = fileSize < start + BLOCK_BYTES ? fileSize : start + BLOCK_BYTES;
+            blockErases++;
+            if (end > start) {
+                pagesProgrammed += (end - start + PAGE_BYTES - 1) / PAGE_BYTES;
+            }
+        }
+        commits++;
+        pagesProgrammed++;
+        if (commits % COMMITS_PER_METADATA_ERASE == 0) {
+            blockErases++;
+        }
+    }
 
 public:
     bool begin(bool formatOnFail = false) {
@@ -45,6 +92,7 @@ public:
         auto it = files.find(path);
         if (it != files.end()) {
             files.erase(it);
+            commit(std::set<size_t>(), 0);   // Metadata only; the blocks are erased when reused
             return true;
         }
         return false;
@@ -67,24 +115,32 @@ public:
     private:
         std::string path;
         std::vector<char>* data;
-        size_t readPos;
+        size_t pos;
         bool writeMode;
         bool valid;
+        bool modified;                  // Needs a commit on close
+        std::set<size_t> touchedBlocks; // Erase blocks written this session (the tail is added on close)
 
     public:
-        File() : data(nullptr), readPos(0), writeMode(false), valid(false) {}
+        File() : data(nullptr), pos(0), writeMode(false), valid(false), modified(false) {}
 
         File(const std::string& p, const char* mode)
-            : path(p), readPos(0), valid(true) {
+            : path(p), pos(0), valid(true), modified(false) {
 
-            writeMode = (mode[0] == 'w');
+            writeMode = (mode[0] == 'w' || mode[0] == 'a' || mode[1] == '+');
 
-            if (writeMode) {
+            if (mode[0] == 'w') {
                 // Create or clear file
                 files[path] = std::vector<char>();
                 data = &files[path];
+                modified = true;
+            } else if (mode[0] == 'a') {
+                // Create if missing; writes go at the end
+                data = &files[path];
+                pos = data->size();
             } else {
-                // Read mode
+                // Read mode ("r+" also writes, in place)
+                if (!writeMode) readOpenCount++;
                 auto it = files.find(path);
                 if (it != files.end()) {
                     data = &it->second;
@@ -100,22 +156,29 @@ public:
         }
 
         size_t write(uint8_t c) {
-            if (!valid || !writeMode || !data) return 0;
-            data->push_back(static_cast<char>(c));
-            return 1;
+            return write(reinterpret_cast<const char*>(&c), 1);
         }
 
         size_t write(const uint8_t* buf, size_t size) {
-            if (!valid || !writeMode || !data) return 0;
-            data->insert(data->end(), reinterpret_cast<const char*>(buf),
-                        reinterpret_cast<const char*>(buf) + size);
-            return size;
+            return write(reinterpret_cast<const char*>(buf), size);
         }
 
         size_t write(const char* buf, size_t size) {
             if (!valid || !writeMode || !data) return 0;
 
-            data->insert(data->end(), buf, buf + size);
+            if (size > 0) {
+                modified = true;
+                bytesWritten += size;
+                for (size_t block = pos / BLOCK_BYTES; block <= (pos + size - 1) / BLOCK_BYTES; block++) {
+                    touchedBlocks.insert(block);
+                }
+            }
+
+            // Overwrite from the current position, extending past the end
+            for (size_t i = 0; i < size; i++, pos++) {
+                if (pos < data->size()) (*data)[pos] = buf[i];
+                else data->push_back(buf[i]);
+            }
             return size;
         }
 
@@ -132,42 +195,99 @@ public:
         }
 
         int read() {
-            if (!valid || !data || readPos >= data->size()) return -1;
-            return (*data)[readPos++];
+            if (!valid || !data || pos >= data->size()) return -1;
+            return (*data)[pos++];
         }
 
         size_t readBytes(char* buffer, size_t length) {
             if (!valid || !data) return 0;
 
-            size_t available = data->size() - readPos;
+            size_t available = data->size() - pos;
             size_t toRead = (length < available) ? length : available;
 
-            std::copy(data->begin() + readPos, data->begin() + readPos + toRead, buffer);
-            readPos += toRead;
+            std::copy(data->begin() + pos, data->begin() + pos + toRead, buffer);
+            pos += toRead;
 
             return toRead;
         }
 
         size_t available() {
             if (!valid || !data) return 0;
-            return data->size() - readPos;
+            return data->size() - pos;
+        }
+
+        bool seek(uint32_t position) {
+            if (!valid || !data || position > data->size()) return false;
+            pos = position;
+            return true;
+        }
+
+        size_t position() const {
+            return pos;
+        }
+
+        size_t size() const {
+            return (valid && data) ? data->size() : 0;
         }
 
         void close() {
+            if (valid && data && writeMode && modified) {
+                commit(touchedBlocks, data->size());
+            }
             valid = false;
             data = nullptr;
+            modified = false;
+            touchedBlocks.clear();
         }
     };
 
     File open(const char* path, const char* mode) {
         return File(path, mode);
     }
+
+    // Test helpers
+    uint32_t getReadOpenCount() const {
+        return readOpenCount;
+    }
+
+    void resetCounts() {
+        readOpenCount = 0;
+    }
+
+    // Flash wear model (see class comment)
+    uint64_t getBytesWritten() const {
+        return bytesWritten;
+    }
+
+    uint32_t getPagesProgrammed() const {
+        return pagesProgrammed;
+    }
+
+    uint32_t getBlockErases() const {
+        return blockErases;
+    }
+
+    uint32_t getCommits() const {
+        return commits;
+    }
+
+    void resetWear() {
+        bytesWritten = 0;
+        pagesProgrammed = 0;
+        blockErases = 0;
+        commits = 0;
+    }
 };
 
 // Static member initialization
 std::map<std::string, std::vector<char>> MockFileSystemClass::files;
 bool MockFileSystemClass::formatted = false;
 bool MockFileSystemClass::mounted = false;
+uint32_t MockFileSystemClass::readOpenCount = 0;
+uint64_t MockFileSystemClass::bytesWritten = 0;
+uint32_t MockFileSystemClass::pagesProgrammed = 0;
+uint32_t MockFileSystemClass::blockErases = 0;
+uint32_t MockFileSystemClass::commits = 0;
 
 // Create a global instance to mimic LittleFS singleton
 static MockFileSystemClass LittleFS;
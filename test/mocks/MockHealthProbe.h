@@ -0,0 +1,49 @@
+#ifndef MOCK_HEALTH_PROBE_H
+#define MOCK_HEALTH_PROBE_H
+
+#include "../../src/interfaces/IHealthProbe.h"
+#include <map>
+
+/**
+ * MockHealthProbe - Test double for IHealthProbe
+ *
+ * Returns whatever heap figures and per-task stack values the test set.
+ */
+class MockHealthProbe : public IHealthProbe {
+private:
+    HeapSample heap;
+    std::map<void*, uint32_t> stackFree;
+    uint32_t sampleCount;
+
+public:
+    MockHealthProbe() : sampleCount(0) {
+        setHeap(200000, 100000, 190000);
+    }
+
+    HeapSample sampleHeap() override {
+        sampleCount++;
+        return heap;
+    }
+
+    uint32_t stackFreeBytes(void* task) override {
+        auto it = stackFree.find(task);
+        return it != stackFree.end() ? it->second : 0;
+    }
+
+    // Test helpers
+    void setHeap(uint32_t freeBytes, uint32_t largestBlock, uint32_t minEverFree) {
+        heap.freeBytes = freeBytes;
+        heap.largestFreeBlock = largestBlock;
+        heap.minEverFreeBytes = minEverFree;
+    }
+
+    void setStackFree(void* task, uint32_t bytes) {
+        stackFree[task] = bytes;
+    }
+
+    uint32_t getSampleCount() const {
+        return sampleCount;
+    }
+};
+
+#endif
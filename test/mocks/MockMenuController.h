@@ -35,6 +35,8 @@ private:
     String pidProfile;
     bool soundEnabled;
     uint32_t remainingTime;
+    HealthStats healthStats;
+    uint8_t cycleHistoryCount;
 
     // Call tracking
     int resetCallCount;
@@ -59,6 +61,7 @@ public:
           pidProfile("NORMAL"),
           soundEnabled(true),
           remainingTime(0),
+          cycleHistoryCount(0),
           resetCallCount(0),
           handleActionCallCount(0),
           setConstraintsCalled(false),
@@ -133,6 +136,14 @@ public:
         remainingTime = seconds;
     }
 
+    void setHealthStats(const HealthStats& health) override {
+        healthStats = health;
+    }
+
+    void setCycleHistory(const CycleRecord* cycles, uint8_t count) override {
+        cycleHistoryCount = count;
+    }
+
     void registerSelectionCallback(MenuSelectionCallback callback) override {
         callbacks.push_back(callback);
     }
@@ -252,6 +263,8 @@ public:
     String getPIDProfile() const { return pidProfile; }
     bool getSoundEnabled() const { return soundEnabled; }
     uint32_t getRemainingTime() const { return remainingTime; }
+    const HealthStats& getHealthStats() const { return healthStats; }
+    uint8_t getCycleHistoryCount() const { return cycleHistoryCount; }
 
     /**
      * Reset mock state
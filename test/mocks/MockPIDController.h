@@ -12,7 +12,10 @@ private:
     float outputMax;
     float maxTemp;
     float fixedOutput;
+    PIDTerms fixedTerms;
+    PIDRecoveryState recoveryState;
     uint32_t computeCallCount;
+    uint32_t restoreCallCount;
     uint32_t resetCallCount;
 
     float lastSetpoint;
@@ -29,6 +32,7 @@ public:
           maxTemp(90.0),
           fixedOutput(0),
           computeCallCount(0),
+          restoreCallCount(0),
           resetCallCount(0),
           lastSetpoint(0),
           lastBoxTemp(0),
@@ -68,14 +72,40 @@ public:
     void reset() override {
         resetCallCount++;
         fixedOutput = 0;
+        fixedTerms = PIDTerms();
+        recoveryState = PIDRecoveryState();
         computeCallCount = 0;
     }
 
+    PIDTerms getLastTerms() const override {
+        return fixedTerms;
+    }
+
+    PIDRecoveryState getRecoveryState() const override {
+        return recoveryState;
+    }
+
+    void restoreRecoveryState(const PIDRecoveryState& state) override {
+        recoveryState = state;
+        restoreCallCount++;
+    }
+
     // Test helpers
     void setOutput(float output) {
         fixedOutput = output;
     }
 
+    void setTerms(float p, float i, float d) {
+        fixedTerms.proportional = p;
+        fixedTerms.integral = i;
+        fixedTerms.derivative = d;
+    }
+
+    void setRecoveryState(float integral, float steadyStateOutput) {
+        recoveryState.integral = integral;
+        recoveryState.steadyStateOutput = steadyStateOutput;
+    }
+
     bool isInitialized() const { return initialized; }
     PIDProfile getProfile() const { return currentProfile; }
     float getOutputMin() const { return outputMin; }
@@ -83,6 +113,7 @@ public:
     float getMaxTemp() const { return maxTemp; }
     uint32_t getComputeCallCount() const { return computeCallCount; }
     uint32_t getResetCallCount() const { return resetCallCount; }
+    uint32_t getRestoreCallCount() const { return restoreCallCount; }
     float getLastSetpoint() const { return lastSetpoint; }
     float getLastBoxTemp() const { return lastBoxTemp; }
     float getLastHeaterTemp() const { return lastHeaterTemp; }
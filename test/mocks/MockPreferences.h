@@ -0,0 +1,133 @@
+#pragma once
+
+#ifdef UNIT_TEST
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstring>
+
+/**
+ * Preferences - In-memory stand-in for the ESP32 NVS Preferences class
+ *
+ * Values live in a static map keyed by namespace and key, so they
+ * persist across instances the way NVS persists across reboots.
+ *
+ * Flash wear model (ESP-IDF NVS on 4 KB pages of 126 32-byte entries):
+ * NVS never rewrites an entry in place. Writing a blob appends a data
+ * header entry, ceil(len / 32) data entries and a blob index entry to
+ * the active page; the entries of the old value are only marked erased.
+ * A page is erased once its worth of entries has been written, when
+ * garbage collection reclaims it. Writing the value already stored
+ * costs nothing (NVS compares first). Tests read the totals to hold
+ * storage to a write budget.
+ */
+class Preferences {
+public:
+    static constexpr size_t ENTRY_BYTES = 32;
+    static constexpr uint32_t ENTRIES_PER_PAGE = 126;
+
+private:
+    static std::map<std::string, std::vector<uint8_t>> values;
+    static uint32_t entriesWritten;
+
+    std::string space;
+    bool opened;
+    bool readOnly;
+
+    std::string slot(const char* key) const {
+        return space + "/" + key;
+    }
+
+public:
+    Preferences() : opened(false), readOnly(false) {}
+
+    bool begin(const char* name, bool readOnlyMode = false, const char* partitionLabel = nullptr) {
+        (void)partitionLabel;
+        if (!name || strlen(name) == 0 || strlen(name) > 15) {
+            return false;
+        }
+        space = name;
+        opened = true;
+        readOnly = readOnlyMode;
+        return true;
+    }
+
+    void end() {
+        opened = false;
+    }
+
+    size_t putBytes(const char* key, const void* value, size_t len) {
+        if (!opened || readOnly || !key || !value || len == 0) {
+            return 0;
+        }
+        const uint8_t* bytes = static_cast<const uint8_t*>(value);
+        std::vector<uint8_t> data(bytes, bytes + len);
+        std::vector<uint8_t>& stored = values[slot(key)];
+        if (stored != data) {
+            stored = data;
+            entriesWritten += 2 + (len + ENTRY_BYTES - 1) / ENTRY_BYTES;
+        }
+        return len;
+    }
+
+    size_t getBytesLength(const char* key) {
+        if (!opened || !key) {
+            return 0;
+        }
+        auto it = values.find(slot(key));
+        return it == values.end() ? 0 : it->second.size();
+    }
+
+    size_t getBytes(const char* key, void* buffer, size_t maxLen) {
+        size_t len = getBytesLength(key);
+        if (len == 0 || len > maxLen || !buffer) {
+            return 0;
+        }
+        memcpy(buffer, values[slot(key)].data(), len);
+        return len;
+    }
+
+    bool isKey(const char* key) {
+        return getBytesLength(key) > 0;
+    }
+
+    bool remove(const char* key) {
+        if (!opened || readOnly || !key) {
+            return false;
+        }
+        return values.erase(slot(key)) > 0;
+    }
+
+    // ========== Test helpers ==========
+
+    // nvs_flash_erase(): every namespace gone, wear counters kept
+    static void eraseAll() {
+        values.clear();
+    }
+
+    // Overwrite a stored value without wear accounting (damage simulation)
+    static void corrupt(const char* name, const char* key, const void* value, size_t len) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(value);
+        values[std::string(name) + "/" + key] = std::vector<uint8_t>(bytes, bytes + len);
+    }
+
+    // Flash wear model (see class comment)
+    static uint32_t getEntriesWritten() {
+        return entriesWritten;
+    }
+
+    static uint32_t getPageErases() {
+        return entriesWritten / ENTRIES_PER_PAGE;
+    }
+
+    static void resetWear() {
+        entriesWritten = 0;
+    }
+};
+
+// Static member initialization
+std::map<std::string, std::vector<uint8_t>> Preferences::values;
+uint32_t Preferences::entriesWritten = 0;
+
+#endif // UNIT_TEST
@@ -0,0 +1,73 @@
+#ifndef MOCK_RECOVERY_MEMORY_H
+#define MOCK_RECOVERY_MEMORY_H
+
+#include "../../src/interfaces/IRecoveryMemory.h"
+
+/**
+ * MockRecoveryMemory - Test double for IRecoveryMemory
+ *
+ * Holds one snapshot in plain memory. setSnapshot() plays the contents a
+ * reset left behind; clear() plays a power-on (nothing intact).
+ */
+class MockRecoveryMemory : public IRecoveryMemory {
+private:
+    RecoverySnapshot snapshot;
+    bool valid;
+    uint32_t storeCallCount;
+
+public:
+    MockRecoveryMemory()
+        : valid(false),
+          storeCallCount(0) {
+    }
+
+    bool load(RecoverySnapshot& out) override {
+        if (!valid) {
+            return false;
+        }
+        out = snapshot;
+        return true;
+    }
+
+    void store(const RecoverySnapshot& value) override {
+        storeCallCount++;
+        snapshot = value;
+        valid = true;
+    }
+
+    // ==================== Test Helper Methods ====================
+
+    void setSnapshot(DryerState state, uint32_t elapsed, float targetTemp, uint32_t targetTime,
+                     PresetType preset, float integral = 0, float steadyStateOutput = 0) {
+        snapshot.state = state;
+        snapshot.preset = preset;
+        snapshot.elapsed = elapsed;
+        snapshot.targetTemp = targetTemp;
+        snapshot.targetTime = targetTime;
+        snapshot.pid.integral = integral;
+        snapshot.pid.steadyStateOutput = steadyStateOutput;
+        valid = true;
+    }
+
+    void clear() {
+        valid = false;
+    }
+
+    bool isValid() const {
+        return valid;
+    }
+
+    const RecoverySnapshot& getSnapshot() const {
+        return snapshot;
+    }
+
+    uint32_t getStoreCallCount() const {
+        return storeCallCount;
+    }
+
+    void resetCounts() {
+        storeCallCount = 0;
+    }
+};
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef MOCK_SENSOR_CHANNEL_H
+#define MOCK_SENSOR_CHANNEL_H
+
+#include "../../src/interfaces/ISensorChannel.h"
+
+/**
+ * MockSensorChannel - Test double for ISensorChannel
+ *
+ * Can behave as a synchronous or async driver. Async samples complete
+ * when the test calls completeSample() (or immediately if autoReady).
+ */
+class MockSensorChannel : public ISensorChannel {
+private:
+    SensorType type;
+    bool async;
+    bool autoReady;
+    bool sampleReady;
+    float value;
+    bool valid;
+    String lastError;
+    bool initialized;
+    uint32_t startCallCount;
+    uint32_t readCallCount;
+
+public:
+    explicit MockSensorChannel(SensorType sensorType = SensorType::BOX_TEMP, bool isAsync = false)
+        : type(sensorType),
+          async(isAsync),
+          autoReady(false),
+          sampleReady(false),
+          value(0.0),
+          valid(true),
+          initialized(false),
+          startCallCount(0),
+          readCallCount(0) {
+    }
+
+    void begin() override {
+        initialized = true;
+    }
+
+    SampleStatus startSample() override {
+        startCallCount++;
+        sampleReady = autoReady;
+        return async ? SampleStatus::PENDING : SampleStatus::READY;
+    }
+
+    bool isSampleReady() override {
+        return sampleReady;
+    }
+
+    bool readSample() override {
+        readCallCount++;
+        sampleReady = false;
+        return valid;
+    }
+
+    uint8_t getValueCount() const override { return 1; }
+    float getValue(uint8_t index) const override { return value; }
+    SensorType getSensorType() const override { return type; }
+    bool isValid() const override { return valid; }
+    String getLastError() const override { return lastError; }
+
+    // ==================== Test Helper Methods ====================
+
+    void setValue(float v) {
+        value = v;
+        valid = true;
+        lastError = "";
+    }
+
+    void setInvalid(const String& error) {
+        valid = false;
+        lastError = error;
+    }
+
+    void setAutoReady(bool ready) { autoReady = ready; }
+    void completeSample() { sampleReady = true; }
+
+    bool isInitialized() const { return initialized; }
+    uint32_t getStartCallCount() const { return startCallCount; }
+    uint32_t getReadCallCount() const { return readCallCount; }
+
+    void resetCallCounts() {
+        startCallCount = 0;
+        readCallCount = 0;
+    }
+};
+
+#endif
@@ -2,6 +2,7 @@
 #define MOCK_SENSOR_MANAGER_H
 
 #include "../../src/interfaces/ISensorManager.h"
+#include "../../src/Config.h"
 #include <vector>
 
 /**
@@ -19,14 +20,24 @@ private:
     std::vector<HeaterTempCallback> heaterTempCallbacks;
     std::vector<BoxDataCallback> boxDataCallbacks;
     std::vector<SensorErrorCallback> errorCallbacks;
+    std::vector<SensorChannelCallback> channelCallbacks;
+
+    // Extra channels registered after the built-in heater (0) and box (1)
+    std::vector<ISensorChannel*> extraChannels;
+    SensorReading channelReadings[MAX_SENSOR_CHANNELS][MAX_SENSOR_CHANNEL_VALUES];
+    SensorChannelStats channelStats[MAX_SENSOR_CHANNELS];
 
     bool initialized;
     uint32_t updateCallCount;
+    uint32_t minIntervalMs;
+    uint32_t resetChannelStatsCallCount;
 
 public:
     MockSensorManager()
         : initialized(false),
-          updateCallCount(0) {
+          updateCallCount(0),
+          minIntervalMs(0),
+          resetChannelStatsCallCount(0) {
         heaterTemp.value = 25.0;
         heaterTemp.isValid = true;
         heaterTemp.timestamp = 0;
@@ -89,6 +100,61 @@ public:
         return boxTemp.isValid && boxHumidity.isValid;
     }
 
+    uint8_t registerChannel(ISensorChannel* channel, const SensorChannelConfig& config) override {
+        if (getChannelCount() >= MAX_SENSOR_CHANNELS) {
+            return INVALID_SENSOR_CHANNEL;
+        }
+        extraChannels.push_back(channel);
+        return getChannelCount() - 1;
+    }
+
+    void registerChannelCallback(SensorChannelCallback callback) override {
+        channelCallbacks.push_back(callback);
+    }
+
+    uint8_t getChannelCount() const override {
+        return 2 + extraChannels.size();
+    }
+
+    uint8_t findChannel(SensorType type) const override {
+        if (type == SensorType::HEATER_TEMP) return 0;
+        if (type == SensorType::BOX_TEMP) return 1;
+        for (size_t i = 0; i < extraChannels.size(); i++) {
+            if (extraChannels[i]->getSensorType() == type) {
+                return 2 + i;
+            }
+        }
+        return INVALID_SENSOR_CHANNEL;
+    }
+
+    SensorReading getChannelReading(uint8_t channel, uint8_t valueIndex = 0) const override {
+        if (channel == 0) return heaterTemp;
+        if (channel == 1) return valueIndex == 0 ? boxTemp : boxHumidity;
+        if (channel >= MAX_SENSOR_CHANNELS || valueIndex >= MAX_SENSOR_CHANNEL_VALUES) {
+            return SensorReading();
+        }
+        return channelReadings[channel][valueIndex];
+    }
+
+    const SensorChannelStats* getChannelStats(uint8_t channel) const override {
+        return channel < getChannelCount() ? &channelStats[channel] : nullptr;
+    }
+
+    void resetChannelStats() override {
+        resetChannelStatsCallCount++;
+        for (SensorChannelStats& stats : channelStats) {
+            stats.reset();
+        }
+    }
+
+    void setMinInterval(uint32_t intervalMs) override {
+        minIntervalMs = intervalMs;
+    }
+
+    uint32_t getMinInterval() const override {
+        return minIntervalMs;
+    }
+
     // ==================== Test Helper Methods ====================
 
     void setHeaterTemp(float temp, uint32_t timestamp = 0) {
@@ -140,7 +206,7 @@ public:
     void triggerSensorError(SensorType type, const String& error) {
         if (type == SensorType::HEATER_TEMP) {
             setHeaterTempInvalid();
-        } else {
+        } else if (type != SensorType::SPOOL_WEIGHT) {
             setBoxDataInvalid();
         }
 
@@ -151,10 +217,30 @@ public:
         }
     }
 
+    void triggerChannelUpdate(uint8_t channel, float value, uint32_t timestamp) {
+        if (channel >= MAX_SENSOR_CHANNELS) {
+            return;
+        }
+        channelReadings[channel][0] = SensorReading(value, timestamp, true);
+        for (auto& callback : channelCallbacks) {
+            if (callback) {
+                callback(channel, channelReadings[channel], 1);
+            }
+        }
+    }
+
     bool isInitialized() const {
         return initialized;
     }
 
+    SensorChannelStats& getMutableChannelStats(uint8_t channel) {
+        return channelStats[channel];
+    }
+
+    uint32_t getResetChannelStatsCallCount() const {
+        return resetChannelStatsCallCount;
+    }
+
     uint32_t getUpdateCallCount() const {
         return updateCallCount;
     }
@@ -170,6 +256,10 @@ public:
     size_t getErrorCallbackCount() const {
         return errorCallbacks.size();
     }
+
+    size_t getChannelCallbackCount() const {
+        return channelCallbacks.size();
+    }
 };
 
 #endif
\ No newline at end of file
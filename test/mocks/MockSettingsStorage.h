@@ -3,6 +3,7 @@
 #define MOCK_SETTINGS_STORAGE_H
 
 #include "../../src/interfaces/ISettingsStorage.h"
+#include "../../src/interfaces/IHeaterControl.h"
 
 class MockSettingsStorage : public ISettingsStorage {
 private:
@@ -11,12 +12,21 @@ private:
     PresetType selectedPreset;
     PIDProfile selectedPIDProfile;
     bool soundEnabled;
+    ScaleCalibration scaleCalibration;
     bool hasRuntimeState;
     DryerState savedState;
     uint32_t savedElapsed;
     float savedTargetTemp;
     uint32_t savedTargetTime;
     PresetType savedPreset;
+    CycleRecord lastCycleRecord;
+    TelemetryPage lastTelemetryPage;
+    bool holdTelemetryPages;
+    const IHeaterControl* watchedHeater;
+    bool heaterRunningAtCycleRecord;
+    String exportedJson;
+    String lastImportedJson;
+    bool acceptImports;
 
     uint32_t beginCallCount;
     uint32_t saveSettingsCallCount;
@@ -26,6 +36,12 @@ private:
     uint32_t savePIDProfileCallCount;
     uint32_t saveRuntimeStateCallCount;
     uint32_t clearRuntimeStateCallCount;
+    uint32_t saveScaleCalibrationCallCount;
+    uint32_t updateCallCount;
+    uint32_t flushCallCount;
+    uint32_t saveCycleRecordCallCount;
+    uint32_t saveTelemetryPageCallCount;
+    uint32_t importJsonCallCount;
 
 public:
     MockSettingsStorage()
@@ -39,6 +55,11 @@ public:
           savedTargetTemp(50.0),
           savedTargetTime(14400),
           savedPreset(PresetType::PLA),
+          holdTelemetryPages(false),
+          watchedHeater(nullptr),
+          heaterRunningAtCycleRecord(false),
+          exportedJson("{}"),
+          acceptImports(true),
           beginCallCount(0),
           saveSettingsCallCount(0),
           loadSettingsCallCount(0),
@@ -46,11 +67,19 @@ public:
           saveSelectedPresetCallCount(0),
           savePIDProfileCallCount(0),
           saveRuntimeStateCallCount(0),
-          clearRuntimeStateCallCount(0) {
+          clearRuntimeStateCallCount(0),
+          saveScaleCalibrationCallCount(0),
+          updateCallCount(0),
+          flushCallCount(0),
+          saveCycleRecordCallCount(0),
+          saveTelemetryPageCallCount(0),
+          importJsonCallCount(0) {
 
         customPreset.targetTemp = 50.0;
         customPreset.targetTime = 14400;
         customPreset.maxOvershoot = 10.0;
+        memset(&lastCycleRecord, 0, sizeof(lastCycleRecord));
+        memset(&lastTelemetryPage, 0, sizeof(lastTelemetryPage));
     }
 
     void begin() override {
@@ -66,6 +95,14 @@ public:
         saveSettingsCallCount++;
     }
 
+    void update(uint32_t currentMillis) override {
+        updateCallCount++;
+    }
+
+    void flush() override {
+        flushCallCount++;
+    }
+
     void saveCustomPreset(const DryingPreset& preset) override {
         saveCustomPresetCallCount++;
         customPreset = preset;
@@ -101,6 +138,15 @@ public:
         return soundEnabled;
     }
 
+    void saveScaleCalibration(const ScaleCalibration& calibration) override {
+        saveScaleCalibrationCallCount++;
+        scaleCalibration = calibration;
+    }
+
+    ScaleCalibration loadScaleCalibration() override {
+        return scaleCalibration;
+    }
+
     void saveRuntimeState(DryerState state, uint32_t elapsed,
                          float targetTemp, uint32_t targetTime,
                          PresetType preset, uint32_t timestamp) override {
@@ -152,6 +198,32 @@ public:
         return savedPreset;
     }
 
+    void saveCycleRecord(const CycleRecord& record) override {
+        saveCycleRecordCallCount++;
+        lastCycleRecord = record;
+        heaterRunningAtCycleRecord = watchedHeater && watchedHeater->isRunning();
+    }
+
+    // Copies the page; released at once unless holding (simulates a busy worker)
+    bool saveTelemetryPage(TelemetryPageBuffer& buffer) override {
+        saveTelemetryPageCallCount++;
+        lastTelemetryPage = buffer.page;
+        if (!holdTelemetryPages) {
+            buffer.release();
+        }
+        return true;
+    }
+
+    String exportJson() const override {
+        return exportedJson;
+    }
+
+    bool importJson(const String& json) override {
+        importJsonCallCount++;
+        lastImportedJson = json;
+        return acceptImports;
+    }
+
     // Test helpers
     bool isInitialized() const { return initialized; }
     bool isHealthy() const { return true; }  // Mock always healthy
@@ -166,6 +238,22 @@ public:
     uint32_t getSavePIDProfileCallCount() const { return savePIDProfileCallCount; }
     uint32_t getSaveRuntimeStateCallCount() const { return saveRuntimeStateCallCount; }
     uint32_t getClearRuntimeStateCallCount() const { return clearRuntimeStateCallCount; }
+    uint32_t getSaveScaleCalibrationCallCount() const { return saveScaleCalibrationCallCount; }
+    uint32_t getUpdateCallCount() const { return updateCallCount; }
+    uint32_t getFlushCallCount() const { return flushCallCount; }
+    uint32_t getSaveCycleRecordCallCount() const { return saveCycleRecordCallCount; }
+    const CycleRecord& getLastCycleRecord() const { return lastCycleRecord; }
+    uint32_t getSaveTelemetryPageCallCount() const { return saveTelemetryPageCallCount; }
+    const TelemetryPage& getLastTelemetryPage() const { return lastTelemetryPage; }
+    void setHoldTelemetryPages(bool hold) { holdTelemetryPages = hold; }
+    void setExportedJson(const String& json) { exportedJson = json; }
+    void setAcceptImports(bool accept) { acceptImports = accept; }
+    uint32_t getImportJsonCallCount() const { return importJsonCallCount; }
+    const String& getLastImportedJson() const { return lastImportedJson; }
+
+    // Note whether `heater` was still on when each cycle record arrived
+    void watchHeater(const IHeaterControl* heater) { watchedHeater = heater; }
+    bool wasHeaterRunningAtCycleRecord() const { return heaterRunningAtCycleRecord; }
 
     void setHasRuntimeState(bool has) { hasRuntimeState = has; }
 
@@ -173,6 +261,7 @@ public:
     void setPIDProfile(PIDProfile profile) { selectedPIDProfile = profile; }
     void setSoundEnabled(bool enabled) { soundEnabled = enabled; }
     void setCustomPreset(const DryingPreset& preset) { customPreset = preset; }
+    void setScaleCalibration(const ScaleCalibration& calibration) { scaleCalibration = calibration; }
 
     void setRuntimeState(DryerState state, uint32_t elapsed,
                         float targetTemp, uint32_t targetTime,
@@ -194,6 +283,12 @@ public:
         savePIDProfileCallCount = 0;
         saveRuntimeStateCallCount = 0;
         clearRuntimeStateCallCount = 0;
+        saveScaleCalibrationCallCount = 0;
+        updateCallCount = 0;
+        flushCallCount = 0;
+        saveCycleRecordCallCount = 0;
+        saveTelemetryPageCallCount = 0;
+        importJsonCallCount = 0;
     }
 };
 
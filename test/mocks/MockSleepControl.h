@@ -0,0 +1,74 @@
+#ifndef MOCK_SLEEP_CONTROL_H
+#define MOCK_SLEEP_CONTROL_H
+
+#include "../../src/interfaces/ISleepControl.h"
+#include <cstdint>
+
+/**
+ * MockSleepControl - Test double for ISleepControl
+ *
+ * Records wait/lightSleep calls instead of blocking. setWakeByButton()
+ * chooses what lightSleep() reports as the wake cause,
+ * setSerialHostConnected() whether a serial console is attached.
+ */
+class MockSleepControl : public ISleepControl {
+private:
+    uint32_t waitCount;
+    uint32_t lightSleepCount;
+    uint32_t lastDurationMs;
+    bool wakeByButton;
+    bool hostConnected;
+
+public:
+    MockSleepControl()
+        : waitCount(0),
+          lightSleepCount(0),
+          lastDurationMs(0),
+          wakeByButton(false),
+          hostConnected(false) {
+    }
+
+    void wait(uint32_t ms) override {
+        waitCount++;
+        lastDurationMs = ms;
+    }
+
+    bool lightSleep(uint32_t ms) override {
+        lightSleepCount++;
+        lastDurationMs = ms;
+        return wakeByButton;
+    }
+
+    bool serialHostConnected() override {
+        return hostConnected;
+    }
+
+    // Test helpers
+    void setWakeByButton(bool byButton) {
+        wakeByButton = byButton;
+    }
+
+    void setSerialHostConnected(bool connected) {
+        hostConnected = connected;
+    }
+
+    uint32_t getWaitCount() const {
+        return waitCount;
+    }
+
+    uint32_t getLightSleepCount() const {
+        return lightSleepCount;
+    }
+
+    uint32_t getLastDuration() const {
+        return lastDurationMs;
+    }
+
+    void reset() {
+        waitCount = 0;
+        lightSleepCount = 0;
+        lastDurationMs = 0;
+    }
+};
+
+#endif
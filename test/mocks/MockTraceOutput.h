@@ -0,0 +1,68 @@
+#ifndef MOCK_TRACE_OUTPUT_H
+#define MOCK_TRACE_OUTPUT_H
+
+#include "../../src/interfaces/ITraceOutput.h"
+#include <cstdint>
+#include <cstring>
+
+/**
+ * MockTraceOutput - Test double for ITraceOutput
+ *
+ * Captures written bytes; setRoom() chooses what availableForWrite()
+ * reports (default: plenty).
+ */
+class MockTraceOutput : public ITraceOutput {
+public:
+    static constexpr size_t CAPACITY = 4096;
+
+private:
+    uint8_t bytes[CAPACITY];
+    size_t length;
+    size_t room;
+    uint32_t writeCount;
+
+public:
+    MockTraceOutput()
+        : length(0),
+          room(CAPACITY),
+          writeCount(0) {
+    }
+
+    size_t availableForWrite() override {
+        return room;
+    }
+
+    size_t write(const uint8_t* data, size_t count) override {
+        if (length + count > CAPACITY) {
+            count = CAPACITY - length;
+        }
+        memcpy(&bytes[length], data, count);
+        length += count;
+        writeCount++;
+        return count;
+    }
+
+    // Test helpers
+    void setRoom(size_t bytesFree) {
+        room = bytesFree;
+    }
+
+    const uint8_t* getBytes() const {
+        return bytes;
+    }
+
+    size_t getLength() const {
+        return length;
+    }
+
+    uint32_t getWriteCount() const {
+        return writeCount;
+    }
+
+    void reset() {
+        length = 0;
+        writeCount = 0;
+    }
+};
+
+#endif
@@ -0,0 +1,142 @@
+#ifndef MOCK_WEIGHT_SENSOR_H
+#define MOCK_WEIGHT_SENSOR_H
+
+#include "../../src/interfaces/IWeightSensor.h"
+
+/**
+ * MockWeightSensor - Test double for IWeightSensor
+ *
+ * Models a load cell: setLoad() puts a physical mass on the holder and
+ * the raw reading follows with a fixed zero offset and gain, so tare
+ * and calibration behave like the real driver.
+ */
+class MockWeightSensor : public IWeightSensor {
+private:
+    int32_t raw;
+    bool valid;
+    String lastError;
+    bool initialized;
+    bool sampleReady;
+    ScaleCalibration calibration;
+
+    uint32_t readCallCount;
+    uint32_t tareCallCount;
+    uint32_t calibrateCallCount;
+
+public:
+    static constexpr int32_t ZERO_RAW = 8000;        // Raw counts with nothing on the cell
+    static constexpr float COUNTS_PER_GRAM = 400.0f;
+
+    MockWeightSensor()
+        : raw(ZERO_RAW),
+          valid(true),
+          initialized(false),
+          sampleReady(true),
+          readCallCount(0),
+          tareCallCount(0),
+          calibrateCallCount(0) {
+    }
+
+    void begin() override {
+        initialized = true;
+    }
+
+    void requestSample() override {
+    }
+
+    bool isSampleReady() override {
+        return sampleReady;
+    }
+
+    bool read() override {
+        readCallCount++;
+        return valid;
+    }
+
+    float getWeight() const override {
+        if (!isCalibrated()) {
+            return 0.0f;
+        }
+        return (raw - calibration.tareOffset) / calibration.countsPerGram;
+    }
+
+    int32_t getRawValue() const override {
+        return raw;
+    }
+
+    bool tare() override {
+        tareCallCount++;
+        if (!valid) {
+            return false;
+        }
+        calibration.tareOffset = raw;
+        return true;
+    }
+
+    bool calibrate(float knownMassGrams) override {
+        calibrateCallCount++;
+        if (!valid || knownMassGrams <= 0.0f || raw == calibration.tareOffset) {
+            return false;
+        }
+        calibration.countsPerGram = (raw - calibration.tareOffset) / knownMassGrams;
+        return true;
+    }
+
+    void setCalibration(const ScaleCalibration& newCalibration) override {
+        calibration = newCalibration;
+    }
+
+    ScaleCalibration getCalibration() const override {
+        return calibration;
+    }
+
+    bool isCalibrated() const override {
+        return calibration.countsPerGram != 0.0f;
+    }
+
+    bool isValid() const override {
+        return valid;
+    }
+
+    String getLastError() const override {
+        return lastError;
+    }
+
+    // ==================== Test Helper Methods ====================
+
+    void setLoad(float grams) {
+        raw = ZERO_RAW + static_cast<int32_t>(grams * COUNTS_PER_GRAM);
+    }
+
+    void setInvalid(const String& error) {
+        valid = false;
+        lastError = error;
+    }
+
+    void setValid() {
+        valid = true;
+        lastError = "";
+    }
+
+    void setSampleReady(bool ready) {
+        sampleReady = ready;
+    }
+
+    bool isInitialized() const {
+        return initialized;
+    }
+
+    uint32_t getReadCallCount() const {
+        return readCallCount;
+    }
+
+    uint32_t getTareCallCount() const {
+        return tareCallCount;
+    }
+
+    uint32_t getCalibrateCallCount() const {
+        return calibrateCallCount;
+    }
+};
+
+#endif
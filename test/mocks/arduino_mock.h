@@ -95,6 +95,10 @@ inline unsigned long millis() {
     return (clock() / (CLOCKS_PER_SEC / 1000)) - start_time;
 }
 
+inline unsigned long micros() {
+    return static_cast<unsigned long>(static_cast<double>(clock()) * 1000000.0 / CLOCKS_PER_SEC);
+}
+
 inline void delay(unsigned long ms) {
     static unsigned long total_delay = 0;
     total_delay += ms;
@@ -120,8 +124,9 @@ inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
 
 #define F(string_literal) (string_literal)
 
-// Include filesystem and JSON mocks after String class is defined
+// Include filesystem, NVS and JSON mocks after String class is defined
 #include "MockFileSystem.h"
+#include "MockPreferences.h"
 #include "MockArduinoJson.h"
 
 #endif // ARDUINO_MOCK
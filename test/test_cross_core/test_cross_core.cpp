@@ -0,0 +1,440 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#include <thread>
+#include <atomic>
+
+#include "../../src/concurrency/SpscQueue.h"
+#include "../../src/concurrency/SeqLock.h"
+#include "../../src/concurrency/DryerLink.h"
+#include "../../src/concurrency/DryerBridge.h"
+#include "../../src/concurrency/DryerProxy.h"
+#include "../mocks/MockDryer.h"
+#include "../mocks/MockSensorManager.h"
+#include "../mocks/MockSettingsStorage.h"
+
+// Test fixture
+MockDryer* mockDryer;
+MockSensorManager* mockSensors;
+MockSettingsStorage* mockSettings;
+DryerLink* dryerLink;
+DryerBridge* bridge;
+DryerProxy* proxy;
+
+void setUp(void) {
+    mockDryer = new MockDryer();
+    mockSensors = new MockSensorManager();
+    mockSettings = new MockSettingsStorage();
+    dryerLink = new DryerLink();
+    bridge = new DryerBridge(mockDryer, dryerLink, mockSensors, mockSettings);
+    proxy = new DryerProxy(dryerLink);
+    bridge->begin();
+    proxy->begin(0);
+}
+
+void tearDown(void) {
+    delete proxy;
+    delete bridge;
+    delete dryerLink;
+    delete mockSettings;
+    delete mockSensors;
+    delete mockDryer;
+}
+
+// ==================== SPSC Queue Tests ====================
+
+void test_spsc_queue_is_fifo_and_bounded() {
+    SpscQueue<int, 4> queue;
+
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(queue.push(i));
+    }
+    TEST_ASSERT_FALSE(queue.push(99));
+    TEST_ASSERT_EQUAL(4, queue.size());
+
+    int value;
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(queue.pop(value));
+        TEST_ASSERT_EQUAL(i, value);
+    }
+    TEST_ASSERT_FALSE(queue.pop(value));
+    TEST_ASSERT_TRUE(queue.isEmpty());
+}
+
+void test_spsc_queue_preserves_order_across_threads() {
+    static SpscQueue<uint32_t, 64> queue;
+    const uint32_t ITEMS = 200000;
+    std::atomic<bool> outOfOrder(false);
+
+    std::thread consumer([&]() {
+        uint32_t expected = 0;
+        uint32_t value;
+        while (expected < ITEMS) {
+            if (queue.pop(value)) {
+                if (value != expected) {
+                    outOfOrder = true;
+                }
+                expected++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    for (uint32_t i = 0; i < ITEMS; ) {
+        if (queue.push(i)) {
+            i++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    consumer.join();
+
+    TEST_ASSERT_FALSE(outOfOrder.load());
+    TEST_ASSERT_TRUE(queue.isEmpty());
+}
+
+// ==================== SeqLock Tests ====================
+
+// Every field carries the same generation number, so a torn read shows up
+// as two fields that disagree
+static DryerSnapshot generationSnapshot(uint32_t generation) {
+    DryerSnapshot snapshot;
+    snapshot.stats.currentTemp = generation;
+    snapshot.stats.targetTemp = generation;
+    snapshot.stats.boxTemp = generation;
+    snapshot.stats.boxHumidity = generation;
+    snapshot.stats.elapsedTime = generation;
+    snapshot.stats.remainingTime = generation;
+    snapshot.stats.waterRemoved = generation;
+    snapshot.stats.massLossRate = generation;
+    snapshot.customPreset.targetTime = generation;
+    snapshot.maxTime = generation;
+    snapshot.statsSerial = generation;
+    return snapshot;
+}
+
+static bool isConsistent(const DryerSnapshot& snapshot) {
+    uint32_t generation = snapshot.statsSerial;
+    float asFloat = static_cast<float>(generation);
+    return snapshot.stats.currentTemp == asFloat &&
+           snapshot.stats.targetTemp == asFloat &&
+           snapshot.stats.boxTemp == asFloat &&
+           snapshot.stats.boxHumidity == asFloat &&
+           snapshot.stats.elapsedTime == generation &&
+           snapshot.stats.remainingTime == generation &&
+           snapshot.stats.waterRemoved == asFloat &&
+           snapshot.stats.massLossRate == asFloat &&
+           snapshot.customPreset.targetTime == generation &&
+           snapshot.maxTime == generation;
+}
+
+void test_seqlock_returns_last_write() {
+    SeqLock<DryerSnapshot> lock;
+    TEST_ASSERT_EQUAL(0, lock.getVersion());
+
+    lock.write(generationSnapshot(7));
+
+    TEST_ASSERT_EQUAL(1, lock.getVersion());
+    TEST_ASSERT_EQUAL(7, lock.read().statsSerial);
+    TEST_ASSERT_TRUE(isConsistent(lock.read()));
+}
+
+void test_seqlock_has_no_torn_reads_under_stress() {
+    static SeqLock<DryerSnapshot> lock;
+    // Floats hold integers exactly up to 2^24
+    const uint32_t WRITES = 500000;
+    std::atomic<bool> done(false);
+    std::atomic<uint32_t> tornReads(0);
+    std::atomic<uint32_t> backwardsReads(0);
+    std::atomic<uint32_t> reads(0);
+
+    // Readers may start before the first write below: give them a
+    // generation-0 snapshot rather than the default one
+    lock.write(generationSnapshot(0));
+
+    auto reader = [&]() {
+        uint32_t lastGeneration = 0;
+        while (!done.load()) {
+            DryerSnapshot snapshot = lock.read();
+            if (!isConsistent(snapshot)) {
+                tornReads++;
+            }
+            if (snapshot.statsSerial < lastGeneration) {
+                backwardsReads++;
+            }
+            lastGeneration = snapshot.statsSerial;
+            reads++;
+            std::this_thread::yield();
+        }
+    };
+
+    std::thread readerA(reader);
+    std::thread readerB(reader);
+
+    for (uint32_t generation = 1; generation <= WRITES; generation++) {
+        lock.write(generationSnapshot(generation));
+        if (generation % 256 == 0) {
+            std::this_thread::yield();
+        }
+    }
+    done = true;
+    readerA.join();
+    readerB.join();
+
+    TEST_ASSERT_TRUE(reads.load() > 0);
+    TEST_ASSERT_EQUAL(0, tornReads.load());
+    TEST_ASSERT_EQUAL(0, backwardsReads.load());
+    TEST_ASSERT_EQUAL(WRITES, lock.read().statsSerial);
+}
+
+// ==================== Bridge / Proxy Tests ====================
+
+void test_proxy_commands_apply_on_next_control_tick() {
+    proxy->start();
+    proxy->setCustomPresetTime(7200);
+
+    // Nothing reaches the Dryer until the control core runs
+    TEST_ASSERT_EQUAL(0, mockDryer->getStartCallCount());
+
+    bridge->update(1000);
+
+    TEST_ASSERT_EQUAL(1, mockDryer->getStartCallCount());
+    TEST_ASSERT_EQUAL(1, mockDryer->getUpdateCallCount());
+    TEST_ASSERT_EQUAL(7200, mockDryer->getCustomPreset().targetTime);
+}
+
+void test_proxy_getters_read_published_snapshot() {
+    CurrentStats stats;
+    stats.currentTemp = 63.5;
+    stats.remainingTime = 5400;
+    mockDryer->setStats(stats);
+    mockDryer->setPIDProfile(PIDProfile::STRONG);
+    mockDryer->setSoundEnabled(false);
+
+    bridge->update(1000);
+
+    TEST_ASSERT_EQUAL_FLOAT(63.5, proxy->getCurrentStats().currentTemp);
+    TEST_ASSERT_EQUAL(5400, proxy->getCurrentStats().remainingTime);
+    TEST_ASSERT_FALSE(proxy->isSoundEnabled());
+    TEST_ASSERT_EQUAL_FLOAT(80.0, proxy->getMaxTemp());
+    TEST_ASSERT_EQUAL(36000, proxy->getMaxTime());
+}
+
+void test_proxy_delivers_every_state_change_in_order() {
+    std::vector<DryerState> seen;
+    proxy->registerStateChangeCallback([&](DryerState oldState, DryerState newState) {
+        seen.push_back(newState);
+    });
+
+    mockDryer->setState(DryerState::RUNNING);
+    mockDryer->setState(DryerState::PAUSED);
+    bridge->update(1000);
+
+    // Callbacks fire on the UI side only
+    TEST_ASSERT_EQUAL(0, seen.size());
+
+    proxy->update(1000);
+
+    TEST_ASSERT_EQUAL(2, seen.size());
+    TEST_ASSERT_EQUAL(DryerState::RUNNING, seen[0]);
+    TEST_ASSERT_EQUAL(DryerState::PAUSED, seen[1]);
+    TEST_ASSERT_EQUAL(DryerState::PAUSED, proxy->getState());
+}
+
+void test_proxy_fires_stats_callback_once_per_dryer_update() {
+    int statsCalls = 0;
+    proxy->registerStatsUpdateCallback([&](const CurrentStats& stats) {
+        statsCalls++;
+    });
+
+    proxy->update(0);
+    TEST_ASSERT_EQUAL(0, statsCalls);
+
+    mockDryer->triggerStatsUpdate();
+    bridge->update(1000);
+    proxy->update(1000);
+    proxy->update(1020);
+
+    TEST_ASSERT_EQUAL(1, statsCalls);
+}
+
+void test_proxy_rejects_scale_calibration_while_running() {
+    mockDryer->setState(DryerState::RUNNING);
+    bridge->update(1000);
+
+    TEST_ASSERT_FALSE(proxy->tareScale());
+    TEST_ASSERT_FALSE(proxy->calibrateScale(500));
+
+    mockDryer->setState(DryerState::READY);
+    bridge->update(2000);
+
+    TEST_ASSERT_TRUE(proxy->calibrateScale(500));
+    bridge->update(3000);
+    TEST_ASSERT_EQUAL_FLOAT(500.0, mockDryer->getLastCalibrationMass());
+}
+
+void test_proxy_counts_commands_dropped_on_full_queue() {
+    for (size_t i = 0; i < DRYER_COMMAND_QUEUE_SIZE + 3; i++) {
+        proxy->adjustRemainingTime(60);
+    }
+
+    TEST_ASSERT_EQUAL(3, proxy->getDroppedCommands());
+
+    bridge->update(1000);
+    TEST_ASSERT_EQUAL(DRYER_COMMAND_QUEUE_SIZE, mockDryer->getAdjustRemainingTimeCallCount());
+}
+
+// ==================== Sensor Diagnostics Tests ====================
+
+void test_proxy_sensor_stats_request_answered_on_control_tick() {
+    mockSensors->getMutableChannelStats(1).skippedSamples = 7;
+    mockSensors->getMutableChannelStats(1).readDurationUs.record(850);
+    uint32_t previousSerial = proxy->getSensorStatsSerial();
+
+    TEST_ASSERT_TRUE(proxy->requestSensorStats(1));
+
+    SensorStatsReply reply;
+    TEST_ASSERT_FALSE(proxy->readSensorStats(previousSerial, reply));
+
+    bridge->update(1000);
+
+    TEST_ASSERT_TRUE(proxy->readSensorStats(previousSerial, reply));
+    TEST_ASSERT_EQUAL(1, reply.channel);
+    TEST_ASSERT_TRUE(reply.found);
+    TEST_ASSERT_EQUAL(7, reply.stats.skippedSamples);
+    TEST_ASSERT_EQUAL(1, reply.stats.readDurationUs.getCount());
+}
+
+void test_proxy_sensor_stats_reply_for_unknown_channel() {
+    uint32_t previousSerial = proxy->getSensorStatsSerial();
+    proxy->requestSensorStats(MAX_SENSOR_CHANNELS - 1);
+    bridge->update(1000);
+
+    SensorStatsReply reply;
+    TEST_ASSERT_TRUE(proxy->readSensorStats(previousSerial, reply));
+    TEST_ASSERT_FALSE(reply.found);
+}
+
+void test_proxy_sensor_stats_reset_runs_on_control_core() {
+    mockSensors->getMutableChannelStats(0).skippedSamples = 3;
+
+    proxy->resetSensorStats();
+    TEST_ASSERT_EQUAL(0, mockSensors->getResetChannelStatsCallCount());
+
+    bridge->update(1000);
+
+    TEST_ASSERT_EQUAL(1, mockSensors->getResetChannelStatsCallCount());
+    TEST_ASSERT_EQUAL(0, mockSensors->getChannelStats(0)->skippedSamples);
+}
+
+// ==================== Settings JSON Tests ====================
+
+void test_proxy_settings_export_answered_on_control_tick() {
+    mockSettings->setExportedJson("{\"pidProfile\":\"SOFT\"}");
+    uint32_t previousSerial = proxy->getSettingsReplySerial();
+
+    TEST_ASSERT_TRUE(proxy->requestSettingsJson());
+
+    SettingsJsonReply reply;
+    TEST_ASSERT_FALSE(proxy->readSettingsReply(previousSerial, reply));
+
+    bridge->update(1000);
+
+    TEST_ASSERT_TRUE(proxy->readSettingsReply(previousSerial, reply));
+    TEST_ASSERT_EQUAL(proxy->getSettingsRequestSerial(), reply.request);
+    TEST_ASSERT_TRUE(reply.ok);
+    TEST_ASSERT_EQUAL_STRING("{\"pidProfile\":\"SOFT\"}", reply.json);
+}
+
+void test_proxy_settings_import_applied_on_control_core() {
+    uint32_t previousSerial = proxy->getSettingsReplySerial();
+
+    TEST_ASSERT_TRUE(proxy->importSettingsJson("{\"soundEnabled\":false}"));
+    TEST_ASSERT_EQUAL(0, mockSettings->getImportJsonCallCount());
+
+    bridge->update(1000);
+
+    TEST_ASSERT_EQUAL(1, mockSettings->getImportJsonCallCount());
+    TEST_ASSERT_EQUAL_STRING("{\"soundEnabled\":false}", mockSettings->getLastImportedJson().c_str());
+
+    SettingsJsonReply reply;
+    TEST_ASSERT_TRUE(proxy->readSettingsReply(previousSerial, reply));
+    TEST_ASSERT_EQUAL(proxy->getSettingsRequestSerial(), reply.request);
+    TEST_ASSERT_TRUE(reply.ok);
+}
+
+void test_proxy_settings_import_reports_rejected_document() {
+    mockSettings->setAcceptImports(false);
+    uint32_t previousSerial = proxy->getSettingsReplySerial();
+
+    proxy->importSettingsJson("{\"pidProfile\":");
+    bridge->update(1000);
+
+    SettingsJsonReply reply;
+    TEST_ASSERT_TRUE(proxy->readSettingsReply(previousSerial, reply));
+    TEST_ASSERT_FALSE(reply.ok);
+}
+
+void test_proxy_settings_import_rejects_oversized_document() {
+    char json[SETTINGS_JSON_MAX_BYTES + 1];
+    memset(json, ' ', sizeof(json) - 1);
+    json[sizeof(json) - 1] = '\0';
+
+    TEST_ASSERT_FALSE(proxy->importSettingsJson(json));
+
+    bridge->update(1000);
+    TEST_ASSERT_EQUAL(0, mockSettings->getImportJsonCallCount());
+}
+
+void test_proxy_settings_import_skips_replaced_document() {
+    // The first document is overwritten before the control core runs:
+    // only the second is applied, the first command is answered "not applied"
+    proxy->importSettingsJson("{\"soundEnabled\":false}");
+    proxy->importSettingsJson("{\"soundEnabled\":true}");
+
+    bridge->update(1000);
+
+    TEST_ASSERT_EQUAL(1, mockSettings->getImportJsonCallCount());
+    TEST_ASSERT_EQUAL_STRING("{\"soundEnabled\":true}", mockSettings->getLastImportedJson().c_str());
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // SPSC queue
+    RUN_TEST(test_spsc_queue_is_fifo_and_bounded);
+    RUN_TEST(test_spsc_queue_preserves_order_across_threads);
+
+    // SeqLock
+    RUN_TEST(test_seqlock_returns_last_write);
+    RUN_TEST(test_seqlock_has_no_torn_reads_under_stress);
+
+    // Bridge / proxy
+    RUN_TEST(test_proxy_commands_apply_on_next_control_tick);
+    RUN_TEST(test_proxy_getters_read_published_snapshot);
+    RUN_TEST(test_proxy_delivers_every_state_change_in_order);
+    RUN_TEST(test_proxy_fires_stats_callback_once_per_dryer_update);
+    RUN_TEST(test_proxy_rejects_scale_calibration_while_running);
+    RUN_TEST(test_proxy_counts_commands_dropped_on_full_queue);
+
+    // Sensor diagnostics
+    RUN_TEST(test_proxy_sensor_stats_request_answered_on_control_tick);
+    RUN_TEST(test_proxy_sensor_stats_reply_for_unknown_channel);
+    RUN_TEST(test_proxy_sensor_stats_reset_runs_on_control_core);
+
+    // Settings JSON
+    RUN_TEST(test_proxy_settings_export_answered_on_control_tick);
+    RUN_TEST(test_proxy_settings_import_applied_on_control_core);
+    RUN_TEST(test_proxy_settings_import_reports_rejected_document);
+    RUN_TEST(test_proxy_settings_import_rejects_oversized_document);
+    RUN_TEST(test_proxy_settings_import_skips_replaced_document);
+
+    return UNITY_END();
+}
@@ -0,0 +1,287 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#include "../../src/storage/CycleHistoryFile.h"
+#include "../../src/storage/SettingsStorage.h"
+#include "../../src/history/CycleRecorder.h"
+
+#define HISTORY_PATH "/test_cycles.bin"
+
+CycleHistoryFile* history;
+
+static CycleRecord cycleWithDuration(uint32_t duration) {
+    CycleRecord record;
+    memset(&record, 0, sizeof(record));
+    record.endReason = static_cast<uint8_t>(CycleEndReason::FINISHED);
+    record.duration = duration;
+    return record;
+}
+
+static size_t fileSize() {
+    File file = LittleFS.open(HISTORY_PATH, "r");
+    size_t size = file.size();
+    file.close();
+    return size;
+}
+
+// Overwrite bytes in place, as a torn or stale write would leave them
+static void patchFile(size_t offset, const void* data, size_t length) {
+    File file = LittleFS.open(HISTORY_PATH, "r+");
+    file.seek(offset);
+    file.write(static_cast<const uint8_t*>(data), length);
+    file.close();
+}
+
+static void restart() {
+    delete history;
+    history = new CycleHistoryFile(HISTORY_PATH);
+    history->load();
+}
+
+void setUp(void) {
+    LittleFS.format();
+    LittleFS.begin(true);
+    history = new CycleHistoryFile(HISTORY_PATH);
+    history->load();
+}
+
+void tearDown(void) {
+    delete history;
+}
+
+// ==================== Ring File Tests ====================
+
+void test_load_preallocates_empty_history() {
+    TEST_ASSERT_EQUAL(CYCLE_HISTORY_BYTES, fileSize());
+    TEST_ASSERT_EQUAL(0, history->getLatestId());
+    TEST_ASSERT_EQUAL(0, history->getCount());
+
+    CycleRecord record;
+    TEST_ASSERT_FALSE(history->read(1, record));
+}
+
+void test_append_assigns_ids_and_reads_back_by_id() {
+    CycleRecord first = cycleWithDuration(100);
+    CycleRecord second = cycleWithDuration(200);
+    TEST_ASSERT_TRUE(history->append(first));
+    TEST_ASSERT_TRUE(history->append(second));
+
+    TEST_ASSERT_EQUAL(1, first.id);
+    TEST_ASSERT_EQUAL(2, second.id);
+    TEST_ASSERT_EQUAL(2, history->getCount());
+
+    CycleRecord record;
+    TEST_ASSERT_TRUE(history->read(1, record));
+    TEST_ASSERT_EQUAL(100, record.duration);
+    TEST_ASSERT_TRUE(history->read(2, record));
+    TEST_ASSERT_EQUAL(200, record.duration);
+    TEST_ASSERT_FALSE(history->read(3, record));
+
+    // Appends write in place: the file never grows
+    TEST_ASSERT_EQUAL(CYCLE_HISTORY_BYTES, fileSize());
+}
+
+void test_ring_rotates_oldest_cycle_out() {
+    for (uint32_t i = 1; i <= CYCLE_HISTORY_RECORDS + 2; i++) {
+        CycleRecord record = cycleWithDuration(i);
+        history->append(record);
+    }
+
+    CycleRecord record;
+    TEST_ASSERT_EQUAL(CYCLE_HISTORY_RECORDS, history->getCount());
+    TEST_ASSERT_FALSE(history->read(1, record));
+    TEST_ASSERT_FALSE(history->read(2, record));
+    TEST_ASSERT_TRUE(history->read(3, record));
+    TEST_ASSERT_EQUAL(3, record.duration);
+    TEST_ASSERT_TRUE(history->read(CYCLE_HISTORY_RECORDS + 2, record));
+    TEST_ASSERT_EQUAL(CYCLE_HISTORY_RECORDS + 2, record.duration);
+}
+
+void test_read_recent_lists_newest_first() {
+    for (uint32_t i = 1; i <= 5; i++) {
+        CycleRecord record = cycleWithDuration(i * 10);
+        history->append(record);
+    }
+
+    CycleRecord recent[3];
+    TEST_ASSERT_EQUAL(3, history->readRecent(recent, 3));
+    TEST_ASSERT_EQUAL(5, recent[0].id);
+    TEST_ASSERT_EQUAL(4, recent[1].id);
+    TEST_ASSERT_EQUAL(3, recent[2].id);
+    TEST_ASSERT_EQUAL(30, recent[2].duration);
+}
+
+void test_history_survives_restart() {
+    CycleRecord record = cycleWithDuration(3600);
+    history->append(record);
+
+    restart();
+
+    TEST_ASSERT_EQUAL(1, history->getLatestId());
+    TEST_ASSERT_TRUE(history->read(1, record));
+    TEST_ASSERT_EQUAL(3600, record.duration);
+    TEST_ASSERT_EQUAL(0, history->getHeaderRepairs());
+}
+
+// ==================== Repair Tests ====================
+
+void test_record_written_before_header_is_rolled_forward() {
+    CycleRecord first = cycleWithDuration(100);
+    CycleRecord second = cycleWithDuration(200);
+    history->append(first);
+    history->append(second);
+
+    // Power cut after the record, before the header: header still says "next is 2"
+    CycleHistoryHeader stale;
+    File file = LittleFS.open(HISTORY_PATH, "r");
+    file.readBytes(reinterpret_cast<char*>(&stale), sizeof(stale));
+    file.close();
+    stale.nextId = 2;
+    stale.crc = crc32(&stale, offsetof(CycleHistoryHeader, crc));
+    patchFile(0, &stale, sizeof(stale));
+
+    restart();
+
+    CycleRecord record;
+    TEST_ASSERT_EQUAL(2, history->getLatestId());
+    TEST_ASSERT_TRUE(history->read(2, record));
+    TEST_ASSERT_EQUAL(1, history->getHeaderRepairs());
+}
+
+void test_damaged_header_is_rebuilt_from_slots() {
+    for (uint32_t i = 1; i <= 3; i++) {
+        CycleRecord record = cycleWithDuration(i);
+        history->append(record);
+    }
+
+    uint8_t garbage[8] = {0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0};
+    patchFile(0, garbage, sizeof(garbage));
+
+    restart();
+
+    CycleRecord record;
+    TEST_ASSERT_EQUAL(3, history->getLatestId());
+    TEST_ASSERT_TRUE(history->read(1, record));
+    TEST_ASSERT_TRUE(history->read(3, record));
+}
+
+void test_torn_record_reads_as_missing() {
+    CycleRecord record = cycleWithDuration(100);
+    history->append(record);
+
+    uint8_t torn = 0x00;
+    patchFile(sizeof(CycleRecord) + 20, &torn, 1);   // Inside slot 0
+
+    TEST_ASSERT_FALSE(history->read(1, record));
+}
+
+// ==================== Recorder Tests ====================
+
+void test_recorder_tracks_temperature_and_humidity() {
+    CycleRecorder recorder;
+    recorder.begin(0, PresetType::PETG, PIDProfile::STRONG, 65.0, 3600, false);
+
+    recorder.sample(0, 40.0, 70.0, 35.0, 0);
+    recorder.sample(1000, 60.0, 85.0, 25.0, 0);
+    recorder.sample(1500, 99.0, 99.0, 99.0, 0);   // Inside the interval: ignored
+    recorder.sample(2000, 50.0, 80.0, 15.0, 0);
+
+    CycleRecord record;
+    TEST_ASSERT_TRUE(recorder.finish(CycleEndReason::FINISHED, 3600, 3600, 12.5, record));
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(PresetType::PETG), record.preset);
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(PIDProfile::STRONG), record.pidProfile);
+    TEST_ASSERT_EQUAL_FLOAT(40.0, record.getBoxTempMin());
+    TEST_ASSERT_EQUAL_FLOAT(60.0, record.getBoxTempMax());
+    TEST_ASSERT_EQUAL_FLOAT(50.0, record.getBoxTempMean());
+    TEST_ASSERT_EQUAL_FLOAT(85.0, record.getHeaterTempMax());
+    TEST_ASSERT_EQUAL_FLOAT(35.0, record.getHumidityStart());
+    TEST_ASSERT_EQUAL_FLOAT(15.0, record.getHumidityEnd());
+    TEST_ASSERT_EQUAL_FLOAT(12.5, record.waterRemoved);
+
+    // Only one finish per cycle
+    TEST_ASSERT_FALSE(recorder.finish(CycleEndReason::FINISHED, 3600, 3600, 0, record));
+}
+
+void test_recorder_energy_skips_pauses() {
+    CycleRecorder recorder;
+    recorder.begin(0, PresetType::PLA, PIDProfile::NORMAL, 50.0, 7200, false);
+
+    // One hour at 50% PWM
+    for (uint32_t t = 0; t <= 3600000; t += CYCLE_SAMPLE_INTERVAL_MS) {
+        recorder.sample(t, 50.0, 60.0, 30.0, PWM_MAX / 2);
+    }
+
+    // Paused for an hour, then resumed: the gap costs nothing
+    recorder.resume(7200000);
+    recorder.sample(7200000, 50.0, 60.0, 30.0, PWM_MAX / 2);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.5, HEATER_RATED_POWER_W / 2, recorder.getEnergyWh());
+}
+
+void test_recorder_keeps_first_fault_reason() {
+    CycleRecorder recorder;
+    recorder.noteFault("Ignored");                 // No cycle yet
+    recorder.begin(0, PresetType::PLA, PIDProfile::NORMAL, 50.0, 7200, true);
+    recorder.noteFault();
+    recorder.noteFault("Heater overtemperature limit");
+    recorder.noteFault("Later");
+
+    CycleRecord record;
+    recorder.finish(CycleEndReason::FAILED, 60, 7200, 0, record);
+    TEST_ASSERT_EQUAL(3, record.faultCount);
+    TEST_ASSERT_EQUAL_STRING("Heater overtemp", record.faultReason);   // Truncated, terminated
+    TEST_ASSERT_EQUAL(CYCLE_FLAG_RECOVERED, record.flags);
+}
+
+// ==================== Storage Integration Tests ====================
+
+void test_storage_appends_cycles_behind_and_keeps_them() {
+    SettingsStorage* storage = new SettingsStorage();
+    storage->begin();
+
+    CycleRecord record = cycleWithDuration(5400);
+    storage->saveCycleRecord(record);
+    TEST_ASSERT_EQUAL(0, storage->getCycleHistory().getLatestId());   // Queued, not written
+
+    storage->sync();
+    delete storage;
+
+    storage = new SettingsStorage();
+    storage->begin();
+    TEST_ASSERT_EQUAL(1, storage->getCycleHistory().getLatestId());
+    TEST_ASSERT_TRUE(storage->getCycleHistory().read(1, record));
+    TEST_ASSERT_EQUAL(5400, record.duration);
+    delete storage;
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // Ring file
+    RUN_TEST(test_load_preallocates_empty_history);
+    RUN_TEST(test_append_assigns_ids_and_reads_back_by_id);
+    RUN_TEST(test_ring_rotates_oldest_cycle_out);
+    RUN_TEST(test_read_recent_lists_newest_first);
+    RUN_TEST(test_history_survives_restart);
+
+    // Repair
+    RUN_TEST(test_record_written_before_header_is_rolled_forward);
+    RUN_TEST(test_damaged_header_is_rebuilt_from_slots);
+    RUN_TEST(test_torn_record_reads_as_missing);
+
+    // Recorder
+    RUN_TEST(test_recorder_tracks_temperature_and_humidity);
+    RUN_TEST(test_recorder_energy_skips_pauses);
+    RUN_TEST(test_recorder_keeps_first_fault_reason);
+
+    // Storage integration
+    RUN_TEST(test_storage_appends_cycles_behind_and_keeps_them);
+
+    return UNITY_END();
+}
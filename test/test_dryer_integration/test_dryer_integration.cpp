@@ -14,6 +14,9 @@
 #include "../mocks/MockSettingsStorage.h"
 #include "../mocks/MockSoundController.h"
 #include "../mocks/MockFanControl.h"
+#include "../mocks/MockWeightSensor.h"
+#include "../mocks/MockRecoveryMemory.h"
+#include "../../src/sensors/SensorChannelAdapters.h"
 
 // Test fixture
 MockSensorManager* sensors;
@@ -367,6 +370,216 @@ void test_dryer_fires_stats_update_callback() {
     TEST_ASSERT_TRUE(callbackFired);
 }
 
+// ==================== Humidity Estimation Tests ====================
+
+void test_dryer_reports_absolute_humidity_and_dew_point() {
+    dryer->begin(0);
+
+    // 50°C at 20% RH: ~16.6 g/m³, dew point ~21°C
+    sensors->triggerBoxDataUpdate(50.0, 20.0, 1000);
+
+    CurrentStats stats = dryer->getCurrentStats();
+    TEST_ASSERT_FLOAT_WITHIN(0.3, 16.6, stats.absoluteHumidity);
+    TEST_ASSERT_FLOAT_WITHIN(0.5, 21.0, stats.dewPoint);
+}
+
+void test_dryer_estimates_water_removed_while_running() {
+    MockFanControl* mockFan = new MockFanControl();
+    Dryer* dryerWithFan = new Dryer(sensors, heater, pid, safety, storage, sound, mockFan);
+    dryerWithFan->begin(0);
+    dryerWithFan->start();
+
+    // Baseline: ambient box air, then one minute later warm and moist
+    sensors->triggerBoxDataUpdate(25.0, 50.0, 0);
+    sensors->triggerBoxDataUpdate(50.0, 20.0, 60000);
+
+    float intake = Psychrometrics::absoluteHumidity(25.0, 50.0);
+    float chamber = Psychrometrics::absoluteHumidity(50.0, 20.0);
+    float expected = (FAN_EXHAUST_FLOW_M3H / 3600.0f) * (chamber - intake) * 60.0f +
+                     CHAMBER_VOLUME_M3 * (chamber - intake);
+
+    CurrentStats stats = dryerWithFan->getCurrentStats();
+    TEST_ASSERT_FLOAT_WITHIN(0.001, expected, stats.waterRemoved);
+    TEST_ASSERT_TRUE(stats.waterRemoved > 0);
+
+    delete dryerWithFan;
+    delete mockFan;
+}
+
+void test_dryer_does_not_integrate_water_when_not_running() {
+    dryer->begin(0);
+
+    sensors->triggerBoxDataUpdate(25.0, 50.0, 0);
+    sensors->triggerBoxDataUpdate(50.0, 20.0, 60000);
+
+    TEST_ASSERT_EQUAL_FLOAT(0.0, dryer->getCurrentStats().waterRemoved);
+}
+
+void test_dryer_resets_water_removed_on_new_cycle() {
+    dryer->begin(0);
+    dryer->start();
+    sensors->triggerBoxDataUpdate(25.0, 50.0, 0);
+    sensors->triggerBoxDataUpdate(50.0, 30.0, 60000);
+    TEST_ASSERT_TRUE(dryer->getCurrentStats().waterRemoved > 0);
+
+    dryer->stop();
+    dryer->start();
+
+    TEST_ASSERT_EQUAL_FLOAT(0.0, dryer->getCurrentStats().waterRemoved);
+}
+
+// ==================== Spool Scale Tests ====================
+
+// Scale fixture: weight sensor registered as a channel before begin(), as in main.cpp
+MockWeightSensor* scale;
+SpoolWeightChannel* scaleChannel;
+uint8_t scaleChannelId;
+Dryer* scaleDryer;
+
+static void createScaleDryer() {
+    scale = new MockWeightSensor();
+    scaleChannel = new SpoolWeightChannel(scale);
+    scaleChannelId = sensors->registerChannel(scaleChannel,
+        SensorChannelConfig(WEIGHT_SENSOR_INTERVAL, SENSOR_TIMEOUT));
+    scaleDryer = new Dryer(sensors, heater, pid, safety, storage, sound, nullptr, scale);
+}
+
+static void destroyScaleDryer() {
+    delete scaleDryer;
+    delete scaleChannel;
+    delete scale;
+}
+
+// Feed a weight sample every 10s from fromSeconds to toSeconds, losing lossPerHour
+static void runWithSpoolWeight(uint32_t fromSeconds, uint32_t toSeconds, float startGrams, float lossPerHour) {
+    for (uint32_t t = fromSeconds; t <= toSeconds; t += 10) {
+        float grams = startGrams - lossPerHour * t / 3600.0f;
+        sensors->triggerChannelUpdate(scaleChannelId, grams, t * 1000);
+        scaleDryer->update(t * 1000);
+        if (scaleDryer->getState() != DryerState::RUNNING) {
+            return;
+        }
+    }
+}
+
+void test_dryer_loads_scale_calibration_on_begin() {
+    createScaleDryer();
+    storage->setScaleCalibration(ScaleCalibration(1234, 420.0f));
+
+    scaleDryer->begin(0);
+
+    TEST_ASSERT_TRUE(scale->isCalibrated());
+    TEST_ASSERT_EQUAL(1234, scale->getCalibration().tareOffset);
+    TEST_ASSERT_EQUAL_FLOAT(420.0, scale->getCalibration().countsPerGram);
+
+    destroyScaleDryer();
+}
+
+void test_dryer_stats_report_sensor_and_scale_validity() {
+    createScaleDryer();
+    scaleDryer->begin(0);
+
+    CurrentStats stats = scaleDryer->getCurrentStats();
+    TEST_ASSERT_TRUE(stats.heaterTempValid);
+    TEST_ASSERT_TRUE(stats.boxDataValid);
+    TEST_ASSERT_FALSE(stats.scaleCalibrated);
+
+    storage->setScaleCalibration(ScaleCalibration(0, 420.0f));
+    scaleDryer->begin(0);
+    sensors->setBoxDataInvalid();
+    scale->setInvalid("HX711 timeout");
+
+    stats = scaleDryer->getCurrentStats();
+    TEST_ASSERT_TRUE(stats.heaterTempValid);
+    TEST_ASSERT_FALSE(stats.boxDataValid);
+    TEST_ASSERT_TRUE(stats.scaleCalibrated);
+    TEST_ASSERT_FALSE(stats.scaleValid);
+
+    destroyScaleDryer();
+}
+
+void test_dryer_tare_and_calibrate_persist_calibration() {
+    createScaleDryer();
+    scaleDryer->begin(0);
+
+    scale->setLoad(0);
+    TEST_ASSERT_TRUE(scaleDryer->tareScale());
+
+    scale->setLoad(500);
+    TEST_ASSERT_TRUE(scaleDryer->calibrateScale(500));
+
+    TEST_ASSERT_EQUAL(2, storage->getSaveScaleCalibrationCallCount());
+    TEST_ASSERT_EQUAL_FLOAT(MockWeightSensor::COUNTS_PER_GRAM,
+                            storage->loadScaleCalibration().countsPerGram);
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 500.0, scale->getWeight());
+
+    destroyScaleDryer();
+}
+
+void test_dryer_rejects_scale_calibration_while_running() {
+    createScaleDryer();
+    scaleDryer->begin(0);
+    scaleDryer->start();
+
+    TEST_ASSERT_FALSE(scaleDryer->tareScale());
+    TEST_ASSERT_FALSE(scaleDryer->calibrateScale(500));
+    TEST_ASSERT_EQUAL(0, storage->getSaveScaleCalibrationCallCount());
+
+    destroyScaleDryer();
+}
+
+void test_dryer_scale_calls_fail_without_weight_sensor() {
+    dryer->begin(0);
+
+    TEST_ASSERT_FALSE(dryer->tareScale());
+    TEST_ASSERT_FALSE(dryer->calibrateScale(500));
+}
+
+void test_dryer_finishes_when_mass_loss_flattens() {
+    createScaleDryer();
+    storage->setScaleCalibration(ScaleCalibration(MockWeightSensor::ZERO_RAW, MockWeightSensor::COUNTS_PER_GRAM));
+    scaleDryer->begin(0);
+    scaleDryer->start();
+
+    // Spool is dry: weight is flat, but the first hour never ends on weight
+    runWithSpoolWeight(0, DRY_END_MIN_ELAPSED_S - 10, 1000.0, 0.0);
+    TEST_ASSERT_EQUAL(DryerState::RUNNING, scaleDryer->getState());
+
+    runWithSpoolWeight(DRY_END_MIN_ELAPSED_S, DRY_END_MIN_ELAPSED_S + 600, 1000.0, 0.0);
+    TEST_ASSERT_EQUAL(DryerState::FINISHED, scaleDryer->getState());
+    TEST_ASSERT_TRUE(scaleDryer->getCurrentStats().elapsedTime < TEST_PRESET_PLA_TIME);
+
+    destroyScaleDryer();
+}
+
+void test_dryer_keeps_running_while_spool_loses_mass() {
+    createScaleDryer();
+    storage->setScaleCalibration(ScaleCalibration(MockWeightSensor::ZERO_RAW, MockWeightSensor::COUNTS_PER_GRAM));
+    scaleDryer->begin(0);
+    scaleDryer->start();
+
+    runWithSpoolWeight(0, DRY_END_MIN_ELAPSED_S + 1800, 1000.0, 5.0);
+
+    TEST_ASSERT_EQUAL(DryerState::RUNNING, scaleDryer->getState());
+    TEST_ASSERT_FLOAT_WITHIN(0.1, 5.0, scaleDryer->getCurrentStats().massLossRate);
+    TEST_ASSERT_TRUE(scaleDryer->getCurrentStats().spoolWeight < 1000.0);
+
+    destroyScaleDryer();
+}
+
+void test_dryer_ignores_weight_end_without_calibration() {
+    createScaleDryer();
+    scaleDryer->begin(0);
+    scaleDryer->start();
+
+    runWithSpoolWeight(0, DRY_END_MIN_ELAPSED_S + 1800, 1000.0, 0.0);
+
+    TEST_ASSERT_EQUAL(DryerState::RUNNING, scaleDryer->getState());
+    TEST_ASSERT_EQUAL_FLOAT(0.0, scaleDryer->getCurrentStats().spoolWeight);
+
+    destroyScaleDryer();
+}
+
 // ==================== Preset Tests ====================
 
 void test_dryer_selects_pla_preset() {
@@ -480,6 +693,165 @@ void test_dryer_does_not_persist_when_not_running() {
     TEST_ASSERT_EQUAL(0, storage->getSaveRuntimeStateCallCount());
 }
 
+void test_dryer_drives_coalesced_settings_writes() {
+    dryer->begin(0);
+    storage->resetCounts();
+
+    // Every tick gives storage its debounce clock, in any state
+    dryer->update(1000);
+    dryer->update(2000);
+    TEST_ASSERT_EQUAL(2, storage->getUpdateCallCount());
+    TEST_ASSERT_EQUAL(0, storage->getFlushCallCount());
+
+    // Transitions write pending settings at once
+    dryer->start();
+    TEST_ASSERT_EQUAL(1, storage->getFlushCallCount());
+    dryer->pause();
+    TEST_ASSERT_EQUAL(2, storage->getFlushCallCount());
+}
+
+// ==================== Cycle History Tests ====================
+
+void test_dryer_records_finished_cycle() {
+    dryer->begin(0);
+    dryer->selectPreset(PresetType::PLA);
+    dryer->start();
+
+    sensors->triggerBoxDataUpdate(45.0, 40.0, 1000);
+    dryer->update(1000);
+    sensors->triggerBoxDataUpdate(55.0, 20.0, 2000);
+    dryer->update(2000);
+    TEST_ASSERT_EQUAL(0, storage->getSaveCycleRecordCallCount());
+
+    dryer->update(18001000);
+    TEST_ASSERT_EQUAL(DryerState::FINISHED, dryer->getState());
+
+    TEST_ASSERT_EQUAL(1, storage->getSaveCycleRecordCallCount());
+    const CycleRecord& cycle = storage->getLastCycleRecord();
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(CycleEndReason::FINISHED), cycle.endReason);
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(PresetType::PLA), cycle.preset);
+    TEST_ASSERT_EQUAL(18001, cycle.duration);
+    TEST_ASSERT_EQUAL(PRESET_PLA_TIME, cycle.targetTime);
+    TEST_ASSERT_EQUAL_FLOAT(45.0, cycle.getBoxTempMin());
+    TEST_ASSERT_EQUAL_FLOAT(55.0, cycle.getBoxTempMax());
+    TEST_ASSERT_EQUAL_FLOAT(40.0, cycle.getHumidityStart());
+    TEST_ASSERT_EQUAL_FLOAT(20.0, cycle.getHumidityEnd());
+    TEST_ASSERT_EQUAL(0, cycle.faultCount);
+}
+
+void test_dryer_records_stopped_and_failed_cycles() {
+    dryer->begin(0);
+
+    dryer->start();
+    dryer->stop();
+    TEST_ASSERT_EQUAL(1, storage->getSaveCycleRecordCallCount());
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(CycleEndReason::STOPPED),
+                      storage->getLastCycleRecord().endReason);
+
+    dryer->start();
+    safety->triggerEmergency("Overheat");
+    safety->update(1000);
+    TEST_ASSERT_EQUAL(2, storage->getSaveCycleRecordCallCount());
+    const CycleRecord& cycle = storage->getLastCycleRecord();
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(CycleEndReason::FAILED), cycle.endReason);
+    TEST_ASSERT_EQUAL(1, cycle.faultCount);
+    TEST_ASSERT_EQUAL_STRING("Overheat", cycle.faultReason);
+}
+
+void test_dryer_records_cycle_only_after_heater_is_off() {
+    storage->watchHeater(heater);
+    dryer->begin(0);
+
+    dryer->start();
+    dryer->update(5000);
+    dryer->pause();
+    dryer->update(8000);
+    dryer->resume();
+    dryer->update(10000);
+    dryer->stop();
+
+    TEST_ASSERT_EQUAL(1, storage->getSaveCycleRecordCallCount());
+    TEST_ASSERT_FALSE(storage->wasHeaterRunningAtCycleRecord());
+    // Elapsed was taken before the transition reset it
+    TEST_ASSERT_EQUAL(7, storage->getLastCycleRecord().duration);
+
+    dryer->start();
+    dryer->update(12000);
+    safety->triggerEmergency("Overheat");
+    safety->update(12000);
+
+    TEST_ASSERT_EQUAL(DryerState::FAILED, dryer->getState());
+    TEST_ASSERT_EQUAL(2, storage->getSaveCycleRecordCallCount());
+    TEST_ASSERT_FALSE(storage->wasHeaterRunningAtCycleRecord());
+    TEST_ASSERT_EQUAL(2, storage->getLastCycleRecord().duration);
+}
+
+void test_dryer_records_no_cycle_without_a_run() {
+    dryer->begin(0);
+
+    dryer->reset();
+    dryer->start();
+    dryer->pause();
+    dryer->resume();
+
+    // Pausing does not end the cycle; resetting the finished dryer adds nothing
+    TEST_ASSERT_EQUAL(0, storage->getSaveCycleRecordCallCount());
+    dryer->update(18001000);
+    dryer->reset();
+    TEST_ASSERT_EQUAL(1, storage->getSaveCycleRecordCallCount());
+}
+
+// ==================== Telemetry Tests ====================
+
+void test_dryer_records_telemetry_for_each_pid_step() {
+    dryer->begin(0);
+    dryer->start();
+    pid->setOutput(40.0);
+    pid->setTerms(8.0, 35.5, -2.5);
+
+    sensors->triggerBoxDataUpdate(48.0, 30.0, 500);
+    sensors->triggerHeaterTempUpdate(62.0, 1000);
+    sensors->triggerHeaterTempUpdate(62.5, 2000);
+    TEST_ASSERT_EQUAL(0, storage->getSaveTelemetryPageCallCount());   // Still filling the page
+
+    // Pause hands the partial page over, flagged as a recording start
+    dryer->pause();
+    TEST_ASSERT_EQUAL(1, storage->getSaveTelemetryPageCallCount());
+    const TelemetryPage& page = storage->getLastTelemetryPage();
+    TEST_ASSERT_EQUAL(TELEMETRY_PAGE_FIRST, page.header.flags);
+    TEST_ASSERT_EQUAL(2, page.header.sampleCount);
+
+    TelemetryPageDecoder decoder(page);
+    TelemetrySample sample;
+    TEST_ASSERT_TRUE(decoder.next(sample));
+    TEST_ASSERT_TRUE(decoder.next(sample));
+    TEST_ASSERT_EQUAL_FLOAT(62.5, sample.getHeaterTemp());
+    TEST_ASSERT_EQUAL_FLOAT(48.0, sample.getBoxTemp());
+    TEST_ASSERT_EQUAL(40, sample.getPWM());
+    TEST_ASSERT_EQUAL_FLOAT(35.5, sample.getITerm());
+}
+
+void test_dryer_telemetry_continues_after_pause_and_closes_at_end() {
+    dryer->begin(0);
+    dryer->start();
+    sensors->triggerHeaterTempUpdate(60.0, 1000);
+    dryer->pause();
+    dryer->resume();
+    sensors->triggerHeaterTempUpdate(61.0, 2000);
+
+    // Same recording: the second page is not a start
+    dryer->stop();
+    TEST_ASSERT_EQUAL(2, storage->getSaveTelemetryPageCallCount());
+    TEST_ASSERT_EQUAL(0, storage->getLastTelemetryPage().header.flags);
+    TEST_ASSERT_EQUAL(1, storage->getLastTelemetryPage().header.firstSample);
+
+    // Nothing is recorded while not heating
+    sensors->triggerHeaterTempUpdate(40.0, 3000);
+    dryer->start();
+    dryer->stop();
+    TEST_ASSERT_EQUAL(2, storage->getSaveTelemetryPageCallCount());
+}
+
 // ==================== Constraint Getters Tests ====================
 
 void test_dryer_provides_constraints() {
@@ -1237,6 +1609,90 @@ void test_dryer_power_recovery_loads_all_settings() {
     TEST_ASSERT_EQUAL(14400, stats.remainingTime + stats.elapsedTime);  // Total time
 }
 
+// ==================== Recovery Memory Tests ====================
+
+void test_dryer_mirrors_snapshot_to_recovery_memory_every_tick() {
+    MockRecoveryMemory memory;
+    Dryer dryerWithMemory(sensors, heater, pid, safety, storage, sound, nullptr, nullptr, &memory);
+    dryerWithMemory.begin(0);
+    dryerWithMemory.start();
+    pid->setRecoveryState(12.5f, 33.0f);
+    memory.resetCounts();
+
+    dryerWithMemory.update(1000);
+    dryerWithMemory.update(2000);
+    dryerWithMemory.update(3000);
+
+    TEST_ASSERT_EQUAL(3, memory.getStoreCallCount());
+    const RecoverySnapshot& mirrored = memory.getSnapshot();
+    TEST_ASSERT_EQUAL(DryerState::RUNNING, mirrored.state);
+    TEST_ASSERT_EQUAL(3, mirrored.elapsed);
+    TEST_ASSERT_EQUAL_FLOAT(dryerWithMemory.getCurrentStats().targetTemp, mirrored.targetTemp);
+    TEST_ASSERT_EQUAL_FLOAT(12.5f, mirrored.pid.integral);
+    TEST_ASSERT_EQUAL_FLOAT(33.0f, mirrored.pid.steadyStateOutput);
+}
+
+void test_dryer_recovers_from_recovery_memory_before_flash() {
+    MockRecoveryMemory memory;
+    storage->setRuntimeState(DryerState::RUNNING, 5000, 60.0, 18000, PresetType::PETG);
+    memory.setSnapshot(DryerState::RUNNING, 5009, 60.0, 18000, PresetType::PETG, 14.0f, 41.0f);
+    Dryer dryerWithMemory(sensors, heater, pid, safety, storage, sound, nullptr, nullptr, &memory);
+
+    dryerWithMemory.begin(0);
+
+    TEST_ASSERT_EQUAL(DryerState::POWER_RECOVERED, dryerWithMemory.getState());
+    TEST_ASSERT_EQUAL(5009, dryerWithMemory.getCurrentStats().elapsedTime);
+
+    // PID resumes with its integrator and learned output
+    TEST_ASSERT_EQUAL(1, pid->getRestoreCallCount());
+    TEST_ASSERT_EQUAL_FLOAT(14.0f, pid->getRecoveryState().integral);
+    TEST_ASSERT_EQUAL_FLOAT(41.0f, pid->getRecoveryState().steadyStateOutput);
+
+    // Flash catches up with the newer point
+    TEST_ASSERT_EQUAL(5009, storage->getRuntimeElapsed());
+}
+
+void test_dryer_falls_back_to_flash_without_recovery_memory_snapshot() {
+    MockRecoveryMemory memory;     // Power-on: nothing intact
+    storage->setRuntimeState(DryerState::PAUSED, 7200, 60.0, 14400, PresetType::PLA);
+    Dryer dryerWithMemory(sensors, heater, pid, safety, storage, sound, nullptr, nullptr, &memory);
+
+    dryerWithMemory.begin(0);
+
+    TEST_ASSERT_EQUAL(DryerState::POWER_RECOVERED, dryerWithMemory.getState());
+    TEST_ASSERT_EQUAL(7200, dryerWithMemory.getCurrentStats().elapsedTime);
+    TEST_ASSERT_EQUAL(0, pid->getRestoreCallCount());
+}
+
+void test_dryer_finished_cycle_in_recovery_memory_clears_stale_flash() {
+    MockRecoveryMemory memory;
+    storage->setRuntimeState(DryerState::RUNNING, 17990, 60.0, 18000, PresetType::PETG);
+    memory.setSnapshot(DryerState::FINISHED, 18000, 60.0, 18000, PresetType::PETG);
+    Dryer dryerWithMemory(sensors, heater, pid, safety, storage, sound, nullptr, nullptr, &memory);
+
+    dryerWithMemory.begin(0);
+
+    TEST_ASSERT_EQUAL(DryerState::READY, dryerWithMemory.getState());
+    TEST_ASSERT_EQUAL(1, storage->getClearRuntimeStateCallCount());
+    TEST_ASSERT_FALSE(storage->hasValidRuntimeState());
+}
+
+void test_dryer_keeps_recovered_snapshot_while_power_recovered() {
+    MockRecoveryMemory memory;
+    memory.setSnapshot(DryerState::RUNNING, 5009, 60.0, 18000, PresetType::PETG, 14.0f, 41.0f);
+    Dryer dryerWithMemory(sensors, heater, pid, safety, storage, sound, nullptr, nullptr, &memory);
+    dryerWithMemory.begin(0);
+    memory.resetCounts();
+
+    dryerWithMemory.update(1000);
+    dryerWithMemory.update(2000);
+
+    // A second reset before the user decides still recovers the same point
+    TEST_ASSERT_EQUAL(0, memory.getStoreCallCount());
+    TEST_ASSERT_EQUAL(DryerState::RUNNING, memory.getSnapshot().state);
+    TEST_ASSERT_EQUAL(5009, memory.getSnapshot().elapsed);
+}
+
 // ==================== Main Test Runner ====================
 
 int main(int argc, char **argv) {
@@ -1281,6 +1737,22 @@ int main(int argc, char **argv) {
     RUN_TEST(test_dryer_calculates_remaining_time);
     RUN_TEST(test_dryer_fires_stats_update_callback);
 
+    // Humidity estimation
+    RUN_TEST(test_dryer_reports_absolute_humidity_and_dew_point);
+    RUN_TEST(test_dryer_estimates_water_removed_while_running);
+    RUN_TEST(test_dryer_does_not_integrate_water_when_not_running);
+    RUN_TEST(test_dryer_resets_water_removed_on_new_cycle);
+
+    // Spool scale
+    RUN_TEST(test_dryer_loads_scale_calibration_on_begin);
+    RUN_TEST(test_dryer_stats_report_sensor_and_scale_validity);
+    RUN_TEST(test_dryer_tare_and_calibrate_persist_calibration);
+    RUN_TEST(test_dryer_rejects_scale_calibration_while_running);
+    RUN_TEST(test_dryer_scale_calls_fail_without_weight_sensor);
+    RUN_TEST(test_dryer_finishes_when_mass_loss_flattens);
+    RUN_TEST(test_dryer_keeps_running_while_spool_loses_mass);
+    RUN_TEST(test_dryer_ignores_weight_end_without_calibration);
+
     // Presets
     RUN_TEST(test_dryer_selects_pla_preset);
     RUN_TEST(test_dryer_selects_petg_preset);
@@ -1298,6 +1770,17 @@ int main(int argc, char **argv) {
     // Persistence
     RUN_TEST(test_dryer_persists_state_during_running);
     RUN_TEST(test_dryer_does_not_persist_when_not_running);
+    RUN_TEST(test_dryer_drives_coalesced_settings_writes);
+
+    // Cycle history
+    RUN_TEST(test_dryer_records_finished_cycle);
+    RUN_TEST(test_dryer_records_stopped_and_failed_cycles);
+    RUN_TEST(test_dryer_records_cycle_only_after_heater_is_off);
+    RUN_TEST(test_dryer_records_no_cycle_without_a_run);
+
+    // Telemetry
+    RUN_TEST(test_dryer_records_telemetry_for_each_pid_step);
+    RUN_TEST(test_dryer_telemetry_continues_after_pause_and_closes_at_end);
 
     // Constraints
     RUN_TEST(test_dryer_provides_constraints);
@@ -1354,5 +1837,12 @@ int main(int argc, char **argv) {
     RUN_TEST(test_dryer_power_recovery_loads_sound_setting);
     RUN_TEST(test_dryer_power_recovery_loads_all_settings);
 
+    // Recovery memory
+    RUN_TEST(test_dryer_mirrors_snapshot_to_recovery_memory_every_tick);
+    RUN_TEST(test_dryer_recovers_from_recovery_memory_before_flash);
+    RUN_TEST(test_dryer_falls_back_to_flash_without_recovery_memory_snapshot);
+    RUN_TEST(test_dryer_finished_cycle_in_recovery_memory_clears_stale_flash);
+    RUN_TEST(test_dryer_keeps_recovered_snapshot_while_power_recovered);
+
     return UNITY_END();
 }
\ No newline at end of file
@@ -0,0 +1,153 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#include <chrono>
+#include <stdio.h>
+
+#include "../TestConfig.h"
+#include "../../src/Dryer.h"
+#include "../../src/sensors/SensorManager.h"
+#include "../../src/control/HeaterControl.h"
+#include "../../src/control/PIDController.h"
+#include "../../src/control/SafetyMonitor.h"
+#include "../mocks/MockHeaterTempSensor.h"
+#include "../mocks/MockBoxTempHumiditySensor.h"
+#include "../mocks/MockSettingsStorage.h"
+
+// Firmware-style wiring: control path bound to the concrete classes
+using StaticDryer = BasicDryer<SensorManager, HeaterControl, PIDController,
+                               SafetyMonitor, MockSettingsStorage>;
+
+constexpr uint32_t TICK_MS = CONTROL_TASK_PERIOD_MS;
+constexpr uint32_t RUN_MS = 30UL * 60UL * 1000UL;   // 30 minute cycle
+
+/**
+ * One complete control stack around a Dryer variant. Both variants get
+ * the same concrete components; only the Dryer's view of them differs.
+ */
+template <typename DryerType>
+struct Rig {
+    MockHeaterTempSensor heaterSensor;
+    MockBoxTempHumiditySensor boxSensor;
+    SensorManager sensors;
+    HeaterControl heater;
+    PIDController pid;
+    SafetyMonitor safety;
+    MockSettingsStorage storage;
+    DryerType dryer;
+
+    Rig()
+        : sensors(&heaterSensor, &boxSensor),
+          dryer(&sensors, &heater, &pid, &safety, &storage) {
+        heaterSensor.setTemperature(40.0);
+        boxSensor.setReadings(30.0, 45.0);
+        sensors.begin();
+        heater.begin(0);
+        dryer.begin(0);
+        dryer.start();
+    }
+
+    // Crude plant: heater follows PWM, box follows heater
+    void tick(uint32_t now) {
+        float pwm = dryer.getCurrentStats().pwmOutput;
+        float heaterTemp = 25.0 + pwm * 0.5;
+        heaterSensor.setTemperature(heaterTemp);
+        boxSensor.setReadings(20.0 + pwm * 0.35, 45.0);
+
+        dryer.update(now);
+        heater.update(now);
+    }
+};
+
+template <typename DryerType>
+static double nanosPerTick() {
+    Rig<DryerType> rig;
+    auto start = std::chrono::steady_clock::now();
+    uint32_t ticks = 0;
+    for (uint32_t now = 0; now < RUN_MS; now += TICK_MS) {
+        rig.tick(now);
+        ticks++;
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / ticks;
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+// ==================== Equivalence Tests ====================
+
+void test_static_wiring_behaves_like_interface_wiring() {
+    Rig<Dryer> virtualRig;
+    Rig<StaticDryer> staticRig;
+
+    for (uint32_t now = 0; now < RUN_MS; now += TICK_MS) {
+        virtualRig.tick(now);
+        staticRig.tick(now);
+
+        CurrentStats a = virtualRig.dryer.getCurrentStats();
+        CurrentStats b = staticRig.dryer.getCurrentStats();
+        if (a.pwmOutput != b.pwmOutput || a.boxTemp != b.boxTemp) {
+            TEST_FAIL_MESSAGE("Static and interface wiring diverged");
+        }
+    }
+
+    TEST_ASSERT_EQUAL(virtualRig.dryer.getState(), staticRig.dryer.getState());
+    TEST_ASSERT_EQUAL(DryerState::RUNNING, staticRig.dryer.getState());
+}
+
+void test_static_wiring_accepts_interface_calls() {
+    // The firmware still hands the Dryer to UI code as an IDryer
+    Rig<StaticDryer> rig;
+    IDryer* dryer = &rig.dryer;
+
+    dryer->pause();
+    TEST_ASSERT_EQUAL(DryerState::PAUSED, dryer->getState());
+
+    dryer->resume();
+    TEST_ASSERT_EQUAL(DryerState::RUNNING, dryer->getState());
+}
+
+// ==================== Benchmark ====================
+
+void test_benchmark_per_tick_cost() {
+    // Warm-up pass so both variants start with hot caches
+    nanosPerTick<Dryer>();
+
+    double virtualNs = nanosPerTick<Dryer>();
+    double staticNs = nanosPerTick<StaticDryer>();
+
+    char line[128];
+    snprintf(line, sizeof(line), "Dryer tick (sensors+safety+PID+heater): interface %.0f ns, static %.0f ns (%.2fx)",
+             virtualNs, staticNs, staticNs > 0 ? virtualNs / staticNs : 0.0);
+    TEST_MESSAGE(line);
+    snprintf(line, sizeof(line), "sizeof: Dryer %u B, StaticDryer %u B",
+             (unsigned)sizeof(Dryer), (unsigned)sizeof(StaticDryer));
+    TEST_MESSAGE(line);
+
+    // Timing is reported, not asserted - native timings are too noisy to gate on
+    TEST_ASSERT_TRUE(virtualNs > 0);
+    TEST_ASSERT_TRUE(staticNs > 0);
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // Equivalence
+    RUN_TEST(test_static_wiring_behaves_like_interface_wiring);
+    RUN_TEST(test_static_wiring_accepts_interface_calls);
+
+    // Benchmark
+    RUN_TEST(test_benchmark_per_tick_cost);
+
+    return UNITY_END();
+}
@@ -0,0 +1,235 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#include <new>
+#include <stdlib.h>
+
+#include "../TestConfig.h"
+#include "../../src/events/Delegate.h"
+#include "../../src/events/EventBus.h"
+#include "../../src/events/Events.h"
+#include "../../src/Dryer.h"
+#include "../../src/sensors/SensorManager.h"
+#include "../../src/control/SafetyMonitor.h"
+#include "../../src/control/PIDController.h"
+#include "../mocks/MockHeaterTempSensor.h"
+#include "../mocks/MockBoxTempHumiditySensor.h"
+#include "../mocks/MockHeaterControl.h"
+#include "../mocks/MockSettingsStorage.h"
+#include "../mocks/MockSoundController.h"
+
+// ==================== Allocation Counter ====================
+
+// Every heap allocation in this binary goes through here
+static size_t allocationCount = 0;
+
+void* operator new(size_t size) {
+    allocationCount++;
+    void* ptr = malloc(size ? size : 1);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+// Test event with a small subscriber limit
+struct CounterEvent {
+    using Handler = Delegate<void(int)>;
+    static constexpr uint8_t MAX_SUBSCRIBERS = 3;
+};
+
+// Call log
+int received[8];
+uint8_t receivedCount;
+
+void recordValue(int value) {
+    received[receivedCount++] = value;
+}
+
+void setUp(void) {
+    receivedCount = 0;
+    memset(received, 0, sizeof(received));
+}
+
+void tearDown(void) {
+}
+
+// ==================== Delegate Tests ====================
+
+void test_delegate_starts_empty() {
+    Delegate<void(int)> empty;
+    Delegate<void(int)> null = nullptr;
+
+    TEST_ASSERT_FALSE(static_cast<bool>(empty));
+    TEST_ASSERT_TRUE(null == nullptr);
+}
+
+void test_delegate_calls_function_pointer() {
+    Delegate<void(int)> delegate = recordValue;
+    delegate(5);
+
+    TEST_ASSERT_TRUE(delegate != nullptr);
+    TEST_ASSERT_EQUAL(1, receivedCount);
+    TEST_ASSERT_EQUAL(5, received[0]);
+}
+
+void test_delegate_calls_capturing_lambda_and_returns_value() {
+    int base = 40;
+    int* counter = &base;
+    Delegate<int(int)> delegate = [counter](int add) { return *counter + add; };
+
+    TEST_ASSERT_EQUAL(42, delegate(2));
+}
+
+void test_delegate_copies_keep_their_target() {
+    Delegate<void(int)> original = [](int value) { recordValue(value * 10); };
+    Delegate<void(int)> copy = original;
+    original = nullptr;
+
+    copy(3);
+
+    TEST_ASSERT_FALSE(static_cast<bool>(original));
+    TEST_ASSERT_EQUAL(30, received[0]);
+}
+
+// ==================== EventBus Tests ====================
+
+void test_bus_publishes_in_subscription_order() {
+    EventBus<CounterEvent> bus;
+    bus.subscribe([](int value) { recordValue(value + 1); });
+    bus.subscribe([](int value) { recordValue(value + 2); });
+
+    bus.publish(10);
+
+    TEST_ASSERT_EQUAL(2, bus.getSubscriberCount());
+    TEST_ASSERT_EQUAL(11, received[0]);
+    TEST_ASSERT_EQUAL(12, received[1]);
+}
+
+void test_bus_refuses_subscribers_past_capacity() {
+    EventBus<CounterEvent> bus;
+    for (uint8_t i = 0; i < CounterEvent::MAX_SUBSCRIBERS; i++) {
+        TEST_ASSERT_TRUE(bus.subscribe(recordValue));
+    }
+
+    TEST_ASSERT_TRUE(bus.isFull());
+    TEST_ASSERT_FALSE(bus.subscribe(recordValue));
+
+    bus.publish(1);
+    TEST_ASSERT_EQUAL(CounterEvent::MAX_SUBSCRIBERS, receivedCount);
+}
+
+void test_bus_refuses_empty_handler() {
+    EventBus<CounterEvent> bus;
+
+    TEST_ASSERT_FALSE(bus.subscribe(nullptr));
+    TEST_ASSERT_EQUAL(0, bus.getSubscriberCount());
+}
+
+// ==================== Allocation Tests ====================
+
+void test_bus_never_allocates() {
+    size_t before = allocationCount;
+
+    EventBus<CounterEvent> bus;
+    int total = 0;
+    int* sum = &total;
+    bus.subscribe([sum](int value) { *sum += value; });
+    for (int i = 0; i < 1000; i++) {
+        bus.publish(i);
+    }
+
+    TEST_ASSERT_EQUAL(499500, total);
+    TEST_ASSERT_EQUAL(before, allocationCount);
+}
+
+void test_control_path_does_not_allocate_after_setup() {
+    // Real sensor -> safety -> PID -> Dryer chain, mocked hardware
+    MockHeaterTempSensor heaterSensor;
+    MockBoxTempHumiditySensor boxSensor;
+    SensorManager sensorManager(&heaterSensor, &boxSensor);
+    SafetyMonitor safety;
+    PIDController pid;
+    MockHeaterControl heater;
+    MockSettingsStorage storage;
+    MockSoundController sound;
+    Dryer dryer(&sensorManager, &heater, &pid, &safety, &storage, &sound);
+
+    uint32_t stateChanges = 0;
+    uint32_t statsUpdates = 0;
+    uint32_t* stateCounter = &stateChanges;
+    uint32_t* statsCounter = &statsUpdates;
+
+    // Setup: everything allowed to allocate until the first tick
+    heaterSensor.setTemperature(45.0);
+    boxSensor.setReadings(30.0, 40.0);
+    sensorManager.begin();
+    dryer.begin(0);
+    dryer.registerStateChangeCallback([stateCounter](DryerState oldState, DryerState newState) {
+        (*stateCounter)++;
+    });
+    dryer.registerStatsUpdateCallback([statsCounter](const CurrentStats& stats) {
+        (*statsCounter)++;
+    });
+    dryer.start();
+
+    size_t before = allocationCount;
+
+    // Ten minutes of 50ms ticks while running
+    for (uint32_t now = 0; now < 600000; now += 50) {
+        sensorManager.update(now);
+        safety.update(now);
+        dryer.update(now);
+    }
+
+    TEST_ASSERT_EQUAL(DryerState::RUNNING, dryer.getState());
+    TEST_ASSERT_TRUE(statsUpdates > 0);
+    TEST_ASSERT_EQUAL(before, allocationCount);
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // Delegate
+    RUN_TEST(test_delegate_starts_empty);
+    RUN_TEST(test_delegate_calls_function_pointer);
+    RUN_TEST(test_delegate_calls_capturing_lambda_and_returns_value);
+    RUN_TEST(test_delegate_copies_keep_their_target);
+
+    // EventBus
+    RUN_TEST(test_bus_publishes_in_subscription_order);
+    RUN_TEST(test_bus_refuses_subscribers_past_capacity);
+    RUN_TEST(test_bus_refuses_empty_handler);
+
+    // Allocation
+    RUN_TEST(test_bus_never_allocates);
+    RUN_TEST(test_control_path_does_not_allocate_after_setup);
+
+    return UNITY_END();
+}
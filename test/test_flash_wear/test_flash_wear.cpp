@@ -0,0 +1,407 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#include "../TestConfig.h"  // Test-specific configuration (decoupled from production Config.h)
+#include "../../src/Dryer.h"
+#include "../../src/storage/SettingsStorage.h"
+#include "../mocks/MockSensorManager.h"
+#include "../mocks/MockHeaterControl.h"
+#include "../mocks/MockPIDController.h"
+#include "../mocks/MockSafetyMonitor.h"
+#include "../mocks/MockSoundController.h"
+#include <math.h>
+
+#define TEST_PATH "/test_wear.bin"
+#define JOURNAL_NAMESPACE "test_journal"
+
+// One hour of RUNNING through the real storage stack may cost no more
+// erases than pre-journal firmware spent on its runtime.json rewrites
+// alone (runtimeJsonHour(), 63 in the MockFileSystem model). Measured:
+// 53 erases and 12 KB written to LittleFS - telemetry pages are most of
+// it, the runtime journal's NVS records add one page erase - and the same
+// with the telemetry ring full and rotating. A second file written per
+// tick, or a write before EOF in a multi-block file (which rewrites the
+// whole tail), breaks it.
+static const uint32_t CYCLE_HOUR_MS = 3600000UL;
+static const uint32_t BYTES_PER_CYCLE_HOUR_BUDGET = 16 * 1024;
+
+// Pre-journal firmware rewrote /runtime.json this often while RUNNING
+static const uint32_t LEGACY_STATE_SAVE_INTERVAL = 60000;
+
+struct WearTotals {
+    uint32_t erases;
+    uint32_t bytes;
+};
+
+// The runtime.json document pre-journal firmware wrote on every save
+static void writeLegacyRuntimeJson(uint32_t elapsed, uint32_t timestamp) {
+    char json[160];
+    int length = snprintf(json, sizeof(json),
+                          "{\"version\":1,\"state\":\"RUNNING\",\"elapsed\":%lu,"
+                          "\"targetTemp\":50,\"targetTime\":18000,\"preset\":\"PLA\","
+                          "\"timestamp\":%lu}",
+                          (unsigned long)elapsed, (unsigned long)timestamp);
+    File file = LittleFS.open(LEGACY_RUNTIME_FILE, "w");
+    TEST_ASSERT_EQUAL(length, file.write(reinterpret_cast<const uint8_t*>(json), length));
+    file.close();
+}
+
+// Baseline: one hour of RUNNING saves as pre-journal firmware made them,
+// through the same flash model. Leaves the wear counters at zero.
+static WearTotals runtimeJsonHour() {
+    LittleFS.resetWear();
+    for (uint32_t t = LEGACY_STATE_SAVE_INTERVAL; t <= CYCLE_HOUR_MS; t += LEGACY_STATE_SAVE_INTERVAL) {
+        writeLegacyRuntimeJson(t / 1000, t / 1000);
+    }
+    WearTotals totals = { LittleFS.getBlockErases(), static_cast<uint32_t>(LittleFS.getBytesWritten()) };
+
+    LittleFS.remove(LEGACY_RUNTIME_FILE);
+    LittleFS.resetWear();
+    return totals;
+}
+
+static void writeFile(const char* path, const char* mode, size_t offset, size_t length) {
+    std::vector<uint8_t> bytes(length, 0xA5);
+    File file = LittleFS.open(path, mode);
+    TEST_ASSERT_TRUE(file.seek(offset));
+    TEST_ASSERT_EQUAL(length, file.write(bytes.data(), length));
+    file.close();
+}
+
+void setUp(void) {
+    LittleFS.format();
+    LittleFS.begin(true);
+    LittleFS.resetWear();
+    Preferences::eraseAll();
+    Preferences::resetWear();
+    flashWriteStats().reset(0);
+}
+
+void tearDown(void) {
+}
+
+// ==================== Mock Flash Model Tests ====================
+
+void test_new_file_write_erases_one_block() {
+    writeFile(TEST_PATH, "w", 0, 256);
+
+    TEST_ASSERT_EQUAL(256, LittleFS.getBytesWritten());
+    TEST_ASSERT_EQUAL(1, LittleFS.getBlockErases());
+    TEST_ASSERT_EQUAL(2, LittleFS.getPagesProgrammed());   // Data page + metadata commit
+    TEST_ASSERT_EQUAL(1, LittleFS.getCommits());
+}
+
+void test_small_overwrite_copies_the_whole_block() {
+    writeFile(TEST_PATH, "w", 0, 4096);
+    LittleFS.resetWear();
+
+    writeFile(TEST_PATH, "r+", 100, 32);
+
+    TEST_ASSERT_EQUAL(32, LittleFS.getBytesWritten());
+    TEST_ASSERT_EQUAL(1, LittleFS.getBlockErases());
+    TEST_ASSERT_EQUAL(16 + 1, LittleFS.getPagesProgrammed());
+}
+
+void test_write_across_block_boundary_copies_both_blocks() {
+    writeFile(TEST_PATH, "w", 0, 8192);
+    LittleFS.resetWear();
+
+    writeFile(TEST_PATH, "r+", 4090, 12);
+
+    TEST_ASSERT_EQUAL(2, LittleFS.getBlockErases());
+    TEST_ASSERT_EQUAL(32 + 1, LittleFS.getPagesProgrammed());
+}
+
+void test_write_before_eof_copies_the_whole_tail() {
+    writeFile(TEST_PATH, "w", 0, 4 * 4096);
+    LittleFS.resetWear();
+
+    // Block 1 changes; blocks 2 and 3 point back at it and are rewritten too
+    writeFile(TEST_PATH, "r+", 4096 + 100, 32);
+
+    TEST_ASSERT_EQUAL(3, LittleFS.getBlockErases());
+    TEST_ASSERT_EQUAL(3 * 16 + 1, LittleFS.getPagesProgrammed());
+}
+
+void test_append_copies_only_the_last_block() {
+    writeFile(TEST_PATH, "w", 0, 4 * 4096 - 256);
+    LittleFS.resetWear();
+
+    writeFile(TEST_PATH, "a", 4 * 4096 - 256, 256);
+
+    TEST_ASSERT_EQUAL(1, LittleFS.getBlockErases());
+}
+
+void test_metadata_block_compacts_every_sixteen_commits() {
+    for (int i = 0; i < 16; i++) {
+        writeFile(TEST_PATH, "w", 0, 1);
+    }
+
+    TEST_ASSERT_EQUAL(16, LittleFS.getCommits());
+    TEST_ASSERT_EQUAL(16 + 1, LittleFS.getBlockErases());
+}
+
+void test_reading_costs_no_flash_wear() {
+    writeFile(TEST_PATH, "w", 0, 512);
+    LittleFS.resetWear();
+
+    char buffer[512];
+    File file = LittleFS.open(TEST_PATH, "r");
+    TEST_ASSERT_EQUAL(512, file.readBytes(buffer, sizeof(buffer)));
+    file.close();
+
+    TEST_ASSERT_EQUAL(0, LittleFS.getBlockErases());
+    TEST_ASSERT_EQUAL(0, LittleFS.getPagesProgrammed());
+    TEST_ASSERT_EQUAL(0, LittleFS.getCommits());
+}
+
+// ==================== Write Accounting Tests ====================
+
+void test_session_records_bytes_blocks_and_latency() {
+    {
+        FlashWriteSession session(FlashFile::RUNTIME);
+        session.wrote(4000, 64);
+        session.wrote(4064, 136);
+    }
+
+    const FlashWriteStats::FileStats& runtime = flashWriteStats().get(FlashFile::RUNTIME);
+    TEST_ASSERT_EQUAL(200, runtime.bytes.load());
+    TEST_ASSERT_EQUAL(1, runtime.sessions.load());
+    TEST_ASSERT_EQUAL(2, runtime.blocks.load());     // 4000..4199 crosses into block 1
+    TEST_ASSERT_EQUAL(1, runtime.latency.getCount());
+    TEST_ASSERT_EQUAL(0, flashWriteStats().get(FlashFile::SETTINGS).sessions.load());
+}
+
+void test_session_counts_the_tail_after_a_write_before_eof() {
+    {
+        FlashWriteSession session(FlashFile::CYCLES);
+        session.wrote(100, 64);
+        session.fileEnds(3 * 4096);
+    }
+
+    TEST_ASSERT_EQUAL(3, flashWriteStats().get(FlashFile::CYCLES).blocks.load());
+}
+
+void test_session_without_writes_records_nothing() {
+    {
+        FlashWriteSession session(FlashFile::TELEMETRY);
+    }
+
+    TEST_ASSERT_EQUAL(0, flashWriteStats().getFilesWritten());
+    TEST_ASSERT_EQUAL(0, flashWriteStats().get(FlashFile::TELEMETRY).latency.getCount());
+}
+
+void test_journal_erase_estimate_matches_nvs_model() {
+    RuntimeJournal journal(JOURNAL_NAMESPACE);
+    RuntimeRecord latest;
+    journal.recover(latest);
+    for (uint32_t i = 0; i < 100; i++) {
+        TEST_ASSERT_TRUE(journal.save(DryerState::RUNNING, i * 10, 50.0f, 3600, PresetType::PLA, i));
+    }
+
+    const FlashWriteStats::FileStats& runtime = flashWriteStats().get(FlashFile::RUNTIME);
+    TEST_ASSERT_EQUAL(100, runtime.sessions.load());
+    TEST_ASSERT_EQUAL(0, runtime.blocks.load());
+    TEST_ASSERT_EQUAL(100 * sizeof(RuntimeRecord), runtime.bytes.load());
+    TEST_ASSERT_EQUAL(Preferences::getEntriesWritten(), flashWriteStats().getNvsEntries());
+    TEST_ASSERT_EQUAL(Preferences::getPageErases(), flashWriteStats().getEstimatedErases());
+    TEST_ASSERT_EQUAL(0, LittleFS.getBlockErases());
+}
+
+void test_wear_report_projects_budget_from_rate() {
+    FlashWriteStats stats;
+    stats.reset(1000);
+    for (int i = 0; i < 96; i++) {
+        stats.record(FlashFile::RUNTIME, 32, 1, 5000);
+    }
+
+    // 96 blocks + 6 metadata compactions in one hour, on a 1 MB partition
+    FlashWearReport report = estimateFlashWear(stats, 200000, 1048576, 1000 + CYCLE_HOUR_MS);
+
+    TEST_ASSERT_EQUAL(102, report.estimatedErases);
+    TEST_ASSERT_EQUAL(256UL * FLASH_ERASE_CYCLES, report.eraseBudget);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 102.0f, report.erasesPerHour);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 25600000.0f / (102.0f * 8760.0f), report.yearsAtThisRate);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 102.0f * 8760.0f * 100.0f / 25600000.0f, report.budgetPercentPerYear);
+}
+
+void test_wear_report_waits_a_minute_for_a_rate() {
+    FlashWriteStats stats;
+    stats.reset(0);
+    stats.record(FlashFile::SETTINGS, 128, 1, 3000);
+
+    FlashWearReport report = estimateFlashWear(stats, 0, 1048576, 59000);
+
+    TEST_ASSERT_EQUAL(1, report.estimatedErases);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, report.erasesPerHour);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, report.yearsAtThisRate);
+}
+
+void test_settings_storage_reports_littlefs_usage() {
+    SettingsStorage storage;
+    storage.begin();
+
+    FlashWearReport report = storage.getWearReport(millis());
+
+    TEST_ASSERT_EQUAL(LittleFS.totalBytes(), report.totalBytes);
+    TEST_ASSERT_EQUAL(LittleFS.usedBytes(), report.usedBytes);
+    TEST_ASSERT_TRUE(report.usedBytes > 0);
+    TEST_ASSERT_TRUE(report.filesWritten > 0);          // First boot writes settings
+    TEST_ASSERT_EQUAL(LittleFS.getBytesWritten(), report.bytesWritten);
+}
+
+// ==================== Write Budget Tests ====================
+
+void test_runtime_json_baseline_erases_a_block_per_save() {
+    WearTotals baseline = runtimeJsonHour();
+
+    // 60 rewrites, each copying its block, plus a metadata compaction
+    // every sixteen commits
+    TEST_ASSERT_EQUAL(60 + 60 / MockFileSystemClass::COMMITS_PER_METADATA_ERASE, baseline.erases);
+    TEST_ASSERT_TRUE(baseline.bytes > 60 * 100);
+}
+
+void test_runtime_saves_cost_less_than_runtime_json() {
+    uint32_t jsonErases = runtimeJsonHour().erases;
+
+    // The same hour through the runtime journal at STATE_SAVE_INTERVAL
+    RuntimeJournal journal(JOURNAL_NAMESPACE);
+    RuntimeRecord latest;
+    journal.recover(latest);
+    for (uint32_t t = STATE_SAVE_INTERVAL; t <= CYCLE_HOUR_MS; t += STATE_SAVE_INTERVAL) {
+        TEST_ASSERT_TRUE(journal.save(DryerState::RUNNING, t / 1000, 50.0f, 18000, PresetType::PLA, t / 1000));
+    }
+    uint32_t journalErases = LittleFS.getBlockErases() + Preferences::getPageErases();
+
+    char message[96];
+    snprintf(message, sizeof(message), "runtime hour: json %u erases, journal %u erases (%u NVS entries)",
+             (unsigned)jsonErases, (unsigned)journalErases, (unsigned)Preferences::getEntriesWritten());
+    TEST_MESSAGE(message);
+
+    TEST_ASSERT_EQUAL(0, LittleFS.getBlockErases());
+    TEST_ASSERT_TRUE(journalErases < jsonErases);
+    // Per save, too: three entries are well under one block
+    TEST_ASSERT_TRUE(nvsBlobEntries(sizeof(RuntimeRecord)) * 4 < Preferences::ENTRIES_PER_PAGE);
+}
+
+// Telemetry pages as the recorder seals them, straight into the ring
+static void fillTelemetryRing(uint32_t pages) {
+    TelemetryLogFile log;
+    log.load();
+    PIDTerms terms;
+    for (uint32_t i = 0; i < pages; i++) {
+        TelemetryPage page;
+        TelemetryPageEncoder encoder;
+        encoder.reset(page, i);
+        encoder.append(TelemetrySample::from(i * 1000, 60.0f, 50.0f, 30.0f, 40.0f, terms));
+        encoder.seal(i == 0 ? TELEMETRY_PAGE_FIRST : 0);
+        TEST_ASSERT_TRUE(log.append(page));
+    }
+}
+
+/**
+ * One hour of RUNNING at 1 Hz through Dryer and the real storage stack,
+ * held to the runtime.json baseline (erases) and the byte budget
+ */
+static void runCycleHour(const char* label) {
+    MockSensorManager sensors;
+    MockHeaterControl heater;
+    MockPIDController pid;
+    MockSafetyMonitor safety;
+    MockSoundController sound;
+    SettingsStorage storage;
+    Dryer dryer(&sensors, &heater, &pid, &safety, &storage, &sound);
+
+    WearTotals baseline = runtimeJsonHour();
+    uint32_t eraseBudget = baseline.erases;
+
+    dryer.begin(0);
+    dryer.start();
+    storage.getWorker().drain();
+    LittleFS.resetWear();
+    Preferences::resetWear();
+    flashWriteStats().reset(0);
+
+    // 1 Hz PID ticks with moving readings and terms, so telemetry pages
+    // fill at a realistic rate; the worker drains as the storage task would
+    for (uint32_t t = 1000; t <= CYCLE_HOUR_MS; t += 1000) {
+        float phase = t / 90000.0f;
+        pid.setOutput(40.0f + 20.0f * sinf(phase));
+        pid.setTerms(6.0f * sinf(phase), 30.0f + t / 360000.0f, -1.5f * cosf(phase));
+        if (t % 2000 == 0) {
+            sensors.triggerBoxDataUpdate(48.0f + sinf(phase / 4), 30.0f - t / 400000.0f, t);
+        }
+        sensors.triggerHeaterTempUpdate(60.0f + 2.0f * sinf(phase) + (t / 1000 % 7) * 0.01f, t);
+        dryer.update(t);
+        storage.getWorker().drain();
+    }
+    TEST_ASSERT_EQUAL(DryerState::RUNNING, dryer.getState());
+
+    uint32_t erases = LittleFS.getBlockErases() + Preferences::getPageErases();
+    uint32_t nvsBytes = flashWriteStats().get(FlashFile::RUNTIME).bytes.load();
+
+    char message[192];
+    snprintf(message, sizeof(message),
+             "%s: %u erases (%u NVS) of %u budget (runtime.json), %u pages, %u bytes, "
+             "%u commits, %u NVS entries",
+             label, (unsigned)erases, (unsigned)Preferences::getPageErases(), (unsigned)eraseBudget,
+             (unsigned)LittleFS.getPagesProgrammed(), (unsigned)LittleFS.getBytesWritten(),
+             (unsigned)LittleFS.getCommits(), (unsigned)Preferences::getEntriesWritten());
+    TEST_MESSAGE(message);
+
+    TEST_ASSERT_TRUE(erases <= eraseBudget);
+    TEST_ASSERT_TRUE(LittleFS.getBytesWritten() <= BYTES_PER_CYCLE_HOUR_BUDGET);
+
+    // The on-device estimate follows the model closely
+    TEST_ASSERT_EQUAL(LittleFS.getBytesWritten() + nvsBytes, flashWriteStats().getBytesWritten());
+    TEST_ASSERT_EQUAL(Preferences::getEntriesWritten(), flashWriteStats().getNvsEntries());
+    TEST_ASSERT_UINT32_WITHIN(erases / 20, erases, flashWriteStats().getEstimatedErases());
+}
+
+void test_one_cycle_hour_stays_within_flash_budget() {
+    runCycleHour("cycle hour");
+}
+
+// Worst case: the telemetry ring is full and rotates during the hour, so
+// every segment started deletes the oldest one
+void test_cycle_hour_with_wrapped_telemetry_ring_stays_within_budget() {
+    fillTelemetryRing(TELEMETRY_LOG_PAGES + TELEMETRY_SEGMENT_PAGES / 2);
+
+    runCycleHour("cycle hour, ring wrapped");
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // Mock flash model
+    RUN_TEST(test_new_file_write_erases_one_block);
+    RUN_TEST(test_small_overwrite_copies_the_whole_block);
+    RUN_TEST(test_write_across_block_boundary_copies_both_blocks);
+    RUN_TEST(test_write_before_eof_copies_the_whole_tail);
+    RUN_TEST(test_append_copies_only_the_last_block);
+    RUN_TEST(test_metadata_block_compacts_every_sixteen_commits);
+    RUN_TEST(test_reading_costs_no_flash_wear);
+
+    // Write accounting
+    RUN_TEST(test_session_records_bytes_blocks_and_latency);
+    RUN_TEST(test_session_counts_the_tail_after_a_write_before_eof);
+    RUN_TEST(test_session_without_writes_records_nothing);
+    RUN_TEST(test_journal_erase_estimate_matches_nvs_model);
+    RUN_TEST(test_wear_report_projects_budget_from_rate);
+    RUN_TEST(test_wear_report_waits_a_minute_for_a_rate);
+    RUN_TEST(test_settings_storage_reports_littlefs_usage);
+
+    // Write budget
+    RUN_TEST(test_runtime_json_baseline_erases_a_block_per_save);
+    RUN_TEST(test_runtime_saves_cost_less_than_runtime_json);
+    RUN_TEST(test_one_cycle_hour_stays_within_flash_budget);
+    RUN_TEST(test_cycle_hour_with_wrapped_telemetry_ring_stays_within_budget);
+
+    return UNITY_END();
+}
@@ -0,0 +1,208 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#include "../../src/diagnostics/HealthMonitor.h"
+#include "../mocks/MockHealthProbe.h"
+
+MockHealthProbe* probe;
+HealthMonitor* monitor;
+
+// Stand-ins for FreeRTOS task handles
+int loopTask;
+int controlTask;
+
+// Warning callback capture
+int warningCalls;
+uint8_t lastRaised;
+
+void setUp(void) {
+    probe = new MockHealthProbe();
+    monitor = new HealthMonitor(probe);
+    warningCalls = 0;
+    lastRaised = 0;
+    monitor->registerWarningCallback([](uint8_t raised, const HealthStats& stats) {
+        warningCalls++;
+        lastRaised = raised;
+    });
+}
+
+void tearDown(void) {
+    delete monitor;
+    delete probe;
+}
+
+// ==================== Sampling Tests ====================
+
+void test_no_stats_before_first_sample() {
+    TEST_ASSERT_EQUAL(0, monitor->getStats().sampleCount);
+    TEST_ASSERT_EQUAL(0, monitor->getTrendCount());
+}
+
+void test_sample_records_heap_and_fragmentation() {
+    probe->setHeap(200000, 50000, 180000);
+
+    monitor->update(0);
+
+    const HealthStats& stats = monitor->getStats();
+    TEST_ASSERT_EQUAL(200000, stats.freeHeap);
+    TEST_ASSERT_EQUAL(50000, stats.largestFreeBlock);
+    TEST_ASSERT_EQUAL(180000, stats.minEverFreeHeap);
+    TEST_ASSERT_EQUAL(75, stats.fragmentationPercent);
+    TEST_ASSERT_EQUAL(1, stats.sampleCount);
+}
+
+void test_minima_survive_recovery() {
+    probe->setHeap(200000, 100000, 190000);
+    monitor->update(0);
+    probe->setHeap(150000, 30000, 140000);
+    monitor->update(5000);
+    probe->setHeap(210000, 110000, 140000);
+    monitor->update(10000);
+
+    const HealthStats& stats = monitor->getStats();
+    TEST_ASSERT_EQUAL(210000, stats.freeHeap);
+    TEST_ASSERT_EQUAL(150000, stats.minFreeHeap);
+    TEST_ASSERT_EQUAL(30000, stats.minLargestFreeBlock);
+    TEST_ASSERT_EQUAL(80, stats.maxFragmentationPercent);
+}
+
+void test_watched_task_stacks_are_sampled() {
+    TEST_ASSERT_TRUE(monitor->watchTask("LOOP", &loopTask));
+    TEST_ASSERT_TRUE(monitor->watchTask("CONTROL", &controlTask));
+    probe->setStackFree(&loopTask, 3000);
+    probe->setStackFree(&controlTask, 1200);
+
+    monitor->update(0);
+
+    const HealthStats& stats = monitor->getStats();
+    TEST_ASSERT_EQUAL(2, stats.taskCount);
+    TEST_ASSERT_EQUAL_STRING("LOOP", stats.tasks[0].name);
+    TEST_ASSERT_EQUAL(3000, stats.tasks[0].freeBytes);
+    TEST_ASSERT_EQUAL(1200, stats.tasks[1].freeBytes);
+}
+
+void test_watch_task_rejects_null_and_overflow() {
+    static int handles[MAX_HEALTH_TASKS];
+
+    TEST_ASSERT_FALSE(monitor->watchTask("NULL", nullptr));
+    for (uint8_t i = 0; i < MAX_HEALTH_TASKS; i++) {
+        TEST_ASSERT_TRUE(monitor->watchTask("T", &handles[i]));
+    }
+    TEST_ASSERT_FALSE(monitor->watchTask("EXTRA", &loopTask));
+}
+
+// ==================== Trend Tests ====================
+
+void test_trend_keeps_per_slot_minima() {
+    probe->setHeap(200000, 100000, 190000);
+    monitor->update(0);
+    probe->setHeap(180000, 90000, 170000);
+    monitor->update(HEALTH_TREND_SLOT_MS / 2);
+
+    // Next slot
+    probe->setHeap(170000, 60000, 160000);
+    monitor->update(HEALTH_TREND_SLOT_MS);
+
+    TEST_ASSERT_EQUAL(2, monitor->getTrendCount());
+    TEST_ASSERT_EQUAL(170000, monitor->getTrendSlot(0).minFreeHeap);
+    TEST_ASSERT_EQUAL(60000, monitor->getTrendSlot(0).minLargestFreeBlock);
+    TEST_ASSERT_EQUAL(180000, monitor->getTrendSlot(1).minFreeHeap);
+    TEST_ASSERT_EQUAL(90000, monitor->getTrendSlot(1).minLargestFreeBlock);
+}
+
+void test_trend_drops_oldest_slot() {
+    for (uint32_t slot = 0; slot < HEALTH_TREND_SLOTS + 2; slot++) {
+        probe->setHeap(200000 - slot * 1000, 100000, 150000);
+        monitor->update(slot * HEALTH_TREND_SLOT_MS);
+    }
+
+    TEST_ASSERT_EQUAL(HEALTH_TREND_SLOTS, monitor->getTrendCount());
+    TEST_ASSERT_EQUAL(200000 - (HEALTH_TREND_SLOTS + 1) * 1000, monitor->getTrendSlot(0).minFreeHeap);
+    TEST_ASSERT_EQUAL(200000 - 2 * 1000, monitor->getTrendSlot(HEALTH_TREND_SLOTS - 1).minFreeHeap);
+}
+
+// ==================== Warning Tests ====================
+
+void test_fragmentation_warning_fires_once_per_episode() {
+    probe->setHeap(100000, HEALTH_WARN_LARGEST_BLOCK_BYTES - 1, 90000);
+    monitor->update(0);
+    monitor->update(5000);
+    monitor->update(10000);
+
+    TEST_ASSERT_EQUAL(1, warningCalls);
+    TEST_ASSERT_EQUAL(HEALTH_FRAGMENTED, lastRaised);
+    TEST_ASSERT_EQUAL(1, monitor->getStats().warningCount);
+    TEST_ASSERT_TRUE(monitor->getStats().warnings & HEALTH_FRAGMENTED);
+}
+
+void test_warning_needs_hysteresis_to_rearm() {
+    probe->setHeap(100000, HEALTH_WARN_LARGEST_BLOCK_BYTES - 1, 90000);
+    monitor->update(0);
+
+    // Just above threshold: still the same episode
+    probe->setHeap(100000, HEALTH_WARN_LARGEST_BLOCK_BYTES + 1, 90000);
+    monitor->update(5000);
+    probe->setHeap(100000, HEALTH_WARN_LARGEST_BLOCK_BYTES - 1, 90000);
+    monitor->update(10000);
+    TEST_ASSERT_EQUAL(1, warningCalls);
+
+    // Clear recovery, then a new drop is a new episode
+    probe->setHeap(100000, HEALTH_WARN_LARGEST_BLOCK_BYTES * 2, 90000);
+    monitor->update(15000);
+    TEST_ASSERT_EQUAL(0, monitor->getStats().warnings);
+    probe->setHeap(100000, HEALTH_WARN_LARGEST_BLOCK_BYTES - 1, 90000);
+    monitor->update(20000);
+    TEST_ASSERT_EQUAL(2, warningCalls);
+}
+
+void test_low_heap_and_low_stack_warnings() {
+    monitor->watchTask("LOOP", &loopTask);
+    probe->setStackFree(&loopTask, HEALTH_WARN_STACK_BYTES - 1);
+    probe->setHeap(HEALTH_WARN_FREE_HEAP_BYTES - 1, HEALTH_WARN_LARGEST_BLOCK_BYTES * 2, 1000);
+
+    monitor->update(0);
+
+    TEST_ASSERT_EQUAL(1, warningCalls);
+    TEST_ASSERT_EQUAL(HEALTH_LOW_HEAP | HEALTH_LOW_STACK, lastRaised);
+}
+
+void test_healthy_system_never_warns() {
+    monitor->watchTask("LOOP", &loopTask);
+    probe->setStackFree(&loopTask, 4000);
+
+    for (uint32_t t = 0; t < 10UL * 3600UL * 1000UL; t += HEALTH_TASK_PERIOD_MS) {
+        monitor->update(t);
+    }
+
+    TEST_ASSERT_EQUAL(0, warningCalls);
+    TEST_ASSERT_EQUAL(0, monitor->getStats().warnings);
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // Sampling
+    RUN_TEST(test_no_stats_before_first_sample);
+    RUN_TEST(test_sample_records_heap_and_fragmentation);
+    RUN_TEST(test_minima_survive_recovery);
+    RUN_TEST(test_watched_task_stacks_are_sampled);
+    RUN_TEST(test_watch_task_rejects_null_and_overflow);
+
+    // Trend
+    RUN_TEST(test_trend_keeps_per_slot_minima);
+    RUN_TEST(test_trend_drops_oldest_slot);
+
+    // Warnings
+    RUN_TEST(test_fragmentation_warning_fires_once_per_episode);
+    RUN_TEST(test_warning_needs_hysteresis_to_rearm);
+    RUN_TEST(test_low_heap_and_low_stack_warnings);
+    RUN_TEST(test_healthy_system_never_warns);
+
+    return UNITY_END();
+}
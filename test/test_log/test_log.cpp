@@ -0,0 +1,155 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#include <string.h>
+
+#include "../../src/diagnostics/Log.h"
+#include "../../src/control/PIDController.h"
+
+// Captures what reaches the sink
+static char lastLine[LOG_LINE_BYTES];
+static int lineCount = 0;
+
+static void captureSink(const char* line) {
+    strncpy(lastLine, line, sizeof(lastLine) - 1);
+    lastLine[sizeof(lastLine) - 1] = '\0';
+    lineCount++;
+}
+
+// Argument with a visible side effect
+static int evaluations = 0;
+
+static int countedArg(int value) {
+    evaluations++;
+    return value;
+}
+
+void setUp(void) {
+    logFilter().setAll(LogLevel::DEBUG);
+    logFilter().setSink(captureSink);
+    lastLine[0] = '\0';
+    lineCount = 0;
+    evaluations = 0;
+}
+
+void tearDown(void) {
+    logFilter().setSink(nullptr);
+    logFilter().setAll(static_cast<LogLevel>(LOG_RUNTIME_DEFAULT_LEVEL));
+}
+
+// ==================== Compile-Time Level Tests ====================
+
+void test_statement_above_ceiling_does_not_evaluate_arguments() {
+    // Config ships PID at warn: debug statements are compiled out
+    TEST_ASSERT_TRUE(LOG_LEVEL_PID < static_cast<uint8_t>(LogLevel::DEBUG));
+
+    LOG_DEBUG(PID, "value=%d", countedArg(42));
+
+    TEST_ASSERT_EQUAL(0, evaluations);
+    TEST_ASSERT_EQUAL(0, lineCount);
+}
+
+void test_statement_within_ceiling_is_formatted() {
+    LOG_WARN(PID, "value=%d", countedArg(42));
+
+    TEST_ASSERT_EQUAL(1, evaluations);
+    TEST_ASSERT_EQUAL(1, lineCount);
+    TEST_ASSERT_EQUAL_STRING("value=42", lastLine);
+}
+
+void test_pid_compute_logs_nothing_by_default() {
+    PIDController pid;
+    pid.begin();
+    pid.setLimits(0.0, 100.0);
+
+    for (uint32_t now = 0; now < 20 * PID_UPDATE_INTERVAL; now += PID_UPDATE_INTERVAL) {
+        pid.compute(50.0, 48.0, 60.0, now);
+    }
+
+    TEST_ASSERT_EQUAL(0, lineCount);
+}
+
+// ==================== Runtime Filter Tests ====================
+
+void test_runtime_filter_skips_arguments_and_formatting() {
+    logFilter().setLevel(LogModule::PID, LogLevel::ERROR);
+
+    LOG_WARN(PID, "value=%d", countedArg(1));
+    TEST_ASSERT_EQUAL(0, evaluations);
+    TEST_ASSERT_EQUAL(0, lineCount);
+
+    LOG_ERROR(PID, "value=%d", countedArg(2));
+    TEST_ASSERT_EQUAL(1, evaluations);
+    TEST_ASSERT_EQUAL_STRING("value=2", lastLine);
+}
+
+void test_runtime_filter_is_per_module() {
+    logFilter().setLevel(LogModule::STORAGE, LogLevel::NONE);
+
+    LOG_ERROR(STORAGE, "storage");
+    TEST_ASSERT_EQUAL(0, lineCount);
+
+    LOG_INFO(UI, "ui");
+    TEST_ASSERT_EQUAL(1, lineCount);
+    TEST_ASSERT_EQUAL_STRING("ui", lastLine);
+}
+
+void test_runtime_filter_cannot_reenable_compiled_out_level() {
+    logFilter().setLevel(LogModule::HEATER, LogLevel::DEBUG);
+
+    LOG_DEBUG(HEATER, "edge %d", countedArg(1));
+
+    TEST_ASSERT_EQUAL(0, evaluations);
+    TEST_ASSERT_EQUAL(0, lineCount);
+}
+
+void test_long_line_is_truncated() {
+    char longText[LOG_LINE_BYTES * 2];
+    memset(longText, 'x', sizeof(longText) - 1);
+    longText[sizeof(longText) - 1] = '\0';
+
+    LOG_ERROR(UI, "%s", longText);
+
+    TEST_ASSERT_EQUAL(LOG_LINE_BYTES - 1, strlen(lastLine));
+}
+
+// ==================== Parsing Tests ====================
+
+void test_parse_module_and_level_names() {
+    LogModule module;
+    LogLevel level;
+
+    TEST_ASSERT_TRUE(LogFilter::parseModule("storage", module));
+    TEST_ASSERT_EQUAL(LogModule::STORAGE, module);
+    TEST_ASSERT_TRUE(LogFilter::parseLevel("debug", level));
+    TEST_ASSERT_EQUAL(LogLevel::DEBUG, level);
+
+    TEST_ASSERT_FALSE(LogFilter::parseModule("wifi", module));
+    TEST_ASSERT_FALSE(LogFilter::parseLevel("verbose", level));
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // Compile-time level
+    RUN_TEST(test_statement_above_ceiling_does_not_evaluate_arguments);
+    RUN_TEST(test_statement_within_ceiling_is_formatted);
+    RUN_TEST(test_pid_compute_logs_nothing_by_default);
+
+    // Runtime filter
+    RUN_TEST(test_runtime_filter_skips_arguments_and_formatting);
+    RUN_TEST(test_runtime_filter_is_per_module);
+    RUN_TEST(test_runtime_filter_cannot_reenable_compiled_out_level);
+    RUN_TEST(test_long_line_is_truncated);
+
+    // Parsing
+    RUN_TEST(test_parse_module_and_level_names);
+
+    return UNITY_END();
+}
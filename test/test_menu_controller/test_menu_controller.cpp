@@ -296,7 +296,7 @@ void test_set_remaining_time() {
 void test_root_menu_has_expected_items() {
     std::vector<MenuItem> items = menu->getCurrentMenuItems();
 
-    // Root menu should have: Status, Select Preset, Edit Custom, Adjust Timer, PID, Sound, System Info, Back
+    // Root menu should have: Status, Select Preset, Edit Custom, Adjust Timer, PID, Sound, Scale, System Info, Back
     TEST_ASSERT_GREATER_OR_EQUAL(7, items.size());
 }
 
@@ -341,6 +341,137 @@ void test_pid_menu_accessible() {
     TEST_ASSERT_GREATER_OR_EQUAL(3, items.size());
 }
 
+static void enterScaleMenu() {
+    // Scale sits after Sound on the root menu
+    for (int i = 0; i < 6; i++) {
+        menu->handleAction(MenuAction::DOWN);
+    }
+    menu->handleAction(MenuAction::ENTER);
+}
+
+void test_scale_menu_accessible() {
+    enterScaleMenu();
+
+    TEST_ASSERT_EQUAL(MenuPath::SCALE, menu->getCurrentMenuPath());
+    std::vector<MenuItem> items = menu->getCurrentMenuItems();
+    // Should have Tare, Calibrate, Back
+    TEST_ASSERT_EQUAL(3, items.size());
+    TEST_ASSERT_EQUAL(MenuPath::SCALE_TARE, items[0].path);
+    TEST_ASSERT_EQUAL(MenuPath::SCALE_CALIBRATE, items[1].path);
+}
+
+void test_scale_tare_fires_callback() {
+    menu->registerSelectionCallback(selectionCallback);
+    enterScaleMenu();
+
+    menu->handleAction(MenuAction::ENTER);
+
+    TEST_ASSERT_EQUAL(1, selectionHistory.size());
+    TEST_ASSERT_EQUAL(MenuPath::SCALE_TARE, selectionHistory[0].path);
+}
+
+void test_scale_calibrate_edits_reference_mass() {
+    menu->registerSelectionCallback(selectionCallback);
+    enterScaleMenu();
+    menu->handleAction(MenuAction::DOWN);
+    menu->handleAction(MenuAction::ENTER);
+
+    TEST_ASSERT_TRUE(menu->isInEditMode());
+    TEST_ASSERT_EQUAL(SCALE_DEFAULT_CAL_MASS_G, menu->getEditValue());
+
+    menu->handleAction(MenuAction::UP);
+    menu->handleAction(MenuAction::ENTER);
+
+    TEST_ASSERT_EQUAL(1, selectionHistory.size());
+    TEST_ASSERT_EQUAL(MenuPath::SCALE_CALIBRATE, selectionHistory[0].path);
+    TEST_ASSERT_EQUAL(SCALE_DEFAULT_CAL_MASS_G + SCALE_CAL_MASS_STEP_G, selectionHistory[0].value);
+
+    // The mass is remembered for the next calibration
+    TEST_ASSERT_EQUAL(SCALE_DEFAULT_CAL_MASS_G + SCALE_CAL_MASS_STEP_G,
+                      menu->getCurrentMenuItems()[1].currentValue);
+}
+
+static void enterSystemInfo() {
+    std::vector<MenuItem> root = menu->getCurrentMenuItems();
+    for (size_t i = 0; i < root.size(); i++) {
+        if (root[i].path == MenuPath::SYSTEM_INFO) {
+            break;
+        }
+        menu->handleAction(MenuAction::DOWN);
+    }
+    menu->handleAction(MenuAction::ENTER);
+}
+
+void test_system_info_lists_health_once_sampled() {
+    enterSystemInfo();
+    TEST_ASSERT_EQUAL(MenuPath::SYSTEM_INFO, menu->getCurrentMenuPath());
+    size_t configOnly = menu->getCurrentMenuItems().size();
+
+    HealthStats health;
+    health.sampleCount = 1;
+    health.freeHeap = 180000;
+    health.minEverFreeHeap = 150000;
+    health.largestFreeBlock = 90000;
+    health.fragmentationPercent = 50;
+    health.taskCount = 1;
+    health.tasks[0].name = "LOOP";
+    health.tasks[0].freeBytes = 2500;
+    menu->setHealthStats(health);
+
+    std::vector<MenuItem> items = menu->getCurrentMenuItems();
+    TEST_ASSERT_EQUAL(configOnly + 6, items.size());
+    TEST_ASSERT_EQUAL_STRING("FREE_HEAP", items[0].label.c_str());
+    TEST_ASSERT_EQUAL(180000, items[0].currentValue);
+    TEST_ASSERT_EQUAL(150000, items[1].currentValue);
+    TEST_ASSERT_EQUAL(50, items[4].currentValue);
+    TEST_ASSERT_EQUAL_STRING("STACK_LOOP", items[5].label.c_str());
+    TEST_ASSERT_EQUAL(2500, items[5].currentValue);
+}
+
+static void enterHistory() {
+    std::vector<MenuItem> root = menu->getCurrentMenuItems();
+    for (size_t i = 0; i < root.size(); i++) {
+        if (root[i].path == MenuPath::HISTORY) {
+            break;
+        }
+        menu->handleAction(MenuAction::DOWN);
+    }
+    menu->handleAction(MenuAction::ENTER);
+}
+
+void test_history_without_cycles_shows_placeholder() {
+    enterHistory();
+    TEST_ASSERT_EQUAL(MenuPath::HISTORY, menu->getCurrentMenuPath());
+
+    std::vector<MenuItem> items = menu->getCurrentMenuItems();
+    TEST_ASSERT_EQUAL(2, items.size());
+    TEST_ASSERT_EQUAL_STRING("No cycles yet", items[0].label.c_str());
+    TEST_ASSERT_EQUAL(MenuPath::BACK, items[1].path);
+}
+
+void test_history_lists_recent_cycles_newest_first() {
+    CycleRecord cycles[2];
+    memset(cycles, 0, sizeof(cycles));
+    cycles[0].id = 12;
+    cycles[0].preset = static_cast<uint8_t>(PresetType::PETG);
+    cycles[0].endReason = static_cast<uint8_t>(CycleEndReason::FAILED);
+    cycles[0].duration = 4 * 3600 + 5 * 60;
+    cycles[0].boxTempMean = 6500;
+    cycles[0].energyWh = 35.2f;
+    cycles[0].humidityStart = 4200;
+    cycles[0].humidityEnd = 1800;
+    cycles[1].id = 11;
+    menu->setCycleHistory(cycles, 2);
+
+    enterHistory();
+    std::vector<MenuItem> items = menu->getCurrentMenuItems();
+    TEST_ASSERT_EQUAL(3, items.size());
+    TEST_ASSERT_EQUAL_STRING("#12 PETG FAILED", items[0].label.c_str());
+    TEST_ASSERT_EQUAL_STRING("4h05 65C 35Wh 42>18%", items[0].unit.c_str());
+    TEST_ASSERT_EQUAL(12, items[0].currentValue);
+    TEST_ASSERT_EQUAL(11, items[1].currentValue);
+}
+
 // ==================== Edge Cases ====================
 
 void test_multiple_resets() {
@@ -489,6 +620,12 @@ int main(int argc, char **argv) {
     RUN_TEST(test_preset_menu_accessible);
     RUN_TEST(test_custom_preset_menu_accessible);
     RUN_TEST(test_pid_menu_accessible);
+    RUN_TEST(test_scale_menu_accessible);
+    RUN_TEST(test_scale_tare_fires_callback);
+    RUN_TEST(test_scale_calibrate_edits_reference_mass);
+    RUN_TEST(test_system_info_lists_health_once_sampled);
+    RUN_TEST(test_history_without_cycles_shows_placeholder);
+    RUN_TEST(test_history_lists_recent_cycles_newest_first);
 
     // Edge cases
     RUN_TEST(test_multiple_resets);
@@ -0,0 +1,121 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#define PERF_PROFILING
+#include "../../src/diagnostics/PerfCounters.h"
+
+#include <thread>
+#include <chrono>
+
+void setUp(void) {
+    perfCounters().reset();
+}
+
+void tearDown(void) {
+}
+
+static void sleepMicros(uint32_t micros) {
+    std::this_thread::sleep_for(std::chrono::microseconds(micros));
+}
+
+// ==================== Counter Tests ====================
+
+void test_counters_record_per_zone() {
+    perfCounters().record(PerfZone::PID_COMPUTE, 40);
+    perfCounters().record(PerfZone::PID_COMPUTE, 60);
+
+    const PerfCounters::ZoneHistogram& pid = perfCounters().get(PerfZone::PID_COMPUTE);
+    TEST_ASSERT_EQUAL(2, pid.getCount());
+    TEST_ASSERT_EQUAL(40, pid.getMin());
+    TEST_ASSERT_EQUAL(50, pid.getMean());
+    TEST_ASSERT_EQUAL(60, pid.getMax());
+    TEST_ASSERT_EQUAL(0, perfCounters().get(PerfZone::DRYER_UPDATE).getCount());
+}
+
+void test_counters_reset_clears_every_zone() {
+    perfCounters().record(PerfZone::UI_RENDER_HOME, 25000);
+    perfCounters().record(PerfZone::SETTINGS_WRITE, 9000);
+
+    perfCounters().reset();
+
+    for (uint8_t i = 0; i < static_cast<uint8_t>(PerfZone::COUNT); i++) {
+        TEST_ASSERT_EQUAL(0, perfCounters().get(static_cast<PerfZone>(i)).getCount());
+    }
+}
+
+void test_reset_request_is_applied_by_each_zone_writer() {
+    perfCounters().record(PerfZone::PID_COMPUTE, 40);
+    perfCounters().record(PerfZone::SETTINGS_WRITE, 9000);
+
+    perfCounters().requestReset();
+
+    // Nothing is written until the zone records again, but old samples are hidden
+    TEST_ASSERT_EQUAL(1, perfCounters().get(PerfZone::PID_COMPUTE).getCount());
+    TEST_ASSERT_FALSE(perfCounters().hasSamples(PerfZone::PID_COMPUTE));
+    TEST_ASSERT_FALSE(perfCounters().hasSamples(PerfZone::SETTINGS_WRITE));
+
+    // Another core's writer applies the reset to its own zone
+    std::thread controlCore([] {
+        perfCounters().record(PerfZone::PID_COMPUTE, 70);
+    });
+    controlCore.join();
+
+    const PerfCounters::ZoneHistogram& pid = perfCounters().get(PerfZone::PID_COMPUTE);
+    TEST_ASSERT_TRUE(perfCounters().hasSamples(PerfZone::PID_COMPUTE));
+    TEST_ASSERT_EQUAL(1, pid.getCount());
+    TEST_ASSERT_EQUAL(70, pid.getMin());
+    TEST_ASSERT_FALSE(perfCounters().hasSamples(PerfZone::SETTINGS_WRITE));
+}
+
+void test_every_zone_has_a_name() {
+    for (uint8_t i = 0; i < static_cast<uint8_t>(PerfZone::COUNT); i++) {
+        TEST_ASSERT_NOT_EQUAL(0, strcmp("?", perfZoneName(static_cast<PerfZone>(i))));
+    }
+}
+
+// ==================== Scope Tests ====================
+
+void test_scope_records_elapsed_microseconds() {
+    {
+        PERF_SCOPE(PerfZone::SETTINGS_WRITE);
+        sleepMicros(2000);
+    }
+
+    const PerfCounters::ZoneHistogram& write = perfCounters().get(PerfZone::SETTINGS_WRITE);
+    TEST_ASSERT_EQUAL(1, write.getCount());
+    TEST_ASSERT_TRUE(write.getMax() >= 2000);
+    TEST_ASSERT_TRUE(write.getMax() < 1000000);
+}
+
+void test_scope_p99_tracks_slow_outlier() {
+    for (int i = 0; i < 99; i++) {
+        perfCounters().record(PerfZone::UI_TASK, 100);
+    }
+    perfCounters().record(PerfZone::UI_TASK, 30000);
+
+    const PerfCounters::ZoneHistogram& ui = perfCounters().get(PerfZone::UI_TASK);
+    TEST_ASSERT_TRUE(ui.getPercentile(99) < 256);
+    TEST_ASSERT_EQUAL(30000, ui.getMax());
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // Counters
+    RUN_TEST(test_counters_record_per_zone);
+    RUN_TEST(test_counters_reset_clears_every_zone);
+    RUN_TEST(test_reset_request_is_applied_by_each_zone_writer);
+    RUN_TEST(test_every_zone_has_a_name);
+
+    // Scopes
+    RUN_TEST(test_scope_records_elapsed_microseconds);
+    RUN_TEST(test_scope_p99_tracks_slow_outlier);
+
+    return UNITY_END();
+}
@@ -315,6 +315,46 @@ void test_pid_reset_clears_derivative_filter() {
     TEST_ASSERT_EQUAL_FLOAT(0.0, output);
 }
 
+// ==================== Recovery State Tests ====================
+
+void test_pid_recovery_state_survives_restart() {
+    pid->begin();
+    pid->setProfile(PIDProfile::NORMAL);
+    pid->setLimits(0, 30);
+
+    pid->compute(50.0, 45.0, 50.0, 0);
+    for (int i = 1; i <= 5; i++) {
+        pid->compute(50.0, 45.0, 50.0, i * 1000);
+    }
+    PIDRecoveryState saved = pid->getRecoveryState();
+    TEST_ASSERT_TRUE(saved.integral > 0.0);
+
+    // A fresh controller, as after a reset
+    PIDController restarted;
+    restarted.begin();
+    restarted.setProfile(PIDProfile::NORMAL);
+    restarted.setLimits(0, 30);
+    restarted.restoreRecoveryState(saved);
+
+    PIDRecoveryState restored = restarted.getRecoveryState();
+    TEST_ASSERT_EQUAL_FLOAT(saved.integral, restored.integral);
+    TEST_ASSERT_EQUAL_FLOAT(saved.steadyStateOutput, restored.steadyStateOutput);
+}
+
+void test_pid_restore_clamps_to_output_limits() {
+    pid->begin();
+    pid->setLimits(0, 30);
+    float baseline = pid->getRecoveryState().steadyStateOutput;
+
+    PIDRecoveryState state;
+    state.integral = 500.0;
+    state.steadyStateOutput = 0.0;      // Never learned: keep the baseline
+    pid->restoreRecoveryState(state);
+
+    TEST_ASSERT_EQUAL_FLOAT(30.0, pid->getRecoveryState().integral);
+    TEST_ASSERT_EQUAL_FLOAT(baseline, pid->getRecoveryState().steadyStateOutput);
+}
+
 // ==================== Profile Comparison Tests ====================
 
 void test_pid_soft_profile_gentler_than_normal() {
@@ -562,6 +602,10 @@ int main(int argc, char **argv) {
     RUN_TEST(test_pid_reset_clears_integral);
     RUN_TEST(test_pid_reset_clears_derivative_filter);
 
+    // Recovery state
+    RUN_TEST(test_pid_recovery_state_survives_restart);
+    RUN_TEST(test_pid_restore_clamps_to_output_limits);
+
     // Profile comparison
     RUN_TEST(test_pid_soft_profile_gentler_than_normal);
     RUN_TEST(test_pid_strong_profile_more_aggressive_than_normal);
@@ -0,0 +1,231 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#include "../TestConfig.h"
+#include "../../src/control/PowerManager.h"
+#include "../mocks/MockDryer.h"
+#include "../mocks/MockSensorManager.h"
+#include "../mocks/MockDisplay.h"
+#include "../mocks/MockSleepControl.h"
+
+MockDryer* mockDryer;
+MockSensorManager* mockSensors;
+MockDisplay* mockDisplay;
+MockSleepControl* mockSleep;
+PowerManager* powerManager;
+
+void setUp(void) {
+    mockDryer = new MockDryer();
+    mockSensors = new MockSensorManager();
+    mockDisplay = new MockDisplay();
+    mockSleep = new MockSleepControl();
+    powerManager = new PowerManager(mockDryer, mockSensors, mockDisplay, mockSleep);
+
+    mockDryer->setState(DryerState::READY);
+    powerManager->begin(0);
+}
+
+void tearDown(void) {
+    delete powerManager;
+    delete mockSleep;
+    delete mockDisplay;
+    delete mockSensors;
+    delete mockDryer;
+}
+
+// ==================== Idle Stage Tests ====================
+
+void test_starts_active() {
+    powerManager->update(0);
+
+    TEST_ASSERT_EQUAL(PowerMode::ACTIVE, powerManager->getMode());
+    TEST_ASSERT_EQUAL(DisplayPowerMode::NORMAL, mockDisplay->getPowerMode());
+    TEST_ASSERT_EQUAL(0, mockSensors->getMinInterval());
+}
+
+void test_dims_after_idle_timeout_when_ready() {
+    powerManager->update(IDLE_DIM_AFTER_MS - 1);
+    TEST_ASSERT_EQUAL(PowerMode::ACTIVE, powerManager->getMode());
+
+    powerManager->update(IDLE_DIM_AFTER_MS);
+
+    TEST_ASSERT_EQUAL(PowerMode::DIMMED, powerManager->getMode());
+    TEST_ASSERT_EQUAL(DisplayPowerMode::DIMMED, mockDisplay->getPowerMode());
+    TEST_ASSERT_EQUAL(IDLE_SENSOR_INTERVAL_MS, mockSensors->getMinInterval());
+}
+
+void test_sleeps_after_sleep_timeout() {
+    powerManager->update(IDLE_DIM_AFTER_MS);
+    powerManager->update(IDLE_SLEEP_AFTER_MS);
+
+    TEST_ASSERT_EQUAL(PowerMode::SLEEPING, powerManager->getMode());
+    TEST_ASSERT_EQUAL(DisplayPowerMode::OFF, mockDisplay->getPowerMode());
+    TEST_ASSERT_EQUAL(IDLE_SENSOR_INTERVAL_MS, mockSensors->getMinInterval());
+}
+
+void test_finished_state_also_idles() {
+    mockDryer->setState(DryerState::FINISHED);
+    powerManager->update(1000);
+
+    powerManager->update(1000 + IDLE_SLEEP_AFTER_MS);
+
+    TEST_ASSERT_EQUAL(PowerMode::SLEEPING, powerManager->getMode());
+}
+
+void test_running_never_idles() {
+    mockDryer->setState(DryerState::RUNNING);
+
+    for (uint32_t t = 0; t <= 2 * IDLE_SLEEP_AFTER_MS; t += POWER_TASK_PERIOD_MS) {
+        powerManager->update(t);
+    }
+
+    TEST_ASSERT_EQUAL(PowerMode::ACTIVE, powerManager->getMode());
+    TEST_ASSERT_EQUAL(0, mockSensors->getMinInterval());
+}
+
+void test_idle_timer_restarts_when_cycle_finishes() {
+    mockDryer->setState(DryerState::RUNNING);
+    powerManager->update(2 * IDLE_SLEEP_AFTER_MS);
+
+    mockDryer->setState(DryerState::FINISHED);
+    powerManager->update(2 * IDLE_SLEEP_AFTER_MS + 1000);
+
+    TEST_ASSERT_EQUAL(PowerMode::ACTIVE, powerManager->getMode());
+}
+
+// ==================== Wake Tests ====================
+
+void test_activity_restores_active_immediately() {
+    powerManager->update(IDLE_SLEEP_AFTER_MS);
+    TEST_ASSERT_EQUAL(PowerMode::SLEEPING, powerManager->getMode());
+
+    powerManager->notifyActivity(IDLE_SLEEP_AFTER_MS + 10);
+
+    TEST_ASSERT_EQUAL(PowerMode::ACTIVE, powerManager->getMode());
+    TEST_ASSERT_EQUAL(DisplayPowerMode::NORMAL, mockDisplay->getPowerMode());
+    TEST_ASSERT_EQUAL(0, mockSensors->getMinInterval());
+
+    // Idle timers restart from the activity
+    powerManager->update(IDLE_SLEEP_AFTER_MS + 10 + IDLE_DIM_AFTER_MS - 1);
+    TEST_ASSERT_EQUAL(PowerMode::ACTIVE, powerManager->getMode());
+}
+
+void test_state_change_wakes() {
+    powerManager->update(IDLE_SLEEP_AFTER_MS);
+
+    // e.g. "start" arriving from the menu or serial
+    mockDryer->setState(DryerState::RUNNING);
+
+    TEST_ASSERT_EQUAL(PowerMode::ACTIVE, powerManager->getMode());
+}
+
+void test_button_wake_from_light_sleep_restores_active() {
+    powerManager->update(IDLE_SLEEP_AFTER_MS);
+    mockSleep->setWakeByButton(true);
+
+    powerManager->idle(50, IDLE_SLEEP_AFTER_MS);
+
+    TEST_ASSERT_EQUAL(1, mockSleep->getLightSleepCount());
+    TEST_ASSERT_EQUAL(PowerMode::ACTIVE, powerManager->getMode());
+}
+
+void test_timer_wake_stays_sleeping() {
+    powerManager->update(IDLE_SLEEP_AFTER_MS);
+    mockSleep->setWakeByButton(false);
+
+    powerManager->idle(50, IDLE_SLEEP_AFTER_MS);
+
+    TEST_ASSERT_EQUAL(PowerMode::SLEEPING, powerManager->getMode());
+}
+
+void test_serial_command_wakes_sleeping_dryer() {
+    mockSleep->setSerialHostConnected(true);
+    powerManager->update(IDLE_SLEEP_AFTER_MS);
+    TEST_ASSERT_EQUAL(PowerMode::SLEEPING, powerManager->getMode());
+
+    // With a host attached the loop only waits, so serial is still read...
+    powerManager->idle(50, IDLE_SLEEP_AFTER_MS);
+    TEST_ASSERT_EQUAL(0, mockSleep->getLightSleepCount());
+    TEST_ASSERT_EQUAL(1, mockSleep->getWaitCount());
+
+    // ...and the next pass handles `start` like main's serial handler does
+    powerManager->notifyActivity(IDLE_SLEEP_AFTER_MS + 50);
+    mockDryer->start();
+    powerManager->update(IDLE_SLEEP_AFTER_MS + 50);
+
+    TEST_ASSERT_EQUAL(PowerMode::ACTIVE, powerManager->getMode());
+    TEST_ASSERT_EQUAL(DisplayPowerMode::NORMAL, mockDisplay->getPowerMode());
+    TEST_ASSERT_EQUAL(0, mockSensors->getMinInterval());
+}
+
+// ==================== Idle Wait Tests ====================
+
+void test_idle_uses_plain_wait_unless_sleeping() {
+    powerManager->idle(50, 0);
+    powerManager->update(IDLE_DIM_AFTER_MS);
+    powerManager->idle(50, IDLE_DIM_AFTER_MS);
+
+    TEST_ASSERT_EQUAL(2, mockSleep->getWaitCount());
+    TEST_ASSERT_EQUAL(0, mockSleep->getLightSleepCount());
+}
+
+void test_idle_light_sleeps_for_requested_time() {
+    powerManager->update(IDLE_SLEEP_AFTER_MS);
+
+    powerManager->idle(40, IDLE_SLEEP_AFTER_MS);
+
+    TEST_ASSERT_EQUAL(1, mockSleep->getLightSleepCount());
+    TEST_ASSERT_EQUAL(40, mockSleep->getLastDuration());
+}
+
+void test_short_idle_does_not_light_sleep() {
+    powerManager->update(IDLE_SLEEP_AFTER_MS);
+
+    powerManager->idle(IDLE_MIN_LIGHT_SLEEP_MS - 1, IDLE_SLEEP_AFTER_MS);
+
+    TEST_ASSERT_EQUAL(0, mockSleep->getLightSleepCount());
+    TEST_ASSERT_EQUAL(1, mockSleep->getWaitCount());
+}
+
+void test_works_without_sensor_manager() {
+    PowerManager displayOnly(mockDryer, nullptr, mockDisplay, mockSleep);
+    displayOnly.begin(0);
+
+    displayOnly.update(IDLE_SLEEP_AFTER_MS);
+
+    TEST_ASSERT_EQUAL(PowerMode::SLEEPING, displayOnly.getMode());
+    TEST_ASSERT_EQUAL(DisplayPowerMode::OFF, mockDisplay->getPowerMode());
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // Idle stages
+    RUN_TEST(test_starts_active);
+    RUN_TEST(test_dims_after_idle_timeout_when_ready);
+    RUN_TEST(test_sleeps_after_sleep_timeout);
+    RUN_TEST(test_finished_state_also_idles);
+    RUN_TEST(test_running_never_idles);
+    RUN_TEST(test_idle_timer_restarts_when_cycle_finishes);
+
+    // Wake
+    RUN_TEST(test_activity_restores_active_immediately);
+    RUN_TEST(test_state_change_wakes);
+    RUN_TEST(test_button_wake_from_light_sleep_restores_active);
+    RUN_TEST(test_timer_wake_stays_sleeping);
+    RUN_TEST(test_serial_command_wakes_sleeping_dryer);
+
+    // Idle wait
+    RUN_TEST(test_idle_uses_plain_wait_unless_sleeping);
+    RUN_TEST(test_idle_light_sleeps_for_requested_time);
+    RUN_TEST(test_short_idle_does_not_light_sleep);
+    RUN_TEST(test_works_without_sensor_manager);
+
+    return UNITY_END();
+}
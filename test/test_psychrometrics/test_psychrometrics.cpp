@@ -0,0 +1,103 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#include <math.h>
+#include "../../src/sensors/Psychrometrics.h"
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+// Reference: Magnus/Buck formula evaluated with expf (test host only)
+static float referenceSaturation(float t) {
+    return 6.1121f * expf((18.678f - t / 234.5f) * (t / (257.14f + t)));
+}
+
+// ==================== Saturation Pressure Tests ====================
+
+void test_saturation_pressure_matches_table_points() {
+    TEST_ASSERT_FLOAT_WITHIN(0.001, 6.1121, Psychrometrics::saturationVaporPressure(0.0));
+    TEST_ASSERT_FLOAT_WITHIN(0.001, 123.494, Psychrometrics::saturationVaporPressure(50.0));
+}
+
+void test_saturation_pressure_within_two_percent_between_points() {
+    for (float t = -15.0f; t <= 95.0f; t += 0.5f) {
+        float reference = referenceSaturation(t);
+        float approx = Psychrometrics::saturationVaporPressure(t);
+        TEST_ASSERT_FLOAT_WITHIN(reference * 0.02f, reference, approx);
+    }
+}
+
+void test_saturation_pressure_clamps_outside_table() {
+    TEST_ASSERT_EQUAL_FLOAT(Psychrometrics::saturationVaporPressure(-20.0),
+                            Psychrometrics::saturationVaporPressure(-40.0));
+    TEST_ASSERT_EQUAL_FLOAT(Psychrometrics::saturationVaporPressure(100.0),
+                            Psychrometrics::saturationVaporPressure(130.0));
+}
+
+// ==================== Absolute Humidity Tests ====================
+
+void test_absolute_humidity_at_room_conditions() {
+    // 20°C / 50% RH is ~8.6 g/m³
+    TEST_ASSERT_FLOAT_WITHIN(0.2, 8.6, Psychrometrics::absoluteHumidity(20.0, 50.0));
+}
+
+void test_absolute_humidity_constant_when_heating_sealed_air() {
+    // Same water content: heating 25°C/60% to 50°C drops RH to ~15.4%
+    float cold = Psychrometrics::absoluteHumidity(25.0, 60.0);
+    float hot = Psychrometrics::absoluteHumidity(50.0, 15.4);
+
+    // AH only differs by the gas expansion factor (298K vs 323K)
+    TEST_ASSERT_FLOAT_WITHIN(cold * 0.1f, cold, hot);
+}
+
+void test_absolute_humidity_zero_for_dry_air() {
+    TEST_ASSERT_EQUAL_FLOAT(0.0, Psychrometrics::absoluteHumidity(50.0, 0.0));
+}
+
+// ==================== Dew Point Tests ====================
+
+void test_dew_point_equals_temperature_at_saturation() {
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 30.0, Psychrometrics::dewPoint(30.0, 100.0));
+    TEST_ASSERT_FLOAT_WITHIN(0.3, 42.5, Psychrometrics::dewPoint(42.5, 100.0));
+}
+
+void test_dew_point_matches_reference() {
+    // 25°C / 50% RH -> 13.9°C, 60°C / 10% RH -> 17.5°C
+    TEST_ASSERT_FLOAT_WITHIN(0.4, 13.9, Psychrometrics::dewPoint(25.0, 50.0));
+    TEST_ASSERT_FLOAT_WITHIN(0.4, 17.5, Psychrometrics::dewPoint(60.0, 10.0));
+}
+
+void test_dew_point_clamps_to_table_minimum() {
+    TEST_ASSERT_EQUAL_FLOAT(-20.0, Psychrometrics::dewPoint(25.0, 0.5));
+    TEST_ASSERT_EQUAL_FLOAT(-20.0, Psychrometrics::dewPoint(25.0, 0.0));
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // Saturation pressure
+    RUN_TEST(test_saturation_pressure_matches_table_points);
+    RUN_TEST(test_saturation_pressure_within_two_percent_between_points);
+    RUN_TEST(test_saturation_pressure_clamps_outside_table);
+
+    // Absolute humidity
+    RUN_TEST(test_absolute_humidity_at_room_conditions);
+    RUN_TEST(test_absolute_humidity_constant_when_heating_sealed_air);
+    RUN_TEST(test_absolute_humidity_zero_for_dry_air);
+
+    // Dew point
+    RUN_TEST(test_dew_point_equals_temperature_at_saturation);
+    RUN_TEST(test_dew_point_matches_reference);
+    RUN_TEST(test_dew_point_clamps_to_table_minimum);
+
+    return UNITY_END();
+}
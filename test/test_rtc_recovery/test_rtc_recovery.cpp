@@ -0,0 +1,160 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#include "../../src/storage/RtcRecoveryMemory.h"
+
+// Plays the RTC_NOINIT_ATTR region: survives "resets" (new instances)
+RtcRecoveryRegion region;
+RtcRecoveryMemory* memory;
+
+static RecoverySnapshot snapshot(DryerState state, uint32_t elapsed, float integral = 0) {
+    RecoverySnapshot value;
+    value.state = state;
+    value.preset = PresetType::PETG;
+    value.elapsed = elapsed;
+    value.targetTemp = 65.0f;
+    value.targetTime = 18000;
+    value.pid.integral = integral;
+    value.pid.steadyStateOutput = 42.5f;
+    return value;
+}
+
+static void reset() {
+    delete memory;
+    memory = new RtcRecoveryMemory(region);
+}
+
+void setUp(void) {
+    memset(&region, 0, sizeof(region));
+    memory = new RtcRecoveryMemory(region);
+}
+
+void tearDown(void) {
+    delete memory;
+    memory = nullptr;
+}
+
+// ==================== Load Tests ====================
+
+void test_zeroed_region_has_no_snapshot() {
+    RecoverySnapshot loaded;
+
+    TEST_ASSERT_FALSE(memory->load(loaded));
+    TEST_ASSERT_EQUAL(0, memory->getSequence());
+}
+
+void test_noise_region_has_no_snapshot() {
+    memset(&region, 0xA5, sizeof(region));
+    reset();
+
+    RecoverySnapshot loaded;
+    TEST_ASSERT_FALSE(memory->load(loaded));
+}
+
+void test_snapshot_survives_reset() {
+    memory->store(snapshot(DryerState::RUNNING, 1234, 17.25f));
+
+    reset();
+
+    RecoverySnapshot loaded;
+    TEST_ASSERT_TRUE(memory->load(loaded));
+    TEST_ASSERT_EQUAL(DryerState::RUNNING, loaded.state);
+    TEST_ASSERT_EQUAL(PresetType::PETG, loaded.preset);
+    TEST_ASSERT_EQUAL(1234, loaded.elapsed);
+    TEST_ASSERT_EQUAL_FLOAT(65.0f, loaded.targetTemp);
+    TEST_ASSERT_EQUAL(18000, loaded.targetTime);
+    TEST_ASSERT_EQUAL_FLOAT(17.25f, loaded.pid.integral);
+    TEST_ASSERT_EQUAL_FLOAT(42.5f, loaded.pid.steadyStateOutput);
+}
+
+void test_other_layout_version_is_rejected() {
+    memory->store(snapshot(DryerState::RUNNING, 10));
+    for (RtcRecoveryRecord& record : region.slots) {
+        record.version = RTC_RECOVERY_VERSION + 1;
+    }
+
+    reset();
+
+    RecoverySnapshot loaded;
+    TEST_ASSERT_FALSE(memory->load(loaded));
+}
+
+// ==================== Store Tests ====================
+
+void test_stores_alternate_slots_with_rising_sequence() {
+    memory->store(snapshot(DryerState::RUNNING, 1));
+    memory->store(snapshot(DryerState::RUNNING, 2));
+    memory->store(snapshot(DryerState::RUNNING, 3));
+
+    TEST_ASSERT_EQUAL(3, memory->getSequence());
+    TEST_ASSERT_EQUAL(3, region.slots[0].elapsed);
+    TEST_ASSERT_EQUAL(2, region.slots[1].elapsed);
+
+    reset();
+    TEST_ASSERT_EQUAL(3, memory->getSequence());
+}
+
+void test_unchanged_snapshot_writes_nothing() {
+    memory->store(snapshot(DryerState::PAUSED, 600));
+    RtcRecoveryRegion before = region;
+
+    memory->store(snapshot(DryerState::PAUSED, 600));
+
+    TEST_ASSERT_EQUAL(1, memory->getSequence());
+    TEST_ASSERT_EQUAL_MEMORY(&before, &region, sizeof(region));
+}
+
+void test_torn_newest_slot_falls_back_to_previous_tick() {
+    memory->store(snapshot(DryerState::RUNNING, 100));
+    memory->store(snapshot(DryerState::RUNNING, 101));
+
+    // Reset in the middle of writing slot 1
+    region.slots[1].elapsed = 0xFFFF;
+
+    reset();
+
+    RecoverySnapshot loaded;
+    TEST_ASSERT_TRUE(memory->load(loaded));
+    TEST_ASSERT_EQUAL(100, loaded.elapsed);
+    TEST_ASSERT_EQUAL(1, memory->getSequence());
+
+    // The next store replaces the torn slot, not the intact one
+    memory->store(snapshot(DryerState::RUNNING, 102));
+    TEST_ASSERT_EQUAL(100, region.slots[0].elapsed);
+    TEST_ASSERT_EQUAL(102, region.slots[1].elapsed);
+}
+
+void test_invalidate_forgets_snapshot() {
+    memory->store(snapshot(DryerState::RUNNING, 100));
+
+    memory->invalidate();
+
+    RecoverySnapshot loaded;
+    TEST_ASSERT_FALSE(memory->load(loaded));
+    reset();
+    TEST_ASSERT_FALSE(memory->load(loaded));
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // Load
+    RUN_TEST(test_zeroed_region_has_no_snapshot);
+    RUN_TEST(test_noise_region_has_no_snapshot);
+    RUN_TEST(test_snapshot_survives_reset);
+    RUN_TEST(test_other_layout_version_is_rejected);
+
+    // Store
+    RUN_TEST(test_stores_alternate_slots_with_rising_sequence);
+    RUN_TEST(test_unchanged_snapshot_writes_nothing);
+    RUN_TEST(test_torn_newest_slot_falls_back_to_previous_tick);
+    RUN_TEST(test_invalidate_forgets_snapshot);
+
+    return UNITY_END();
+}
@@ -0,0 +1,172 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#include "../../src/storage/RuntimeJournal.h"
+
+#define JOURNAL_NAMESPACE "test_journal"
+
+RuntimeJournal* journal;
+
+// Read the stored record straight from NVS
+static RuntimeRecord readStored() {
+    RuntimeRecord record;
+    memset(&record, 0, sizeof(record));
+    Preferences preferences;
+    preferences.begin(JOURNAL_NAMESPACE, true);
+    preferences.getBytes(RUNTIME_NVS_KEY, &record, sizeof(record));
+    preferences.end();
+    return record;
+}
+
+static void restart() {
+    delete journal;
+    journal = new RuntimeJournal(JOURNAL_NAMESPACE);
+}
+
+void setUp(void) {
+    LittleFS.format();
+    LittleFS.begin(true);
+    LittleFS.resetWear();
+    Preferences::eraseAll();
+    Preferences::resetWear();
+    journal = new RuntimeJournal(JOURNAL_NAMESPACE);
+}
+
+void tearDown(void) {
+    delete journal;
+}
+
+// ==================== CRC Tests ====================
+
+void test_crc32_matches_standard_check_value() {
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, crc32("123456789", 9));
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, crc32("6789", 4, crc32("12345", 5)));
+}
+
+// ==================== Save Tests ====================
+
+void test_first_recover_finds_nothing_and_writes_nothing() {
+    RuntimeRecord latest;
+
+    TEST_ASSERT_FALSE(journal->recover(latest));
+    TEST_ASSERT_EQUAL(0, journal->getSequence());
+    TEST_ASSERT_EQUAL(0, Preferences::getEntriesWritten());
+}
+
+void test_save_replaces_the_record_with_a_higher_sequence() {
+    RuntimeRecord latest;
+    journal->recover(latest);
+
+    journal->save(DryerState::RUNNING, 10, 50.0f, 3600, PresetType::PLA, 100);
+    TEST_ASSERT_EQUAL(1, readStored().sequence);
+
+    journal->save(DryerState::RUNNING, 20, 50.0f, 3600, PresetType::PLA, 200);
+    TEST_ASSERT_EQUAL(2, readStored().sequence);
+    TEST_ASSERT_EQUAL(20, readStored().elapsed);
+    TEST_ASSERT_EQUAL(2, journal->getSequence());
+}
+
+void test_save_appends_nvs_entries_not_a_littlefs_block() {
+    RuntimeRecord latest;
+    journal->recover(latest);
+
+    for (uint32_t i = 0; i < 42; i++) {
+        TEST_ASSERT_TRUE(journal->save(DryerState::RUNNING, i, 50.0f, 3600, PresetType::PLA, i));
+    }
+
+    // Three entries per 32-byte record: 42 saves fill one NVS page
+    TEST_ASSERT_EQUAL(nvsBlobEntries(sizeof(RuntimeRecord)), 3);
+    TEST_ASSERT_EQUAL(126, Preferences::getEntriesWritten());
+    TEST_ASSERT_EQUAL(1, Preferences::getPageErases());
+    TEST_ASSERT_EQUAL(0, LittleFS.getBlockErases());
+    TEST_ASSERT_EQUAL(0, LittleFS.getBytesWritten());
+}
+
+// ==================== Recovery Tests ====================
+
+void test_recover_returns_newest_record_after_restart() {
+    RuntimeRecord latest;
+    journal->recover(latest);
+    journal->save(DryerState::RUNNING, 10, 50.0f, 3600, PresetType::PLA, 100);
+    journal->save(DryerState::PAUSED, 70, 65.0f, 18000, PresetType::PETG, 700);
+
+    restart();
+
+    TEST_ASSERT_TRUE(journal->recover(latest));
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(DryerState::PAUSED), latest.state);
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(PresetType::PETG), latest.preset);
+    TEST_ASSERT_EQUAL(70, latest.elapsed);
+    TEST_ASSERT_EQUAL_FLOAT(65.0f, latest.targetTemp);
+    TEST_ASSERT_EQUAL(2, journal->getSequence());
+}
+
+void test_damaged_record_is_ignored() {
+    RuntimeRecord latest;
+    journal->recover(latest);
+    journal->save(DryerState::RUNNING, 10, 50.0f, 3600, PresetType::PLA, 100);
+
+    RuntimeRecord damaged = readStored();
+    damaged.elapsed ^= 0x40;
+    Preferences::corrupt(JOURNAL_NAMESPACE, RUNTIME_NVS_KEY, &damaged, sizeof(damaged));
+
+    restart();
+    TEST_ASSERT_FALSE(journal->recover(latest));
+
+    // The next save replaces it
+    journal->save(DryerState::RUNNING, 30, 50.0f, 3600, PresetType::PLA, 300);
+    restart();
+    TEST_ASSERT_TRUE(journal->recover(latest));
+    TEST_ASSERT_EQUAL(30, latest.elapsed);
+}
+
+void test_wrong_size_value_is_ignored() {
+    Preferences::corrupt(JOURNAL_NAMESPACE, RUNTIME_NVS_KEY, "{\"version\":1}", 13);
+
+    RuntimeRecord latest;
+    TEST_ASSERT_FALSE(journal->recover(latest));
+    TEST_ASSERT_EQUAL(0, journal->getSequence());
+}
+
+void test_clear_writes_tombstone() {
+    RuntimeRecord latest;
+    journal->recover(latest);
+    journal->save(DryerState::RUNNING, 10, 50.0f, 3600, PresetType::PLA, 100);
+    journal->clear(200);
+
+    restart();
+    TEST_ASSERT_FALSE(journal->recover(latest));
+    TEST_ASSERT_EQUAL(2, journal->getSequence());
+
+    // The sequence keeps rising across cycles
+    journal->save(DryerState::RUNNING, 5, 50.0f, 3600, PresetType::PLA, 300);
+    restart();
+    TEST_ASSERT_TRUE(journal->recover(latest));
+    TEST_ASSERT_EQUAL(5, latest.elapsed);
+    TEST_ASSERT_EQUAL(3, latest.sequence);
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // CRC
+    RUN_TEST(test_crc32_matches_standard_check_value);
+
+    // Save
+    RUN_TEST(test_first_recover_finds_nothing_and_writes_nothing);
+    RUN_TEST(test_save_replaces_the_record_with_a_higher_sequence);
+    RUN_TEST(test_save_appends_nvs_entries_not_a_littlefs_block);
+
+    // Recovery
+    RUN_TEST(test_recover_returns_newest_record_after_restart);
+    RUN_TEST(test_damaged_record_is_ignored);
+    RUN_TEST(test_wrong_size_value_is_ignored);
+    RUN_TEST(test_clear_writes_tombstone);
+
+    return UNITY_END();
+}
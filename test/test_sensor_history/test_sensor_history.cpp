@@ -0,0 +1,187 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#include "../../src/history/SensorHistory.h"
+
+// Test fixture
+SensorHistory* history;
+
+void setUp(void) {
+    history = new SensorHistory();
+}
+
+void tearDown(void) {
+    delete history;
+}
+
+static void addSamples(uint32_t count, float heater, float box, float humidity, float pwm) {
+    for (uint32_t i = 0; i < count; i++) {
+        history->addSample(HistorySample::from(heater, box, humidity, pwm));
+    }
+}
+
+// ==================== Encoding Tests ====================
+
+void test_sample_encodes_fixed_point_hundredths() {
+    HistorySample sample = HistorySample::from(72.345f, 49.99f, 38.5f, 42.4f);
+
+    TEST_ASSERT_EQUAL(7235, sample.heaterTemp);
+    TEST_ASSERT_EQUAL(4999, sample.boxTemp);
+    TEST_ASSERT_EQUAL(3850, sample.humidity);
+    TEST_ASSERT_EQUAL(42, sample.pwm);
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 72.35, sample.getHeaterTemp());
+}
+
+void test_sample_encoding_clamps_out_of_range_values() {
+    HistorySample sample = HistorySample::from(500.0f, -20.5f, 120.0f, 150.0f);
+
+    TEST_ASSERT_EQUAL(32700, sample.heaterTemp);
+    TEST_ASSERT_EQUAL(-2050, sample.boxTemp);
+    TEST_ASSERT_EQUAL(10000, sample.humidity);
+    TEST_ASSERT_EQUAL(PWM_MAX, sample.pwm);
+}
+
+// ==================== Tier Tests ====================
+
+void test_history_starts_empty() {
+    TEST_ASSERT_EQUAL(0, history->getCount(HistoryTier::SECONDS));
+    TEST_ASSERT_EQUAL(0, history->getCount(HistoryTier::TEN_SECONDS));
+    TEST_ASSERT_EQUAL(0, history->getCount(HistoryTier::MINUTES));
+}
+
+void test_history_seconds_tier_returns_newest_first() {
+    addSamples(1, 60.0, 40.0, 30.0, 10);
+    addSamples(1, 61.0, 41.0, 31.0, 20);
+
+    TEST_ASSERT_EQUAL(2, history->getCount(HistoryTier::SECONDS));
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 61.0, history->get(HistoryTier::SECONDS, 0).mean.getHeaterTemp());
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 60.0, history->get(HistoryTier::SECONDS, 1).mean.getHeaterTemp());
+}
+
+void test_history_seconds_tier_overwrites_oldest_when_full() {
+    addSamples(HISTORY_TIER0_SAMPLES, 50.0, 40.0, 30.0, 0);
+    addSamples(5, 70.0, 40.0, 30.0, 0);
+
+    TEST_ASSERT_EQUAL(HISTORY_TIER0_SAMPLES, history->getCount(HistoryTier::SECONDS));
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 70.0, history->get(HistoryTier::SECONDS, 4).mean.getHeaterTemp());
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 50.0, history->get(HistoryTier::SECONDS, 5).mean.getHeaterTemp());
+}
+
+void test_history_ten_second_tier_downsamples_min_max_mean() {
+    // Heater ramps 60..69, humidity falls 40..31
+    for (int i = 0; i < HISTORY_TIER1_FACTOR; i++) {
+        history->addSample(HistorySample::from(60.0 + i, 45.0, 40.0 - i, i * 10));
+    }
+
+    TEST_ASSERT_EQUAL(1, history->getCount(HistoryTier::TEN_SECONDS));
+
+    HistoryAggregate entry = history->get(HistoryTier::TEN_SECONDS, 0);
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 60.0, entry.minimum.getHeaterTemp());
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 69.0, entry.maximum.getHeaterTemp());
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 64.5, entry.mean.getHeaterTemp());
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 31.0, entry.minimum.getHumidity());
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 40.0, entry.maximum.getHumidity());
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 45.0, entry.mean.getBoxTemp());
+    TEST_ASSERT_EQUAL(0, entry.minimum.getPWM());
+    TEST_ASSERT_EQUAL(90, entry.maximum.getPWM());
+    TEST_ASSERT_EQUAL(45, entry.mean.getPWM());
+}
+
+void test_history_minute_tier_cascades_from_ten_second_tier() {
+    uint32_t perMinute = HISTORY_TIER1_FACTOR * HISTORY_TIER2_FACTOR;
+
+    addSamples(perMinute - 1, 50.0, 40.0, 30.0, 20);
+    TEST_ASSERT_EQUAL(0, history->getCount(HistoryTier::MINUTES));
+
+    addSamples(1, 80.0, 40.0, 30.0, 20);   // One spike at the end of the minute
+    TEST_ASSERT_EQUAL(1, history->getCount(HistoryTier::MINUTES));
+
+    HistoryAggregate minute = history->get(HistoryTier::MINUTES, 0);
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 50.0, minute.minimum.getHeaterTemp());
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 80.0, minute.maximum.getHeaterTemp());
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 50.5, minute.mean.getHeaterTemp());
+}
+
+void test_history_minute_tier_covers_ten_hours() {
+    uint32_t seconds = 10UL * 3600UL;
+    addSamples(seconds, 55.0, 45.0, 20.0, 30);
+
+    TEST_ASSERT_EQUAL(600, history->getCount(HistoryTier::MINUTES));
+    TEST_ASSERT_EQUAL(HISTORY_TIER1_SAMPLES, history->getCount(HistoryTier::TEN_SECONDS));
+    TEST_ASSERT_TRUE(history->getCapacity(HistoryTier::MINUTES) *
+                     SensorHistory::getResolutionSeconds(HistoryTier::MINUTES) >= seconds);
+}
+
+// ==================== Recording Tests ====================
+
+void test_history_records_at_most_once_per_interval() {
+    CurrentStats stats;
+    stats.currentTemp = 60.0;
+    stats.boxTemp = 45.0;
+    stats.boxHumidity = 30.0;
+    stats.pwmOutput = 25.0;
+
+    // Stats callback fires every loop; only one sample per second is kept
+    for (uint32_t t = 0; t < 5000; t += 10) {
+        history->record(stats, t);
+    }
+
+    TEST_ASSERT_EQUAL(5, history->getCount(HistoryTier::SECONDS));
+    TEST_ASSERT_EQUAL(25, history->get(HistoryTier::SECONDS, 0).mean.getPWM());
+}
+
+void test_history_keeps_cadence_after_late_call() {
+    CurrentStats stats;
+
+    history->record(stats, 0);
+    history->record(stats, 1300);   // Late - counts as the 1000ms slot
+    history->record(stats, 1999);   // Still in the same slot
+    history->record(stats, 2000);
+
+    TEST_ASSERT_EQUAL(3, history->getCount(HistoryTier::SECONDS));
+}
+
+void test_history_clear_empties_all_tiers() {
+    addSamples(HISTORY_TIER1_FACTOR * HISTORY_TIER2_FACTOR, 50.0, 40.0, 30.0, 20);
+    history->clear();
+
+    TEST_ASSERT_EQUAL(0, history->getCount(HistoryTier::SECONDS));
+    TEST_ASSERT_EQUAL(0, history->getCount(HistoryTier::TEN_SECONDS));
+    TEST_ASSERT_EQUAL(0, history->getCount(HistoryTier::MINUTES));
+}
+
+void test_history_footprint_is_fixed_at_compile_time() {
+    TEST_ASSERT_TRUE(SensorHistory::FOOTPRINT_BYTES <= HISTORY_MAX_BYTES);
+    TEST_ASSERT_TRUE(sizeof(SensorHistory) >= SensorHistory::FOOTPRINT_BYTES);
+    TEST_ASSERT_TRUE(sizeof(SensorHistory) < SensorHistory::FOOTPRINT_BYTES + 256);
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // Encoding
+    RUN_TEST(test_sample_encodes_fixed_point_hundredths);
+    RUN_TEST(test_sample_encoding_clamps_out_of_range_values);
+
+    // Tiers
+    RUN_TEST(test_history_starts_empty);
+    RUN_TEST(test_history_seconds_tier_returns_newest_first);
+    RUN_TEST(test_history_seconds_tier_overwrites_oldest_when_full);
+    RUN_TEST(test_history_ten_second_tier_downsamples_min_max_mean);
+    RUN_TEST(test_history_minute_tier_cascades_from_ten_second_tier);
+    RUN_TEST(test_history_minute_tier_covers_ten_hours);
+
+    // Recording
+    RUN_TEST(test_history_records_at_most_once_per_interval);
+    RUN_TEST(test_history_keeps_cadence_after_late_call);
+    RUN_TEST(test_history_clear_empties_all_tiers);
+    RUN_TEST(test_history_footprint_is_fixed_at_compile_time);
+
+    return UNITY_END();
+}
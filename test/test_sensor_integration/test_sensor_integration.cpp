@@ -9,6 +9,7 @@
 #include "../src/sensors/SensorManager.h"
 #include "mocks/MockHeaterTempSensor.h"
 #include "mocks/MockBoxTempHumiditySensor.h"
+#include "mocks/MockSensorChannel.h"
 
 // Test fixture
 MockHeaterTempSensor* heaterSensor;
@@ -265,10 +266,300 @@ void test_sensor_manager_maintains_independent_sensor_states() {
 }
 
 // ==================== Timeout Tests ====================
-// Note: Timeout detection removed from SensorManager as it's redundant
-// (timeout check runs in same update() call that would be missing)
-// True watchdog protection should be implemented at a higher level
-// (e.g., hardware watchdog timer, separate monitoring task)
+// Note: SensorManager does not raise timeouts (SafetyMonitor does), but a
+// reading older than SENSOR_TIMEOUT is reported invalid by the getters
+
+void test_sensor_manager_heater_reading_goes_stale_after_sensor_timeout() {
+    const uint32_t interval = SENSOR_TIMEOUT + 2000;
+    heaterSensor->setTemperature(60.0);
+    sensorManager->begin();
+    sensorManager->setMinInterval(interval);
+
+    sensorManager->update(interval);
+    sensorManager->update(interval + 1);
+    TEST_ASSERT_TRUE(sensorManager->isHeaterTempValid());
+
+    sensorManager->update(interval + 1 + SENSOR_TIMEOUT);
+    TEST_ASSERT_TRUE(sensorManager->isHeaterTempValid());
+
+    sensorManager->update(interval + 2 + SENSOR_TIMEOUT);
+    TEST_ASSERT_FALSE(sensorManager->isHeaterTempValid());
+    TEST_ASSERT_FALSE(sensorManager->getReadings().heaterTemp.isValid);
+    TEST_ASSERT_EQUAL_FLOAT(60.0, sensorManager->getHeaterTemp());   // Last value kept
+
+    // The next completed sample makes it valid again
+    sensorManager->setMinInterval(0);
+    sensorManager->update(interval + 3 + SENSOR_TIMEOUT);
+    sensorManager->update(interval + 4 + SENSOR_TIMEOUT);
+    TEST_ASSERT_TRUE(sensorManager->isHeaterTempValid());
+}
+
+void test_sensor_manager_box_data_goes_stale_between_stretched_samples() {
+    boxSensor->setReadings(45.0, 30.0);
+    sensorManager->begin();
+    sensorManager->setMinInterval(SENSOR_TIMEOUT + 2000);
+
+    sensorManager->update(SENSOR_TIMEOUT + 2000);
+    TEST_ASSERT_TRUE(sensorManager->isBoxDataValid());
+
+    sensorManager->update(2 * SENSOR_TIMEOUT + 2001);
+    TEST_ASSERT_FALSE(sensorManager->isBoxDataValid());
+}
+
+// ==================== Channel Registry Tests ====================
+
+void test_sensor_manager_registers_builtin_channels() {
+    TEST_ASSERT_EQUAL(2, sensorManager->getChannelCount());
+}
+
+void test_sensor_manager_reads_registered_channel_at_its_own_rate() {
+    MockSensorChannel ambient(SensorType::BOX_TEMP);
+    ambient.setValue(21.5);
+
+    uint8_t id = sensorManager->registerChannel(&ambient, SensorChannelConfig(500, 0));
+    TEST_ASSERT_EQUAL(2, id);
+
+    sensorManager->begin();
+    TEST_ASSERT_TRUE(ambient.isInitialized());
+
+    sensorManager->update(499);
+    TEST_ASSERT_EQUAL(0, ambient.getReadCallCount());
+
+    sensorManager->update(500);
+    TEST_ASSERT_EQUAL(1, ambient.getReadCallCount());
+
+    sensorManager->update(999);
+    TEST_ASSERT_EQUAL(1, ambient.getReadCallCount());
+
+    sensorManager->update(1000);
+    TEST_ASSERT_EQUAL(2, ambient.getReadCallCount());
+
+    SensorReading reading = sensorManager->getChannelReading(id);
+    TEST_ASSERT_TRUE(reading.isValid);
+    TEST_ASSERT_EQUAL_FLOAT(21.5, reading.value);
+    TEST_ASSERT_EQUAL(1000, reading.timestamp);
+}
+
+void test_sensor_manager_polls_async_channel_until_ready() {
+    MockSensorChannel scale(SensorType::BOX_TEMP, true);
+    scale.setValue(812.0);
+
+    uint8_t id = sensorManager->registerChannel(&scale, SensorChannelConfig(1000, 0));
+    sensorManager->begin();
+
+    int updates = 0;
+    uint8_t lastChannel = INVALID_SENSOR_CHANNEL;
+    sensorManager->registerChannelCallback(
+        [&updates, &lastChannel, id](uint8_t channel, const SensorReading* values, uint8_t count) {
+            if (channel == id) {
+                updates++;
+                lastChannel = channel;
+            }
+        }
+    );
+
+    sensorManager->update(1000);
+    TEST_ASSERT_EQUAL(1, scale.getStartCallCount());
+    TEST_ASSERT_EQUAL(0, scale.getReadCallCount());
+
+    // Not ready yet - polled but not read
+    sensorManager->update(1050);
+    TEST_ASSERT_EQUAL(0, scale.getReadCallCount());
+
+    scale.completeSample();
+    sensorManager->update(1100);
+    TEST_ASSERT_EQUAL(1, scale.getReadCallCount());
+    TEST_ASSERT_EQUAL(1, updates);
+    TEST_ASSERT_EQUAL(id, lastChannel);
+
+    // No new acquisition started while one was in flight
+    TEST_ASSERT_EQUAL(1, scale.getStartCallCount());
+}
+
+void test_sensor_manager_channel_reading_expires_after_validity_timeout() {
+    MockSensorChannel ambient(SensorType::BOX_TEMP);
+    ambient.setValue(20.0);
+
+    // 10s interval with a 3s validity timeout
+    uint8_t id = sensorManager->registerChannel(&ambient, SensorChannelConfig(10000, 3000));
+    sensorManager->begin();
+
+    sensorManager->update(10000);
+    TEST_ASSERT_TRUE(sensorManager->getChannelReading(id).isValid);
+
+    sensorManager->update(13000);
+    TEST_ASSERT_TRUE(sensorManager->getChannelReading(id).isValid);
+
+    sensorManager->update(13001);
+    TEST_ASSERT_FALSE(sensorManager->getChannelReading(id).isValid);
+}
+
+void test_sensor_manager_rejects_channels_beyond_capacity() {
+    MockSensorChannel extra[MAX_SENSOR_CHANNELS];
+
+    for (uint8_t i = 2; i < MAX_SENSOR_CHANNELS; i++) {
+        TEST_ASSERT_EQUAL(i, sensorManager->registerChannel(&extra[i], SensorChannelConfig(1000, 0)));
+    }
+
+    TEST_ASSERT_EQUAL(INVALID_SENSOR_CHANNEL,
+                      sensorManager->registerChannel(&extra[0], SensorChannelConfig(1000, 0)));
+    TEST_ASSERT_EQUAL(MAX_SENSOR_CHANNELS, sensorManager->getChannelCount());
+}
+
+void test_sensor_manager_full_registry_keeps_per_channel_rates() {
+    MockSensorChannel extra[MAX_SENSOR_CHANNELS];
+    for (uint8_t i = 2; i < MAX_SENSOR_CHANNELS; i++) {
+        // 250ms, 500ms, ... up to intervals longer than one wheel revolution
+        sensorManager->registerChannel(&extra[i], SensorChannelConfig(250 * (i - 1), 0));
+    }
+    sensorManager->begin();
+
+    for (uint32_t t = 0; t <= 10000; t += 10) {
+        sensorManager->update(t);
+    }
+
+    for (uint8_t i = 2; i < MAX_SENSOR_CHANNELS; i++) {
+        TEST_ASSERT_EQUAL(10000 / (250 * (i - 1)), extra[i].getReadCallCount());
+    }
+}
+
+void test_sensor_manager_reports_registered_channel_error() {
+    MockSensorChannel ambient(SensorType::BOX_HUMIDITY);
+    ambient.setInvalid("Mux timeout");
+
+    uint8_t id = sensorManager->registerChannel(&ambient, SensorChannelConfig(500, 0));
+    sensorManager->begin();
+
+    SensorType errorType = SensorType::HEATER_TEMP;
+    String errorMsg;
+    sensorManager->registerSensorErrorCallback(
+        [&errorType, &errorMsg](SensorType type, const String& error) {
+            errorType = type;
+            errorMsg = error;
+        }
+    );
+
+    sensorManager->update(500);
+
+    TEST_ASSERT_EQUAL(SensorType::BOX_HUMIDITY, errorType);
+    TEST_ASSERT_EQUAL_STRING("Mux timeout", errorMsg.c_str());
+    TEST_ASSERT_FALSE(sensorManager->getChannelReading(id).isValid);
+}
+
+// ==================== Acquisition Diagnostics Tests ====================
+
+void test_sensor_manager_records_conversion_wait() {
+    MockSensorChannel scale(SensorType::BOX_TEMP, true);
+    uint8_t id = sensorManager->registerChannel(&scale, SensorChannelConfig(1000, 0));
+    sensorManager->begin();
+
+    sensorManager->update(1000);   // Start
+    scale.completeSample();
+    sensorManager->update(1300);   // Ready after 300ms
+
+    const SensorChannelStats* stats = sensorManager->getChannelStats(id);
+    TEST_ASSERT_NOT_NULL(stats);
+    TEST_ASSERT_EQUAL(1, stats->conversionWaitMs.getCount());
+    TEST_ASSERT_EQUAL(300, stats->conversionWaitMs.getMax());
+    TEST_ASSERT_EQUAL(1, stats->readDurationUs.getCount());
+}
+
+void test_sensor_manager_counts_skipped_samples_while_in_flight() {
+    MockSensorChannel scale(SensorType::BOX_TEMP, true);
+    uint8_t id = sensorManager->registerChannel(&scale, SensorChannelConfig(500, 0));
+    sensorManager->begin();
+
+    sensorManager->update(500);    // Start, never completes
+    sensorManager->update(1000);   // Due again while in flight
+    sensorManager->update(1500);
+
+    TEST_ASSERT_EQUAL(2, sensorManager->getChannelStats(id)->skippedSamples);
+    TEST_ASSERT_EQUAL(1, scale.getStartCallCount());
+}
+
+void test_sensor_manager_records_error_streak_length() {
+    MockSensorChannel ambient(SensorType::BOX_TEMP);
+    uint8_t id = sensorManager->registerChannel(&ambient, SensorChannelConfig(100, 0));
+    sensorManager->begin();
+
+    ambient.setInvalid("CRC error");
+    sensorManager->update(100);
+    sensorManager->update(200);
+    sensorManager->update(300);
+    TEST_ASSERT_EQUAL(3, sensorManager->getChannelStats(id)->currentErrorStreak);
+
+    ambient.setValue(20.0);
+    sensorManager->update(400);
+
+    const SensorChannelStats* stats = sensorManager->getChannelStats(id);
+    TEST_ASSERT_EQUAL(0, stats->currentErrorStreak);
+    TEST_ASSERT_EQUAL(1, stats->errorStreaks.getCount());
+    TEST_ASSERT_EQUAL(3, stats->errorStreaks.getMax());
+}
+
+void test_sensor_manager_records_sample_age_on_consumption() {
+    heaterSensor->setTemperature(60.0);
+    sensorManager->begin();
+    sensorManager->update(0);      // Heater sample at t=0
+    sensorManager->update(700);
+
+    sensorManager->getHeaterTemp();
+
+    const SensorChannelStats* stats = sensorManager->getChannelStats(SensorManager::HEATER_CHANNEL);
+    TEST_ASSERT_EQUAL(1, stats->sampleAgeMs.getCount());
+    TEST_ASSERT_EQUAL(700, stats->sampleAgeMs.getMax());
+    // 700ms lands in the [512, 1023] log2 bucket
+    TEST_ASSERT_EQUAL(1, stats->sampleAgeMs.getBucket(10));
+    TEST_ASSERT_EQUAL(700, stats->sampleAgeMs.getPercentile(99));
+}
+
+void test_sensor_manager_resets_channel_stats() {
+    MockSensorChannel scale(SensorType::BOX_TEMP, true);
+    uint8_t id = sensorManager->registerChannel(&scale, SensorChannelConfig(500, 0));
+    sensorManager->begin();
+    sensorManager->update(500);
+    sensorManager->update(1000);
+
+    sensorManager->resetChannelStats();
+
+    TEST_ASSERT_EQUAL(0, sensorManager->getChannelStats(id)->skippedSamples);
+    TEST_ASSERT_EQUAL(0, sensorManager->getChannelStats(id)->readDurationUs.getCount());
+    TEST_ASSERT_NULL(sensorManager->getChannelStats(MAX_SENSOR_CHANNELS));
+}
+
+// ==================== Idle Rate Tests ====================
+
+void test_sensor_manager_min_interval_stretches_sampling() {
+    sensorManager->begin();
+    sensorManager->setMinInterval(4000);
+    heaterSensor->resetCallCount();
+
+    // 1000ms heater interval is floored to 4000ms
+    for (uint32_t t = 0; t <= 12000; t += 100) {
+        sensorManager->update(t);
+        sensorManager->update(t + 1);
+    }
+
+    TEST_ASSERT_EQUAL(4000, sensorManager->getMinInterval());
+    TEST_ASSERT_TRUE(heaterSensor->getReadCallCount() >= 2);
+    TEST_ASSERT_TRUE(heaterSensor->getReadCallCount() <= 4);
+}
+
+void test_sensor_manager_lowering_min_interval_resamples_immediately() {
+    sensorManager->begin();
+    sensorManager->setMinInterval(4000);
+    sensorManager->update(0);
+    sensorManager->update(1);
+    sensorManager->update(100);
+    heaterSensor->resetCallCount();
+
+    // Leaving idle: next update requests a conversion instead of waiting ~4s
+    sensorManager->setMinInterval(0);
+    sensorManager->update(200);
+    sensorManager->update(201);
+
+    TEST_ASSERT_EQUAL(1, heaterSensor->getReadCallCount());
+}
 
 // ==================== Complete Integration Test ====================
 
@@ -346,6 +637,30 @@ int main(int argc, char **argv) {
     RUN_TEST(test_sensor_manager_coordinates_different_update_rates);
     RUN_TEST(test_sensor_manager_maintains_independent_sensor_states);
 
+    // Timeout
+    RUN_TEST(test_sensor_manager_heater_reading_goes_stale_after_sensor_timeout);
+    RUN_TEST(test_sensor_manager_box_data_goes_stale_between_stretched_samples);
+
+    // Channel registry
+    RUN_TEST(test_sensor_manager_registers_builtin_channels);
+    RUN_TEST(test_sensor_manager_reads_registered_channel_at_its_own_rate);
+    RUN_TEST(test_sensor_manager_polls_async_channel_until_ready);
+    RUN_TEST(test_sensor_manager_channel_reading_expires_after_validity_timeout);
+    RUN_TEST(test_sensor_manager_rejects_channels_beyond_capacity);
+    RUN_TEST(test_sensor_manager_full_registry_keeps_per_channel_rates);
+    RUN_TEST(test_sensor_manager_reports_registered_channel_error);
+
+    // Acquisition diagnostics
+    RUN_TEST(test_sensor_manager_records_conversion_wait);
+    RUN_TEST(test_sensor_manager_counts_skipped_samples_while_in_flight);
+    RUN_TEST(test_sensor_manager_records_error_streak_length);
+    RUN_TEST(test_sensor_manager_records_sample_age_on_consumption);
+    RUN_TEST(test_sensor_manager_resets_channel_stats);
+
+    // Idle rate
+    RUN_TEST(test_sensor_manager_min_interval_stretches_sampling);
+    RUN_TEST(test_sensor_manager_lowering_min_interval_resamples_immediately);
+
     // Full integration
     RUN_TEST(test_sensor_manager_full_integration_with_both_sensors);
 
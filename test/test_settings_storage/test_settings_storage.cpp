@@ -6,11 +6,17 @@
 #endif
 
 #include "../../src/storage/SettingsStorage.h"
+#include "../../src/Dryer.h"
+#include "../mocks/MockSensorManager.h"
+#include "../mocks/MockHeaterControl.h"
+#include "../mocks/MockPIDController.h"
+#include "../mocks/MockSafetyMonitor.h"
 
 // Test fixture
 SettingsStorage* storage;
 
 void setUp(void) {
+    Preferences::eraseAll();
     storage = new SettingsStorage();
 }
 
@@ -97,6 +103,30 @@ void test_storage_saves_and_loads_sound_setting() {
     TEST_ASSERT_TRUE(storage->loadSoundEnabled());
 }
 
+// ==================== Scale Calibration Tests ====================
+
+void test_storage_scale_starts_uncalibrated() {
+    storage->begin();
+
+    ScaleCalibration calibration = storage->loadScaleCalibration();
+    TEST_ASSERT_EQUAL(0, calibration.tareOffset);
+    TEST_ASSERT_EQUAL_FLOAT(0.0, calibration.countsPerGram);
+}
+
+void test_storage_persists_scale_calibration() {
+    storage->begin();
+    storage->saveScaleCalibration(ScaleCalibration(-81234, 412.5));
+    storage->sync();
+
+    delete storage;
+    storage = new SettingsStorage();
+    storage->begin();
+
+    ScaleCalibration calibration = storage->loadScaleCalibration();
+    TEST_ASSERT_EQUAL(-81234, calibration.tareOffset);
+    TEST_ASSERT_EQUAL_FLOAT(412.5, calibration.countsPerGram);
+}
+
 // ==================== Runtime State Tests ====================
 
 void test_storage_saves_runtime_state() {
@@ -247,6 +277,7 @@ void test_storage_persists_settings_across_simulated_restart() {
     storage->saveSelectedPreset(PresetType::CUSTOM);
     storage->savePIDProfile(PIDProfile::SOFT);
     storage->saveSoundEnabled(false);
+    storage->sync();    // Shutdown path
 
     // Simulate restart by deleting and recreating storage
     delete storage;
@@ -275,6 +306,7 @@ void test_storage_persists_runtime_state_for_power_recovery() {
         7200, 65.0, 18000,
         PresetType::PETG, 12345
     );
+    storage->getWorker().drain();   // The worker got to it before the power cut
 
     // Simulate power loss and restart
     delete storage;
@@ -292,6 +324,513 @@ void test_storage_persists_runtime_state_for_power_recovery() {
     TEST_ASSERT_EQUAL(PresetType::PETG, storage->getRuntimePreset());
 }
 
+// ==================== Boot Path Tests ====================
+
+void test_storage_parses_each_file_once_on_boot() {
+    LittleFS.format();
+    storage->begin();
+    storage->saveSoundEnabled(false);
+    storage->saveRuntimeState(DryerState::RUNNING, 60, 50.0, 3600, PresetType::PLA, 1);
+    storage->sync();
+
+    delete storage;
+    storage = new SettingsStorage();
+    LittleFS.resetCounts();
+
+    storage->begin();
+
+    // Settings + cycle history index (runtime is in NVS), no separate
+    // verification pass
+    TEST_ASSERT_EQUAL(2, LittleFS.getReadOpenCount());
+    TEST_ASSERT_FALSE(storage->loadSoundEnabled());
+    TEST_ASSERT_TRUE(storage->hasValidRuntimeState());
+}
+
+void test_storage_begin_twice_reads_files_once() {
+    LittleFS.format();
+    storage->begin();
+    LittleFS.resetCounts();
+
+    storage->begin();
+
+    TEST_ASSERT_EQUAL(0, LittleFS.getReadOpenCount());
+    TEST_ASSERT_TRUE(storage->isInitialized());
+}
+
+void test_boot_reads_each_storage_file_once() {
+    LittleFS.format();
+    storage->begin();
+    storage->saveRuntimeState(DryerState::RUNNING, 60, 50.0, 3600, PresetType::PLA, 1);
+    storage->sync();
+    delete storage;
+    storage = new SettingsStorage();
+    LittleFS.resetCounts();
+
+    // The boot sequence of setup(): heater low first, then the Dryer
+    // begins everything it owns, storage included
+    MockSensorManager sensors;
+    MockHeaterControl heater;
+    MockPIDController pid;
+    MockSafetyMonitor safety;
+    Dryer dryer(&sensors, &heater, &pid, &safety, storage);
+    heater.begin(0);
+    dryer.begin(0);
+
+    TEST_ASSERT_EQUAL(2, LittleFS.getReadOpenCount());   // Settings + cycle history
+    TEST_ASSERT_EQUAL(DryerState::POWER_RECOVERED, dryer.getState());
+}
+
+void test_storage_begin_leaves_telemetry_scan_to_worker() {
+    LittleFS.format();
+    storage->begin();
+
+    TEST_ASSERT_FALSE(storage->getTelemetryLog().isLoaded());
+    storage->getWorker().runOnce();
+    TEST_ASSERT_TRUE(storage->getTelemetryLog().isLoaded());
+}
+
+void test_storage_recovers_from_corrupt_settings_file() {
+    LittleFS.format();
+    LittleFS.begin(true);
+    File file = LittleFS.open(SETTINGS_FILE, "w");
+    file.print("{\"version\":1,\"soundEna");
+    file.close();
+
+    storage->begin();
+
+    TEST_ASSERT_TRUE(storage->isHealthy());
+    TEST_ASSERT_TRUE(storage->loadSoundEnabled());
+
+    // Rewritten with defaults and readable on the next boot
+    delete storage;
+    storage = new SettingsStorage();
+    LittleFS.resetCounts();
+    storage->begin();
+    TEST_ASSERT_TRUE(storage->isHealthy());
+    TEST_ASSERT_EQUAL(PIDProfile::NORMAL, storage->loadPIDProfile());
+}
+
+void test_storage_ignores_damaged_runtime_record() {
+    storage->begin();
+    storage->saveRuntimeState(DryerState::RUNNING, 600, 50.0, 3600, PresetType::PLA, 1);
+    storage->sync();
+    Preferences::corrupt(RUNTIME_NVS_NAMESPACE, RUNTIME_NVS_KEY, "not a journal", 13);
+
+    delete storage;
+    storage = new SettingsStorage();
+    storage->begin();
+
+    TEST_ASSERT_FALSE(storage->hasValidRuntimeState());
+    TEST_ASSERT_TRUE(storage->isHealthy());
+}
+
+void test_storage_removes_legacy_runtime_files() {
+    LittleFS.format();
+    LittleFS.begin(true);
+    File file = LittleFS.open(LEGACY_RUNTIME_FILE, "w");
+    file.print("{\"version\":1,\"state\":\"RUNNING\"}");
+    file.close();
+    file = LittleFS.open(LEGACY_RUNTIME_JOURNAL_FILE, "w");
+    file.print("old journal");
+    file.close();
+
+    storage->begin();
+
+    TEST_ASSERT_FALSE(storage->hasValidRuntimeState());
+    TEST_ASSERT_FALSE(LittleFS.exists(LEGACY_RUNTIME_FILE));
+    TEST_ASSERT_FALSE(LittleFS.exists(LEGACY_RUNTIME_JOURNAL_FILE));
+}
+
+void test_storage_cleared_runtime_stays_cleared_after_restart() {
+    storage->begin();
+    storage->saveRuntimeState(DryerState::RUNNING, 600, 50.0, 3600, PresetType::PLA, 1);
+    storage->clearRuntimeState();
+    storage->sync();
+
+    delete storage;
+    storage = new SettingsStorage();
+    storage->begin();
+
+    TEST_ASSERT_FALSE(storage->hasValidRuntimeState());
+}
+
+// ==================== Binary Record Tests ====================
+
+static size_t settingsFileSize() {
+    File file = LittleFS.open(SETTINGS_FILE, "r");
+    size_t size = file.size();
+    file.close();
+    return size;
+}
+
+static SettingsRecord readSlot(uint8_t slot) {
+    SettingsRecord record;
+    File file = LittleFS.open(SETTINGS_FILE, "r");
+    file.seek(slot * SETTINGS_SLOT_BYTES);
+    file.readBytes(reinterpret_cast<char*>(&record), sizeof(record));
+    file.close();
+    return record;
+}
+
+void test_storage_alternates_settings_slots() {
+    LittleFS.format();
+    storage->begin();                               // Defaults -> slot A
+    storage->savePIDProfile(PIDProfile::STRONG);    // -> slot B
+    storage->sync();
+
+    TEST_ASSERT_EQUAL(SETTINGS_FILE_BYTES, settingsFileSize());
+    TEST_ASSERT_EQUAL(1, readSlot(0).sequence);
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(PIDProfile::NORMAL), readSlot(0).pidProfile);
+    TEST_ASSERT_EQUAL(2, readSlot(1).sequence);
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(PIDProfile::STRONG), readSlot(1).pidProfile);
+
+    storage->savePIDProfile(PIDProfile::SOFT);      // -> slot A again
+    storage->sync();
+    TEST_ASSERT_EQUAL(3, readSlot(0).sequence);
+    TEST_ASSERT_EQUAL(SETTINGS_FILE_BYTES, settingsFileSize());
+}
+
+void test_storage_torn_slot_falls_back_to_previous_settings() {
+    LittleFS.format();
+    storage->begin();                               // Slot A, sequence 1
+    storage->savePIDProfile(PIDProfile::SOFT);      // Slot B, sequence 2
+    storage->sync();
+    storage->savePIDProfile(PIDProfile::STRONG);    // Slot A, sequence 3
+    storage->sync();
+
+    // Power lost while slot A was written: its CRC no longer matches
+    File file = LittleFS.open(SETTINGS_FILE, "r+");
+    file.seek(offsetof(SettingsRecord, customTemp));
+    file.write(static_cast<uint8_t>(0xFF));
+    file.close();
+
+    delete storage;
+    storage = new SettingsStorage();
+    storage->begin();
+
+    TEST_ASSERT_EQUAL(PIDProfile::SOFT, storage->loadPIDProfile());
+    TEST_ASSERT_TRUE(storage->isHealthy());
+}
+
+void test_storage_damaged_settings_never_format() {
+    LittleFS.format();
+    storage->begin();
+    storage->saveRuntimeState(DryerState::RUNNING, 600, 50.0, 3600, PresetType::PLA, 1);
+    storage->sync();
+
+    File file = LittleFS.open(SETTINGS_FILE, "w");
+    file.print("garbage in both slots");
+    file.close();
+
+    delete storage;
+    storage = new SettingsStorage();
+    storage->begin();
+
+    TEST_ASSERT_TRUE(storage->isHealthy());
+    TEST_ASSERT_EQUAL(PIDProfile::NORMAL, storage->loadPIDProfile());
+    TEST_ASSERT_TRUE(storage->hasValidRuntimeState());   // Runtime journal untouched
+}
+
+void test_storage_migrates_single_record_v1_file() {
+    LittleFS.format();
+    LittleFS.begin(true);
+
+    // Version 1 layout: header, fields, CRC - no sequence, one per file
+    uint8_t v1[32];
+    memset(v1, 0, sizeof(v1));
+    uint16_t magic = SETTINGS_RECORD_MAGIC;
+    float temp = 61.0f;
+    memcpy(v1, &magic, 2);
+    v1[2] = 1;
+    v1[3] = sizeof(v1);
+    memcpy(v1 + 4, &temp, 4);
+    v1[16] = static_cast<uint8_t>(PresetType::PETG);
+    v1[17] = static_cast<uint8_t>(PIDProfile::STRONG);
+    v1[18] = 0;   // Sound off
+    sealSettingsRecord(v1, sizeof(v1));
+    File file = LittleFS.open(SETTINGS_FILE, "w");
+    file.write(v1, sizeof(v1));
+    file.close();
+
+    storage->begin();
+
+    TEST_ASSERT_EQUAL_FLOAT(61.0, storage->loadCustomPreset().targetTemp);
+    TEST_ASSERT_EQUAL(PresetType::PETG, storage->loadSelectedPreset());
+    TEST_ASSERT_EQUAL(PIDProfile::STRONG, storage->loadPIDProfile());
+    TEST_ASSERT_FALSE(storage->loadSoundEnabled());
+
+    // Saved again in the current layout, in slot B
+    TEST_ASSERT_EQUAL(SETTINGS_FILE_BYTES, settingsFileSize());
+    TEST_ASSERT_EQUAL(SETTINGS_RECORD_VERSION, readSlot(1).version);
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(PIDProfile::STRONG), readSlot(1).pidProfile);
+}
+
+void test_storage_imports_legacy_json_settings_once() {
+    LittleFS.format();
+    LittleFS.begin(true);
+    File file = LittleFS.open(LEGACY_SETTINGS_FILE, "w");
+    file.print("{\"version\":1,\"customPreset\":{\"temp\":57,\"time\":5400,\"overshoot\":6},"
+               "\"selectedPreset\":\"CUSTOM\",\"pidProfile\":\"SOFT\",\"soundEnabled\":false,"
+               "\"scale\":{\"offset\":-500,\"countsPerGram\":420.5}}");
+    file.close();
+
+    storage->begin();
+
+    TEST_ASSERT_EQUAL(PresetType::CUSTOM, storage->loadSelectedPreset());
+    TEST_ASSERT_EQUAL(PIDProfile::SOFT, storage->loadPIDProfile());
+    TEST_ASSERT_FALSE(storage->loadSoundEnabled());
+    TEST_ASSERT_EQUAL_FLOAT(57.0, storage->loadCustomPreset().targetTemp);
+    TEST_ASSERT_EQUAL(-500, storage->loadScaleCalibration().tareOffset);
+    TEST_ASSERT_FALSE(LittleFS.exists(LEGACY_SETTINGS_FILE));
+    TEST_ASSERT_EQUAL(SETTINGS_SLOT_BYTES, settingsFileSize());
+}
+
+void test_storage_json_debug_path_round_trip() {
+    LittleFS.format();
+    storage->begin();
+    storage->saveSelectedPreset(PresetType::PETG);
+
+    TEST_ASSERT_TRUE(storage->exportJson().indexOf("\"PETG\"") >= 0);
+
+    // Partial document: only the PID profile changes
+    TEST_ASSERT_TRUE(storage->importJson("{\"pidProfile\":\"STRONG\"}"));
+    TEST_ASSERT_EQUAL(PIDProfile::STRONG, storage->loadPIDProfile());
+    TEST_ASSERT_EQUAL(PresetType::PETG, storage->loadSelectedPreset());
+
+    TEST_ASSERT_FALSE(storage->importJson("{\"pidProfile\":"));
+    TEST_ASSERT_FALSE(storage->importJson("{\"version\":9}"));
+    TEST_ASSERT_EQUAL(PIDProfile::STRONG, storage->loadPIDProfile());
+}
+
+// ==================== Write Coalescing Tests ====================
+
+void test_storage_coalesces_changes_into_one_write() {
+    LittleFS.format();
+    storage->begin();                               // Defaults -> slot A
+
+    // Scrolling through values in the menu
+    DryingPreset preset = storage->loadCustomPreset();
+    for (int i = 0; i < 10; i++) {
+        preset.targetTemp += 1.0;
+        storage->saveCustomPreset(preset);
+    }
+    storage->savePIDProfile(PIDProfile::SOFT);
+
+    storage->update(1000);                          // Window starts
+    storage->update(2999);
+    TEST_ASSERT_EQUAL(SETTINGS_SLOT_BYTES, settingsFileSize());
+    TEST_ASSERT_NOT_EQUAL(0, storage->getDirtyMask());
+
+    storage->update(3000);                          // Quiet for the window: queued
+    TEST_ASSERT_EQUAL(0, storage->getDirtyMask());
+    TEST_ASSERT_EQUAL(1, storage->getWorker().getPending());
+    TEST_ASSERT_EQUAL(SETTINGS_SLOT_BYTES, settingsFileSize());
+
+    storage->getWorker().drain();                   // Worker writes slot B
+    TEST_ASSERT_EQUAL(10, storage->getCoalescedChanges());
+    TEST_ASSERT_EQUAL(2, readSlot(1).sequence);
+    TEST_ASSERT_EQUAL_FLOAT(preset.targetTemp, readSlot(1).customTemp);
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(PIDProfile::SOFT), readSlot(1).pidProfile);
+
+    storage->update(10000);                         // Nothing pending
+    TEST_ASSERT_EQUAL(2, readSlot(1).sequence);
+    TEST_ASSERT_EQUAL(1, readSlot(0).sequence);
+}
+
+void test_storage_change_restarts_debounce_window() {
+    LittleFS.format();
+    storage->begin();
+
+    storage->saveSelectedPreset(PresetType::PETG);
+    storage->update(0);
+    storage->update(1500);
+    storage->saveSelectedPreset(PresetType::CUSTOM);   // Still editing
+    storage->update(2500);                             // New window starts here
+    storage->update(4000);
+    TEST_ASSERT_EQUAL(SETTINGS_SLOT_BYTES, settingsFileSize());
+
+    storage->update(4500);
+    storage->getWorker().drain();
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(PresetType::CUSTOM), readSlot(1).selectedPreset);
+}
+
+void test_storage_unchanged_setting_is_not_written() {
+    LittleFS.format();
+    storage->begin();
+
+    storage->saveSoundEnabled(true);                // Already the default
+    storage->savePIDProfile(PIDProfile::NORMAL);
+    storage->saveScaleCalibration(storage->loadScaleCalibration());
+
+    TEST_ASSERT_EQUAL(0, storage->getDirtyMask());
+    storage->flush();
+    TEST_ASSERT_EQUAL(SETTINGS_SLOT_BYTES, settingsFileSize());
+}
+
+void test_storage_emergency_flushes_pending_settings() {
+    LittleFS.format();
+    storage->begin();
+    storage->savePIDProfile(PIDProfile::STRONG);
+
+    storage->saveEmergencyState("Heater overtemp");
+
+    TEST_ASSERT_EQUAL(0, storage->getDirtyMask());
+    delete storage;
+    storage = new SettingsStorage();
+    storage->begin();
+    TEST_ASSERT_EQUAL(PIDProfile::STRONG, storage->loadPIDProfile());
+}
+
+void test_storage_full_queue_keeps_settings_dirty() {
+    LittleFS.format();
+    storage->begin();
+    for (uint32_t i = 0; i < STORAGE_QUEUE_DEPTH; i++) {
+        storage->saveRuntimeState(DryerState::RUNNING, i, 50.0, 3600, PresetType::PLA, i);
+    }
+
+    storage->savePIDProfile(PIDProfile::STRONG);
+    storage->flush();                               // Queue full: not lost, still dirty
+    TEST_ASSERT_NOT_EQUAL(0, storage->getDirtyMask());
+
+    storage->getWorker().drain();
+    storage->update(0);
+    storage->update(SETTINGS_WRITE_DEBOUNCE_MS);    // Retried after a window
+    storage->getWorker().drain();
+    TEST_ASSERT_EQUAL(0, storage->getDirtyMask());
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(PIDProfile::STRONG), readSlot(1).pidProfile);
+}
+
+void test_storage_full_queue_defers_cycle_record_without_waiting() {
+    LittleFS.format();
+    storage->begin();
+    for (uint32_t i = 0; i < STORAGE_QUEUE_DEPTH; i++) {
+        storage->saveRuntimeState(DryerState::RUNNING, i, 50.0, 3600, PresetType::PLA, i);
+    }
+
+    CycleRecord record;
+    memset(&record, 0, sizeof(record));
+    record.endReason = static_cast<uint8_t>(CycleEndReason::STOPPED);
+    record.duration = 1234;
+    storage->saveCycleRecord(record);
+
+    // Called from a state transition: nothing was drained to make room
+    TEST_ASSERT_EQUAL(0, storage->getWorker().getCompleted());
+    TEST_ASSERT_TRUE(storage->hasPendingWrites());
+
+    storage->getWorker().drain();
+    storage->update(0);
+    TEST_ASSERT_FALSE(storage->hasPendingWrites());
+    storage->getWorker().drain();
+
+    CycleRecord saved;
+    TEST_ASSERT_EQUAL(1, storage->getCycleHistory().getLatestId());
+    TEST_ASSERT_TRUE(storage->getCycleHistory().read(1, saved));
+    TEST_ASSERT_EQUAL(1234, saved.duration);
+}
+
+void test_storage_full_queue_defers_runtime_clear_without_waiting() {
+    LittleFS.format();
+    storage->begin();
+    for (uint32_t i = 0; i < STORAGE_QUEUE_DEPTH; i++) {
+        storage->saveRuntimeState(DryerState::RUNNING, i, 50.0, 3600, PresetType::PLA, i);
+    }
+
+    storage->clearRuntimeState();
+
+    TEST_ASSERT_EQUAL(0, storage->getWorker().getCompleted());
+    TEST_ASSERT_TRUE(storage->hasPendingWrites());
+
+    // sync() waits, so it may make room and write the tombstone itself
+    TEST_ASSERT_TRUE(storage->sync());
+    TEST_ASSERT_FALSE(storage->hasPendingWrites());
+
+    delete storage;
+    storage = new SettingsStorage();
+    storage->begin();
+    TEST_ASSERT_FALSE(storage->hasValidRuntimeState());
+}
+
+void test_storage_new_snapshot_supersedes_deferred_runtime_clear() {
+    LittleFS.format();
+    storage->begin();
+    for (uint32_t i = 0; i < STORAGE_QUEUE_DEPTH; i++) {
+        storage->saveRuntimeState(DryerState::RUNNING, i, 50.0, 3600, PresetType::PLA, i);
+    }
+    storage->clearRuntimeState();
+    storage->getWorker().drain();
+
+    // The next cycle starts before update() got to the tombstone
+    storage->saveRuntimeState(DryerState::RUNNING, 5, 50.0, 3600, PresetType::PLA, 100);
+    TEST_ASSERT_FALSE(storage->hasPendingWrites());
+    storage->update(0);
+    storage->sync();
+
+    delete storage;
+    storage = new SettingsStorage();
+    storage->begin();
+    TEST_ASSERT_TRUE(storage->hasValidRuntimeState());
+    TEST_ASSERT_EQUAL(5, storage->getRuntimeElapsed());
+}
+
+// ==================== Migration Chain Tests ====================
+
+// Test steps: v1 -> v2 turns sound off, v2 -> v3 selects STRONG
+static size_t muteStep(uint8_t* record, size_t length) {
+    record[offsetof(SettingsRecord, soundEnabled)] = 0;
+    return length;
+}
+
+static size_t strongStep(uint8_t* record, size_t length) {
+    record[offsetof(SettingsRecord, pidProfile)] = static_cast<uint8_t>(PIDProfile::STRONG);
+    return length;
+}
+
+static const SettingsMigrationStep TEST_MIGRATIONS[] = { nullptr, muteStep, strongStep };
+
+static size_t sealedRecord(uint8_t* buffer, uint8_t version) {
+    SettingsRecord record;
+    memset(&record, 0, sizeof(record));
+    record.soundEnabled = 1;
+    record.pidProfile = static_cast<uint8_t>(PIDProfile::NORMAL);
+    sealSettingsRecord(record);
+    memcpy(buffer, &record, sizeof(record));
+    buffer[2] = version;
+    sealSettingsRecord(buffer, sizeof(record));
+    return sizeof(record);
+}
+
+void test_migration_chain_applies_steps_in_order() {
+    uint8_t buffer[SETTINGS_RECORD_MAX_BYTES];
+    size_t length = sealedRecord(buffer, 1);
+    SettingsRecord out;
+
+    TEST_ASSERT_EQUAL(SettingsDecodeResult::MIGRATED,
+                      decodeSettingsRecord(buffer, length, out, TEST_MIGRATIONS, 3));
+    TEST_ASSERT_EQUAL(3, out.version);
+    TEST_ASSERT_EQUAL(0, out.soundEnabled);
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(PIDProfile::STRONG), out.pidProfile);
+    TEST_ASSERT_EQUAL(settingsRecordCrc(reinterpret_cast<uint8_t*>(&out), sizeof(out)), out.crc);
+
+    // Starting part way up the chain runs only the remaining step
+    length = sealedRecord(buffer, 2);
+    decodeSettingsRecord(buffer, length, out, TEST_MIGRATIONS, 3);
+    TEST_ASSERT_EQUAL(1, out.soundEnabled);
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(PIDProfile::STRONG), out.pidProfile);
+}
+
+void test_migration_chain_rejects_newer_or_unmigratable_versions() {
+    uint8_t buffer[SETTINGS_RECORD_MAX_BYTES];
+    SettingsRecord out;
+
+    size_t length = sealedRecord(buffer, SETTINGS_RECORD_VERSION + 1);
+    TEST_ASSERT_EQUAL(SettingsDecodeResult::UNSUPPORTED, decodeSettingsRecord(buffer, length, out));
+
+    // No step registered for version 1 -> 2
+    static const SettingsMigrationStep gap[] = { nullptr, nullptr };
+    length = sealedRecord(buffer, 1);
+    TEST_ASSERT_EQUAL(SettingsDecodeResult::UNSUPPORTED, decodeSettingsRecord(buffer, length, out, gap, 2));
+}
+
 // ==================== Main Test Runner ====================
 
 int main(int argc, char **argv) {
@@ -314,6 +853,10 @@ int main(int argc, char **argv) {
     // Sound setting
     RUN_TEST(test_storage_saves_and_loads_sound_setting);
 
+    // Scale calibration
+    RUN_TEST(test_storage_scale_starts_uncalibrated);
+    RUN_TEST(test_storage_persists_scale_calibration);
+
     // Runtime state
     RUN_TEST(test_storage_saves_runtime_state);
     RUN_TEST(test_storage_clears_runtime_state);
@@ -336,6 +879,38 @@ int main(int argc, char **argv) {
     RUN_TEST(test_storage_persists_settings_across_simulated_restart);
     RUN_TEST(test_storage_persists_runtime_state_for_power_recovery);
 
+    // Boot path
+    RUN_TEST(test_storage_parses_each_file_once_on_boot);
+    RUN_TEST(test_storage_begin_twice_reads_files_once);
+    RUN_TEST(test_boot_reads_each_storage_file_once);
+    RUN_TEST(test_storage_begin_leaves_telemetry_scan_to_worker);
+    RUN_TEST(test_storage_recovers_from_corrupt_settings_file);
+    RUN_TEST(test_storage_ignores_damaged_runtime_record);
+    RUN_TEST(test_storage_removes_legacy_runtime_files);
+    RUN_TEST(test_storage_cleared_runtime_stays_cleared_after_restart);
+
+    // Binary record
+    RUN_TEST(test_storage_alternates_settings_slots);
+    RUN_TEST(test_storage_torn_slot_falls_back_to_previous_settings);
+    RUN_TEST(test_storage_damaged_settings_never_format);
+    RUN_TEST(test_storage_migrates_single_record_v1_file);
+    RUN_TEST(test_storage_imports_legacy_json_settings_once);
+    RUN_TEST(test_storage_json_debug_path_round_trip);
+
+    // Write coalescing
+    RUN_TEST(test_storage_coalesces_changes_into_one_write);
+    RUN_TEST(test_storage_change_restarts_debounce_window);
+    RUN_TEST(test_storage_unchanged_setting_is_not_written);
+    RUN_TEST(test_storage_emergency_flushes_pending_settings);
+    RUN_TEST(test_storage_full_queue_keeps_settings_dirty);
+    RUN_TEST(test_storage_full_queue_defers_cycle_record_without_waiting);
+    RUN_TEST(test_storage_full_queue_defers_runtime_clear_without_waiting);
+    RUN_TEST(test_storage_new_snapshot_supersedes_deferred_runtime_clear);
+
+    // Migration chain
+    RUN_TEST(test_migration_chain_applies_steps_in_order);
+    RUN_TEST(test_migration_chain_rejects_newer_or_unmigratable_versions);
+
     return UNITY_END();
 }
 
@@ -0,0 +1,107 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#include <stdint.h>
+
+#include "../../src/memory/StaticSlot.h"
+#include "../../src/control/PIDController.h"
+
+// Records construction so tests can see how often it happened
+struct Probe {
+    static int constructions;
+    int a;
+    double b;
+
+    Probe(int first, double second) : a(first), b(second) {
+        constructions++;
+    }
+};
+int Probe::constructions = 0;
+
+// Over-aligned type to check the storage honours alignas(T)
+struct alignas(16) Wide {
+    uint8_t bytes[24];
+};
+
+void setUp(void) {
+    Probe::constructions = 0;
+}
+
+void tearDown(void) {
+}
+
+// ==================== Construction Tests ====================
+
+void test_slot_is_empty_until_constructed() {
+    static StaticSlot<Probe> slot;
+
+    TEST_ASSERT_FALSE(slot.isConstructed());
+    TEST_ASSERT_NULL(slot.get());
+}
+
+void test_slot_constructs_in_place_with_arguments() {
+    static StaticSlot<Probe> slot;
+
+    Probe* probe = slot.construct(7, 2.5);
+
+    TEST_ASSERT_TRUE(slot.isConstructed());
+    TEST_ASSERT_EQUAL_PTR(probe, slot.get());
+    TEST_ASSERT_TRUE(reinterpret_cast<uint8_t*>(probe) >= reinterpret_cast<uint8_t*>(&slot));
+    TEST_ASSERT_TRUE(reinterpret_cast<uint8_t*>(probe) < reinterpret_cast<uint8_t*>(&slot) + sizeof(slot));
+    TEST_ASSERT_EQUAL(7, probe->a);
+    TEST_ASSERT_EQUAL_FLOAT(2.5, probe->b);
+}
+
+void test_slot_constructs_only_once() {
+    static StaticSlot<Probe> slot;
+
+    Probe* first = slot.construct(1, 1.0);
+    Probe* second = slot.construct(2, 2.0);
+
+    TEST_ASSERT_EQUAL_PTR(first, second);
+    TEST_ASSERT_EQUAL(1, Probe::constructions);
+    TEST_ASSERT_EQUAL(1, second->a);
+}
+
+void test_slot_respects_alignment_and_reports_size() {
+    static StaticSlot<Wide> slot;
+
+    Wide* wide = slot.construct();
+
+    TEST_ASSERT_EQUAL(0, reinterpret_cast<uintptr_t>(wide) % 16);
+    TEST_ASSERT_EQUAL(sizeof(Wide), StaticSlot<Wide>::SIZE_BYTES);
+}
+
+void test_slot_hosts_real_component() {
+    static StaticSlot<PIDController> slot;
+
+    // Used through its interface, exactly as main.cpp does
+    IPIDController* pid = slot.construct();
+    pid->begin();
+    pid->setLimits(0.0, 100.0);
+
+    pid->compute(50.0, 20.0, 20.0, 0);  // First call only seeds the state
+    float output = pid->compute(50.0, 20.0, 20.0, PID_UPDATE_INTERVAL);
+
+    TEST_ASSERT_TRUE(output > 0.0);
+    TEST_ASSERT_TRUE(output <= 100.0);
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // Construction
+    RUN_TEST(test_slot_is_empty_until_constructed);
+    RUN_TEST(test_slot_constructs_in_place_with_arguments);
+    RUN_TEST(test_slot_constructs_only_once);
+    RUN_TEST(test_slot_respects_alignment_and_reports_size);
+    RUN_TEST(test_slot_hosts_real_component);
+
+    return UNITY_END();
+}
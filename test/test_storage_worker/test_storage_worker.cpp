@@ -0,0 +1,298 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#include "../../src/storage/StorageWorker.h"
+
+#define SETTINGS_PATH "/test_settings.bin"
+#define JOURNAL_NAMESPACE "test_journal"
+#define HISTORY_PATH "/test_cycles.bin"
+#define TELEMETRY_PATH "/test_telemetry"   // Segment file prefix
+
+SettingsSlots* slots;
+RuntimeJournal* journal;
+CycleHistoryFile* history;
+TelemetryLogFile* telemetry;
+StorageWorker* worker;
+
+static RuntimeSnapshot snapshot(DryerState state, uint32_t elapsed) {
+    RuntimeSnapshot runtime;
+    runtime.state = state;
+    runtime.preset = PresetType::PLA;
+    runtime.elapsed = elapsed;
+    runtime.targetTemp = 50.0f;
+    runtime.targetTime = 3600;
+    runtime.timestamp = elapsed;
+    return runtime;
+}
+
+static SettingsRecord settingsWithSound(bool enabled) {
+    SettingsRecord record;
+    memset(&record, 0, sizeof(record));
+    record.soundEnabled = enabled ? 1 : 0;
+    return record;
+}
+
+// What a reboot would recover from the journal
+static bool recoverLatest(RuntimeRecord& latest) {
+    RuntimeJournal reader(JOURNAL_NAMESPACE);
+    return reader.recover(latest);
+}
+
+void setUp(void) {
+    LittleFS.format();
+    LittleFS.begin(true);
+    Preferences::eraseAll();
+    slots = new SettingsSlots(SETTINGS_PATH);
+    journal = new RuntimeJournal(JOURNAL_NAMESPACE);
+
+    RuntimeRecord unused;
+    journal->recover(unused);   // Boot reads the journal first
+
+    history = new CycleHistoryFile(HISTORY_PATH);
+    history->load();
+
+    telemetry = new TelemetryLogFile(TELEMETRY_PATH);
+    telemetry->load();
+
+    worker = new StorageWorker(*slots, *journal, *history, *telemetry);
+}
+
+void tearDown(void) {
+    delete worker;
+    delete telemetry;
+    delete history;
+    delete journal;
+    delete slots;
+}
+
+// ==================== Write-Behind Tests ====================
+
+void test_submit_returns_before_anything_is_written() {
+    TEST_ASSERT_TRUE(worker->submitSettings(settingsWithSound(false)));
+
+    TEST_ASSERT_FALSE(LittleFS.exists(SETTINGS_PATH));
+    TEST_ASSERT_EQUAL(1, worker->getPending());
+
+    TEST_ASSERT_EQUAL(1, worker->drain());
+    TEST_ASSERT_EQUAL(0, worker->getPending());
+    TEST_ASSERT_TRUE(LittleFS.exists(SETTINGS_PATH));
+}
+
+void test_snapshot_is_copied_at_submit() {
+    SettingsRecord record = settingsWithSound(false);
+    worker->submitSettings(record);
+    record.soundEnabled = 1;            // Caller keeps changing its copy
+
+    worker->drain();
+
+    SettingsRecord loaded;
+    SettingsSlots reader(SETTINGS_PATH);
+    TEST_ASSERT_EQUAL(SettingsDecodeResult::OK, reader.load(loaded));
+    TEST_ASSERT_EQUAL(0, loaded.soundEnabled);
+}
+
+void test_cycle_record_is_written_behind() {
+    CycleRecord cycle;
+    memset(&cycle, 0, sizeof(cycle));
+    cycle.duration = 3600;
+
+    TEST_ASSERT_TRUE(worker->submitCycle(cycle));
+    TEST_ASSERT_EQUAL(0, history->getLatestId());
+
+    worker->drain();
+
+    CycleRecord stored;
+    TEST_ASSERT_EQUAL(1, history->getLatestId());
+    TEST_ASSERT_TRUE(history->read(1, stored));
+    TEST_ASSERT_EQUAL(3600, stored.duration);
+}
+
+void test_telemetry_page_is_released_after_write() {
+    TelemetryPageBuffer buffer;
+    buffer.page.header.magic = TELEMETRY_PAGE_MAGIC;
+    buffer.page.header.version = TELEMETRY_PAGE_VERSION;
+    buffer.page.header.flags = TELEMETRY_PAGE_FIRST;
+    buffer.page.header.payloadCrc = telemetryPayloadCrc(buffer.page);
+    buffer.pending.store(true);
+
+    TEST_ASSERT_TRUE(worker->submitTelemetry(buffer));
+    TEST_ASSERT_TRUE(buffer.isPending());   // Recorder must not reuse it yet
+    TEST_ASSERT_EQUAL(0, telemetry->getPageCount());
+
+    worker->drain();
+
+    TEST_ASSERT_FALSE(buffer.isPending());
+    TEST_ASSERT_EQUAL(1, telemetry->getPageCount());
+    TEST_ASSERT_EQUAL(1, telemetry->getLatestRecording());
+}
+
+static void firstTelemetryPage(TelemetryPageBuffer& buffer) {
+    buffer.page.header.magic = TELEMETRY_PAGE_MAGIC;
+    buffer.page.header.version = TELEMETRY_PAGE_VERSION;
+    buffer.page.header.flags = TELEMETRY_PAGE_FIRST;
+    buffer.page.header.payloadCrc = telemetryPayloadCrc(buffer.page);
+    buffer.pending.store(true);
+}
+
+void test_first_pass_scans_telemetry_log_before_writing() {
+    TelemetryPageBuffer buffer;
+    firstTelemetryPage(buffer);
+    worker->submitTelemetry(buffer);
+    worker->drain();
+
+    // Reboot: the log is not scanned until the worker runs
+    delete worker;
+    delete telemetry;
+    telemetry = new TelemetryLogFile(TELEMETRY_PATH);
+    worker = new StorageWorker(*slots, *journal, *history, *telemetry);
+    TEST_ASSERT_FALSE(telemetry->isLoaded());
+    TEST_ASSERT_EQUAL(0, telemetry->getPageCount());
+
+    firstTelemetryPage(buffer);
+    worker->submitTelemetry(buffer);
+
+    TEST_ASSERT_TRUE(worker->runOnce());     // The scan, nothing written
+    TEST_ASSERT_TRUE(telemetry->isLoaded());
+    TEST_ASSERT_EQUAL(1, telemetry->getPageCount());
+    TEST_ASSERT_EQUAL(1, worker->getPending());
+
+    TEST_ASSERT_EQUAL(1, worker->drain());
+    TEST_ASSERT_EQUAL(2, telemetry->getPageCount());
+    TEST_ASSERT_EQUAL(2, telemetry->getLatestRecording());
+}
+
+// ==================== Ordering Tests ====================
+
+void test_requests_are_written_in_submission_order() {
+    worker->submitRuntime(snapshot(DryerState::RUNNING, 10));
+    worker->submitSettings(settingsWithSound(false));
+    worker->submitRuntime(snapshot(DryerState::PAUSED, 20));
+
+    TEST_ASSERT_TRUE(worker->runOnce());
+    RuntimeRecord latest;
+    TEST_ASSERT_TRUE(recoverLatest(latest));
+    TEST_ASSERT_EQUAL(10, latest.elapsed);
+    TEST_ASSERT_FALSE(LittleFS.exists(SETTINGS_PATH));
+
+    worker->drain();
+    TEST_ASSERT_TRUE(recoverLatest(latest));
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(DryerState::PAUSED), latest.state);
+    TEST_ASSERT_EQUAL(20, latest.elapsed);
+    TEST_ASSERT_TRUE(LittleFS.exists(SETTINGS_PATH));
+}
+
+void test_emergency_jumps_the_queue() {
+    worker->submitSettings(settingsWithSound(false));
+    worker->submitRuntime(snapshot(DryerState::RUNNING, 10));
+    worker->submitEmergency(snapshot(DryerState::RUNNING, 30), "Heater overtemp");
+
+    TEST_ASSERT_TRUE(worker->runOnce());      // Emergency lane first
+
+    RuntimeRecord latest;
+    TEST_ASSERT_TRUE(recoverLatest(latest));
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(DryerState::FAILED), latest.state);
+    TEST_ASSERT_EQUAL(30, latest.elapsed);
+    TEST_ASSERT_FALSE(LittleFS.exists(SETTINGS_PATH));
+
+    char reason[32] = {};
+    File file = LittleFS.open(EMERGENCY_FILE, "r");
+    TEST_ASSERT_TRUE(file);
+    file.readBytes(reason, sizeof(reason) - 1);
+    file.close();
+    TEST_ASSERT_EQUAL_STRING("Heater overtemp", reason);
+}
+
+void test_older_runtime_never_follows_emergency() {
+    worker->submitRuntime(snapshot(DryerState::RUNNING, 10));
+    worker->submitRuntime(snapshot(DryerState::RUNNING, 20));
+    worker->submitEmergency(snapshot(DryerState::RUNNING, 25), "Sensor lost");
+
+    worker->drain();
+
+    RuntimeRecord latest;
+    TEST_ASSERT_TRUE(recoverLatest(latest));
+    TEST_ASSERT_EQUAL(static_cast<uint8_t>(DryerState::FAILED), latest.state);
+    TEST_ASSERT_EQUAL(2, worker->getSuperseded());
+    TEST_ASSERT_EQUAL(3, worker->getCompleted());
+}
+
+void test_runtime_after_emergency_is_written() {
+    worker->submitEmergency(snapshot(DryerState::RUNNING, 25), "Sensor lost");
+    worker->submitRuntimeClear(100);
+
+    worker->drain();
+
+    RuntimeRecord latest;
+    TEST_ASSERT_FALSE(recoverLatest(latest));   // Tombstone wins
+    TEST_ASSERT_EQUAL(0, worker->getSuperseded());
+}
+
+// ==================== Backpressure Tests ====================
+
+void test_full_queue_rejects_without_blocking() {
+    for (uint32_t i = 0; i < STORAGE_QUEUE_DEPTH; i++) {
+        TEST_ASSERT_TRUE(worker->submitRuntime(snapshot(DryerState::RUNNING, i)));
+    }
+
+    TEST_ASSERT_FALSE(worker->submitRuntime(snapshot(DryerState::RUNNING, 99)));
+    TEST_ASSERT_EQUAL(1, worker->getDropped());
+    TEST_ASSERT_EQUAL(STORAGE_QUEUE_DEPTH, worker->getPeakDepth());
+    TEST_ASSERT_EQUAL(STORAGE_QUEUE_DEPTH, worker->getPending());
+
+    // One slice frees one slot
+    worker->runOnce();
+    TEST_ASSERT_TRUE(worker->submitRuntime(snapshot(DryerState::RUNNING, 100)));
+
+    worker->drain();
+    RuntimeRecord latest;
+    TEST_ASSERT_TRUE(recoverLatest(latest));
+    TEST_ASSERT_EQUAL(100, latest.elapsed);
+}
+
+void test_emergency_lane_accepts_when_queue_is_full() {
+    for (uint32_t i = 0; i < STORAGE_QUEUE_DEPTH; i++) {
+        worker->submitRuntime(snapshot(DryerState::RUNNING, i));
+    }
+
+    TEST_ASSERT_TRUE(worker->submitEmergency(snapshot(DryerState::RUNNING, 50), "Overheat"));
+}
+
+void test_barrier_drains_inline_without_worker_task() {
+    worker->submitRuntime(snapshot(DryerState::RUNNING, 10));
+    worker->submitSettings(settingsWithSound(false));
+
+    TEST_ASSERT_TRUE(worker->barrier());
+    TEST_ASSERT_EQUAL(0, worker->getPending());
+    TEST_ASSERT_EQUAL(2, worker->getCompleted());
+    TEST_ASSERT_FALSE(worker->runOnce());
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // Write-behind
+    RUN_TEST(test_submit_returns_before_anything_is_written);
+    RUN_TEST(test_snapshot_is_copied_at_submit);
+    RUN_TEST(test_cycle_record_is_written_behind);
+    RUN_TEST(test_telemetry_page_is_released_after_write);
+    RUN_TEST(test_first_pass_scans_telemetry_log_before_writing);
+
+    // Ordering
+    RUN_TEST(test_requests_are_written_in_submission_order);
+    RUN_TEST(test_emergency_jumps_the_queue);
+    RUN_TEST(test_older_runtime_never_follows_emergency);
+    RUN_TEST(test_runtime_after_emergency_is_written);
+
+    // Backpressure
+    RUN_TEST(test_full_queue_rejects_without_blocking);
+    RUN_TEST(test_emergency_lane_accepts_when_queue_is_full);
+    RUN_TEST(test_barrier_drains_inline_without_worker_task);
+
+    return UNITY_END();
+}
@@ -0,0 +1,255 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#include "../../src/scheduler/TaskScheduler.h"
+
+// Test fixture
+TaskScheduler* scheduler;
+
+// Fake clock, advanced by the tests (and by task bodies to simulate work)
+uint32_t fakeMillis;
+
+uint32_t fakeClock() {
+    return fakeMillis;
+}
+
+// Run log
+char runOrder[16];
+uint8_t runCount;
+uint32_t lastStartMillis;
+uint32_t workMillis;   // How long taskA "takes"
+
+void taskA(uint32_t currentMillis) {
+    runOrder[runCount++] = 'A';
+    lastStartMillis = currentMillis;
+    fakeMillis += workMillis;
+}
+
+void taskB(uint32_t currentMillis) {
+    runOrder[runCount++] = 'B';
+}
+
+void setUp(void) {
+    fakeMillis = 1000;
+    runCount = 0;
+    lastStartMillis = 0;
+    workMillis = 0;
+    memset(runOrder, 0, sizeof(runOrder));
+    scheduler = new TaskScheduler(fakeClock);
+}
+
+void tearDown(void) {
+    delete scheduler;
+}
+
+// Advance the clock 1ms at a time until `until`, running due tasks
+static void runUntil(uint32_t until) {
+    while (fakeMillis < until) {
+        scheduler->runDue();
+        fakeMillis++;
+    }
+}
+
+// ==================== Table Tests ====================
+
+void test_scheduler_adds_tasks_to_table() {
+    TEST_ASSERT_EQUAL(0, scheduler->addTask("a", taskA, 10, 10));
+    TEST_ASSERT_EQUAL(1, scheduler->addTask("b", taskB, 20, 20));
+
+    TEST_ASSERT_EQUAL(2, scheduler->getTaskCount());
+    TEST_ASSERT_EQUAL_STRING("b", scheduler->getTaskStats(1)->name);
+    TEST_ASSERT_EQUAL(20, scheduler->getTaskStats(1)->periodMs);
+    TEST_ASSERT_NULL(scheduler->getTaskStats(2));
+}
+
+void test_scheduler_rejects_invalid_tasks_and_full_table() {
+    TEST_ASSERT_EQUAL(INVALID_TASK, scheduler->addTask("zero", taskA, 0, 10));
+    TEST_ASSERT_EQUAL(INVALID_TASK, scheduler->addTask("null", nullptr, 10, 10));
+
+    for (uint8_t i = 0; i < MAX_SCHEDULER_TASKS; i++) {
+        TEST_ASSERT_NOT_EQUAL(INVALID_TASK, scheduler->addTask("t", taskB, 10, 10));
+    }
+    TEST_ASSERT_EQUAL(INVALID_TASK, scheduler->addTask("extra", taskB, 10, 10));
+}
+
+// ==================== Release Tests ====================
+
+void test_scheduler_runs_new_tasks_immediately_in_table_order() {
+    scheduler->addTask("b", taskB, 10, 10);
+    scheduler->addTask("a", taskA, 10, 10);
+
+    TEST_ASSERT_EQUAL(2, scheduler->runDue());
+    TEST_ASSERT_EQUAL_STRING("BA", runOrder);
+}
+
+void test_scheduler_runs_each_task_at_its_period() {
+    scheduler->addTask("a", taskA, 10, 10);
+    scheduler->addTask("b", taskB, 25, 25);
+
+    runUntil(1100);
+
+    TEST_ASSERT_EQUAL(10, scheduler->getTaskStats(0)->runs);
+    TEST_ASSERT_EQUAL(4, scheduler->getTaskStats(1)->runs);
+}
+
+void test_scheduler_does_not_run_early() {
+    scheduler->addTask("a", taskA, 10, 10);
+    scheduler->runDue();
+
+    fakeMillis += 9;
+    TEST_ASSERT_EQUAL(0, scheduler->runDue());
+
+    fakeMillis += 1;
+    TEST_ASSERT_EQUAL(1, scheduler->runDue());
+}
+
+void test_scheduler_keeps_release_phase_after_late_start() {
+    scheduler->addTask("a", taskA, 10, 10);
+    scheduler->runDue();
+
+    // Picked up 4ms late, next release is still on the 10ms grid
+    fakeMillis += 14;
+    scheduler->runDue();
+    TEST_ASSERT_EQUAL(1014, lastStartMillis);
+
+    fakeMillis = 1019;
+    TEST_ASSERT_EQUAL(0, scheduler->runDue());
+    fakeMillis = 1020;
+    TEST_ASSERT_EQUAL(1, scheduler->runDue());
+}
+
+// ==================== Sleep Tests ====================
+
+void test_scheduler_sleeps_until_next_release() {
+    scheduler->addTask("a", taskA, 20, 20);
+    scheduler->addTask("b", taskB, 50, 50);
+    scheduler->runDue();
+
+    TEST_ASSERT_EQUAL(20, scheduler->getSleepTime());
+
+    fakeMillis += 15;
+    TEST_ASSERT_EQUAL(5, scheduler->getSleepTime());
+
+    fakeMillis += 5;
+    TEST_ASSERT_EQUAL(0, scheduler->getSleepTime());
+}
+
+void test_scheduler_sleep_is_capped() {
+    scheduler->addTask("slow", taskA, SCHEDULER_MAX_SLEEP_MS * 10, 10);
+    scheduler->runDue();
+
+    TEST_ASSERT_EQUAL(SCHEDULER_MAX_SLEEP_MS, scheduler->getSleepTime());
+}
+
+// ==================== Overrun Tests ====================
+
+void test_scheduler_counts_deadline_overruns() {
+    scheduler->addTask("a", taskA, 100, 10);
+
+    workMillis = 5;
+    scheduler->runDue();
+    TEST_ASSERT_EQUAL(0, scheduler->getTaskStats(0)->overruns);
+
+    fakeMillis = 1100;
+    workMillis = 15;
+    scheduler->runDue();
+
+    const TaskStats* stats = scheduler->getTaskStats(0);
+    TEST_ASSERT_EQUAL(2, stats->runs);
+    TEST_ASSERT_EQUAL(1, stats->overruns);
+    TEST_ASSERT_EQUAL(15, stats->maxResponseMs);
+    TEST_ASSERT_EQUAL(15, stats->executionMs.getMax());
+}
+
+void test_scheduler_blames_waiting_time_on_later_tasks() {
+    // A hogs the pass, B was released at the same time and misses its deadline
+    scheduler->addTask("a", taskA, 100, 100);
+    scheduler->addTask("b", taskB, 100, 10);
+
+    workMillis = 30;
+    scheduler->runDue();
+
+    TEST_ASSERT_EQUAL(0, scheduler->getTaskStats(0)->overruns);
+    TEST_ASSERT_EQUAL(1, scheduler->getTaskStats(1)->overruns);
+    TEST_ASSERT_EQUAL(30, scheduler->getTaskStats(1)->maxResponseMs);
+    TEST_ASSERT_EQUAL(0, scheduler->getTaskStats(1)->executionMs.getMax());
+}
+
+void test_scheduler_skips_missed_releases_instead_of_bursting() {
+    scheduler->addTask("a", taskA, 10, 10);
+    scheduler->runDue();
+
+    // Loop stalled for 45ms: run once, count the releases that passed
+    fakeMillis += 45;
+    TEST_ASSERT_EQUAL(1, scheduler->runDue());
+    TEST_ASSERT_EQUAL(0, scheduler->runDue());
+
+    TEST_ASSERT_EQUAL(3, scheduler->getTaskStats(0)->skippedReleases);
+    TEST_ASSERT_EQUAL(5, scheduler->getSleepTime());
+}
+
+void test_scheduler_reset_clears_stats() {
+    scheduler->addTask("a", taskA, 10, 1);
+    workMillis = 5;
+    scheduler->runDue();
+
+    scheduler->resetStats();
+
+    const TaskStats* stats = scheduler->getTaskStats(0);
+    TEST_ASSERT_EQUAL(0, stats->runs);
+    TEST_ASSERT_EQUAL(0, stats->overruns);
+    TEST_ASSERT_EQUAL(0, stats->executionMs.getCount());
+    TEST_ASSERT_EQUAL(10, stats->periodMs);
+}
+
+void test_scheduler_reset_request_applies_on_next_run() {
+    scheduler->addTask("a", taskA, 10, 1);
+    workMillis = 5;
+    scheduler->runDue();
+
+    scheduler->requestResetStats();
+    TEST_ASSERT_EQUAL(1, scheduler->getTaskStats(0)->runs);
+
+    // Cleared by the owning thread before the next pass runs anything
+    fakeMillis = 1010;
+    workMillis = 0;
+    scheduler->runDue();
+
+    const TaskStats* stats = scheduler->getTaskStats(0);
+    TEST_ASSERT_EQUAL(1, stats->runs);
+    TEST_ASSERT_EQUAL(0, stats->overruns);
+    TEST_ASSERT_EQUAL(1, stats->executionMs.getCount());
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // Table
+    RUN_TEST(test_scheduler_adds_tasks_to_table);
+    RUN_TEST(test_scheduler_rejects_invalid_tasks_and_full_table);
+
+    // Releases
+    RUN_TEST(test_scheduler_runs_new_tasks_immediately_in_table_order);
+    RUN_TEST(test_scheduler_runs_each_task_at_its_period);
+    RUN_TEST(test_scheduler_does_not_run_early);
+    RUN_TEST(test_scheduler_keeps_release_phase_after_late_start);
+
+    // Sleep
+    RUN_TEST(test_scheduler_sleeps_until_next_release);
+    RUN_TEST(test_scheduler_sleep_is_capped);
+
+    // Overruns
+    RUN_TEST(test_scheduler_counts_deadline_overruns);
+    RUN_TEST(test_scheduler_blames_waiting_time_on_later_tasks);
+    RUN_TEST(test_scheduler_skips_missed_releases_instead_of_bursting);
+    RUN_TEST(test_scheduler_reset_clears_stats);
+    RUN_TEST(test_scheduler_reset_request_applies_on_next_run);
+
+    return UNITY_END();
+}
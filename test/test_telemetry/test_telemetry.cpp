@@ -0,0 +1,557 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#include "../../src/history/TelemetryRecorder.h"
+#include "../../src/storage/TelemetryLogFile.h"
+#include "../../src/control/PIDController.h"
+#include "../mocks/MockSettingsStorage.h"
+#include <vector>
+
+#define TELEMETRY_PATH "/test_telemetry"   // Segment file prefix
+
+TelemetryLogFile* telemetryLog;
+
+static TelemetrySample sampleAt(uint32_t second, float heater, float box) {
+    PIDTerms terms;
+    terms.proportional = 12.3f;
+    terms.integral = 40.5f;
+    terms.derivative = -1.2f;
+    return TelemetrySample::from(second * 1000, heater, box, 30.0f, 80.0f, terms);
+}
+
+// Encode `count` samples into pages and append them to the log
+static uint32_t appendRecording(uint32_t count, std::vector<TelemetrySample>* kept = nullptr) {
+    TelemetryPage page;
+    TelemetryPageEncoder encoder;
+    encoder.reset(page, 0);
+    uint8_t flags = TELEMETRY_PAGE_FIRST;
+    uint32_t pages = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        TelemetrySample sample = sampleAt(i, 60.0f + (i % 7) * 0.0625f, 50.0f + (i % 3) * 0.1f);
+        if (kept) {
+            kept->push_back(sample);
+        }
+        if (!encoder.append(sample)) {
+            encoder.seal(flags);
+            telemetryLog->append(page);
+            flags = 0;
+            pages++;
+            encoder.reset(page, i);
+            encoder.append(sample);
+        }
+    }
+    encoder.seal(flags);
+    telemetryLog->append(page);
+    return pages + 1;
+}
+
+static std::vector<TelemetrySample> readRecording(uint32_t recording) {
+    std::vector<TelemetrySample> samples;
+    telemetryLog->forEachPage(recording, [&samples](const TelemetryPage& page) {
+        TelemetryPageDecoder decoder(page);
+        TelemetrySample sample;
+        while (decoder.next(sample)) {
+            samples.push_back(sample);
+        }
+    });
+    return samples;
+}
+
+static void restart() {
+    delete telemetryLog;
+    telemetryLog = new TelemetryLogFile(TELEMETRY_PATH);
+    telemetryLog->load();
+}
+
+void setUp(void) {
+    LittleFS.format();
+    LittleFS.begin(true);
+    telemetryLog = new TelemetryLogFile(TELEMETRY_PATH);
+    telemetryLog->load();
+}
+
+void tearDown(void) {
+    delete telemetryLog;
+}
+
+// ==================== Codec Tests ====================
+
+void test_zigzag_varint_round_trip() {
+    const int32_t values[] = {0, 1, -1, 63, -64, 64, 8191, -8192, INT32_MAX, INT32_MIN};
+    for (int32_t value : values) {
+        uint8_t buffer[5];
+        size_t length = TelemetryCodec::putVarint(buffer, TelemetryCodec::zigzag(value));
+        uint32_t raw;
+        TEST_ASSERT_EQUAL(length, TelemetryCodec::getVarint(buffer, buffer + length, raw));
+        TEST_ASSERT_EQUAL_INT32(value, TelemetryCodec::unzigzag(raw));
+    }
+
+    // Small deltas of either sign take one byte
+    uint8_t buffer[5];
+    TEST_ASSERT_EQUAL(1, TelemetryCodec::putVarint(buffer, TelemetryCodec::zigzag(-64)));
+    TEST_ASSERT_EQUAL(1, TelemetryCodec::putVarint(buffer, TelemetryCodec::zigzag(63)));
+
+    // Truncated varint is rejected
+    uint32_t raw;
+    size_t length = TelemetryCodec::putVarint(buffer, TelemetryCodec::zigzag(INT32_MAX));
+    TEST_ASSERT_EQUAL(0, TelemetryCodec::getVarint(buffer, buffer + length - 1, raw));
+}
+
+void test_page_round_trip_is_exact() {
+    TelemetryPage page;
+    TelemetryPageEncoder encoder;
+    encoder.reset(page, 0);
+
+    std::vector<TelemetrySample> written;
+    for (uint32_t i = 0; i < 20; i++) {
+        TelemetrySample sample = sampleAt(i, 55.0f + i * 0.5f, 45.0f - i * 0.25f);
+        written.push_back(sample);
+        TEST_ASSERT_TRUE(encoder.append(sample));
+    }
+    encoder.seal(TELEMETRY_PAGE_FIRST);
+
+    TelemetryPageDecoder decoder(page);
+    TEST_ASSERT_TRUE(decoder.isValid());
+    TelemetrySample sample;
+    for (const TelemetrySample& expected : written) {
+        TEST_ASSERT_TRUE(decoder.next(sample));
+        TEST_ASSERT_TRUE(expected == sample);
+    }
+    TEST_ASSERT_FALSE(decoder.next(sample));
+    TEST_ASSERT_EQUAL_FLOAT(64.5f, written[19].getHeaterTemp());
+    TEST_ASSERT_EQUAL_FLOAT(40.5f, written[19].getITerm());
+}
+
+void test_steady_tick_costs_one_byte() {
+    TelemetryPage page;
+    TelemetryPageEncoder encoder;
+    encoder.reset(page, 0);
+
+    encoder.append(sampleAt(0, 60.0f, 50.0f));   // Keyframe
+    encoder.append(sampleAt(1, 60.0f, 50.0f));   // Interval set
+    uint16_t before = encoder.getPayloadBytes();
+    encoder.append(sampleAt(2, 60.0f, 50.0f));
+
+    // Same interval, nothing moved: only the mask byte
+    TEST_ASSERT_EQUAL(1, encoder.getPayloadBytes() - before);
+}
+
+void test_full_page_rejects_without_change() {
+    TelemetryPage page;
+    TelemetryPageEncoder encoder;
+    encoder.reset(page, 0);
+
+    uint32_t i = 0;
+    while (encoder.append(sampleAt(i * 37, i * 3.1f, -i * 2.7f))) {
+        i++;
+    }
+    uint16_t count = encoder.getSampleCount();
+    uint16_t bytes = encoder.getPayloadBytes();
+    TEST_ASSERT_TRUE(count > 0);
+    TEST_ASSERT_TRUE(bytes <= TELEMETRY_PAYLOAD_BYTES);
+
+    TEST_ASSERT_FALSE(encoder.append(sampleAt(1, 0, 0)));
+    TEST_ASSERT_EQUAL(count, encoder.getSampleCount());
+    TEST_ASSERT_EQUAL(bytes, encoder.getPayloadBytes());
+}
+
+void test_corrupt_payload_decodes_nothing() {
+    TelemetryPage page;
+    TelemetryPageEncoder encoder;
+    encoder.reset(page, 0);
+    encoder.append(sampleAt(0, 60.0f, 50.0f));
+    encoder.seal(0);
+
+    page.payload[1] ^= 0x40;
+
+    TelemetryPageDecoder decoder(page);
+    TelemetrySample sample;
+    TEST_ASSERT_FALSE(decoder.isValid());
+    TEST_ASSERT_FALSE(decoder.next(sample));
+}
+
+// ==================== Recorder Tests ====================
+
+void test_recorder_hands_over_full_pages_and_flags_the_first() {
+    MockSettingsStorage storage;
+    TelemetryRecorder recorder(&storage);
+    recorder.begin(0);
+
+    PIDTerms terms;
+    for (uint32_t t = 0; t < 600; t++) {
+        recorder.record(t * 1000, 60.0f + (t % 5) * 0.0625f, 50.0f, 30.0f, 40.0f, terms);
+    }
+
+    uint32_t pages = storage.getSaveTelemetryPageCallCount();
+    TEST_ASSERT_TRUE(pages >= 1);
+    TEST_ASSERT_EQUAL(0, storage.getLastTelemetryPage().header.flags);   // Only the first is FIRST
+    TEST_ASSERT_TRUE(storage.getLastTelemetryPage().header.firstSample > 0);
+
+    recorder.finish();
+    TEST_ASSERT_EQUAL(pages + 1, storage.getSaveTelemetryPageCallCount());   // Partial page flushed
+    TEST_ASSERT_FALSE(recorder.isRecording());
+    TEST_ASSERT_EQUAL(0, recorder.getPagesDropped());
+    TEST_ASSERT_EQUAL(600, recorder.getSampleCount());
+}
+
+void test_recorder_drops_page_when_other_half_is_busy() {
+    MockSettingsStorage storage;
+    storage.setHoldTelemetryPages(true);   // Worker never finishes
+    TelemetryRecorder recorder(&storage);
+    recorder.begin(0);
+
+    PIDTerms terms;
+    for (uint32_t t = 0; t < 2000; t++) {
+        recorder.record(t * 1000, 60.0f + (t % 5) * 0.5f, 50.0f + (t % 3) * 0.1f, 30.0f, t % 200, terms);
+    }
+
+    // First page went out; later full pages had nowhere to go
+    TEST_ASSERT_EQUAL(1, storage.getSaveTelemetryPageCallCount());
+    TEST_ASSERT_EQUAL(1, recorder.getPagesWritten());
+    TEST_ASSERT_TRUE(recorder.getPagesDropped() > 0);
+    TEST_ASSERT_EQUAL(2000, recorder.getSampleCount());   // The tick itself never blocks
+}
+
+void test_recorder_ignores_samples_when_not_recording() {
+    MockSettingsStorage storage;
+    TelemetryRecorder recorder(&storage);
+    PIDTerms terms;
+    recorder.record(0, 60.0f, 50.0f, 30.0f, 40.0f, terms);
+    recorder.pause();
+    recorder.finish();
+
+    TEST_ASSERT_EQUAL(0, recorder.getSampleCount());
+    TEST_ASSERT_EQUAL(0, storage.getSaveTelemetryPageCallCount());
+}
+
+// ==================== Log File Tests ====================
+
+void test_log_numbers_recordings_and_reads_them_back() {
+    std::vector<TelemetrySample> first;
+    appendRecording(500, &first);
+    appendRecording(100);
+
+    TelemetryRecordingInfo info[4];
+    TEST_ASSERT_EQUAL(2, telemetryLog->listRecordings(info, 4));
+    TEST_ASSERT_EQUAL(1, info[0].recording);
+    TEST_ASSERT_EQUAL(500, info[0].samples);
+    TEST_ASSERT_EQUAL(0, info[0].firstSample);
+    TEST_ASSERT_EQUAL(2, info[1].recording);
+    TEST_ASSERT_EQUAL(100, info[1].samples);
+
+    std::vector<TelemetrySample> decoded = readRecording(1);
+    TEST_ASSERT_EQUAL(first.size(), decoded.size());
+    for (size_t i = 0; i < first.size(); i++) {
+        TEST_ASSERT_TRUE(first[i] == decoded[i]);
+    }
+
+    // Pages are whole flash pages
+    TEST_ASSERT_EQUAL(0, telemetryLog->getFileBytes() % TELEMETRY_PAGE_BYTES);
+}
+
+void test_log_survives_restart() {
+    appendRecording(300);
+    uint32_t pages = telemetryLog->getPageCount();
+
+    restart();
+
+    TEST_ASSERT_EQUAL(pages, telemetryLog->getPageCount());
+    TEST_ASSERT_EQUAL(1, telemetryLog->getLatestRecording());
+
+    appendRecording(10);
+    TEST_ASSERT_EQUAL(2, telemetryLog->getLatestRecording());
+    TEST_ASSERT_EQUAL(pages + 1, telemetryLog->getPageCount());
+}
+
+void test_log_rotates_oldest_recording_out() {
+    // More than the ring holds: recording 1 starts rotating out
+    appendRecording(200);
+    while (telemetryLog->getPageCount() < TELEMETRY_LOG_PAGES) {
+        appendRecording(200);
+    }
+    uint32_t recordings = telemetryLog->getLatestRecording();
+    appendRecording(200);
+
+    // The oldest segment went as a whole; the ring never grows past the budget
+    TEST_ASSERT_TRUE(telemetryLog->getPageCount() > TELEMETRY_LOG_PAGES - TELEMETRY_SEGMENT_PAGES);
+    TEST_ASSERT_TRUE(telemetryLog->getPageCount() <= TELEMETRY_LOG_PAGES);
+    TEST_ASSERT_TRUE(LittleFS.usedBytes() <= TELEMETRY_LOG_BYTES);
+    TEST_ASSERT_EQUAL(0, readRecording(1).size());
+
+    TelemetryRecordingInfo newest[2];
+    TEST_ASSERT_EQUAL(2, telemetryLog->listRecordings(newest, 2));
+    TEST_ASSERT_EQUAL(recordings + 1, newest[1].recording);
+    TEST_ASSERT_EQUAL(200, newest[1].samples);
+
+    uint32_t pages = telemetryLog->getPageCount();
+    restart();
+    TEST_ASSERT_EQUAL(recordings + 1, telemetryLog->getLatestRecording());
+    TEST_ASSERT_EQUAL(pages, telemetryLog->getPageCount());
+}
+
+void test_log_only_appends_at_end_of_file() {
+    // Wrap the ring, then watch the bytes of every segment: an append may
+    // only add bytes at the end of one file (or start a new one)
+    while (telemetryLog->getPageCount() < TELEMETRY_LOG_PAGES) {
+        appendRecording(200);
+    }
+    char name[32];
+    for (uint32_t i = 0; i < 3 * TELEMETRY_SEGMENT_PAGES; i++) {
+        std::vector<std::vector<char>> before;
+        for (uint32_t slot = 0; slot < TELEMETRY_LOG_SEGMENTS; slot++) {
+            snprintf(name, sizeof(name), "%s%lu.bin", TELEMETRY_PATH, (unsigned long)slot);
+            std::vector<char> bytes;
+            File file = LittleFS.open(name, "r");
+            bytes.resize(file.size());
+            file.readBytes(bytes.data(), bytes.size());
+            file.close();
+            before.push_back(bytes);
+        }
+
+        appendRecording(10);
+
+        uint32_t changed = 0;
+        for (uint32_t slot = 0; slot < TELEMETRY_LOG_SEGMENTS; slot++) {
+            snprintf(name, sizeof(name), "%s%lu.bin", TELEMETRY_PATH, (unsigned long)slot);
+            std::vector<char> bytes;
+            File file = LittleFS.open(name, "r");
+            bytes.resize(file.size());
+            file.readBytes(bytes.data(), bytes.size());
+            file.close();
+            if (bytes == before[slot]) {
+                continue;
+            }
+            changed++;
+            bool appended = bytes.size() == before[slot].size() + TELEMETRY_PAGE_BYTES &&
+                            std::equal(before[slot].begin(), before[slot].end(), bytes.begin());
+            bool started = bytes.size() == TELEMETRY_PAGE_BYTES;
+            TEST_ASSERT_TRUE(appended || started);
+        }
+        TEST_ASSERT_EQUAL(1, changed);
+    }
+}
+
+void test_find_page_streams_a_recording_in_slices() {
+    appendRecording(300);
+    std::vector<TelemetrySample> second;
+    appendRecording(900, &second);
+    appendRecording(300);
+
+    // Two headers per call, as a serial pass with a small budget would
+    std::vector<TelemetrySample> streamed;
+    uint32_t sequence = 0;
+    uint32_t calls = 0;
+    TelemetryPage page;
+    for (;;) {
+        TelemetryScan scan = telemetryLog->findPage(2, sequence, page, 2);
+        calls++;
+        if (scan == TelemetryScan::END) {
+            break;
+        }
+        if (scan == TelemetryScan::FOUND) {
+            TelemetryPageDecoder decoder(page);
+            TelemetrySample sample;
+            while (decoder.next(sample)) {
+                streamed.push_back(sample);
+            }
+            sequence++;
+        }
+        TEST_ASSERT_TRUE(calls < 100);
+    }
+
+    TEST_ASSERT_EQUAL(second.size(), streamed.size());
+    for (size_t i = 0; i < second.size(); i++) {
+        TEST_ASSERT_TRUE(second[i] == streamed[i]);
+    }
+    // Stopped at recording 3 instead of reading on to the end
+    TEST_ASSERT_TRUE(sequence < telemetryLog->getPageCount());
+}
+
+void test_find_page_ends_for_missing_recording() {
+    appendRecording(100);
+
+    uint32_t sequence = 0;
+    TelemetryPage page;
+    TelemetryScan scan = telemetryLog->findPage(7, sequence, page, TELEMETRY_LOG_PAGES);
+
+    TEST_ASSERT_TRUE(scan == TelemetryScan::END);
+}
+
+void test_torn_page_is_skipped() {
+    appendRecording(500);
+    uint32_t pages = telemetryLog->getPageCount();
+    TEST_ASSERT_TRUE(pages >= 2);
+
+    // Damage the payload of the first page
+    File file = LittleFS.open(TELEMETRY_PATH "0.bin", "r+");
+    file.seek(sizeof(TelemetryPageHeader) + 3);
+    uint8_t garbage = 0xA5;
+    file.write(&garbage, 1);
+    file.close();
+
+    std::vector<TelemetrySample> decoded = readRecording(1);
+    TEST_ASSERT_TRUE(decoded.size() > 0);
+    TEST_ASSERT_TRUE(decoded.size() < 500);
+}
+
+void test_torn_append_moves_to_next_segment() {
+    appendRecording(300);
+    uint32_t pages = telemetryLog->getPageCount();
+    TEST_ASSERT_TRUE(pages >= 2 && pages < TELEMETRY_SEGMENT_PAGES);
+
+    // Power lost in the middle of an append: half a page at the end
+    File file = LittleFS.open(TELEMETRY_PATH "0.bin", "a");
+    char half[TELEMETRY_PAGE_BYTES / 2] = {};
+    file.write(half, sizeof(half));
+    file.close();
+    restart();
+    TEST_ASSERT_EQUAL(1, telemetryLog->getDamagedPages());
+
+    appendRecording(10);
+
+    // Nothing already stored is lost; the new page opens segment 1
+    TEST_ASSERT_TRUE(LittleFS.exists(TELEMETRY_PATH "1.bin"));
+    TEST_ASSERT_EQUAL(300, readRecording(1).size());
+    TEST_ASSERT_EQUAL(10, readRecording(2).size());
+    restart();
+    TEST_ASSERT_EQUAL(10, readRecording(2).size());
+}
+
+void test_single_file_ring_of_older_firmware_is_removed() {
+    File file = LittleFS.open(LEGACY_TELEMETRY_FILE, "w");
+    char page[TELEMETRY_PAGE_BYTES] = {};
+    file.write(page, sizeof(page));
+    file.close();
+
+    restart();
+
+    TEST_ASSERT_FALSE(LittleFS.exists(LEGACY_TELEMETRY_FILE));
+    TEST_ASSERT_EQUAL(0, telemetryLog->getPageCount());
+}
+
+// ==================== Compression Benchmark ====================
+
+/**
+ * 10 hours at 1 Hz of a simulated dryer under the real PIDController:
+ * two-node heater/box model, sensor quantisation and noise as the
+ * DS18B20 (1/16 °C) and AM2320 (0.1 °C / 0.1 %RH, every 2 s). The whole
+ * cycle must fit in the ring with room for older cycles, and decode
+ * back sample for sample.
+ */
+void test_ten_hour_recording_fits_the_flash_budget() {
+    const uint32_t seconds = 10 * 3600;
+    PIDController pid;
+    pid.begin();
+    pid.setProfile(PIDProfile::NORMAL);
+    pid.setMaxAllowedTemp(60.0f);
+
+    float heater = 22.0f;
+    float box = 22.0f;
+    float boxReading = box;
+    float humidityReading = 45.0f;
+    uint32_t noise = 12345;
+    auto jitter = [&noise](float amplitude) {
+        noise = noise * 1103515245u + 12345u;
+        return ((noise >> 16) % 1000 / 999.0f * 2.0f - 1.0f) * amplitude;
+    };
+
+    TelemetryPage page;
+    TelemetryPageEncoder encoder;
+    encoder.reset(page, 0);
+    uint8_t flags = TELEMETRY_PAGE_FIRST;
+    std::vector<TelemetrySample> written;
+    written.reserve(seconds);
+
+    for (uint32_t t = 0; t < seconds; t++) {
+        float heaterReading = roundf((heater + jitter(0.05f)) * 16.0f) / 16.0f;
+        if (t % 2 == 0) {
+            boxReading = roundf((box + jitter(0.08f)) * 10.0f) / 10.0f;
+            float humidity = 12.0f + 33.0f * expf(-(float)t / 7200.0f);
+            humidityReading = roundf((humidity + jitter(0.15f)) * 10.0f) / 10.0f;
+        }
+
+        float pwm = pid.compute(50.0f, boxReading, heaterReading, t * 1000);
+        TelemetrySample sample = TelemetrySample::from(t * 1000 + (t % 5 == 0 ? 20 : 0), heaterReading,
+                                                       boxReading, humidityReading, pwm, pid.getLastTerms());
+        written.push_back(sample);
+        if (!encoder.append(sample)) {
+            encoder.seal(flags);
+            flags = 0;
+            telemetryLog->append(page);
+            encoder.reset(page, t);
+            encoder.append(sample);
+        }
+
+        // Plant: heater -> box -> ambient (22 °C)
+        float power = pwm / PWM_MAX * HEATER_RATED_POWER_W;
+        float toBox = 2.0f * (heater - box);
+        heater += (power - toBox) / 150.0f;
+        box += (toBox - 0.8f * (box - 22.0f)) / 1500.0f;
+    }
+    encoder.seal(flags);
+    telemetryLog->append(page);
+
+    TelemetryRecordingInfo info;
+    TEST_ASSERT_EQUAL(1, telemetryLog->listRecordings(&info, 1));
+    size_t bytes = static_cast<size_t>(info.pages) * TELEMETRY_PAGE_BYTES;
+
+    char line[160];
+    snprintf(line, sizeof(line), "10 h @ 1 Hz: %lu samples in %u pages = %lu KB (%.2f B/sample, %.1fx vs raw), budget %lu KB",
+             (unsigned long)info.samples, (unsigned)info.pages, (unsigned long)(bytes / 1024),
+             (double)bytes / info.samples, (double)(seconds * sizeof(TelemetrySample)) / bytes,
+             (unsigned long)(TELEMETRY_LOG_BYTES / 1024));
+    TEST_MESSAGE(line);
+
+    // The whole cycle is there, and the ring keeps at least as much again for older ones
+    TEST_ASSERT_EQUAL(seconds, info.samples);
+    TEST_ASSERT_EQUAL(0, info.firstSample);
+    TEST_ASSERT_TRUE(bytes * 2 <= TELEMETRY_LOG_BYTES);
+    TEST_ASSERT_TRUE(TELEMETRY_LOG_BYTES <= LittleFS.totalBytes());
+
+    std::vector<TelemetrySample> decoded = readRecording(1);
+    TEST_ASSERT_EQUAL(written.size(), decoded.size());
+    for (size_t i = 0; i < written.size(); i++) {
+        if (!(written[i] == decoded[i])) {
+            TEST_FAIL_MESSAGE("Decoded sample differs");
+        }
+    }
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // Codec
+    RUN_TEST(test_zigzag_varint_round_trip);
+    RUN_TEST(test_page_round_trip_is_exact);
+    RUN_TEST(test_steady_tick_costs_one_byte);
+    RUN_TEST(test_full_page_rejects_without_change);
+    RUN_TEST(test_corrupt_payload_decodes_nothing);
+
+    // Recorder
+    RUN_TEST(test_recorder_hands_over_full_pages_and_flags_the_first);
+    RUN_TEST(test_recorder_drops_page_when_other_half_is_busy);
+    RUN_TEST(test_recorder_ignores_samples_when_not_recording);
+
+    // Log file
+    RUN_TEST(test_log_numbers_recordings_and_reads_them_back);
+    RUN_TEST(test_log_survives_restart);
+    RUN_TEST(test_log_rotates_oldest_recording_out);
+    RUN_TEST(test_log_only_appends_at_end_of_file);
+    RUN_TEST(test_find_page_streams_a_recording_in_slices);
+    RUN_TEST(test_find_page_ends_for_missing_recording);
+    RUN_TEST(test_torn_page_is_skipped);
+    RUN_TEST(test_torn_append_moves_to_next_segment);
+    RUN_TEST(test_single_file_ring_of_older_firmware_is_removed);
+
+    // Benchmark
+    RUN_TEST(test_ten_hour_recording_fits_the_flash_budget);
+
+    return UNITY_END();
+}
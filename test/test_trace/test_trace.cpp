@@ -0,0 +1,271 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#include <string.h>
+
+#include "../../src/diagnostics/Trace.h"
+#include "../../src/diagnostics/TraceDrain.h"
+#include "../../src/control/PIDController.h"
+#include "../mocks/MockTraceOutput.h"
+
+static_assert(traceArgCount("no args") == 0, "plain text");
+static_assert(traceArgCount("%d and %.2f") == 2, "printf conversions");
+static_assert(traceArgCount("100%% {DryerState}") == 1, "escaped percent and enum");
+
+// One decoded frame
+struct Frame {
+    uint16_t site;
+    uint32_t timestamp;
+    uint8_t argCount;
+    uint32_t args[TRACE_MAX_ARGS];
+};
+
+static uint32_t le32(const uint8_t* in) {
+    return in[0] | (in[1] << 8) | (in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+/**
+ * Split the captured stream into frames (what tools/trace_decode.py does)
+ * @return number of frames decoded, -1 on a malformed frame
+ */
+static int decodeFrames(const MockTraceOutput& output, Frame* frames, int maxFrames) {
+    const uint8_t* bytes = output.getBytes();
+    size_t length = output.getLength();
+    int count = 0;
+    size_t i = 0;
+
+    while (i < length) {
+        if (bytes[i] != 0x00) return -1;
+        size_t end = i + 1;
+        while (end < length && bytes[end] != 0x00) end++;
+        if (end >= length) return -1;
+
+        // COBS decode [i+1, end)
+        uint8_t payload[TRACE_MAX_PAYLOAD_BYTES];
+        size_t payloadLength = 0;
+        size_t pos = i + 1;
+        while (pos < end) {
+            uint8_t code = bytes[pos++];
+            for (uint8_t k = 1; k < code && pos < end; k++) payload[payloadLength++] = bytes[pos++];
+            if (code < 0xFF && pos < end) payload[payloadLength++] = 0;
+        }
+
+        uint8_t crc = 0;
+        for (size_t k = 0; k + 1 < payloadLength; k++) {
+            crc ^= payload[k];
+            for (uint8_t bit = 0; bit < 8; bit++) crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+        }
+        if (payloadLength < 8 || payload[0] != TRACE_FRAME_MAGIC || crc != payload[payloadLength - 1]) return -1;
+        if (count >= maxFrames) return -1;
+
+        Frame& frame = frames[count++];
+        frame.site = payload[1] | (payload[2] << 8);
+        frame.timestamp = le32(&payload[3]);
+        frame.argCount = (payloadLength - 8) / 4;
+        for (uint8_t a = 0; a < frame.argCount; a++) frame.args[a] = le32(&payload[7 + 4 * a]);
+
+        i = end + 1;
+    }
+    return count;
+}
+
+static float asFloat(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+void setUp(void) {
+    TraceRecord discard;
+    while (traceBuffer().pop(discard)) {}
+    traceBuffer().setEnabled(false);
+}
+
+void tearDown(void) {
+    traceBuffer().setEnabled(false);
+}
+
+// ==================== Buffer Tests ====================
+
+void test_disabled_buffer_records_nothing() {
+    TraceBuffer buffer;
+
+    buffer.record<1>(TraceSite::PID_BOX_AT_TARGET, 55.0f);
+
+    TEST_ASSERT_EQUAL(0, buffer.getQueued());
+}
+
+void test_record_stores_raw_arguments_and_tick_time() {
+    TraceBuffer buffer;
+    buffer.setEnabled(true);
+    buffer.setTime(1234);
+
+    buffer.record<2>(TraceSite::DRYER_STATE, DryerState::READY, DryerState::RUNNING);
+    buffer.record<1>(TraceSite::PID_BOX_AT_TARGET, 55.5f);
+
+    TraceRecord entry;
+    TEST_ASSERT_TRUE(buffer.pop(entry));
+    TEST_ASSERT_EQUAL(static_cast<uint16_t>(TraceSite::DRYER_STATE), entry.site);
+    TEST_ASSERT_EQUAL(1234, entry.timestamp);
+    TEST_ASSERT_EQUAL(2, entry.argCount);
+    TEST_ASSERT_EQUAL(static_cast<uint32_t>(DryerState::RUNNING), entry.args[1]);
+
+    TEST_ASSERT_TRUE(buffer.pop(entry));
+    TEST_ASSERT_EQUAL_FLOAT(55.5f, asFloat(entry.args[0]));
+}
+
+void test_full_ring_drops_and_counts() {
+    TraceBuffer buffer;
+    buffer.setEnabled(true);
+
+    for (size_t i = 0; i < TRACE_RING_RECORDS + 3; i++) {
+        buffer.record<1>(TraceSite::PID_BOX_AT_TARGET, 1.0f);
+    }
+
+    TEST_ASSERT_EQUAL(TRACE_RING_RECORDS, buffer.getQueued());
+    TEST_ASSERT_EQUAL(3, buffer.getDropped());
+}
+
+// ==================== Drain Tests ====================
+
+void test_drain_opens_session_with_catalog_hash() {
+    TraceBuffer buffer;
+    MockTraceOutput output;
+    TraceDrain drain(&buffer, &output);
+    buffer.setEnabled(true);
+    buffer.setTime(500);
+    buffer.record<2>(TraceSite::PID_MIN_OUTPUT, 12.5f, 20.0f);
+
+    drain.update();
+
+    Frame frames[4];
+    TEST_ASSERT_EQUAL(2, decodeFrames(output, frames, 4));
+    TEST_ASSERT_EQUAL(static_cast<uint16_t>(TraceSite::TRACE_START), frames[0].site);
+    TEST_ASSERT_EQUAL(TRACE_CATALOG_HASH, frames[0].args[0]);
+    TEST_ASSERT_EQUAL(static_cast<uint16_t>(TraceSite::PID_MIN_OUTPUT), frames[1].site);
+    TEST_ASSERT_EQUAL(500, frames[1].timestamp);
+    TEST_ASSERT_EQUAL(2, frames[1].argCount);
+    TEST_ASSERT_EQUAL_FLOAT(12.5f, asFloat(frames[1].args[0]));
+}
+
+void test_drain_reports_dropped_records() {
+    TraceBuffer buffer;
+    MockTraceOutput output;
+    TraceDrain drain(&buffer, &output);
+    buffer.setEnabled(true);
+    drain.update();     // Session start
+    output.reset();
+
+    for (size_t i = 0; i < TRACE_RING_RECORDS + 5; i++) {
+        buffer.record<1>(TraceSite::PID_BOX_AT_TARGET, 1.0f);
+    }
+    output.setRoom(TRACE_DRAIN_MAX_BYTES);
+    drain.update();
+
+    Frame frames[16];
+    int count = decodeFrames(output, frames, 16);
+    TEST_ASSERT_TRUE(count > 0);
+    TEST_ASSERT_EQUAL(static_cast<uint16_t>(TraceSite::TRACE_OVERFLOW), frames[0].site);
+    TEST_ASSERT_EQUAL(5, frames[0].args[0]);
+}
+
+void test_drain_writes_whole_frames_within_tx_room() {
+    TraceBuffer buffer;
+    MockTraceOutput output;
+    TraceDrain drain(&buffer, &output);
+    buffer.setEnabled(true);
+    buffer.record<4>(TraceSite::PID_COOLING, 0.1f, 0.2f, 30.0f, 1.5f);
+
+    output.setRoom(TRACE_MAX_FRAME_BYTES - 1);
+    drain.update();
+    drain.update();   // START fits, the 4-argument frame never does
+    uint32_t writes = output.getWriteCount();
+    TEST_ASSERT_EQUAL(1, writes);
+
+    output.setRoom(TRACE_MAX_FRAME_BYTES);
+    drain.update();
+
+    Frame frames[4];
+    TEST_ASSERT_EQUAL(2, decodeFrames(output, frames, 4));
+    TEST_ASSERT_EQUAL(static_cast<uint16_t>(TraceSite::PID_COOLING), frames[1].site);
+    TEST_ASSERT_EQUAL_FLOAT(1.5f, asFloat(frames[1].args[3]));
+}
+
+void test_frames_never_contain_zero_inside() {
+    TraceBuffer buffer;
+    MockTraceOutput output;
+    TraceDrain drain(&buffer, &output);
+    buffer.setEnabled(true);
+    buffer.setTime(0);
+    buffer.record<2>(TraceSite::DRYER_STATE, DryerState::READY, DryerState::READY);  // All-zero args
+
+    drain.update();
+
+    Frame frames[4];
+    TEST_ASSERT_EQUAL(2, decodeFrames(output, frames, 4));
+    TEST_ASSERT_EQUAL(0, frames[1].args[0]);
+    TEST_ASSERT_EQUAL(0, frames[1].timestamp);
+}
+
+// ==================== Call Site Tests ====================
+
+void test_pid_phase_decisions_are_traced() {
+    traceBuffer().setEnabled(true);
+    PIDController pid;
+    pid.begin();
+    pid.setLimits(0.0, 100.0);
+    pid.setMaxAllowedTemp(80.0);
+
+    // Heater above its limit: HEATER LIMIT REACHED site
+    pid.compute(50.0, 40.0, 90.0, 0);
+    pid.compute(50.0, 40.0, 90.0, PID_UPDATE_INTERVAL);
+
+    bool sawHeaterLimit = false;
+    TraceRecord entry;
+    while (traceBuffer().pop(entry)) {
+        if (entry.site == static_cast<uint16_t>(TraceSite::PID_HEATER_LIMIT)) {
+            sawHeaterLimit = true;
+            TEST_ASSERT_EQUAL_FLOAT(90.0f, asFloat(entry.args[0]));
+        }
+    }
+    TEST_ASSERT_TRUE(sawHeaterLimit);
+}
+
+void test_trace_off_leaves_control_path_silent() {
+    PIDController pid;
+    pid.begin();
+    pid.setLimits(0.0, 100.0);
+    pid.setMaxAllowedTemp(80.0);
+
+    pid.compute(50.0, 40.0, 90.0, 0);
+    pid.compute(50.0, 40.0, 90.0, PID_UPDATE_INTERVAL);
+
+    TEST_ASSERT_EQUAL(0, traceBuffer().getQueued());
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // Buffer
+    RUN_TEST(test_disabled_buffer_records_nothing);
+    RUN_TEST(test_record_stores_raw_arguments_and_tick_time);
+    RUN_TEST(test_full_ring_drops_and_counts);
+
+    // Drain
+    RUN_TEST(test_drain_opens_session_with_catalog_hash);
+    RUN_TEST(test_drain_reports_dropped_records);
+    RUN_TEST(test_drain_writes_whole_frames_within_tx_room);
+    RUN_TEST(test_frames_never_contain_zero_inside);
+
+    // Call sites
+    RUN_TEST(test_pid_phase_decisions_are_traced);
+    RUN_TEST(test_trace_off_leaves_control_path_silent);
+
+    return UNITY_END();
+}
@@ -11,6 +11,9 @@
 #include "../mocks/MockButtonManager.h"
 #include "../mocks/MockSoundController.h"
 #include "../mocks/MockDryer.h"
+#include "../mocks/MockSensorManager.h"
+#include "../mocks/MockSleepControl.h"
+#include "../../src/control/PowerManager.h"
 
 // Test fixture
 UIController* uiController;
@@ -390,6 +393,23 @@ void test_menu_selection_adjust_timer() {
     TEST_ASSERT_EQUAL(3600, mockDryer->getLastAdjustRemainingTimeDelta());
 }
 
+void test_menu_selection_scale_tare_calls_dryer() {
+    uiController->begin();
+
+    mockMenu->fireSelectionCallback(MenuPath::SCALE_TARE, 0);
+
+    TEST_ASSERT_EQUAL(1, mockDryer->getTareScaleCallCount());
+}
+
+void test_menu_selection_scale_calibrate_passes_mass() {
+    uiController->begin();
+
+    mockMenu->fireSelectionCallback(MenuPath::SCALE_CALIBRATE, 750);
+
+    TEST_ASSERT_EQUAL(1, mockDryer->getCalibrateScaleCallCount());
+    TEST_ASSERT_EQUAL_FLOAT(750.0, mockDryer->getLastCalibrationMass());
+}
+
 void test_menu_selection_back_at_root_exits_menu() {
     uiController->begin();
 
@@ -570,6 +590,83 @@ void test_preset_selection_plays_confirm_sound() {
     TEST_ASSERT_GREATER_THAN(0, mockSound->getConfirmCount());
 }
 
+// ==================== Boot Splash Tests ====================
+
+void test_splash_holds_rendering_until_timeout() {
+    uiController->begin();
+    uiController->holdSplashUntil(1000 + SPLASH_DURATION_MS);
+    mockDisplay->resetCounts();
+
+    uiController->update(1000);
+    uiController->update(1000 + SPLASH_DURATION_MS - 1);
+    TEST_ASSERT_EQUAL(0, mockDisplay->getDisplayCallCount());
+    TEST_ASSERT_TRUE(uiController->isSplashActive());
+
+    uiController->update(1000 + SPLASH_DURATION_MS);
+    TEST_ASSERT_GREATER_THAN(0, mockDisplay->getDisplayCallCount());
+    TEST_ASSERT_FALSE(uiController->isSplashActive());
+}
+
+void test_splash_keeps_polling_buttons() {
+    uiController->begin();
+    uiController->holdSplashUntil(1000 + SPLASH_DURATION_MS);
+
+    uiController->update(1000);
+
+    TEST_ASSERT_GREATER_THAN(0, mockButtons->getUpdateCallCount());
+}
+
+void test_button_dismisses_splash() {
+    uiController->begin();
+    uiController->holdSplashUntil(1000 + SPLASH_DURATION_MS);
+    uiController->update(1000);
+    mockDisplay->resetCounts();
+
+    mockButtons->simulateButtonEvent(ButtonType::UP, ButtonEvent::SINGLE_CLICK);
+    uiController->update(1020);
+
+    TEST_ASSERT_FALSE(uiController->isSplashActive());
+    TEST_ASSERT_GREATER_THAN(0, mockDisplay->getDisplayCallCount());
+}
+
+// ==================== Power Management Tests ====================
+
+void test_button_press_wakes_power_manager() {
+    MockSensorManager sensors;
+    MockSleepControl sleep;
+    PowerManager power(mockDryer, &sensors, mockDisplay, &sleep);
+    UIController ui(mockDisplay, mockMenu, mockButtons, mockSound, mockDryer, &power);
+    ui.begin();
+    power.begin(0);
+
+    power.update(IDLE_SLEEP_AFTER_MS);
+    TEST_ASSERT_EQUAL(PowerMode::SLEEPING, power.getMode());
+
+    mockButtons->simulateButtonEvent(ButtonType::UP, ButtonEvent::SINGLE_CLICK);
+
+    TEST_ASSERT_EQUAL(PowerMode::ACTIVE, power.getMode());
+    TEST_ASSERT_EQUAL(DisplayPowerMode::NORMAL, mockDisplay->getPowerMode());
+}
+
+void test_no_rendering_while_sleeping() {
+    MockSensorManager sensors;
+    MockSleepControl sleep;
+    PowerManager power(mockDryer, &sensors, mockDisplay, &sleep);
+    UIController ui(mockDisplay, mockMenu, mockButtons, mockSound, mockDryer, &power);
+    ui.begin();
+    power.begin(0);
+    power.update(IDLE_SLEEP_AFTER_MS);
+
+    mockDisplay->resetCounts();
+    ui.update(IDLE_SLEEP_AFTER_MS);
+    TEST_ASSERT_EQUAL(0, mockDisplay->getDisplayCallCount());
+
+    // Pending frame is drawn once awake
+    power.notifyActivity(IDLE_SLEEP_AFTER_MS + 10);
+    ui.update(IDLE_SLEEP_AFTER_MS + 10);
+    TEST_ASSERT_GREATER_THAN(0, mockDisplay->getDisplayCallCount());
+}
+
 // ==================== Integration Tests ====================
 
 void test_full_start_dryer_flow() {
@@ -616,7 +713,7 @@ void test_full_preset_change_flow() {
 void test_stats_screen_cycling_complete_loop() {
     uiController->begin();
 
-    // Cycle through all 6 screens
+    // Cycle through all 7 screens
     auto screen0 = uiController->getCurrentStatsScreen();
 
     mockButtons->simulateButtonEvent(ButtonType::UP, ButtonEvent::SINGLE_CLICK);
@@ -635,6 +732,10 @@ void test_stats_screen_cycling_complete_loop() {
     mockButtons->simulateButtonEvent(ButtonType::UP, ButtonEvent::SINGLE_CLICK);
     auto screen5 = uiController->getCurrentStatsScreen();
 
+    mockButtons->simulateButtonEvent(ButtonType::UP, ButtonEvent::SINGLE_CLICK);
+    auto screen6 = uiController->getCurrentStatsScreen();
+    TEST_ASSERT_NOT_EQUAL((int)screen5, (int)screen6);
+
     // One more should wrap back to first
     mockButtons->simulateButtonEvent(ButtonType::UP, ButtonEvent::SINGLE_CLICK);
     auto screenWrapped = uiController->getCurrentStatsScreen();
@@ -642,6 +743,27 @@ void test_stats_screen_cycling_complete_loop() {
     TEST_ASSERT_EQUAL((int)screen0, (int)screenWrapped);
 }
 
+void test_humidity_analysis_screen_renders_derived_values() {
+    uiController->begin();
+
+    CurrentStats stats;
+    stats.absoluteHumidity = 16.6;
+    stats.dewPoint = 21.0;
+    stats.waterRemoved = 12.5;
+    stats.boxHumidity = 20.0;
+    mockDryer->setStats(stats);
+    mockDryer->triggerStatsUpdate();
+
+    // DOWN from the first screen wraps to the last (humidity analysis)
+    mockButtons->simulateButtonEvent(ButtonType::DOWN, ButtonEvent::SINGLE_CLICK);
+    mockDisplay->resetCounts();
+    uiController->update(1000);
+
+    TEST_ASSERT_EQUAL_STRING("AH: ", mockDisplay->getTextAtIndex(0).c_str());
+    TEST_ASSERT_EQUAL_STRING("16.6", mockDisplay->getTextAtIndex(1).c_str());
+    TEST_ASSERT_EQUAL_STRING("12.5", mockDisplay->getTextAtIndex(7).c_str());
+}
+
 void test_pause_resume_via_long_press() {
     uiController->begin();
 
@@ -703,6 +825,8 @@ int main(int argc, char **argv) {
     RUN_TEST(test_menu_selection_sound_on);
     RUN_TEST(test_menu_selection_sound_off);
     RUN_TEST(test_menu_selection_adjust_timer);
+    RUN_TEST(test_menu_selection_scale_tare_calls_dryer);
+    RUN_TEST(test_menu_selection_scale_calibrate_passes_mass);
     RUN_TEST(test_menu_selection_back_at_root_exits_menu);
 
     // Display updates
@@ -723,10 +847,20 @@ int main(int argc, char **argv) {
     RUN_TEST(test_start_selection_plays_start_sound);
     RUN_TEST(test_preset_selection_plays_confirm_sound);
 
+    // Boot splash
+    RUN_TEST(test_splash_holds_rendering_until_timeout);
+    RUN_TEST(test_splash_keeps_polling_buttons);
+    RUN_TEST(test_button_dismisses_splash);
+
+    // Power management
+    RUN_TEST(test_button_press_wakes_power_manager);
+    RUN_TEST(test_no_rendering_while_sleeping);
+
     // Integration
     RUN_TEST(test_full_start_dryer_flow);
     RUN_TEST(test_full_preset_change_flow);
     RUN_TEST(test_stats_screen_cycling_complete_loop);
+    RUN_TEST(test_humidity_analysis_screen_renders_derived_values);
     RUN_TEST(test_pause_resume_via_long_press);
 
     return UNITY_END();
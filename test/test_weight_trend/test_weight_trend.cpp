@@ -0,0 +1,102 @@
+#ifdef UNIT_TEST
+    #include <unity.h>
+#else
+    #include <unity.h>
+    #include <Arduino.h>
+#endif
+
+#include "../../src/sensors/WeightTrend.h"
+
+// Test fixture
+WeightTrend* trend;
+
+void setUp(void) {
+    trend = new WeightTrend();
+}
+
+void tearDown(void) {
+    delete trend;
+}
+
+// One sample per second for the given minutes, linear loss plus optional ±noise
+static void feed(uint32_t startSecond, uint32_t minutes, float startGrams, float lossPerHour, float noise = 0) {
+    for (uint32_t s = 0; s < minutes * 60; s++) {
+        uint32_t t = startSecond + s;
+        float jitter = (s % 2 == 0) ? noise : -noise;
+        trend->addSample(startGrams - lossPerHour * t / 3600.0f + jitter, t * 1000);
+    }
+}
+
+// ==================== Window Tests ====================
+
+void test_trend_starts_empty_and_not_ready() {
+    TEST_ASSERT_FALSE(trend->isReady());
+    TEST_ASSERT_EQUAL(0, trend->getPointCount());
+    TEST_ASSERT_EQUAL_FLOAT(0.0, trend->getLossRate());
+}
+
+void test_trend_averages_one_point_per_interval() {
+    feed(0, 5, 1000.0, 0.0);
+
+    // The fifth minute is still open
+    TEST_ASSERT_EQUAL(4, trend->getPointCount());
+}
+
+void test_trend_ready_once_window_is_full() {
+    feed(0, WEIGHT_TREND_POINTS, 1000.0, 0.0);
+    TEST_ASSERT_FALSE(trend->isReady());
+
+    feed(WEIGHT_TREND_POINTS * 60, 1, 1000.0, 0.0);
+    TEST_ASSERT_TRUE(trend->isReady());
+}
+
+// ==================== Rate Tests ====================
+
+void test_trend_fits_linear_mass_loss() {
+    feed(0, WEIGHT_TREND_POINTS + 2, 1000.0, 6.0);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.05, 6.0, trend->getLossRate());
+}
+
+void test_trend_rejects_sample_noise() {
+    // ±2 g of HX711/fan noise on a flat spool
+    feed(0, WEIGHT_TREND_POINTS + 2, 1000.0, 0.0, 2.0);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.1, 0.0, trend->getLossRate());
+}
+
+void test_trend_window_follows_latest_points() {
+    // Fast drying first, then flat for a full window
+    feed(0, 60, 1000.0, 10.0);
+    feed(3600, WEIGHT_TREND_POINTS + 1, 990.0, 0.0);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.1, 0.0, trend->getLossRate());
+}
+
+void test_trend_clear_restarts_window() {
+    feed(0, WEIGHT_TREND_POINTS + 2, 1000.0, 6.0);
+    trend->clear();
+
+    TEST_ASSERT_FALSE(trend->isReady());
+    TEST_ASSERT_EQUAL(0, trend->getPointCount());
+    TEST_ASSERT_EQUAL_FLOAT(0.0, trend->getLossRate());
+}
+
+// ==================== Main Test Runner ====================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // Window
+    RUN_TEST(test_trend_starts_empty_and_not_ready);
+    RUN_TEST(test_trend_averages_one_point_per_interval);
+    RUN_TEST(test_trend_ready_once_window_is_full);
+
+    // Rate
+    RUN_TEST(test_trend_fits_linear_mass_loss);
+    RUN_TEST(test_trend_rejects_sample_noise);
+    RUN_TEST(test_trend_window_follows_latest_points);
+    RUN_TEST(test_trend_clear_restarts_window);
+
+    return UNITY_END();
+}
@@ -0,0 +1,247 @@
+# Decoder for the firmware's binary trace frames (src/diagnostics/Trace.h)
+# Reads the raw serial stream, rebuilds the text of each TRACE() site from
+# src/diagnostics/TraceSites.h and passes ordinary serial text through.
+#
+# run command:
+#   $ python tools/trace_decode.py --port /dev/ttyACM0       (needs pyserial)
+#   $ python tools/trace_decode.py capture.bin
+# then send `trace on` to the dryer.
+
+import argparse
+import re
+import struct
+import sys
+from pathlib import Path
+
+# ANSI color codes
+COLOR_RESET = "\033[0m"
+COLOR_CYAN = "\033[96m"
+COLOR_YELLOW = "\033[93m"
+COLOR_RED = "\033[91m"
+
+FRAME_MAGIC = 0xA7
+MAX_FRAME_BODY = 64          # Anything longer without a 0x00 is text
+
+SITE_PATTERN = re.compile(r'X\(\s*(\w+)\s*,\s*"([^"]*)"\s*\)')
+ENUM_PATTERN = re.compile(r"enum\s+class\s+(\w+)\s*(?::\s*\w+\s*)?\{([^}]*)\}")
+CONVERSION_PATTERN = re.compile(r"%%|%[-+ #0]*\d*(?:\.\d+)?([diuxXfeEgG])|\{(\w+)\}")
+
+
+def fnv1a(data: bytes, value: int) -> int:
+    for byte in data:
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def load_catalog(root: Path):
+    """
+    Return ([(name, format), ...] in site-ID order, catalog hash) as the
+    firmware computes it (FNV-1a over each name then format).
+    """
+    text = (root / "src" / "diagnostics" / "TraceSites.h").read_text(encoding="utf-8")
+    start = text.find("#define TRACE_SITES(X)")
+    sites = SITE_PATTERN.findall(text[start:]) if start >= 0 else []
+    value = 2166136261
+    for name, fmt in sites:
+        value = fnv1a(fmt.encode("utf-8"), fnv1a(name.encode("utf-8"), value))
+    return sites, value
+
+
+def load_enums(root: Path):
+    """
+    Return {EnumName: {value: enumerator}} for the enum classes in Types.h
+    """
+    text = (root / "src" / "Types.h").read_text(encoding="utf-8")
+    text = re.sub(r"//[^\n]*", "", text)
+    enums = {}
+    for name, body in ENUM_PATTERN.findall(text):
+        values = {}
+        next_value = 0
+        for item in body.split(","):
+            item = item.strip()
+            if not item:
+                continue
+            if "=" in item:
+                item, raw = (part.strip() for part in item.split("=", 1))
+                next_value = int(raw, 0)
+            values[next_value] = item
+            next_value += 1
+        enums[name] = values
+    return enums
+
+
+def crc8(data: bytes) -> int:
+    crc = 0
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def cobs_decode(body: bytes):
+    out = bytearray()
+    pos = 0
+    while pos < len(body):
+        code = body[pos]
+        if code == 0 or pos + code > len(body) + 1:
+            return None
+        out += body[pos + 1:pos + code]
+        pos += code
+        if code < 0xFF and pos < len(body):
+            out.append(0)
+    return bytes(out)
+
+
+def parse_frame(body: bytes):
+    """
+    Return (site, timestamp, [args]) or None if body is not a valid frame
+    """
+    payload = cobs_decode(body)
+    if payload is None or len(payload) < 8 or (len(payload) - 8) % 4:
+        return None
+    if payload[0] != FRAME_MAGIC or crc8(payload[:-1]) != payload[-1]:
+        return None
+    site, timestamp = struct.unpack_from("<HI", payload, 1)
+    count = (len(payload) - 8) // 4
+    args = list(struct.unpack_from(f"<{count}I", payload, 7))
+    return site, timestamp, args
+
+
+def format_site(fmt: str, args, enums) -> str:
+    remaining = iter(args)
+
+    def substitute(match):
+        if match.group(0) == "%%":
+            return "%"
+        raw = next(remaining, 0)
+        conversion, enum_name = match.group(1), match.group(2)
+        if enum_name:
+            return enums.get(enum_name, {}).get(raw, f"{enum_name}({raw})")
+        if conversion in "fFeEgG":
+            return match.group(0) % struct.unpack("<f", struct.pack("<I", raw))[0]
+        if conversion in "di":
+            return match.group(0) % struct.unpack("<i", struct.pack("<I", raw))[0]
+        return match.group(0) % raw
+
+    return CONVERSION_PATTERN.sub(substitute, fmt)
+
+
+class Decoder:
+    """
+    Splits the stream on 0x00: after an opening 0x00 comes a frame body,
+    after its closing 0x00 comes text. A body that does not decode is
+    shown as text and its terminating 0x00 treated as a new opening, so
+    the decoder resynchronizes after lost bytes.
+    """
+
+    def __init__(self, sites, catalog_hash, enums, out):
+        self.sites = sites
+        self.catalog_hash = catalog_hash
+        self.enums = enums
+        self.out = out
+        self.pending = bytearray()
+        self.in_frame = False
+
+    def emit_text(self, data: bytes):
+        if data:
+            self.out.write(data.decode("utf-8", errors="replace"))
+            self.out.flush()
+
+    def emit_frame(self, site, timestamp, args):
+        if site >= len(self.sites):
+            line = f"<unknown trace site {site}> {args}"
+        else:
+            name, fmt = self.sites[site]
+            line = format_site(fmt, args, self.enums)
+            if name == "TRACE_START" and args and args[0] != self.catalog_hash:
+                line += f" {COLOR_RED}catalog mismatch: decoder has {self.catalog_hash:08x}{COLOR_RESET}"
+        self.out.write(f"{COLOR_CYAN}[{timestamp / 1000.0:10.3f}]{COLOR_RESET} {line}\n")
+        self.out.flush()
+
+    def feed(self, data: bytes):
+        self.pending += data
+        while True:
+            zero = self.pending.find(0)
+            if zero < 0:
+                if self.in_frame and len(self.pending) > MAX_FRAME_BODY:
+                    self.in_frame = False
+                if not self.in_frame:
+                    # Text: pass complete lines through right away
+                    newline = self.pending.rfind(b"\n")
+                    if newline >= 0:
+                        self.emit_text(bytes(self.pending[:newline + 1]))
+                        del self.pending[:newline + 1]
+                return
+
+            segment = bytes(self.pending[:zero])
+            del self.pending[:zero + 1]
+
+            if self.in_frame:
+                frame = parse_frame(segment) if segment else None
+                if frame:
+                    self.emit_frame(*frame)
+                    self.in_frame = False
+                else:
+                    self.emit_text(segment)      # Stay in frame state: this 0x00 opens the next
+            else:
+                self.emit_text(segment)
+                self.in_frame = True
+
+    def finish(self):
+        if not self.in_frame:
+            self.emit_text(bytes(self.pending))
+        self.pending.clear()
+
+
+def open_input(args):
+    if args.port:
+        try:
+            import serial
+        except ImportError:
+            print(f"{COLOR_RED}Error: --port needs pyserial (pip install pyserial){COLOR_RESET}")
+            sys.exit(1)
+        port = serial.Serial(args.port, args.baud, timeout=0.1)
+        return lambda: port.read(256), True
+    if args.input == "-":
+        stream = sys.stdin.buffer
+    else:
+        try:
+            stream = open(args.input, "rb")
+        except FileNotFoundError:
+            print(f"{COLOR_RED}Error: Input file not found: {args.input}{COLOR_RESET}")
+            sys.exit(1)
+    return lambda: stream.read(4096), False
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode binary trace frames from the dryer's serial output")
+    parser.add_argument("input", nargs="?", default="-", help="capture file, or - for stdin (default)")
+    parser.add_argument("--port", help="read a serial port instead (needs pyserial)")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--root", type=Path, default=Path(__file__).resolve().parent.parent,
+                        help="firmware tree the catalog is read from (default: this checkout)")
+    args = parser.parse_args()
+
+    sites, catalog_hash = load_catalog(args.root)
+    if not sites:
+        print(f"{COLOR_YELLOW}No trace sites found under {args.root}{COLOR_RESET}")
+        sys.exit(1)
+
+    decoder = Decoder(sites, catalog_hash, load_enums(args.root), sys.stdout)
+    read, live = open_input(args)
+
+    try:
+        while True:
+            chunk = read()
+            if chunk:
+                decoder.feed(chunk)
+            elif not live:
+                break
+    except KeyboardInterrupt:
+        pass
+    decoder.finish()
+
+
+if __name__ == "__main__":
+    main()